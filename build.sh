@@ -269,7 +269,7 @@ echo "Build complete."
 
 # copy libraries to the usual locations
 umask "${UMASK}"
-echo "Installing/updating shared libraries ..."
+echo "Installing/updating shared libraries and executables ..."
 for x in "${PROJECTS[@]}" ; do
    mkdir -p "${SourceDir}/${x}/lib"
    rsync -rti --delete --omit-dir-times \
@@ -277,6 +277,12 @@ for x in "${PROJECTS[@]}" ; do
       --include="*.pcm" \
       --exclude="*" \
       "${x}/dict/" "${x}/lib/" "${SourceDir}/${x}/lib/${ARCH_TYPE}/"
+   # executables (eg. the job driver aplusplus-run)
+   if [[ -d ${x}/bin ]] ; then
+      mkdir -p "${SourceDir}/${x}/bin"
+      rsync -rti --delete --omit-dir-times \
+         "${x}/bin/" "${SourceDir}/${x}/bin/${ARCH_TYPE}/"
+   fi
 done
 echo "Installation finished."
 
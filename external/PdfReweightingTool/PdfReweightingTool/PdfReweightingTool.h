@@ -12,6 +12,7 @@
 #ifndef PdfSet_h
 #include "PdfReweightingTool/PdfSet.h"
 #endif
+#include <vector>
 
 class TH1F;
 
@@ -26,6 +27,8 @@ class PdfReweightingTool : public TObject {
   TList   *fVarDown;           // List of histograms (central-value - error-down)
   Int_t    fDSID;              // DSID corresponding to the current normalization scale factor
   TString *fMCtag;             // MC tag corresponding to the current normalization scale factor
+  std::vector<double> fPdfWeights;      //! Weights of all members of all sets (in order of fListOfPdfSets)
+  std::vector<int>    fPdfWeightOffset; //! Offset of each set in fPdfWeights
 
  public:
   PdfReweightingTool(const char* name = "");
@@ -42,6 +45,8 @@ class PdfReweightingTool : public TObject {
   TList* GetListOfPdfSets() const { return fListOfPdfSets; }
   TList* GetVarUp() const { return fVarUp; }
   TList* GetVarDown() const { return fVarDown; }
+  const std::vector<double>& GetPdfWeights() const { return fPdfWeights; }
+  int GetPdfWeightOffset(int set) const { return fPdfWeightOffset.at(set); }
   TList* GetReweightedObservable( TH1F* hist_obs, const char* pdf_set);
   void   GetNormfactor(Int_t DSID);
   void   SetApplyNormfactor(Bool_t set);
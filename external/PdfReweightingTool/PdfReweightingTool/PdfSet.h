@@ -16,6 +16,8 @@
 #include <TString.h>
 #endif
 #include <vector>
+#include <map>
+#include <utility>
 
 class TH1F;
 class TH1D;
@@ -36,10 +38,18 @@ class PdfSet : public TNamed {
   static const char* fgPdfNames[fgNumPdfSets]; // PDF sets names
 
  private:
+  typedef std::pair<int, std::pair<double, double> > PdfPoint; // (id, x, Q)
+
+  static const UInt_t fgMaxCacheSize = 10000; // Max. no. of memoised (id, x, Q) points
+  static LHAPDF::PDF *fgPdfCT10;     // Central CT10 pdf (shared read-only by all sets)
+  static Int_t        fgNPdfCT10;    // No. of sets using the shared CT10 pdf
+
   const int fNset;                   // Unique LHAPDF ID
   std::vector<LHAPDF::PDF*> fPdfSet; // Storage of pdf set (0=central, >0 error pdfs)
-  LHAPDF::PDF *fPdfCT10;             // Central CT10 pdf
   std::vector<double> *fPdfWeights;  // Storage of pdfweights (0=central, >0 error pdfs)
+  std::map<PdfPoint, std::vector<double> > fMemberCache; //! xf(id, x, Q) of all members for recent points
+  Long64_t fNCacheCalls;             //! No. of member evaluations requested
+  Long64_t fNCacheHits;              //! No. of member evaluations taken from the cache
 
   UInt_t   fNMember;                  // Number of members in pdf set
   TList   *fListOfObservables;        // List of TH2D histograms, one for each observable
@@ -52,6 +62,9 @@ class PdfSet : public TNamed {
   virtual ~PdfSet();
   Int_t GetPdfId() const { return fNset; }
   void ComputePdfWeights(double x1, double x2, double scale, int pid1, int pid2, double pdf1, double pdf2);
+  void ComputePdfWeightsRef(double x1, double x2, double scale, int pid1, int pid2, double ref);
+  static double ReferenceXfxQ(int pid, double x, double scale);
+  Double_t GetCacheHitRate() const;
   void AddObservable(TH1F* hist_obs);
   TList* GetListOfObservables() const { return fListOfObservables; }
   void FillObservable(TH1F* hist_obs, float observable, float evt_weight);
@@ -67,6 +80,9 @@ class PdfSet : public TNamed {
   inline void SetApplyNormfactor(Bool_t set)  { fApplyNormfactor = set; }
   TString GetDescription() const;
 
+ private:
+  const std::vector<double>& EvaluateMembers(int pid, double x, double scale);
+
   ClassDef(PdfSet,0);
 };
 
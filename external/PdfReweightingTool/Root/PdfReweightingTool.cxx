@@ -170,6 +170,8 @@ void PdfReweightingTool::Print(Option_t* opt) const {
     while ( (set = (PdfSet*) next_pdf()) ) {
       cout << ">>>>>> PDF description: Set " << set->GetPdfId() << " <<<<<<" << endl;
       cout << set->GetDescription() << endl;
+      cout << "Members: " << set->GetNMember()
+	   << ", cache hit rate: " << set->GetCacheHitRate() << endl;
       cout << ">>>>>>                        <<<<<<" << endl;
       cout << endl;
       cout << endl;
@@ -183,10 +185,23 @@ void PdfReweightingTool::ComputePdfWeights(double x1, double x2, double scale, i
   //
   // Compute new pdf weights for all PdfSets
   //
+  // The CT10 reference is evaluated once for all sets. Afterwards
+  // the weights of all members of all sets are available in one
+  // vector (see GetPdfWeights()), eg. to treat the pdf systematic as
+  // weight variations in a single pass.
+  //
+  double ref = PdfSet::ReferenceXfxQ(pid1, x1, scale)
+    * PdfSet::ReferenceXfxQ(pid2, x2, scale);
+
+  fPdfWeights.clear();
+  fPdfWeightOffset.clear();
   TIter next_pdf(fListOfPdfSets);
   PdfSet* set;
   while ( (set = (PdfSet*) next_pdf()) ) {
-    set->ComputePdfWeights(x1, x2, scale, pid1, pid2, pdf1, pdf2);
+    set->ComputePdfWeightsRef(x1, x2, scale, pid1, pid2, ref);
+    fPdfWeightOffset.push_back(fPdfWeights.size());
+    fPdfWeights.insert(fPdfWeights.end(), set->GetPdfWeights()->begin(),
+		       set->GetPdfWeights()->end());
   }
 }
 
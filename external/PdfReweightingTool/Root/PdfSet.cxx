@@ -33,6 +33,9 @@ const char* PdfSet::fgPdfNames[PdfSet::fgNumPdfSets] = {"CT10nlo",
 							"MSTW2008nlo68cl",
 							"NNPDF23_nlo_as_0119"};
 
+LHAPDF::PDF* PdfSet::fgPdfCT10 = 0;
+Int_t        PdfSet::fgNPdfCT10 = 0;
+
 //__________________________________________________________________
 
 PdfSet::PdfSet(const char* pdfset, const char* path, int nset )
@@ -43,8 +46,12 @@ PdfSet::PdfSet(const char* pdfset, const char* path, int nset )
 
   // Init PdfSet
   LHAPDF::mkPDFs(pdfset, fPdfSet);
-  fPdfCT10 = LHAPDF::mkPDF(fgPdfNames[0], 0);
+  // The CT10 reference grid is loaded only once and shared by all sets
+  if ( fgPdfCT10 == 0 ) fgPdfCT10 = LHAPDF::mkPDF(fgPdfNames[0], 0);
+  fgNPdfCT10++;
   fPdfWeights        = new std::vector<double>;
+  fNCacheCalls       = 0;
+  fNCacheHits        = 0;
   fNMember           = fPdfSet.size();
   fListOfObservables = new TList;
 
@@ -61,7 +68,10 @@ PdfSet::~PdfSet() {
   for (unsigned int i = 0; i < fPdfSet.size(); ++i) {
     delete fPdfSet.at(i);
   }
-  delete fPdfCT10;
+  if ( --fgNPdfCT10 == 0 ) {
+    delete fgPdfCT10;
+    fgPdfCT10 = 0;
+  }
   delete fPdfWeights;
   fListOfObservables->Delete();
   delete fListOfObservables;
@@ -76,33 +86,87 @@ void PdfSet::ComputePdfWeights(double x1, double x2, double scale,
   // Compute new pdf weights for central value and all error pdf sets
   // 
   //
- 
-  // clear pdf weights from previous call
-  fPdfWeights->clear();
-
-  double pdf_weight=1.0;
 
   // reweight with CT10 as default (for all LO generators)
   // CT10 member 0
-  double ct10_w1 = fPdfCT10->xfxQ(pid1, x1, scale);
-  double ct10_w2 = fPdfCT10->xfxQ(pid2, x2, scale);
+  ComputePdfWeightsRef(x1, x2, scale, pid1, pid2,
+		       ReferenceXfxQ(pid1, x1, scale)*ReferenceXfxQ(pid2, x2, scale));
+}
 
-  for ( unsigned int i = 0; i < fNMember; i++ ) {
-    double nw1 = fPdfSet.at(i)->xfxQ(pid1, x1, scale);
-    double nw2 = fPdfSet.at(i)->xfxQ(pid2, x2, scale);
+//__________________________________________________________________
 
-    // Pdf Reweighting
-    // ---------------
+void PdfSet::ComputePdfWeightsRef(double x1, double x2, double scale,
+				  int pid1, int pid2, double ref) {
+  //
+  // Compute new pdf weights for central value and all error pdf sets
+  // for the given reference value ref = xf1*xf2 of the generator pdf.
+  //
+  // All members are evaluated at once for each parton. The results
+  // are memoised by (id, x, Q), such that repeated points (eg. both
+  // partons with same id and x, or events with identical pdf info)
+  // do not need any grid interpolation.
+  //
+
+  // Bound the cache. Both look-ups below must not clear it, since
+  // the first result is used by reference
+  if ( fMemberCache.size() + 2 > fgMaxCacheSize ) fMemberCache.clear();
+  const std::vector<double> &xf1 = EvaluateMembers(pid1, x1, scale);
+  const std::vector<double> &xf2 = EvaluateMembers(pid2, x2, scale);
 
-    // reweighted to NLO
-    pdf_weight = nw1*nw2/(ct10_w1*ct10_w2);
+  // Pdf Reweighting
+  // ---------------
+
+  // reweighted to NLO
+  fPdfWeights->resize(fNMember);
+  for ( unsigned int i = 0; i < fNMember; i++ ) {
+    double pdf_weight = xf1[i]*xf2[i]/ref;
     
     // Apply normalization scale factor
     if ( fApplyNormfactor ) {
-      pdf_weight = pdf_weight*fNormfactors.at(i);
+      pdf_weight = pdf_weight*fNormfactors[i];
     }
-    fPdfWeights->push_back(pdf_weight);
+    (*fPdfWeights)[i] = pdf_weight;
+  }
+}
+
+//__________________________________________________________________
+
+const std::vector<double>& PdfSet::EvaluateMembers(int pid, double x, double scale) {
+  //
+  // Return xf(pid, x, Q) for all members of the set. Values are
+  // taken from the cache if the point has been evaluated before
+  //
+  fNCacheCalls++;
+  PdfPoint key(pid, std::make_pair(x, scale));
+  std::map<PdfPoint, std::vector<double> >::iterator it = fMemberCache.find(key);
+  if ( it != fMemberCache.end() ) {
+    fNCacheHits++;
+    return it->second;
+  }
+  std::vector<double> &xf = fMemberCache[key];
+  xf.resize(fNMember);
+  for ( unsigned int i = 0; i < fNMember; i++ ) {
+    xf[i] = fPdfSet[i]->xfxQ(pid, x, scale);
   }
+  return xf;
+}
+
+//__________________________________________________________________
+
+double PdfSet::ReferenceXfxQ(int pid, double x, double scale) {
+  //
+  // Return xf(pid, x, Q) of the CT10 reference pdf (member 0)
+  //
+  return fgPdfCT10->xfxQ(pid, x, scale);
+}
+
+//__________________________________________________________________
+
+Double_t PdfSet::GetCacheHitRate() const {
+  //
+  // Fraction of member evaluations taken from the cache
+  //
+  return ( fNCacheCalls > 0 ) ? (Double_t)fNCacheHits/fNCacheCalls : 0.;
 }
 
 //__________________________________________________________________
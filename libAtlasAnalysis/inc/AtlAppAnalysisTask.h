@@ -39,11 +39,14 @@ protected:
     TList       *fListOfUserEnvs;          // List of user environment variables
     TList       *fListOfTools;             // List of tools used in the analysis
     Bool_t       fWriteEntryList;          // Switch for writing an entry list
+    Bool_t       fWriteEventIndex;         // Switch for writing an event index (see AtlEventIndex)
     Bool_t       fLoadEntryList;           // Switch for reading from entry list
     Bool_t       fUseAntiList;             // Switch for excluding events stored in an entry list
     Int_t       fNProcessNthEventsOnly;    // process only every Nth event (default=1 every event)
     Bool_t       fPrintEvent;              // Switch for printing every event
     Bool_t       fPrintObjectTable;        // Switch for printing Root's object table
+    Int_t        fEventProfilingNSlowest;  // No. of slowest events kept by the event profiler (0 = no profiling)
+    TString      fEventProfilingDumpFile;  // Output file for the slowest events (see AtlEventProfiler)
     Bool_t       fUseAppInput;             // Switch to show App output is used as input
     
     TString     *fGridUser;                // Grid user name
@@ -62,6 +65,8 @@ protected:
     Double_t     fEvtReaderMCWeightTotalEvents; // totalEventsWeighted for evt reader
     TString      fEvtReaderMCWeightPositionString;    // positions for multiple weights
     TString      fEvtReaderMCWeightTotalEventsString; // total events for multiple weights
+    TString      fJobDriver;               // Compiled job driver for batch jobs (empty = interpret analysis_run.C)
+    Bool_t       fCutsValidated;           //! Cuts have already been checked (see ValidateCuts())
 
 
 
@@ -78,6 +83,7 @@ public:
     virtual void ExecGridJob(Option_t *option);
     virtual void CreateRootScript(Option_t *option);
     virtual void CreateNAFBatchRootScript(Option_t *option);
+    virtual Bool_t CreateJobDescription(Option_t *option);
     virtual void CreateRunScript(Option_t *option = "");
     virtual void CreateNAFBatchRunScript();
     virtual void CreateGridRunScript();
@@ -88,6 +94,10 @@ public:
     void SetToolCut(const char* tool, const char* var, const char* val);
     AtlToolCut* FindToolCut(const char* tool, const char* var);
     AtlCut*     FindCut(const char* var);
+    void ValidateCuts();
+    static Bool_t ValidateCuts(const char* Selector, TList *Cuts,
+			       TList *Tools, TList *ToolCuts,
+			       Bool_t Verbose = kFALSE);
     void AddUserEnv(const char* env); // *MENU*
 
     void SetEvtReader(char const * readerClass, char const * readerArgs = 0);
@@ -109,6 +119,7 @@ public:
     inline TList* GetListOfSubselectionCuts() { return fListOfSubselectionCuts; }
     inline TList* GetListOfToolCuts() { return fListOfToolCuts; }
     inline Bool_t GetWriteEntryList() const { return fWriteEntryList; }
+    inline Bool_t GetWriteEventIndex() const { return fWriteEventIndex; }
     inline Bool_t GetLoadEntryList() const { return fLoadEntryList; }
     inline Bool_t GetUseAntiList() const { return fUseAntiList; }
     inline Bool_t GetPrintEvent() const { return fPrintEvent; }
@@ -128,6 +139,8 @@ public:
 
     inline void SetWriteEntryList(Bool_t WriteEntryList)
     { fWriteEntryList = WriteEntryList; } // *TOGGLE*
+    inline void SetWriteEventIndex(Bool_t WriteEventIndex)
+    { fWriteEventIndex = WriteEventIndex; } // *TOGGLE*
     inline void SetLoadEntryList(Bool_t LoadEntryList)
     { fLoadEntryList = LoadEntryList; } // *TOGGLE*
     inline void SetUseAntiList(Bool_t UseAntiList)
@@ -137,6 +150,13 @@ public:
     inline void SetPrintObjectTable(Bool_t PrintObjectTable)
     { fPrintObjectTable = PrintObjectTable; } // *TOGGLE*
     inline void SetNProcessNthEventsOnly(Int_t N) { fNProcessNthEventsOnly = N; }
+    inline void SetEventProfiling(Int_t NSlowest = 20, const char* DumpFile = "") {
+	//
+	// Per-event timing in the selector (see AtlEventProfiler)
+	//
+	fEventProfilingNSlowest = NSlowest;
+	fEventProfilingDumpFile = DumpFile;
+    }
     inline void SetXsection(Float_t xsec) { fXsection = xsec; }
 
     inline void SetGridUser(TString *GridUser)
@@ -164,11 +184,9 @@ public:
     inline void SetEvtReaderMCWeightTotalEventsString(TString tot) {
         fEvtReaderMCWeightTotalEventsString = tot;
     }
+    void SetJobDriver(const char* Driver = "$LIBSINGLETOP/bin/$ARCH_TYPE/aplusplus-run");
+    inline const char* GetJobDriver() const { return fJobDriver.Data(); }
 
-
-  private:
-    TDataMember* FindDataMember(TClass *cl, const char* DMName) const;
-    
     ClassDef(AtlAppAnalysisTask,0) // A++ analysis task
 };
 #endif
@@ -0,0 +1,101 @@
+#ifndef ATLAS_AtlCompactHist
+#define ATLAS_AtlCompactHist
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <unordered_map>
+#include <vector>
+
+class TH1;
+
+class AtlHistBinning : public TNamed {
+    //
+    // Binning of a 1d or 2d histogram, shared by all histograms of a
+    // tool with the same binning. The name is the signature of the
+    // binning (see GetSignature())
+    //
+  private:
+    Int_t    fNbinsX;  // No. of x bins
+    Double_t fXlow;    // Lower edge of the x axis
+    Double_t fXup;     // Upper edge of the x axis
+    Int_t    fNbinsY;  // No. of y bins (0 = 1d histogram)
+    Double_t fYlow;    // Lower edge of the y axis
+    Double_t fYup;     // Upper edge of the y axis
+    std::vector<Double_t> fYbins; // Variable y bin edges (empty = equidistant)
+
+  public:
+    AtlHistBinning(Int_t nbinsx, Double_t xlow, Double_t xup,
+		   Int_t nbinsy = 0, Double_t ylow = 0., Double_t yup = 0.,
+		   const Double_t *ybins = 0);
+    virtual ~AtlHistBinning() {;}
+    TH1* CreateHistogram(const char* name, const char* title) const;
+    static TString GetSignature(Int_t nbinsx, Double_t xlow, Double_t xup,
+				Int_t nbinsy = 0, Double_t ylow = 0.,
+				Double_t yup = 0., const Double_t *ybins = 0);
+
+    inline Bool_t Is2D() const { return fNbinsY > 0; }
+    inline Int_t GetNcells() const
+    { return (fNbinsX+2)*( fNbinsY > 0 ? fNbinsY+2 : 1 ); }
+    inline Int_t FindBinX(Double_t x) const {
+	//
+	// Bin number incl. under- and overflow (same as
+	// TAxis::FindFixBin())
+	//
+	if ( x < fXlow ) return 0;
+	if ( !(x < fXup) ) return fNbinsX+1;
+	return 1 + (Int_t)(fNbinsX*(x-fXlow)/(fXup-fXlow));
+    }
+    Int_t FindBinY(Double_t y) const;
+    inline Int_t FindBin(Double_t x) const { return FindBinX(x); }
+    inline Int_t FindBin(Double_t x, Double_t y) const
+    { return FindBinX(x) + (fNbinsX+2)*FindBinY(y); }
+    inline Bool_t IsInRange(Int_t bin) const {
+	Int_t ix = bin % (fNbinsX+2);
+	if ( ix == 0 || ix > fNbinsX ) return kFALSE;
+	if ( fNbinsY == 0 ) return kTRUE;
+	Int_t iy = bin / (fNbinsX+2);
+	return ( iy > 0 && iy <= fNbinsY );
+    }
+
+    ClassDef(AtlHistBinning,0) // Shared binning of compact histograms
+};
+
+class AtlCompactHist {
+    //
+    // Compact storage of the contents of a histogram
+    //
+  private:
+    const AtlHistBinning *fBinning; // Shared binning (not owned)
+    Bool_t   fFloat;                // Store contents in single precision
+    Double_t fEntries;              // No. of entries
+    Double_t fTsumw;                // Sum of weights
+    Double_t fTsumw2;               // Sum of squared weights
+    Double_t fTsumwx;               // Sum of weight*x
+    Double_t fTsumwx2;              // Sum of weight*x*x
+    Double_t fTsumwy;               // Sum of weight*y
+    Double_t fTsumwy2;              // Sum of weight*y*y
+    Double_t fTsumwxy;              // Sum of weight*x*y
+    std::vector<Float_t>  fContF;   // Contents (1d, single precision)
+    std::vector<Float_t>  fSumw2F;  // Sum of squared weights (1d, single precision, only if needed)
+    std::vector<Double_t> fContD;   // Contents (1d, double precision)
+    std::vector<Double_t> fSumw2D;  // Sum of squared weights (1d, double precision, only if needed)
+    std::unordered_map<Int_t, Double_t> fContS;  // Contents of the filled bins (2d)
+    std::unordered_map<Int_t, Double_t> fSumw2S; // Sum of squared weights of the filled bins (2d, only if needed)
+    Bool_t   fHasSumw2;             // Sum of squared weights are stored
+
+  public:
+    AtlCompactHist(const AtlHistBinning *binning, Bool_t Float = kFALSE);
+    virtual ~AtlCompactHist() {;}
+    void Fill(Double_t x, Double_t w);
+    void Fill(Double_t x, Double_t y, Double_t w);
+    void CopyTo(TH1 *h) const;
+    inline Double_t GetEntries() const { return fEntries; }
+    inline const AtlHistBinning* GetBinning() const { return fBinning; }
+
+  private:
+    void AddBin(Int_t bin, Double_t w);
+
+    ClassDef(AtlCompactHist,0) // Compact histogram storage
+};
+#endif
+
@@ -82,6 +82,7 @@ class AtlCutFlowTool : public AtlAnalysisTool {
   private:
     void OpenStreamers();
     void CloseStreamers();
+    static void DeclareCuts();
 
 
     ClassDef(AtlCutFlowTool,0) // Analysis cut-flow tool
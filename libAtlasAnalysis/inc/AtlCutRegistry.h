@@ -0,0 +1,87 @@
+#ifndef ATLAS_AtlCutRegistry
+#define ATLAS_AtlCutRegistry
+#ifndef ROOT_Rtypes
+#include <Rtypes.h>
+#endif
+#ifndef ROOT_TString
+#include <TString.h>
+#endif
+#include <map>
+#include <string>
+#include <vector>
+
+class TClass;
+
+class AtlCutRegistry {
+
+  public:
+    enum EType {
+	kBool,          // Bool_t
+	kInt,           // all integer types (see Spec::fDataType)
+	kFloat,         // Float_t, Float16_t
+	kDouble,        // Double_t, Double32_t
+	kEnum,          // enum (given by name of the constant)
+	kString,        // TString (assigned)
+	kStringAppend,  // TString* (appended)
+	kOther          // anything else (C++ expression, set via the interpreter)
+    };
+
+    struct Value {
+	EType       fType;
+	Long64_t    fInt;
+	Double_t    fReal;
+	std::string fStr;
+	Value() : fType(kOther), fInt(0), fReal(0.) {}
+    };
+    typedef void (*Setter_t)(void *obj, const Value &val);
+
+    struct Spec {
+	std::string fName;     // Name of the cut (data member)
+	EType       fType;     // Type of the cut
+	Int_t       fDataType; // Basic data type (ROOT's EDataType) of integer cuts
+	std::string fTypeName; // C++ type name
+	std::string fDefault;  // Default value (declared cuts only)
+	Long_t      fOffset;   // Offset of the data member in the object
+	Setter_t    fSetter;   // Setter (declared cuts only, 0 = use offset)
+    };
+
+    struct Entry {
+	Int_t       fTarget;   // 0 = selector, i = i-th analysis tool
+	std::string fMember;   // Name of the cut
+	Value       fValue;    // Parsed value
+	std::string fClass;    // Class of the target the spec has been resolved for
+	EType       fCutType;  // Type of the cut (resolved spec)
+	Int_t       fDataType; // Basic data type of integer cuts (resolved spec)
+	Long_t      fOffset;   // Offset of the data member (resolved spec, -1 = resolve in the job)
+	Entry() : fTarget(0), fCutType(kOther), fDataType(-1), fOffset(-1) {}
+    };
+
+  public:
+    static void Declare(const char* ClassName, const char* Name, EType type,
+			const char* Default = "", Setter_t setter = 0);
+    static Bool_t SetDefaults(void *obj, TClass *cl);
+    static const Spec* GetSpec(TClass *cl, const char* Name);
+    static Bool_t Parse(const Spec *spec, const char* Text, Value &val);
+    static Bool_t Validate(TClass *cl, const char* Name, const char* Text,
+			   TString &Message);
+    static Bool_t Apply(void *obj, TClass *cl, const char* Name, const Value &val);
+    static Bool_t Apply(void *obj, TClass *cl, const Entry &entry);
+    static Bool_t MakeEntry(TClass *cl, Int_t Target, const char* Name,
+			    const char* Text, Entry &entry);
+    static Bool_t WriteConfig(const char* File, const std::vector<Entry> &entries);
+    static Bool_t ReadConfig(const char* File, std::vector<Entry> &entries);
+    static const char* GetTypeName(EType type);
+
+  private:
+    static std::map<std::string, Spec>& Declared();
+    static std::map<std::string, Spec>& Specs();
+    static const Spec* FindDeclared(TClass *cl, const char* Name);
+    static Bool_t CheckCut(TClass *cl, const char* Name, const char* Text,
+			   TString &Message);
+    static Bool_t Store(char *addr, EType type, Int_t DataType,
+			const Value &val);
+
+    ClassDef(AtlCutRegistry,0) // Typed registry of the cuts of A++ selectors and tools
+};
+#endif
+
@@ -42,6 +42,7 @@ class AtlDataMCPlotterTask : public AtlTask {
     Bool_t   fDrawSignalOverlay;       // Flag for drawing the signal MC (assumed to be the least entry in the MC histogram stack) as overlay instead as part of the stack (default = false)
     Float_t  fScaleOverlay;            // Scale factor of the overlay histogram ( default = 1. )
     Bool_t   fDrawSignificance;        // Draw significance panel
+    Bool_t   fIncremental;             // Rebuild only plots with changed inputs (see HepDataMCPlotter::SetIncremental())
     
   public:
     AtlDataMCPlotterTask(const char* name, const char* title);
@@ -68,6 +69,7 @@ class AtlDataMCPlotterTask : public AtlTask {
     void SetDrawSignalOverlay(Bool_t status);
     void SetScaleOverlay(Float_t scale);
     inline void SetDrawSignificance(Bool_t b = kTRUE) { fDrawSignificance = b;}
+    inline void SetIncremental(Bool_t b = kTRUE) { fIncremental = b;}
     
     inline void AddFolders(TList *folders) {
       fListOfFolders->AddAll(folders);
@@ -0,0 +1,31 @@
+#ifndef ATLAS_AtlDeferredTaskFolder
+#define ATLAS_AtlDeferredTaskFolder
+#ifndef ROOT_TTask
+#include <TTask.h>
+#endif
+
+class TBrowser;
+class AtlTopLevelAnalysis;
+
+class AtlDeferredTaskFolder : public TTask {
+
+  private:
+    AtlTopLevelAnalysis *fTopLevel; // Top-level analysis creating the tasks (not owned)
+    Int_t  fJetbin;                 // Jet bin of the tasks
+    Int_t  fLepChannel;             // Lepton channel of the tasks
+    Int_t  fSystematic;             // Systematic of the tasks
+    Bool_t fIsBuilt;                // Tasks have been created
+
+  public:
+    AtlDeferredTaskFolder(const char* name, const char* title,
+			  AtlTopLevelAnalysis *TopLevel, Int_t Jetbin,
+			  Int_t LepChannel, Int_t Systematic);
+    virtual ~AtlDeferredTaskFolder();
+    void BuildTasks();
+    virtual void Exec(Option_t *option);
+    virtual void Browse(TBrowser *b);
+    inline Bool_t IsBuilt() const { return fIsBuilt; }
+
+    ClassDef(AtlDeferredTaskFolder,0) // Folder of analysis tasks created on demand
+};
+#endif
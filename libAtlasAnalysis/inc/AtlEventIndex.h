@@ -0,0 +1,58 @@
+#ifndef ATLAS_AtlEventIndex
+#define ATLAS_AtlEventIndex
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <vector>
+#include <string>
+
+class TEntryList;
+class TFile;
+
+class AtlEventIndex : public TNamed {
+
+  private:
+    std::vector<std::string> fFileNames;   // Input file names
+    std::vector<Long64_t>    fFileEntries; // Total no. of tree entries per input file
+    std::vector<Int_t>       fFileRanges;  // Index of the first entry range of each file (size = no. of files + 1)
+    std::vector<Long64_t>    fRangeFirst;  // First local entry of each range (inclusive, sorted per file)
+    std::vector<Long64_t>    fRangeLast;   // Last local entry of each range (inclusive)
+    std::vector<UInt_t>      fRunNr;       // Run number of each stored entry (in entry order)
+    std::vector<ULong64_t>   fEventNr;     // Event number of each stored entry (in entry order)
+    Int_t                    fCurrentFile; //! File index used while filling/searching
+
+  public:
+    AtlEventIndex();
+    AtlEventIndex(const char* name, const char* title);
+    virtual ~AtlEventIndex();
+    void BeginFile(const char* FileName, Long64_t NEntries);
+    void Enter(Long64_t entry, UInt_t RunNr, ULong64_t EventNr);
+    void Add(const AtlEventIndex *list);
+    Bool_t Contains(const char* FileName, Long64_t entry);
+    Bool_t Contains(Long64_t entry) const;
+    Int_t  FindFile(const char* FileName) const;
+    Bool_t SetCurrentFile(const char* FileName);
+    Long64_t GetFirstEntry(Int_t file) const;
+    Long64_t GetLastEntry(Int_t file) const;
+    TEntryList* MakeEntryList(const char* TreeName) const;
+    virtual void Clear(Option_t *option = "");
+    virtual void Print(Option_t *option = "") const;
+
+    static AtlEventIndex* Read(TFile *file, const char* name = "app_eventindex");
+
+    inline Long64_t GetN() const { return fRunNr.size(); }
+    inline Int_t GetNFiles() const { return fFileNames.size(); }
+    inline Int_t GetNRanges() const { return fRangeFirst.size(); }
+    inline Int_t GetCurrentFile() const { return fCurrentFile; }
+    inline const char* GetFileName(Int_t file) const {
+	return fFileNames[file].c_str();
+    }
+    inline Long64_t GetFileEntries(Int_t file) const {
+	return fFileEntries[file];
+    }
+    inline UInt_t GetRunNr(Long64_t i) const { return fRunNr[i]; }
+    inline ULong64_t GetEventNr(Long64_t i) const { return fEventNr[i]; }
+
+    ClassDef(AtlEventIndex,1) // Compact per-file entry ranges of selected events
+};
+#endif
@@ -0,0 +1,81 @@
+#ifndef ATLAS_AtlEventProfiler
+#define ATLAS_AtlEventProfiler
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <vector>
+#include <string>
+
+class TDirectory;
+class TH1F;
+class TTree;
+
+class AtlEventProfiler : public TNamed {
+
+  public:
+    enum EStage {
+	kRead = 0,     // Clear + GetEntry
+	kSystematics,  // Systematics tools
+	kObjects,      // Bookkeeping + object definition tools
+	kScaleFactors, // Scale-factor tools
+	kPreAnalysis,  // Pre-analysis tools + ProcessPreCut()
+	kMainAnalysis, // InitEvent() + main-analysis tools
+	kSelection,    // ProcessCut() + ProcessFill()
+	kPostAnalysis, // Post-analysis tools
+	kNStages
+    };
+
+  private:
+    Int_t    fNSlowest;     // Max. no. of slowest events kept
+    TString  fDumpFile;     // Output file for the slowest events (none if empty)
+    TString  fTreeName;     // Name of the input tree
+    Long64_t fNEvents;      // No. of profiled events
+    Double_t fSumTime[kNStages+1]; // Total time (s) spent per stage (last = all stages)
+    Double_t fMaxTime[kNStages+1]; // Max. time (s) of a single event per stage (last = all stages)
+    std::vector<Double_t>    fSlowTotal;   // Total processing time (s) of the slowest events (descending)
+    std::vector<UInt_t>      fSlowRunNr;   // Run number of the slowest events
+    std::vector<ULong64_t>   fSlowEventNr; // Event number of the slowest events
+    std::vector<Long64_t>    fSlowEntry;   // Local tree entry of the slowest events
+    std::vector<std::string> fSlowFile;    // Input file of the slowest events
+    std::vector<Double_t>    fSlowStages;  // Stage breakdown (s) of the slowest events, kNStages per event
+    Double_t fT0;                   //! Start time of the current event
+    Double_t fTLast;                //! Time of the last stage mark
+    Double_t fStageTime[kNStages];  //! Stage times of the current event
+    TH1F    *fHistTime[kNStages+1]; //! Processing time histograms (last = all stages)
+
+  public:
+    AtlEventProfiler(const char* name = "app_eventprofile",
+		     const char* title = "A++ per-event processing time",
+		     Int_t NSlowest = 20);
+    virtual ~AtlEventProfiler();
+    void BookHistograms(TDirectory *dir);
+    void BeginEvent();
+    void Mark(EStage stage);
+    void EndEvent(UInt_t RunNr, ULong64_t EventNr, Long64_t Entry,
+		  TTree *CurrentTree);
+    Int_t DumpSlowEvents(const char* DumpFile = 0);
+    virtual void Clear(Option_t *option = "");
+    virtual void Print(Option_t *option = "") const;
+    static const char* GetStageName(Int_t stage);
+
+    inline void SetNSlowest(Int_t NSlowest) { fNSlowest = NSlowest; }
+    inline void SetDumpFile(const char* DumpFile) { fDumpFile = DumpFile; }
+    inline const char* GetDumpFile() const { return fDumpFile.Data(); }
+    inline Long64_t GetNEvents() const { return fNEvents; }
+    inline Double_t GetSumTime(Int_t stage = kNStages) const { return fSumTime[stage]; }
+    inline Int_t GetNSlow() const { return fSlowTotal.size(); }
+    inline Double_t GetSlowTime(Int_t i) const { return fSlowTotal[i]; }
+    inline Double_t GetSlowTime(Int_t i, EStage stage) const
+	    { return fSlowStages[i*kNStages + stage]; }
+    inline UInt_t GetSlowRunNr(Int_t i) const { return fSlowRunNr[i]; }
+    inline ULong64_t GetSlowEventNr(Int_t i) const { return fSlowEventNr[i]; }
+    inline Long64_t GetSlowEntry(Int_t i) const { return fSlowEntry[i]; }
+    inline const char* GetSlowFile(Int_t i) const { return fSlowFile[i].c_str(); }
+
+  private:
+    static Double_t Now();
+
+    ClassDef(AtlEventProfiler,1) // Per-event processing time profile of the A++ event loop
+};
+#endif
+
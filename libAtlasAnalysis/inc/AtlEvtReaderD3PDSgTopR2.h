@@ -431,6 +431,7 @@ class AtlEvtReaderD3PDSgTopR2 : public AtlEvtReaderD3PDBase {
     TString   fForwardJVTSFVariationName;
     TString   fGlobalLeptonTriggerSFVariationName;
     TString   fTreeName;
+    TString   fSystematicName; // Systematic variation processed by this reader
     
     TTree    *fTruthTree;   // MC truth tree
 
@@ -450,6 +451,7 @@ class AtlEvtReaderD3PDSgTopR2 : public AtlEvtReaderD3PDBase {
     InitialSumOfWeights_t GetInitialSumOfWeights(TFile * inputFile) const override;
     virtual void Print(Option_t *option = "") const override;
     char const * GetTreeName() const { return fTreeName.Data(); }
+    char const * GetSystematicName() const { return fSystematicName.Data(); }
     inline void SetTreeName(char const * treename) { fTreeName = TString(treename); }
     virtual Bool_t Notify() override;
 
@@ -0,0 +1,105 @@
+#ifndef ATLAS_AtlEvtReaderFlat
+#define ATLAS_AtlEvtReaderFlat
+#ifndef ATLAS_AtlEvtReaderD3PDBase
+#include <AtlEvtReaderD3PDBase.h>
+#endif
+#ifndef ATLAS_AtlEvtWriterFlat
+#include <AtlEvtWriterFlat.h>
+#endif
+
+class AtlEvtReaderFlat : public AtlEvtReaderD3PDBase {
+
+  private:
+    static const Int_t fgMaxLeptons = AtlEvtWriterFlat::fgMaxLeptons;
+    static const Int_t fgMaxJets    = AtlEvtWriterFlat::fgMaxJets;
+
+    AtlBTag::ETagger fBTagger; // B-tagger assigned to the b-tag weights of the jets
+    AtlJet::EType    fJetType; // Type of the jets created
+    Bool_t fAllowTruncated;    // Accept events with more objects than stored ?
+    Bool_t fWarnTruncated;     // Warn (once) about events with more objects than stored
+
+    // =========================
+    // Declaration of leaf types
+    // =========================
+    UInt_t    v_run_nr;
+    ULong64_t v_evt_nr;
+    UInt_t    v_channel_nr;
+    Bool_t    v_is_mc;
+    Float_t   v_evt_weight;
+    Float_t   v_mc_weight;
+    Float_t   v_pileup_weight;
+    Float_t   v_met_et;
+    Float_t   v_met_phi;
+    Int_t     v_el_n;
+    Float_t   v_el_e[fgMaxLeptons];
+    Float_t   v_el_pt[fgMaxLeptons];
+    Float_t   v_el_eta[fgMaxLeptons];
+    Float_t   v_el_phi[fgMaxLeptons];
+    Int_t     v_el_chg[fgMaxLeptons];
+    Int_t     v_mu_n;
+    Float_t   v_mu_e[fgMaxLeptons];
+    Float_t   v_mu_pt[fgMaxLeptons];
+    Float_t   v_mu_eta[fgMaxLeptons];
+    Float_t   v_mu_phi[fgMaxLeptons];
+    Int_t     v_mu_chg[fgMaxLeptons];
+    Int_t     v_jet_n;
+    Float_t   v_jet_e[fgMaxJets];
+    Float_t   v_jet_pt[fgMaxJets];
+    Float_t   v_jet_eta[fgMaxJets];
+    Float_t   v_jet_phi[fgMaxJets];
+    Bool_t    v_jet_btagged[fgMaxJets];
+    Float_t   v_jet_btagw[fgMaxJets];
+    Int_t     v_jet_flav[fgMaxJets];
+
+    // List of branches
+    TBranch *b_run_nr;        //!
+    TBranch *b_evt_nr;        //!
+    TBranch *b_channel_nr;    //!
+    TBranch *b_is_mc;         //!
+    TBranch *b_evt_weight;    //!
+    TBranch *b_mc_weight;     //!
+    TBranch *b_pileup_weight; //!
+    TBranch *b_met_et;        //!
+    TBranch *b_met_phi;       //!
+    TBranch *b_el_n;          //!
+    TBranch *b_el_e;          //!
+    TBranch *b_el_pt;         //!
+    TBranch *b_el_eta;        //!
+    TBranch *b_el_phi;        //!
+    TBranch *b_el_chg;        //!
+    TBranch *b_mu_n;          //!
+    TBranch *b_mu_e;          //!
+    TBranch *b_mu_pt;         //!
+    TBranch *b_mu_eta;        //!
+    TBranch *b_mu_phi;        //!
+    TBranch *b_mu_chg;        //!
+    TBranch *b_jet_n;         //!
+    TBranch *b_jet_e;         //!
+    TBranch *b_jet_pt;        //!
+    TBranch *b_jet_eta;       //!
+    TBranch *b_jet_phi;       //!
+    TBranch *b_jet_btagged;   //!
+    TBranch *b_jet_btagw;     //!
+    TBranch *b_jet_flav;      //!
+
+  public:
+    explicit AtlEvtReaderFlat(AtlSelector *parent);
+    virtual ~AtlEvtReaderFlat();
+    void SetBranches(TTree *t) override;
+    inline void SetBTagger(AtlBTag::ETagger BTagger) { fBTagger = BTagger; }
+    inline void SetJetType(AtlJet::EType type) { fJetType = type; }
+    inline void SetAllowTruncated(Bool_t AllowTruncated = kTRUE)
+    { fAllowTruncated = AllowTruncated; }
+
+  protected:
+    void BuildEvent() override;
+    void BuildEventHeader() override;
+    void BuildEnergySum();
+    void BuildElectrons();
+    void BuildMuons();
+    void BuildJets();
+
+    ClassDefOverride(AtlEvtReaderFlat,0) // Event reader for flat columnar ntuples
+};
+#endif
+
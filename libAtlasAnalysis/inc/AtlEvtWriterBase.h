@@ -14,12 +14,15 @@
 #ifndef ROOT_TTree
 #include <TTree.h>
 #endif
+#include <Compression.h>
 
 class AtlEvtWriterBase : public TObject {
 
 protected:
-    TTree    *fTree;  // Output tree
-    AtlEvent *fEvent; // Event object
+    TTree    *fTree;                // Output tree
+    AtlEvent *fEvent;               // Event object
+    Int_t     fCompressionSettings; // Compression settings (100*algorithm + level) of the output tree (-1 = output file default)
+    Long64_t  fAutoFlush;           // Auto-flush setting of the output tree (>0: entries, <0: bytes, 0: Root default)
     
 public:
     AtlEvtWriterBase();
@@ -30,6 +33,18 @@ public:
 			      TTree *InputTree);
     virtual const char* GetNameOfType() { return ""; }
     virtual void Terminate() {;}
+    inline void SetCompression(ROOT::ECompressionAlgorithm algorithm, Int_t level) {
+	//
+	// Set compression algorithm (ROOT::kLZ4, ROOT::kLZMA, ...) and
+	// level (1-9) for the output tree
+	//
+	fCompressionSettings = ROOT::CompressionSettings(algorithm, level);
+    }
+    inline void SetCompressionSettings(Int_t settings) {
+	fCompressionSettings = settings;
+    }
+    inline void SetAutoFlush(Long64_t autof) { fAutoFlush = autof; }
+    void ApplyTreeSettings();
     
     ClassDef(AtlEvtWriterBase,0) // Abstract base class for writing events
 };
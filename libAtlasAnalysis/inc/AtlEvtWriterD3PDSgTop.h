@@ -1,4 +1,4 @@
-//  
+//
 // Author: Oliver Maria Kind <mailto: kind@mail.desy.de>
 // Update: $Id$
 // Copyright: 2013 (C) Oliver Maria Kind
@@ -8,6 +8,7 @@
 #ifndef ATLAS_AtlEvtWriterBase
 #include <AtlEvtWriterBase.h>
 #endif
+class TList;
 
 class AtlEvtWriterD3PDSgTop : public AtlEvtWriterBase {
 
@@ -15,7 +16,12 @@ private:
     Float_t fEventWeight; // Total event weight
 
 protected:
-    Bool_t  fCloneOnly;   // Don't add branches to output
+    Bool_t    fCloneOnly;       // Don't add branches to output
+    Bool_t    fFastSkim;        // Read the branches not used by the analysis for accepted events only (see SetFastSkim())
+    TTree    *fInputTree;       //! Input tree or chain
+    TList    *fLazyBranches;    // Names of the input branches not read by the analysis (fast skim)
+    Int_t     fLazyTreeNumber;  //! Number of the input tree the lazy branches are connected to
+    Long64_t  fNLazyEntries;    // No. of entries for which the lazy branches have been read
 
 public:
     AtlEvtWriterD3PDSgTop();
@@ -24,10 +30,15 @@ public:
     virtual void WriteEvent();
     virtual TTree* CreateTree(const char* name, const char* title,
 			      TTree *InputTree);
+    virtual void Terminate();
     virtual const char* GetNameOfType() /*override*/ { return "kD3PDSgTop"; }
     inline void SetCloneOnly(Bool_t co) { fCloneOnly = co; }
+    inline void SetFastSkim(Bool_t fs = kTRUE) { fFastSkim = fs; }
+    inline Bool_t IsFastSkim() const { return fFastSkim; }
+
+protected:
+    void ConnectLazyBranches(TTree *tree);
 
     ClassDef(AtlEvtWriterD3PDSgTop,0) // Event writer for SgTop-D3PD format
 };
 #endif
-
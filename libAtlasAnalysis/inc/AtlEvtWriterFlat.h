@@ -0,0 +1,88 @@
+#ifndef ATLAS_AtlEvtWriterFlat
+#define ATLAS_AtlEvtWriterFlat
+#ifndef ATLAS_AtlEvtWriterBase
+#include <AtlEvtWriterBase.h>
+#endif
+#ifndef ATLAS_AtlBTag
+#include <AtlBTag.h>
+#endif
+#ifndef ATLAS_AtlJet
+#include <AtlJet.h>
+#endif
+#ifndef ROOT_TString
+#include <TString.h>
+#endif
+#include <vector>
+
+class TList;
+
+class AtlEvtWriterFlat : public AtlEvtWriterBase {
+
+  public:
+    static const Int_t fgMaxLeptons = 4; // Max. no. of leading electrons/muons stored
+    static const Int_t fgMaxJets    = 6; // Max. no. of leading jets stored
+    static const Int_t fgBasketSize = 256000; // Basket size of all columns
+
+  private:
+    AtlBTag::ETagger fBTagger; // Type of b-tagger to be used for writing the b-tag weights for each jet
+    AtlJet::EType    fJetType; // Jet type used if no list of selected jets is given
+    TList  *fElectrons;        // List of selected electron objects (0 = all electrons of the event)
+    TList  *fMuons;            // List of selected muon objects (0 = all muons of the event)
+    TList  *fJets;             // List of selected jet objects (0 = all jets of type fJetType)
+    TList  *fBJets;            // List of selected b-jet objects
+    std::vector<TString>  fColumnNames;  //! Names of user columns
+    std::vector<Float_t*> fColumnValues; //! Addresses of user columns
+    Long64_t fNTruncated;        // No. of events with more objects than stored
+
+    UInt_t    fRunNr;                     // Run number
+    ULong64_t fEventNr;                   // Event number
+    UInt_t    fChannelNr;                 // MC channel number
+    Bool_t    fIsMC;                      // MC event ?
+    Float_t   fEventWeight;               // Total event weight
+    Float_t   fMCWeight;                  // MC generator weight
+    Float_t   fPileupWeight;              // Pile-up weight
+    Float_t   fMET_Et;                    // MET Et (GeV)
+    Float_t   fMET_Phi;                   // MET Phi (rad)
+    Int_t     fElectronN;                 // No. of electrons (all, not only the leading ones)
+    Float_t   fElectronE[fgMaxLeptons];   // Electron E (GeV)
+    Float_t   fElectronPt[fgMaxLeptons];  // Electron Pt (GeV)
+    Float_t   fElectronEta[fgMaxLeptons]; // Electron Eta
+    Float_t   fElectronPhi[fgMaxLeptons]; // Electron Phi (rad)
+    Int_t     fElectronChg[fgMaxLeptons]; // Electron charge (+1e/-1e)
+    Int_t     fMuonN;                     // No. of muons (all, not only the leading ones)
+    Float_t   fMuonE[fgMaxLeptons];       // Muon E (GeV)
+    Float_t   fMuonPt[fgMaxLeptons];      // Muon Pt (GeV)
+    Float_t   fMuonEta[fgMaxLeptons];     // Muon Eta
+    Float_t   fMuonPhi[fgMaxLeptons];     // Muon Phi (rad)
+    Int_t     fMuonChg[fgMaxLeptons];     // Muon charge (+1e/-1e)
+    Int_t     fJetN;                      // No. of jets (all, not only the leading ones)
+    Int_t     fBJetN;                     // No. of b-tagged jets
+    Float_t   fJetE[fgMaxJets];           // Jet E (GeV)
+    Float_t   fJetPt[fgMaxJets];          // Jet Pt (GeV)
+    Float_t   fJetEta[fgMaxJets];         // Jet Eta
+    Float_t   fJetPhi[fgMaxJets];         // Jet Phi (rad)
+    Float_t   fJetBTagWeight[fgMaxJets];  // B-tag weight (defined by SetBTagger())
+    Bool_t    fJetBTagged[fgMaxJets];     // Jet is b-tagged ?
+    Int_t     fJetFlav[fgMaxJets];        // Jet truth flavour (AtlJet::EFlavour)
+
+public:
+    AtlEvtWriterFlat();
+    virtual ~AtlEvtWriterFlat();
+    virtual void BookTree(TTree *tree, AtlEvent *evt);
+    virtual void WriteEvent();
+    virtual void Terminate();
+    virtual const char* GetNameOfType() { return "kFlatNtuple"; }
+    void AddColumn(const char* name, Float_t *value);
+    void SetElectrons(TList *electrons);
+    void SetMuons(TList *muons);
+    void SetJets(TList *jets, TList *bjets);
+    inline void SetBTagger(AtlBTag::ETagger BTagger) { fBTagger = BTagger; }
+    inline void SetJetType(AtlJet::EType type) { fJetType = type; }
+
+  private:
+    void BookColumn(const char* name, void *address, const char* leaflist);
+
+    ClassDef(AtlEvtWriterFlat,0) // Event writer for flat columnar ntuples
+};
+#endif
+
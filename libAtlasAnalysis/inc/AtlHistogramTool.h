@@ -8,6 +8,9 @@
 #ifndef ATLAS_AtlAnalysisTool
 #include <AtlAnalysisTool.h>
 #endif
+#ifndef ATLAS_AtlCompactHist
+#include <AtlCompactHist.h>
+#endif
 #ifndef ROOT_THashList
 #include <THashList.h>
 #endif
@@ -33,21 +36,52 @@ class AtlHistObject : public TNamed {
     // for fast access to the hash list. The histogram itself stores
     // only the (short) basename as identifier.
     //
+    // Besides the histogram the object keeps its definition (shared
+    // binning and axis titles), so that histograms registered via
+    // AtlHistogramTool::Define() can be booked lazily, ie. on their
+    // first fill, and their contents can be kept in a compact
+    // container until written.
+    //
   private:
-    TH1 *fHistogram; // Histogram
+    TH1            *fHistogram; // Histogram (0 = not yet booked)
+    AtlHistBinning *fBinning;   // Binning (owned by the tool)
+    AtlCompactHist *fContents;  // Compact contents (0 = none)
+    TString         fXTitle;    // Title of the x axis
+    TString         fYTitle;    // Title of the y axis
+    TString         fZTitle;    // Title of the z axis
     
   public:
     AtlHistObject(const char* name, const char* title, TH1 *hist) :
-    TNamed(name, title) { fHistogram = hist; }
-    virtual ~AtlHistObject() {;}
+    TNamed(name, title), fHistogram(hist), fBinning(0), fContents(0) {;}
+    AtlHistObject(const char* name, const char* title,
+		  AtlHistBinning *binning, const char* xtitle,
+		  const char* ytitle, const char* ztitle) :
+    TNamed(name, title), fHistogram(0), fBinning(binning), fContents(0),
+	fXTitle(xtitle), fYTitle(ytitle), fZTitle(ztitle) {;}
+    virtual ~AtlHistObject() { delete fContents; }
+    TH1* Book();
     inline TH1* GetHistogram() { return fHistogram; }
+    inline void SetHistogram(TH1 *hist) { fHistogram = hist; }
+    inline AtlCompactHist* GetContents(Bool_t Float) {
+	if ( fContents == 0 ) fContents = new AtlCompactHist(fBinning, Float);
+	return fContents;
+    }
+    inline Bool_t HasContents() const { return fContents != 0; }
+    inline void ClearContents() { delete fContents; fContents = 0; }
 };
 
 class AtlHistogramTool : public AtlAnalysisTool {
 
+  public:
+    Bool_t fSkipEmpty;   // Do not write histograms without entries (default = false)
+    Bool_t fCompact;     // Keep the contents of defined histograms in compact containers until written (default = false)
+    Bool_t fFloatContents; // Compact containers store 1d contents in single precision (default = false)
+
   private:
     TDirectory *fParentDir;  // Top-level folder
     THashList  *fHistograms; // List of histograms
+    THashList  *fBinnings;   // Binnings shared by the histograms
+    THashList  *fFolders;    // Paths of all (sub)folders of the histograms
     
   public:
     AtlHistogramTool(const char* name, const char* title);
@@ -67,11 +101,26 @@ class AtlHistogramTool : public AtlAnalysisTool {
 	      Int_t nbinsy, const Double_t *ybins,
 	      const char* xtitle, const char* ytitle,
 	      const char* ztitle);
+    void Define(const char* hname, const char* title,
+		Int_t nbinsx, Double_t xlow, Double_t xup,
+		const char* xtitle, const char* ytitle);
+    void Define(const char* hname, const char* title,
+		Int_t nbinsx, Double_t xlow, Double_t xup,
+		Int_t nbinsy, Double_t ylow, Double_t yup,
+		const char* xtitle, const char* ytitle,
+		const char* ztitle);
+    void Define(const char* hname, const char* title,
+		Int_t nbinsx, Double_t xlow, Double_t xup,
+		Int_t nbinsy, const Double_t *ybins,
+		const char* xtitle, const char* ytitle,
+		const char* ztitle);
     void Fill(const char* hname, Double_t x, Double_t w);
     void Fill(const char* hname, Double_t x, Double_t y, Double_t w);
+    TH1* GetHistogram(const char* hname);
     virtual void SetBranchStatus() {;}
     virtual void BookHistograms() {;}
     virtual void FillHistograms() {;}
+    virtual void Terminate();
     virtual void Print() const;
 
     inline void Fill(const char* path, const char* hname,
@@ -94,6 +143,12 @@ class AtlHistogramTool : public AtlAnalysisTool {
     }
 	
   private:
+    AtlHistObject* Register(const char* hname, const char* title,
+			    Int_t nbinsx, Double_t xlow, Double_t xup,
+			    Int_t nbinsy, Double_t ylow, Double_t yup,
+			    const Double_t *ybins, const char* xtitle,
+			    const char* ytitle, const char* ztitle);
+    TH1* Book(AtlHistObject *h_obj);
     TDirectory* MkDirWithParents(const char* dir);
     
     ClassDef(AtlHistogramTool,0) // Histogram tool
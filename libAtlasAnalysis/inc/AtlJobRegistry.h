@@ -0,0 +1,105 @@
+#ifndef ATLAS_AtlJobRegistry
+#define ATLAS_AtlJobRegistry
+#ifndef ROOT_Rtypes
+#include <Rtypes.h>
+#endif
+#ifndef ROOT_TString
+#include <TString.h>
+#endif
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+class AtlSelector;
+class AtlEvtReaderBase;
+class AtlAnalysisTool;
+class TClass;
+
+class AtlJobRegistry {
+
+  public:
+    typedef AtlSelector* (*SelectorFactory_t)(const char* OutputFile);
+    typedef AtlEvtReaderBase* (*ReaderFactory_t)(AtlSelector *parent,
+						  const std::vector<std::string> &args,
+						  TString &TreeName);
+    typedef AtlAnalysisTool* (*ToolFactory_t)(const char* name, const char* title);
+
+  public:
+    static void RegisterSelector(const char* ClassName, SelectorFactory_t factory);
+    static void RegisterReader(const char* ClassName, ReaderFactory_t factory);
+    static void RegisterTool(const char* ClassName, ToolFactory_t factory);
+    static void RegisterAtlasAnalysis();
+
+    static AtlSelector* CreateSelector(const char* ClassName, const char* OutputFile);
+    static AtlEvtReaderBase* CreateReader(const char* ClassName, AtlSelector *parent,
+					  const char* Args, TString &TreeName);
+    static AtlAnalysisTool* CreateTool(const char* ClassName, const char* name,
+				       const char* title);
+    static Bool_t SetMember(void *obj, TClass *cl, const char* MemberName,
+			    const char* Value);
+    static std::vector<std::string> SplitArgs(const char* Args);
+    static Int_t RunJob(const char* JobFile);
+
+    // Factories for the common constructor signatures
+    template <class T> static AtlSelector* NewSelector(const char* OutputFile) {
+	return new T(OutputFile);
+    }
+    template <class T> static AtlAnalysisTool* NewTool(const char* name, const char* title) {
+	return new T(name, title);
+    }
+    template <class T> static typename T::EDataType GetDataType(const std::string &arg) {
+	//
+	// Data type from its enum name (with or without class prefix)
+	//
+	TString s(arg.c_str());
+	if ( s.EndsWith("kRealData") ) return T::kRealData;
+	if ( s.EndsWith("kMC") ) return T::kMC;
+	return T::kUndefinedDataType;
+    }
+    template <class T> static AtlEvtReaderBase* NewD3PDReader(AtlSelector *parent,
+							      const std::vector<std::string> &args,
+							      TString &TreeName) {
+	//
+	// Readers with ctor (parent, type, version, syst, tree[, mcweight])
+	//
+	if ( args.size() < 5 ) return 0;
+	T *reader = new T(parent, GetDataType<T>(args[0]), args[1].c_str(),
+			  args[2].c_str(), args[3].c_str(),
+			  std::atoi(args[4].c_str()));
+	TreeName = reader->GetTreeName();
+	return reader;
+    }
+    template <class T> static AtlEvtReaderBase* NewD3PDReaderR2(AtlSelector *parent,
+								const std::vector<std::string> &args,
+								TString &TreeName) {
+	//
+	// As NewD3PDReader(), but also for the ctor taking the full
+	// tree name (parent, type, version, tree[, mcweight])
+	//
+	if ( args.size() < 3 ) return 0;
+	T *reader = 0;
+	if ( args.size() == 3
+	     || ( args.size() == 4 && TString(args[3].c_str()).IsDec() ) ) {
+	    reader = new T(parent, GetDataType<T>(args[0]), args[1].c_str(),
+			   args[2].c_str(),
+			   ( args.size() == 4 ) ? std::atoi(args[3].c_str()) : -1);
+	} else {
+	    reader = new T(parent, GetDataType<T>(args[0]), args[1].c_str(),
+			   args[2].c_str(), args[3].c_str(),
+			   ( args.size() > 4 ) ? std::atoi(args[4].c_str()) : -1);
+	}
+	TreeName = reader->GetTreeName();
+	return reader;
+    }
+
+  private:
+    static std::map<std::string, SelectorFactory_t>& Selectors();
+    static std::map<std::string, ReaderFactory_t>&   Readers();
+    static std::map<std::string, ToolFactory_t>&     Tools();
+    static std::vector<std::string>&                 Fallbacks();
+
+    ClassDef(AtlJobRegistry,0) // Compiled factories and job driver for A++ analysis jobs
+};
+#endif
+
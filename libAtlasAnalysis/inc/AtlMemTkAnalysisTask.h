@@ -23,6 +23,10 @@ private:
     Bool_t   fMemTkTreatAllJetsAsBJets;
     Bool_t   fGridAnalysisOnGrid;
     Bool_t   fGridUsePrecompiledMem;
+    Long64_t fFirstEntry;    // First input entry of this sub-job (cost-aware splitting)
+    Long64_t fNEntries;      // No. of input entries of this sub-job (-1 = split by MemTk)
+    TString  fInputTreeName; // Name of the MemTk input tree
+    TString  fTimingFile;    // File the integration time of the job is appended to
 
 public:
     AtlMemTkAnalysisTask(const char* name  = "MemTkAnalysisTask",
@@ -37,6 +41,7 @@ public:
     virtual void CreateGridRunScript();
     virtual void SubmitGridJob();
     void AddUserEnv(const char* env);
+    void SetEntryRange(Long64_t FirstEntry, Long64_t NEntries);
     virtual void Print(Option_t *option = "") const;
     virtual void SetMemTkRunScript(const char* script);
 //    inline void SetGridHomeSetupScript(const char* script){ fGridHomeSetupScript = script; }
@@ -50,6 +55,14 @@ public:
     inline void SetGridAnalysisOnGrid(Bool_t ongrid = kTRUE) {
       fGridAnalysisOnGrid = ongrid;
     }
+    inline void SetInputTreeName(const char* name) { fInputTreeName = name; }
+    inline void SetTimingFile(const char* file) { fTimingFile = file; }
+    inline Long64_t GetFirstEntry() const { return fFirstEntry; }
+    inline Long64_t GetNEntries() const { return fNEntries; }
+
+private:
+    void WriteEntryRangeSkim(std::ofstream &out, const char* InputFile,
+			     const char* SkimFile);
     
     ClassDef(AtlMemTkAnalysisTask,0) // Atl MemTk Analysis Task
 };
@@ -0,0 +1,51 @@
+#ifndef ATLAS_AtlMemTkJobSplitter
+#define ATLAS_AtlMemTkJobSplitter
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <vector>
+#include <string>
+
+class AtlMemTkJobSplitter : public TNamed {
+
+  private:
+    TString fTreeName;       // Name of the MemTk input tree
+    TString fJetMultExpr;    // Tree expression giving the jet multiplicity of an event (used by the probe)
+    std::vector<Double_t> fJetMultCost;  // Relative integration cost per event vs. jet multiplicity (probe)
+    std::vector<std::string> fTimingFiles; // Input file of each timing record
+    std::vector<Long64_t> fTimingFirst;  // First entry of each timing record
+    std::vector<Long64_t> fTimingN;      // No. of entries of each timing record (-1 = all)
+    std::vector<Double_t> fTimingSec;    // Integration time (s) of each timing record
+
+  public:
+    AtlMemTkJobSplitter(const char* name = "MemTkJobSplitter",
+			const char* title = "MemTk job splitter");
+    virtual ~AtlMemTkJobSplitter();
+    Int_t ReadTimingFile(const char* TimingFile);
+    void AddTiming(const char* InputFile, Long64_t FirstEntry,
+		   Long64_t NEntries, Double_t Seconds);
+    Int_t Split(const char* InputFile, Int_t NSubjobs,
+		std::vector<Long64_t> &FirstEntry,
+		std::vector<Long64_t> &NEntries);
+    void SetJetMultiplicityCost(Int_t NJets, Double_t Cost);
+    virtual void Clear(Option_t *option = "");
+    virtual void Print(Option_t *option = "") const;
+
+    static Int_t ReadSplit(const char* SplitFile,
+			   std::vector<Long64_t> &FirstEntry,
+			   std::vector<Long64_t> &NEntries);
+    static Bool_t WriteSplit(const char* SplitFile,
+			     const std::vector<Long64_t> &FirstEntry,
+			     const std::vector<Long64_t> &NEntries);
+
+    inline void SetTreeName(const char* name) { fTreeName = name; }
+    inline void SetJetMultiplicityExpr(const char* expr) { fJetMultExpr = expr; }
+    inline Int_t GetNTimings() const { return fTimingSec.size(); }
+
+  private:
+    Bool_t ProbeCosts(const char* InputFile, std::vector<Double_t> &cost);
+
+    ClassDef(AtlMemTkJobSplitter,0) // Cost-aware splitting of MemTk jobs into entry ranges
+};
+#endif
+
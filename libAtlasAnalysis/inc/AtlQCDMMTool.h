@@ -35,6 +35,10 @@ class AtlQCDMMTool : public AtlAnalysisTool {
     FakesWeights *fFakeWeightEJets;   // TopFakes object to calculate weights (e+jets)
     FakesWeights *fFakeWeightMuJets;  // TopFakes object to calculate weights (mu+jets)
     TString fYear;                    // Year used in eff. path and param. strings
+    Int_t   fYearCode;                // Year as integer (eg. 2016), set in Notify()
+    Int_t   fTriggerRunNr;            // Run number the trigger bits have been resolved for
+    Int_t   fTrigBitsEl[3];           // HLT bits of the electron trigger split (-1 = unused)
+    Int_t   fTrigBitsMu[3];           // HLT bits of the muon trigger split (-1 = unused)
     
   public:
     AtlQCDMMTool(const char* name, const char* title);
@@ -69,6 +73,7 @@ class AtlQCDMMTool : public AtlAnalysisTool {
 
   private:
     void InitEvent();
+    void SetupTriggerBits();
    
     ClassDefOverride(AtlQCDMMTool,0)  // Atlas QCD Estimation Tool
 };
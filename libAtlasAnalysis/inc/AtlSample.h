@@ -309,10 +309,50 @@ class AtlSample : public TNamed {
 	kFCNC_ctZ_K01L,          // Single-top ctZ FCNC, K=0.01, left-handed
 	kUndefined               // Undefined sample type (needed for type comparisons)
     };
+
+    // Sample categories (see GetCategories())
+    enum ECategory : ULong64_t {
+	kCatDATA          = BIT(0),  // Real data (any stream)
+	kCatDATAEGamma    = BIT(1),  // Egamma stream (DATA)
+	kCatDATAMuon      = BIT(2),  // Muon stream (DATA)
+	kCatMC            = BIT(3),  // MC (neither DATA nor QCD estimate)
+	kCatSgTop         = BIT(4),  // Single-top t-, s-channel and Wt
+	kCatSgTopTChannel = BIT(5),  // Single-top t-channel
+	kCatSgTopSChannel = BIT(6),  // Single-top s-channel
+	kCatSgTopWt       = BIT(7),  // Single-top Wt
+	kCattZj           = BIT(8),  // Single-top tZj
+	kCatTtbar         = BIT(9),  // ttbar
+	kCatTtbarV        = BIT(10), // ttbar+W|Z
+	kCatWjets         = BIT(11), // W+jets (any flavour, no HFOR-split samples)
+	kCatWjetsLight    = BIT(12), // W+light jets
+	kCatWjetsHeavy    = BIT(13), // W+heavy-flavour jets
+	kCatWjetsC        = BIT(14), // W+c(c)
+	kCatWjetsB        = BIT(15), // W+bb
+	kCatHFOR0         = BIT(16), // HFOR type 0
+	kCatHFOR1         = BIT(17), // HFOR type 1
+	kCatHFOR2         = BIT(18), // HFOR type 2
+	kCatHFOR3         = BIT(19), // HFOR type 3
+	kCatZjets         = BIT(20), // Z+jets
+	kCatZjetsLF       = BIT(21), // Z+light jets
+	kCatZjetsHF       = BIT(22), // Z+heavy-flavour jets
+	kCatZjetsC        = BIT(23), // Z+cc
+	kCatZjetsB        = BIT(24), // Z+bb
+	kCatDiboson       = BIT(25), // Diboson
+	kCatFCNCtZ        = BIT(26), // FCNC tZ
+	kCatQCD           = BIT(27), // QCD multi-jet estimate
+	kCatQCDTight      = BIT(28), // QCD (matrix method, tight)
+	kCatQCDLoose      = BIT(29), // QCD (matrix method, loose)
+	kCatQCDEGamma     = BIT(30), // QCD (electron channel)
+	kCatQCDMuon       = BIT(31), // QCD (muon channel)
+	kCatQCDJetLepton  = BIT(32), // QCD (jet-lepton method)
+	kCatQCDAntiMuon   = BIT(33), // QCD (anti-muon method)
+	kCatHFOR = kCatHFOR0 | kCatHFOR1 | kCatHFOR2 | kCatHFOR3 // Any HFOR type
+    };
     
   private:
     TString   fColor;    // Sample Color
     EType     fType;     // Sample type
+    ULong64_t fCategories; //! Categories of the sample type (see GetCategories())
     Float_t   fXsection; // Sample Xsection
     TObjArray fPaths;    // Sample paths
     Bool_t    fIsSystematicSample; // Used for systematic only?
@@ -325,40 +365,54 @@ class AtlSample : public TNamed {
     const char* GetTypeName() const;
     const char* GetCategoryName() const;
     //    static const char* GetCategoryName(ECategory Category);
-    Bool_t IsSgTop() const;
-    Bool_t IsSgTopTChannel() const;
-    Bool_t IsSgTopSChannel() const;
-    Bool_t IsSgTopWt() const;
-    Bool_t IstZj() const;
-    Bool_t IsTtbar() const;
-    Bool_t IsTtbarV() const;
-    Bool_t IsWjetsLight() const;
-    Bool_t IsWjetsHeavy() const;
-    Bool_t IsWjetsC() const;
-    Bool_t IsWjetsB() const;
-    Bool_t IsWjets() const;
-    Bool_t IsHFOR0() const;
-    Bool_t IsHFOR1() const;
-    Bool_t IsHFOR2() const;
-    Bool_t IsHFOR3() const;
-    Bool_t IsZjets() const;
-    Bool_t IsZjetsB() const;
-    Bool_t IsZjetsC() const;
-    Bool_t IsZjetsLF() const;
-    Bool_t IsZjetsHF() const;
-    Bool_t IsDiboson() const;
-    Bool_t IsFCNCtZ() const;
-    Bool_t IsDATA() const;
-    Bool_t IsMC() const;
-    Bool_t IsDATAEGamma() const;
-    Bool_t IsDATAMuon() const;
-    Bool_t IsQCD() const;
-    Bool_t IsQCDTight() const;
-    Bool_t IsQCDLoose() const;
-    Bool_t IsQCDEGamma() const;
-    Bool_t IsQCDMuon() const;
-    Bool_t IsQCDJetLepton() const { return fType == kQCD_JetLepton; }
-    Bool_t IsQCDAntiMuon() const { return fType == kQCD_AntiMuon; }
+    static ULong64_t GetCategories(EType Type);
+    inline ULong64_t GetCategories() const { return fCategories; }
+    inline Bool_t HasCategory(ULong64_t Category) const {
+	//
+	// Does the sample belong to all given categories ?
+	//
+	return ( (fCategories & Category) == Category );
+    }
+    inline Bool_t HasAnyCategory(ULong64_t Categories) const {
+	//
+	// Does the sample belong to any of the given categories ?
+	//
+	return ( (fCategories & Categories) != 0 );
+    }
+    inline Bool_t IsSgTop() const         { return HasCategory(kCatSgTop); }
+    inline Bool_t IsSgTopTChannel() const { return HasCategory(kCatSgTopTChannel); }
+    inline Bool_t IsSgTopSChannel() const { return HasCategory(kCatSgTopSChannel); }
+    inline Bool_t IsSgTopWt() const       { return HasCategory(kCatSgTopWt); }
+    inline Bool_t IstZj() const           { return HasCategory(kCattZj); }
+    inline Bool_t IsTtbar() const         { return HasCategory(kCatTtbar); }
+    inline Bool_t IsTtbarV() const        { return HasCategory(kCatTtbarV); }
+    inline Bool_t IsWjetsLight() const    { return HasCategory(kCatWjetsLight); }
+    inline Bool_t IsWjetsHeavy() const    { return HasCategory(kCatWjetsHeavy); }
+    inline Bool_t IsWjetsC() const        { return HasCategory(kCatWjetsC); }
+    inline Bool_t IsWjetsB() const        { return HasCategory(kCatWjetsB); }
+    inline Bool_t IsWjets() const         { return HasCategory(kCatWjets); }
+    inline Bool_t IsHFOR0() const         { return HasCategory(kCatHFOR0); }
+    inline Bool_t IsHFOR1() const         { return HasCategory(kCatHFOR1); }
+    inline Bool_t IsHFOR2() const         { return HasCategory(kCatHFOR2); }
+    inline Bool_t IsHFOR3() const         { return HasCategory(kCatHFOR3); }
+    inline Bool_t IsZjets() const         { return HasCategory(kCatZjets); }
+    inline Bool_t IsZjetsB() const        { return HasCategory(kCatZjetsB); }
+    inline Bool_t IsZjetsC() const        { return HasCategory(kCatZjetsC); }
+    inline Bool_t IsZjetsLF() const       { return HasCategory(kCatZjetsLF); }
+    inline Bool_t IsZjetsHF() const       { return HasCategory(kCatZjetsHF); }
+    inline Bool_t IsDiboson() const       { return HasCategory(kCatDiboson); }
+    inline Bool_t IsFCNCtZ() const        { return HasCategory(kCatFCNCtZ); }
+    inline Bool_t IsDATA() const          { return HasCategory(kCatDATA); }
+    inline Bool_t IsMC() const            { return HasCategory(kCatMC); }
+    inline Bool_t IsDATAEGamma() const    { return HasCategory(kCatDATAEGamma); }
+    inline Bool_t IsDATAMuon() const      { return HasCategory(kCatDATAMuon); }
+    inline Bool_t IsQCD() const           { return HasCategory(kCatQCD); }
+    inline Bool_t IsQCDTight() const      { return HasCategory(kCatQCDTight); }
+    inline Bool_t IsQCDLoose() const      { return HasCategory(kCatQCDLoose); }
+    inline Bool_t IsQCDEGamma() const     { return HasCategory(kCatQCDEGamma); }
+    inline Bool_t IsQCDMuon() const       { return HasCategory(kCatQCDMuon); }
+    inline Bool_t IsQCDJetLepton() const  { return HasCategory(kCatQCDJetLepton); }
+    inline Bool_t IsQCDAntiMuon() const   { return HasCategory(kCatQCDAntiMuon); }
 
     inline EType GetType() const {
 	//
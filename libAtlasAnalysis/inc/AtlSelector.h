@@ -32,6 +32,7 @@
 #ifndef ROOT_TEntryList
 #include <TEntryList.h>
 #endif
+#include <vector>
 #ifndef ROOT_TH1F
 #include <TH1F.h>
 #endif
@@ -44,6 +45,8 @@ class TROOT;
 class TSystem;
 class AtlEvtReaderBase;
 class AtlEvtWriterBase;
+class AtlEventIndex;
+class AtlEventProfiler;
 class TChainElement;
 
 class AtlSelector : public TSelector {
@@ -56,6 +59,7 @@ class AtlSelector : public TSelector {
 		   kMemNtuple,
 		   kCustom,    // when setting the event reader in AtlTopLevelAnalysis (Run 2)
                    kCustomMem, // like kCustom, but for processed events with single tree
+		   kFlatNtuple // flat columnar ntuple (AtlEvtWriterFlat/AtlEvtReaderFlat)
     };
 
     static const Int_t fgNumLepChannels = 2;
@@ -120,6 +124,15 @@ class AtlSelector : public TSelector {
     TList      *fListOfTools;           // List of analysis tools
     Bool_t      fWriteEntryList;        // Switch for writing an entry list
     TEntryList *fEntryList;             // Global entry list for all files in a chain
+    Bool_t      fWriteEventIndex;       // Switch for writing a compact event index
+    AtlEventIndex *fEventIndex;         // Output event index of all accepted events
+    AtlEventIndex *fInputEventIndex;    // Input event index restricting the processed entries (owned)
+    TEntryList *fInputEntryList;        // Input entry list restricting or excluding the processed entries (owned)
+    Bool_t      fExcludeInputEntryList; // Skip the entries of the input entry list instead of processing only those
+    std::vector<Long64_t> fExclEntries; //! Sorted entries of the current input tree to be skipped
+    size_t      fExclNext;              //! Index of the next entry to be skipped in fExclEntries
+    AtlEventProfiler *fEventProfiler;   // Per-event timing of the processing stages (optional)
+    Bool_t      fResetObjectCount;      // Reset the TRef object count after each event (default)
     TH1F       *fHistEvents;            // Histogram for no. of processed and accepted events etc.
     TH1F       *fHistEvtWeights;        // Histogram of event weights
     TH1D       *fHistCutflow_NoWeights;                 // SgTopD3PD CutFlow Histogram
@@ -194,6 +207,19 @@ class AtlSelector : public TSelector {
     inline Bool_t PassedSelection() const { return fPassedSelection; }
     inline void SetWriteEntryList(Bool_t WriteEntryList)
     { fWriteEntryList = WriteEntryList; }
+    inline Bool_t GetWriteEventIndex() const { return fWriteEventIndex; }
+    inline void SetWriteEventIndex(Bool_t WriteEventIndex)
+    { fWriteEventIndex = WriteEventIndex; }
+    inline AtlEventIndex* GetInputEventIndex() const { return fInputEventIndex; }
+    Bool_t SetInputEventIndex(AtlEventIndex *index);
+    inline TEntryList* GetInputEntryList() const { return fInputEntryList; }
+    inline Bool_t GetExcludeInputEntryList() const { return fExcludeInputEntryList; }
+    Bool_t SetInputEntryList(TEntryList *list, Bool_t Exclude = kFALSE);
+    void SetEventProfiling(Int_t NSlowest = 20, const char* DumpFile = "");
+    inline AtlEventProfiler* GetEventProfiler() const { return fEventProfiler; }
+    inline Bool_t GetResetObjectCount() const { return fResetObjectCount; }
+    inline void SetResetObjectCount(Bool_t ResetObjectCount)
+    { fResetObjectCount = ResetObjectCount; }
     inline TList* GetListOfTools() const { return fListOfTools; }
     inline Int_t GetProcessedEvents() const { return fProcessedEvents; }
     Int_t GetNProcessedFiles() const { return fNProcessedFiles; }
@@ -6,6 +6,7 @@
 #ifndef ATLAS_AtlTask
 #define ATLAS_AtlTask
 #include <fstream>
+#include <ostream>
 #ifndef ROOT_TTask
 #include <TTask.h>
 #endif
@@ -61,7 +62,7 @@ class AtlTask : public TTask {
     void SetTempOutputFile(const char* OutputFile);
     void SetTempOutputPath(const char* OutputPath);
     void SetOutputTree(const char* name, const char* title); // *MENU*    
-    virtual void CreateJobHome();
+    virtual Bool_t CreateJobHome();
     Char_t GetBatchNodeFromPath(const char* path);
     virtual void Exec(Option_t *option = "");
     virtual void ExecInteractiveJob(Option_t *option) = 0;
@@ -73,9 +74,9 @@ class AtlTask : public TTask {
     virtual void CreateGridRunScript() = 0;
     void CreateRunScriptPath();
     void CreateLogFilePath();
-    void CreateOutFilePath();
+    Bool_t CreateOutFilePath();
     void SetJobHome(const char* JobHome); // *MENU*
-    virtual Bool_t WriteEnvSetup(std::ofstream & out) const;
+    virtual Bool_t WriteEnvSetup(std::ostream & out) const;
     virtual Bool_t SubmitBatchJob();
     virtual void SubmitGridJob();
     virtual void SubmitNAFBatchJob();
@@ -94,6 +95,7 @@ class AtlTask : public TTask {
     inline void SetGridIdSuffix(const char* suffix) { fGridIdSuffix = suffix; }
     
     static void CopyFolder(TDirectory *SrcDir, TDirectory *DestDir, Float_t scale);
+    static const char* ExpandPath(const char* path);
 
     inline Bool_t GetBatchNodeAll()  { return fBatchNodeAll; }
     inline Bool_t GetBatchNodeAutomatic()   { return fBatchNodeAutomatic; }
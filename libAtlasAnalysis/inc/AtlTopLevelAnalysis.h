@@ -46,6 +46,7 @@ class TObjString;
 class TObjArray;
 class AtlAnalysisTool;
 class TBits;
+class AtlMemTkJobSplitter;
 
 class AtlTopLevelAnalysis : public TTask {
 
@@ -280,6 +281,7 @@ class AtlTopLevelAnalysis : public TTask {
     Bool_t    fDrawSignalOverlay;       // Flag for drawing the signal MC (assumed to be the least entry in the MC histogram stack) as overlay instead as part of the stack (default = false)
     Float_t   fScaleOverlay;            // Scale factor of the overlay histogram (default = 1.)
     Bool_t    fDrawSignificance;        // Draw significance panel
+    Bool_t    fIncrementalPlots;        // Rebuild only plots with changed inputs (see HepDataMCPlotter::SetIncremental())
 
     	
     TNamed   *fOutputTreeName;          // Name and title of the output tree (if any)
@@ -326,6 +328,7 @@ class AtlTopLevelAnalysis : public TTask {
     Int_t fNProcessNthEventsOnly; // process only every Nth event (default=1 every event)
     Int_t fMaxEventsPerSubjob;    // Calculate NSubJobs automatically with max events per subjob
     TObjArray * fSampleSizes;     // Save number of events per sample
+    AtlMemTkJobSplitter *fMemTkJobSplitter; // Cost-aware splitting of MemTk jobs (0 = split by event count)
 
     AtlHistFactoryMeasurement *fMeasurement; // HistFactory Measurement infos
     
@@ -336,6 +339,9 @@ class AtlTopLevelAnalysis : public TTask {
     Int_t fDebug;                 // Debug flag to be passed to the analysis
     Int_t fDebugBuild;            // Debug flag used for task building
     Bool_t fBatchNodeAutomatic;	  // Automatic Batch node: see AtlTask
+    Bool_t fDryRun;               // Dry run: count the analysis tasks only, do not create them
+    Bool_t fDeferTasks;           // Create the analysis tasks of a systematic folder only when it is executed (default = true)
+    Int_t  fNDryRunTasks;         //! No. of analysis tasks counted in dry-run mode
 
   public:
     AtlTopLevelAnalysis(const char* name, const char* title);
@@ -356,6 +362,7 @@ class AtlTopLevelAnalysis : public TTask {
 			  const char* XTitle, const char* YTitle);
     
     void BuildTree(Bool_t OpenBrowser = kTRUE);
+    void ValidateCuts();
     void BuildHforSplittingTree(TTask *ParentTask);
     void BuildAnalysisTree(TTask *ParentTask);
     void BuildMemTkAnalysisTree(TTask *ParentTask);
@@ -475,6 +482,7 @@ class AtlTopLevelAnalysis : public TTask {
     void SetDrawSignalOverlay(Bool_t status);
     void SetScaleOverlay(Float_t scale);
     inline void SetDrawSignificance(Bool_t b = kTRUE) { fDrawSignificance = b;}
+    inline void SetIncrementalPlots(Bool_t b = kTRUE) { fIncrementalPlots = b;}
 
     // Grid options
     void SetGridRootVersion(const char* RootVersion);
@@ -489,6 +497,7 @@ class AtlTopLevelAnalysis : public TTask {
     void SetMemTkTreatAllJetsAsBJets(Bool_t b = kTRUE) { fMemTkTreatAllJetsAsBJets = b; }
     
     inline Bool_t GetForceRetry() const { return fForceRetry; }
+    inline Int_t GetNDryRunTasks() const { return fNDryRunTasks; }
     inline TString* GetDSIDList() const { return fDSIDList; }
     inline TString* GetHistDir() const { return fHistDir; }
     inline TString* GetSelector() const { return fSelector; }
@@ -526,6 +535,8 @@ class AtlTopLevelAnalysis : public TTask {
 	SetToolCut(tool, var, val);
     }
     inline void SetForceRetry(Bool_t flag) { fForceRetry = flag; }
+    inline void SetDryRun(Bool_t flag) { fDryRun = flag; }
+    inline void SetDeferTasks(Bool_t flag) { fDeferTasks = flag; }
     inline void SetBuildHforTree(Bool_t flag) { fBuildHforTree = flag; }
     inline void SetBuildAnalysisTree(Bool_t flag) { fBuildAnalysisTree = flag; }
     inline void SetBuildMemTkAnalysisTree(Bool_t flag) { fBuildMemTkAnalysisTree = flag; }
@@ -566,6 +577,7 @@ class AtlTopLevelAnalysis : public TTask {
     inline void SetNSubJobsZjetsB(Int_t jobs) { fNSubJobsZjetsB = jobs; }
     inline void SetNProcessNthEventsOnly(Int_t n) { fNProcessNthEventsOnly = n; }
     inline void SetMaxEventsPerSubjob(Int_t n) { fMaxEventsPerSubjob = n; }
+    void SetMemTkJobSplitter(AtlMemTkJobSplitter *splitter);
 
     inline void SetMeasurement(AtlHistFactoryMeasurement *meas) { fMeasurement = meas; }
 
@@ -579,6 +591,9 @@ class AtlTopLevelAnalysis : public TTask {
 
 private:
     Bool_t IsIgnored(AtlSample * sample);
+    Int_t CountTasks(TTask *task, Int_t *NDeferred = 0) const;
+    void BuildSystematicFolder(TTask *ParentTask, Int_t Jetbin,
+			       Int_t LepChannel, Int_t Systematic);
 
     ClassDef(AtlTopLevelAnalysis,0) // Top-level A++ analysis task
 };
@@ -293,6 +293,13 @@
 // <h3>Job submission (at HU cluster):</h3>
 // Use SetBatchNodeAll(), SetBatchNode() or SetBatchNodeAutomatic() to set
 // the type of batch job submssion. For details see AtlTask.cxx.
+// With SetJobDriver() batch jobs are run by a compiled driver
+// executable (default aplusplus-run, installed by build.sh into
+// $LIBSINGLETOP/bin/$ARCH_TYPE, see AtlJobRegistry) from the
+// job description analysis_run.job instead of interpreting
+// analysis_run.C. Jobs with subselections still use the Root script.
+// The cuts are checked only once (ValidateCuts(), see AtlCutRegistry)
+// and handed to the driver as binary configuration analysis_run.cfg.
 //
 // <h3>Project libraries:</h3>
 // User-defined project libraries beside the standard libraries
@@ -320,6 +327,13 @@
 // analysis will now run only on the events stored in this list.
 // If the flag fUseAntiList is set, the analysis will run on events which 
 // are not stored in the lists (events stored in the lists will be skipped).
+// The lists are applied by the selector (AtlSelector::SetInputEntryList())
+// in a single pass over the input.
+// With SetWriteEventIndex(kTRUE) the selector additionally writes the
+// accepted events as compact AtlEventIndex ("app_eventindex").
+// SetEventProfiling(N, "slow_events.root") switches on the per-event
+// timing of the selector (see AtlEventProfiler); the N slowest events
+// are copied into the given file for offline profiling.
 //
 // END_HTML
 //  
@@ -336,10 +350,12 @@
 #include <AtlSelector.h>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <TClass.h>
 #include <TDataMember.h>
 #include <TROOT.h>
 #include <AtlAnalysisTool.h>
+#include <AtlCutRegistry.h>
 #include "AtlSubselectionCuts.h"
 
 using namespace std;
@@ -367,11 +383,14 @@ AtlAppAnalysisTask::AtlAppAnalysisTask(const char* name, const char* title) :
     fListOfUserEnvs = new TList;
     fListOfTools    = new TList;
     fWriteEntryList   = kFALSE;
+    fWriteEventIndex  = kFALSE;
     fLoadEntryList    = kFALSE;
     fUseAntiList      = kFALSE;
     fNProcessNthEventsOnly = 1;
     fPrintEvent       = kFALSE;
     fPrintObjectTable = kFALSE;
+    fEventProfilingNSlowest = 0;
+    fCutsValidated = kFALSE;
     fSelector      = 0;
     fInputTreeName = 0;
     fXsection      = 0;
@@ -475,9 +494,12 @@ Bool_t AtlAppAnalysisTask::ExecBatchJob(Option_t *option) {
     // Create analysis selector
     InitSelector();
 
-    // Create submit scripts
+    // Create submit scripts. With a compiled job driver the job is
+    // run from the job description, analysis_run.C is kept for
+    // reference and as fallback
     CreateRootScript(opt.Data());
-    CreateRunScript();
+    Bool_t UseDriver = !fJobDriver.IsNull() && CreateJobDescription(opt.Data());
+    CreateRunScript(UseDriver ? "DRIVER" : "");
 
     // Submit batch job
     return SubmitBatchJob();
@@ -543,71 +565,15 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
     //
     TString opt = option;
 
-    //
-    // Check first if all cut variables are valid data members of the
-    // selector
-    //
-
     // Class introspection possible for this selector ?
     if ( fSelector == 0 ) {
 	Error("CreateRootScript",
 	      "Selector unknown. Please use SetSelector(). Abort!");
  	gSystem->Abort(0);
     }
-    
-    TClass *sel_cl = (TClass*)gROOT->GetClass( fSelector->Data() );
-    if ( sel_cl == 0 ) {
-     	Error("CreateRootScript",
-	      "Class description for class \"%s\" not found. Abort!",
-	      fSelector->Data());
- 	gSystem->Abort(0);
-    }
-    
-    // Selector cut variables exist ?
-    TIter next_cut(GetListOfCuts());
-    AtlCut *cut = 0;
-    TDataMember *cut_memb = 0;
-    TClass *cut_memb_base = 0; // return value is of type TClass not TDatamember
-    while ( (cut = (AtlCut*)next_cut()) ) {
 
-	// Find data member
-	cut_memb = FindDataMember(sel_cl, cut->GetVar());
-	
-	// Data member not found ?
-	if ( cut_memb == 0 ) {
-	    Error("CreateRootScript",
-		  "Selector - Data member of name \"%s\" does not exist. Abort!",
-		  cut->GetVar());
-	    gSystem->Abort(0);
-	}
-    }
-    
-    // Analysis tools cut variables exist ?
-    TIter next_toolcut(GetListOfToolCuts());
-    AtlToolCut *toolcut = 0;
-    cut_memb = 0;
-    cut_memb_base = 0;
-    
-    TClass *tool_cl = 0;
-    while ( (toolcut = (AtlToolCut*)next_toolcut()) ) {
-      tool_cl = (TClass*)gROOT->GetClass(((AtlAnalysisTool*)fListOfTools->FindObject(toolcut->GetTool().Data()))->ClassName());
-	
-      if ( tool_cl == 0 ) {
-	Error("CreateRootScript",
-	      "Class description for class \"%s\" not found. Abort!",
-	      toolcut->GetTool().Data());
-	gSystem->Abort(0);
-      }
-      
-      cut_memb = tool_cl->GetDataMember(toolcut->GetVariable().Data());
-      cut_memb_base = tool_cl->GetBaseDataMember(toolcut->GetVariable().Data());
-      if ( cut_memb == 0 && cut_memb_base == 0) {
-	  Error("CreateRootScript",
-		"Toolcut - Data member of name \"%s\" does not exist. Abort!",
-		toolcut->GetVariable().Data());
-	  gSystem->Abort(0);
-      }
-    }
+    // Check all cuts (unless already done when building the task tree)
+    if ( !fCutsValidated ) ValidateCuts();
 
     // =============
     // Create script
@@ -621,8 +587,8 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
     }
     fRootScript->ReplaceAll("//","/");
     
-    ofstream out;
-    out.open(fRootScript->Data());
+    // Assemble the script in memory and write it in one go
+    ostringstream out;
     
     // Header
     out << "{" << endl
@@ -728,12 +694,9 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
 	}
     }
     
-    // Create full entry list (containing all events) for creation of anti entry list (if wanted)
-    if ( fLoadEntryList && fUseAntiList ) {
-	out << "ch->Draw(\">>antilist\",\"\",\"app_entrylist\");" << endl;
-	out << "TEntryList *antilist = (TEntryList*)gDirectory->Get(\"antilist\");" << endl;
-    }
-    // Apply entry list if wanted (and subtract from full list if anti list is wanted)
+    // Hand the entry list to the selector (if wanted). In case of an
+    // anti list the listed events are skipped by the selector without
+    // any extra pass over the input chain
     if(fLoadEntryList)  {
       TIter next2(fInputEntryLists);
       TObjString *item2 = 0;
@@ -743,14 +706,8 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
 	      << item2->GetString().Data() << "\",\"read\");" << endl;
 	  out << "inputentrylist->Add((TEntryList*)entrylistfile->Get(\"app_entrylist\"));" << endl;
       }
-      // Subtract from full list for anti list and apply on chain
-      if ( fUseAntiList )  {
-	  out << "antilist->Subtract(inputentrylist);" << endl;
-	  out << "ch->SetEntryList(antilist);" << endl;
-      }
-      else  {
-	  out << "ch->SetEntryList(inputentrylist);" << endl;
-      }
+      out << "sel->SetInputEntryList(inputentrylist, "
+	  << ( fUseAntiList ? "kTRUE" : "kFALSE" ) << ");" << endl;
     }
 
     // only every nth event
@@ -777,6 +734,11 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
     out << "sel->SetWriteEntryList("
 	<< fWriteEntryList << ");" << endl;
 
+    // Switch on/off event index creation
+    if ( fWriteEventIndex ) {
+	out << "sel->SetWriteEventIndex(kTRUE);" << endl;
+    }
+
     // Switch on/off printing every event
     out << "sel->SetPrintEvent("
 	<< fPrintEvent << ");" << endl;
@@ -784,9 +746,16 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
     // Switch on/off printing Root's object table
     out << "sel->SetPrintObjectTable("
 	<< fPrintObjectTable << ");" << endl;
+
+    // Switch on per-event profiling
+    if ( fEventProfilingNSlowest > 0 ) {
+	out << "sel->SetEventProfiling(" << fEventProfilingNSlowest
+	    << ", \"" << fEventProfilingDumpFile.Data() << "\");" << endl;
+    }
     
     // Set selection cuts
-    next_cut.Reset();
+    TIter next_cut(GetListOfCuts());
+    AtlCut *cut = 0;
     while ( (cut = (AtlCut*)next_cut()) ) {
       out << "sel->" << cut->GetVar() << " = "
 	    << cut->GetVal() << ";" << endl;
@@ -818,16 +787,21 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
 	    << "sel->AddTool(tool" << i << ");" << endl;
 
 	// Loop over all cuts
-	// TIter next_cut(GetListOfToolCuts());
-	next_toolcut.Reset();
-	toolcut = 0;
+	TIter next_toolcut(GetListOfToolCuts());
+	AtlToolCut *toolcut = 0;
 	while ( (toolcut = (AtlToolCut*)next_toolcut()) ) {
 	  if ( strcmp(tool->GetName(), toolcut->GetTool().Data()) != 0 ) continue;
 
-	    // Get datamember associated with cut
-	    TClass *cl = gROOT->GetClass(tool->ClassName());
-	    TClass *mem_class = cl->GetBaseDataMember(toolcut->GetVariable().Data());
-	    TDataMember *mem = mem_class->GetDataMember(toolcut->GetVariable().Data());
+	    // Type of the cut (see AtlCutRegistry)
+	    const AtlCutRegistry::Spec *spec =
+		AtlCutRegistry::GetSpec(tool->IsA(), toolcut->GetVariable().Data());
+	    if ( spec == 0 ) {
+		Error(__FUNCTION__,
+		      "Toolcut - Data member of name \"%s\" does not exist in tool class \"%s\". Abort!",
+		      toolcut->GetVariable().Data(), tool->ClassName());
+		gSystem->Abort(0);
+	    }
+	    const char* type = spec->fTypeName.c_str();
 
 	    // debug
 	    if ( fDebugBuild > 1 ) {
@@ -838,27 +812,17 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
 		     "  toolcut val: %s\n"
 		     "  var TrueTypeName: %s",
 		     tool->GetName(), toolcut->GetVariable().Data(),
-		     toolcut->GetVal(), mem->GetTrueTypeName());
-		Info(__FUNCTION__, "Data member dump:\n");
-		mem->Dump();
-	    }
-
-	    // Check if cut is a public datamember
-	    if ( (mem->Property() & kIsPublic) == 0 ) {
-		Error(__FUNCTION__,
-		      "Given cut \"%s\" is not a public datamember in tool class \"%s\", which is necessary. Abort!",
-		      toolcut->GetVariable().Data(), tool->ClassName());
-		gSystem->Abort();
+		     toolcut->GetVal(), type);
 	    }
 
 	    // Set cut value.
 	    // In case of TStrings or TLists the values are appended
 	    out << "tool" << i << "->" << toolcut->GetVariable().Data();
-	    if ( strcmp(mem->GetTrueTypeName(), "TString*") == 0 ) {
+	    if ( strcmp(type, "TString*") == 0 ) {
 		out << "->Append(\"" << toolcut->GetVal() << "\");" << endl;
-	    } else if ( strcmp(mem->GetTrueTypeName(), "TString") == 0 ) {
+	    } else if ( strcmp(type, "TString") == 0 ) {
 		out << " = \"" << toolcut->GetVal() << "\";" << endl;
-	    } else if ( strcmp(mem->GetTrueTypeName(), "TList*") == 0 ) {
+	    } else if ( strcmp(type, "TList*") == 0 ) {
 		out << "->Add(" << toolcut->GetVal() << ");" << endl;
 	    } else {
 		out << " = " << toolcut->GetVal() << ";" << endl;
@@ -877,7 +841,166 @@ void AtlAppAnalysisTask::CreateRootScript(Option_t *option) {
     
     out << "}" << endl;
 
-    out.close();
+    ofstream script(fRootScript->Data());
+    script << out.str();
+    script.close();
+}
+
+//____________________________________________________________________
+
+static Bool_t AddConfigEntry(vector<AtlCutRegistry::Entry> &config,
+			     TClass *cl, Int_t target, const char* member,
+			     const char* value) {
+    //
+    // Convert cut value and add it to the job configuration
+    //
+    AtlCutRegistry::Entry e;
+    if ( !AtlCutRegistry::MakeEntry(cl, target, member, value, e) ) {
+	::Error("AtlAppAnalysisTask::CreateJobDescription",
+		"Invalid cut %s::%s = %s", cl->GetName(), member, value);
+	return kFALSE;
+    }
+    config.push_back(e);
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlAppAnalysisTask::CreateJobDescription(Option_t *option) {
+    //
+    // Create job description for the compiled job driver (see
+    // AtlJobRegistry and SetJobDriver()). It contains the same job
+    // setup as the Root script, except for the cuts which are
+    // converted once and written into the binary configuration
+    // analysis_run.cfg (see AtlCutRegistry). CreateRootScript(),
+    // which checks the cuts, must be called first.
+    //
+    // Returns kFALSE if the job cannot be described this way
+    // (subselections, grid jobs). In this case analysis_run.C has to
+    // be used.
+    //
+    if ( fGridJob || GetListOfSubselectionCuts()->GetEntries() > 0 ) {
+	Info(__FUNCTION__,
+	     "Subselections and grid jobs are not supported by the job driver. Use %s",
+	     fRootScript->Data());
+	return kFALSE;
+    }
+    TString JobFile = Form("%s/analysis_run.job", fJobHome->Data());
+    JobFile.ReplaceAll("//","/");
+
+    // Assemble the description in memory and write it in one go.
+    // Fields are separated by tabs
+    ostringstream out;
+    out << "# !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!" << endl
+	<< "# !!! This is an automatically generated file !!!" << endl
+	<< "# !!! D O   N O T   E D I T                   !!!" << endl
+	<< "# !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!" << endl
+	<< "#" << endl
+	<< "# Job description for A++ analysis batch job execution" << endl
+	<< "# (run with: " << fJobDriver.Data() << " analysis_run.job)" << endl
+	<< "#" << endl;
+    if ( fDebug > 0 ) out << "Debug\t" << fDebug << endl;
+
+    // Selector and reader
+    out << "Selector\t" << fSelector->Data() << endl;
+    if ( fTempOutputFileName != 0 && !fInteractiveJob ) {
+	out << "Output\t" << fTempOutputFileName->Data() << endl;
+    } else {
+	out << "Output\t" << fOutputFileName->Data() << endl;
+    }
+    if ( !fReaderClass->IsNull() ) {
+	out << "Reader\t" << fReaderClass->Data() << "\t" << fReaderArgs->Data() << endl
+	    << "UseJobInfo\t"
+	    << ( fReaderClass->EqualTo("AtlEvtReaderMemR2") || fUseAppInput ) << endl;
+	if ( fEvtReaderMCWeightPosition != -1 ) {
+	    out << "ReaderSet\tfMCWeightPosition\t" << fEvtReaderMCWeightPosition << endl
+		<< "ReaderSet\tfMCWeightTotalEvents\t"
+		<< Form("%g", fEvtReaderMCWeightTotalEvents) << endl;
+	    if ( fEvtReaderMCWeightPosition < -1 ) {
+		out << "ReaderSet\tfMCWeightPositionString\t"
+		    << fEvtReaderMCWeightPositionString.Data() << endl
+		    << "ReaderSet\tfMCWeightTotalEventsString\t"
+		    << fEvtReaderMCWeightTotalEventsString.Data() << endl;
+	    }
+	}
+    }
+
+    // Input
+    if ( fInputTreeName != 0 && !fInputTreeName->IsNull() )
+	out << "Tree\t" << fInputTreeName->Data() << endl;
+    TIter next(fInputFiles);
+    TObjString *item = 0;
+    while ( (item = (TObjString*)next()) ) {
+	out << "Input\t" << item->GetString().Data() << endl;
+    }
+    if ( fLoadEntryList ) {
+	TIter next2(fInputEntryLists);
+	while ( (item = (TObjString*)next2()) ) {
+	    out << "EntryList\t" << item->GetString().Data() << endl;
+	}
+	out << "AntiList\t" << fUseAntiList << endl;
+    }
+
+    // Selector switches
+    if ( fNProcessNthEventsOnly > 1 )
+	out << "NthEvent\t" << fNProcessNthEventsOnly << endl;
+    if ( fOutputTreeName != 0 ) {
+	out << "OutputTree\t" << fOutputTreeName->GetName()
+	    << "\t" << fOutputTreeName->GetTitle() << endl;
+    }
+    out << "WriteEntryList\t" << fWriteEntryList << endl;
+    if ( fWriteEventIndex ) out << "WriteEventIndex\t1" << endl;
+    out << "PrintEvent\t" << fPrintEvent << endl
+	<< "PrintObjectTable\t" << fPrintObjectTable << endl;
+    if ( fEventProfilingNSlowest > 0 ) {
+	out << "EventProfiling\t" << fEventProfilingNSlowest
+	    << "\t" << fEventProfilingDumpFile.Data() << endl;
+    }
+
+    // Selection and tool cuts. They are converted into typed values
+    // here and handed to the job as binary configuration, such that
+    // the job does not need to parse or check them again
+    vector<AtlCutRegistry::Entry> config;
+    TClass *sel_cl = gROOT->GetClass(fSelector->Data());
+    if ( fSelector->EqualTo("AtlSgTop_sChannelAnalysis")
+	 && !AddConfigEntry(config, sel_cl, 0, "fXsection", Form("%g", fXsection)) )
+	return kFALSE;
+    TIter next_cut(GetListOfCuts());
+    AtlCut *cut = 0;
+    while ( (cut = (AtlCut*)next_cut()) ) {
+	if ( !AddConfigEntry(config, sel_cl, 0, cut->GetVar(), cut->GetVal()) )
+	    return kFALSE;
+    }
+    TIter next_tool(fListOfTools);
+    AtlAnalysisTool *tool = 0;
+    Int_t i = 0;
+    while ( (tool = (AtlAnalysisTool*)next_tool()) ) {
+	i++;
+	out << "Tool\t" << tool->ClassName() << "\t" << tool->GetName()
+	    << "\t" << tool->GetTitle() << endl;
+	TIter next_toolcut(GetListOfToolCuts());
+	AtlToolCut *toolcut = 0;
+	while ( (toolcut = (AtlToolCut*)next_toolcut()) ) {
+	    if ( strcmp(tool->GetName(), toolcut->GetTool().Data()) != 0 ) continue;
+	    if ( !AddConfigEntry(config, tool->IsA(), i,
+				 toolcut->GetVariable().Data(), toolcut->GetVal()) )
+		return kFALSE;
+	}
+    }
+    TString ConfigFile = Form("%s/analysis_run.cfg", fJobHome->Data());
+    ConfigFile.ReplaceAll("//","/");
+    if ( !AtlCutRegistry::WriteConfig(ConfigFile.Data(), config) ) return kFALSE;
+    out << "Config\t" << ConfigFile.Data() << endl;
+
+    // Process chain
+    out << "Option\t" << option << endl
+	<< "NEvents\t" << fNEvents << endl
+	<< "FirstEntry\t" << fFirstEntry << endl;
+
+    ofstream job(JobFile.Data());
+    job << out.str();
+    job.close();
+    return kTRUE;
 }
 
 //____________________________________________________________________
@@ -1018,7 +1141,7 @@ void AtlAppAnalysisTask::CreateNAFBatchRootScript(Option_t *option) {
       
     }
     
-    // Apply entry list if wanted
+    // Hand the entry list to the selector if wanted (see above)
     if(fLoadEntryList)  {
       TIter next2(fInputEntryLists);
       TObjString *item2 = 0;
@@ -1027,7 +1150,8 @@ void AtlAppAnalysisTask::CreateNAFBatchRootScript(Option_t *option) {
 	out << "TFile *entrylistfile = new TFile(\"" << item2->GetString().Data() << "\",\"read\");" << endl;
 	out << "inputentrylist->Add((TEntryList*)entrylistfile->Get(\"app_entrylist\"));" << endl;
       }
-      out << "ch->SetEntryList(inputentrylist);" << endl;
+      out << "sel->SetInputEntryList(inputentrylist, "
+	  << ( fUseAntiList ? "kTRUE" : "kFALSE" ) << ");" << endl;
     }
     
     // Set output tree (if any)
@@ -1049,6 +1173,12 @@ void AtlAppAnalysisTask::CreateNAFBatchRootScript(Option_t *option) {
     out << "sel->SetPrintObjectTable("
 	<< fPrintObjectTable << ");" << endl;
 
+    // Switch on per-event profiling
+    if ( fEventProfilingNSlowest > 0 ) {
+	out << "sel->SetEventProfiling(" << fEventProfilingNSlowest
+	    << ", \"" << fEventProfilingDumpFile.Data() << "\");" << endl;
+    }
+
     // Set selection cuts
     next_cut.Reset();
     while ( (cut = (TNamed*)next_cut()) ) {
@@ -1073,21 +1203,19 @@ void AtlAppAnalysisTask::CreateNAFBatchRootScript(Option_t *option) {
 	while ( (cut = (AtlToolCut*)next_cut()) ) {
 	  if ( strcmp(tool->GetName(), cut->GetTool().Data()) != 0 ) continue;
 
-	    // Check if cut is a public datamember
-	    TClass *cl = gROOT->GetClass(tool->ClassName());
-	    if ( cl->GetListOfAllPublicDataMembers()
-		 ->FindObject(cut->GetVariable().Data()) == 0 ) {
-		Error("CreateRootScript",
-		      "Given cut \"%s\" is not a public datamember in tool class \"%s\", which is necessary. Abort!",
+	    // Type of the cut (see AtlCutRegistry)
+	    const AtlCutRegistry::Spec *spec =
+		AtlCutRegistry::GetSpec(tool->IsA(), cut->GetVariable().Data());
+	    if ( spec == 0 ) {
+		Error("CreateNAFBatchRootScript",
+		      "Given cut \"%s\" is not a datamember in tool class \"%s\". Abort!",
 		      cut->GetVariable().Data(), tool->ClassName());
 		gSystem->Abort();
 	    }
 
 	    // Set cut value (do this differently for strings)
 	    out << "tool" << i << "->" << cut->GetVariable().Data();
-	    TDataMember *mem = (TDataMember*)cl->GetListOfAllPublicDataMembers()
-	      ->FindObject(cut->GetVariable().Data());
-	    if ( strcmp(mem->GetTrueTypeName(), "TString*") == 0 ) {
+	    if ( spec->fTypeName == "TString*" ) {
 		out << "->Append(\"" << cut->GetVal() << "\");" << endl;
 	    } else {
 		out << " = " << cut->GetVal() << ";" << endl;
@@ -1109,6 +1237,17 @@ void AtlAppAnalysisTask::CreateRunScript(Option_t *option) {
     //
     // Create run script for job submission
     //
+    // Option "DRIVER": run the job description analysis_run.job with
+    // the compiled job driver (see SetJobDriver()) instead of
+    // interpreting analysis_run.C
+    //
+    TString opt = option;
+    TString RunFile = "analysis_run.C";
+    TString RunCmd  = "root -q -l -b analysis_run.C";
+    if ( opt.Contains("DRIVER") ) {
+	RunFile = "analysis_run.job";
+	RunCmd  = Form("%s analysis_run.job", fJobDriver.Data());
+    }
     TString Machine ="as2.b";
     if(fPriority > 40 ){
     	Machine = "as1.b";
@@ -1124,8 +1263,8 @@ void AtlAppAnalysisTask::CreateRunScript(Option_t *option) {
 <<"requirements = regexp( \".*"<<Machine<<".*\", TARGET.Name )"<<endl
 <<"Queue"<<endl;
     
-    ofstream out;
-    out.open(fRunScript->Data());
+    // Assemble the run script in memory and write it in one go
+    ostringstream out;
     out << "#!/bin/sh" << endl
 	<< "# !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!" << endl
 	<< "# !!! This is an automatically generated file !!!" << endl
@@ -1187,20 +1326,20 @@ void AtlAppAnalysisTask::CreateRunScript(Option_t *option) {
     
     if ( fTempOutputPath != 0 && fTempLogFilePath != 0 ) {
 	out << "mkdir -p " << fTempOutputPath->Data() << endl
-	    << "cp " << fJobHome->Data() << "/analysis_run.C " << fTempOutputPath->Data() << endl
+	    << "cp " << fJobHome->Data() << "/" << RunFile.Data() << " " << fTempOutputPath->Data() << endl
 	    << "cd " << fTempOutputPath->Data() << endl
 	    << endl
 	    << "# Remove old Logfiles " << endl
 	    << "rm " << fTempLogFilePath->Data() << endl
 	    << "rm " << fLogFilePath->Data() << endl
-	    << "root -q -l -b analysis_run.C > " << fTempLogFilePath->Data()
+	    << RunCmd.Data() << " > " << fTempLogFilePath->Data()
 	    << " 2>&1" << endl
 	    << "mv " << fTempLogFilePath->Data() << " " << fLogFilePath->Data() << endl
 	    << "chmod g+w -R " << gSystem->DirName(fLogFilePath->Data()) << endl;
     } else {
 	out << "JOBHOME=" << fJobHome->Data() << endl
 	    << "cd $JOBHOME" << endl	
-	    << "root -q -l -b analysis_run.C > " << fLogFilePath->Data()
+	    << RunCmd.Data() << " > " << fLogFilePath->Data()
 	    << " 2>&1" << endl
 	    << "chmod g+w -R " << fLogFilePath->Data() << endl;
     }
@@ -1209,7 +1348,9 @@ void AtlAppAnalysisTask::CreateRunScript(Option_t *option) {
 	out << "mv " << fTempOutputFileName->Data() << " " << fOutputFileName->Data() << endl
 	    << "chmod g+w " << fOutputFileName->Data() << endl;
     
-    out.close();
+    ofstream script(fRunScript->Data());
+    script << out.str();
+    script.close();
 }
 
 //____________________________________________________________________
@@ -1454,14 +1595,14 @@ void AtlAppAnalysisTask::CreateGridRunScript_old() {
     TString cp_cmd("cp ");
     cp_cmd.Append(fRunScript->Data());
     cp_cmd.Append(" ");
-    cp_cmd.Append(gSystem->ExpandPathName("$GRID_HOME"));
+    cp_cmd.Append(ExpandPath("$GRID_HOME"));
     gSystem->Exec(cp_cmd.Data());
 
     cp_cmd.Clear();
     cp_cmd.Append("cp ");
     cp_cmd.Append(fRootScript->Data());
     cp_cmd.Append(" ");
-    cp_cmd.Append(gSystem->ExpandPathName("$GRID_HOME"));
+    cp_cmd.Append(ExpandPath("$GRID_HOME"));
     gSystem->Exec(cp_cmd.Data());
 
 }
@@ -1574,6 +1715,29 @@ void AtlAppAnalysisTask::AddUserEnv(const char* env) {
 
 //____________________________________________________________________
 
+void AtlAppAnalysisTask::SetJobDriver(const char* Driver) {
+    //
+    // Run batch jobs with the given compiled driver instead of
+    // interpreting analysis_run.C (see AtlJobRegistry). The default
+    // is aplusplus-run as installed by build.sh. Environment
+    // variables are expanded here, since the batch jobs neither have
+    // the driver in their PATH nor all A++ variables set. If the
+    // driver cannot be executed, analysis_run.C is used
+    //
+    TString driver = Driver;
+    gSystem->ExpandPathName(driver);
+    if ( gSystem->AccessPathName(driver.Data(), kExecutePermission) ) {
+	Error("SetJobDriver",
+	      "Job driver %s not found or not executable. Run the jobs by interpreting analysis_run.C",
+	      driver.Data());
+	fJobDriver = "";
+	return;
+    }
+    fJobDriver = driver;
+}
+
+//____________________________________________________________________
+
 void AtlAppAnalysisTask::Print( Option_t *option ) const {
     //
     // Print config
@@ -1762,29 +1926,70 @@ void AtlAppAnalysisTask::SetEvtReader(char const * readerClass, char const * rea
 
 //____________________________________________________________________
 
-TDataMember* AtlAppAnalysisTask::FindDataMember(TClass *cl,
-						const char* DMName) const {
+void AtlAppAnalysisTask::ValidateCuts() {
     //
-    // Find data nember of given namen in the given class. If it's not
-    // found inside the given class, all parent classes are searched
-    // recursively.
+    // Check all selector and tool cuts of this task (see
+    // AtlCutRegistry). Abort in case of errors
     //
+    if ( !ValidateCuts(fSelector->Data(), fListOfCuts, fListOfTools,
+		       fListOfToolCuts) ) {
+	Error(__FUNCTION__, "Invalid cuts. Abort!");
+	gSystem->Abort(0);
+    }
+    fCutsValidated = kTRUE;
+}
 
-    // Test given class
-    TDataMember *dm = cl->GetDataMember(DMName);
-    if ( dm != 0 ) return dm;
+//____________________________________________________________________
 
-    // Test list (multiple inheritance) of all parent classes
-    // recursively
-    TClass *cl_base = 0;
-    TNamed *cl_base_name = 0;
-    TIter next_base(cl->GetListOfBases());
-    while ( (cl_base_name = (TNamed*)next_base()) ) {
-	cl_base = (TClass*)gROOT->GetClass(cl_base_name->GetName());
-	dm = FindDataMember(cl_base, DMName);
-	if ( dm != 0 ) return dm;
+Bool_t AtlAppAnalysisTask::ValidateCuts(const char* Selector, TList *Cuts,
+					TList *Tools, TList *ToolCuts,
+					Bool_t Verbose) {
+    //
+    // Check that all cuts exist as public data members of the given
+    // selector class or of their tools and that their values fit the
+    // type of the cut. All errors are printed, kFALSE is returned if
+    // there was any. With Verbose also the cuts which are set via
+    // the interpreter are listed
+    //
+    TClass *sel_cl = TClass::GetClass(Selector);
+    if ( sel_cl == 0 ) {
+	::Error("AtlAppAnalysisTask::ValidateCuts",
+		"Class description for class \"%s\" not found", Selector);
+	return kFALSE;
     }
+    Bool_t ok = kTRUE;
+    TString msg;
 
-    // Not found ?
-    return 0;
+    // Selector cuts
+    TIter next_cut(Cuts);
+    AtlCut *cut = 0;
+    while ( (cut = (AtlCut*)next_cut()) ) {
+	if ( !AtlCutRegistry::Validate(sel_cl, cut->GetVar(), cut->GetVal(), msg) ) {
+	    ::Error("AtlAppAnalysisTask::ValidateCuts", "Selector - %s", msg.Data());
+	    ok = kFALSE;
+	} else if ( Verbose && !msg.IsNull() ) {
+	    ::Info("AtlAppAnalysisTask::ValidateCuts", "Selector - %s", msg.Data());
+	}
+    }
+
+    // Tool cuts
+    TIter next_toolcut(ToolCuts);
+    AtlToolCut *toolcut = 0;
+    while ( (toolcut = (AtlToolCut*)next_toolcut()) ) {
+	TObject *tool = Tools->FindObject(toolcut->GetTool().Data());
+	if ( tool == 0 ) {
+	    ::Error("AtlAppAnalysisTask::ValidateCuts",
+		    "Toolcut - No tool of name \"%s\"", toolcut->GetTool().Data());
+	    ok = kFALSE;
+	    continue;
+	}
+	if ( !AtlCutRegistry::Validate(tool->IsA(), toolcut->GetVariable().Data(),
+				       toolcut->GetVal(), msg) ) {
+	    ::Error("AtlAppAnalysisTask::ValidateCuts", "Toolcut - %s", msg.Data());
+	    ok = kFALSE;
+	} else if ( Verbose && !msg.IsNull() ) {
+	    ::Info("AtlAppAnalysisTask::ValidateCuts", "Toolcut - %s", msg.Data());
+	}
+    }
+    return ok;
 }
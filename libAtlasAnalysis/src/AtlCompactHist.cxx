@@ -0,0 +1,229 @@
+//____________________________________________________________________
+//
+// Compact histogram storage
+//
+// Analysis jobs book one histogram set per systematic variation and
+// per category. Most of these histograms share the same binning and
+// many of them stay (almost) empty. AtlCompactHist keeps only what is
+// needed to fill a histogram:
+//
+//   - the binning is described by an AtlHistBinning which is shared
+//     by all histograms of a tool with identical binning,
+//   - the contents of 1d histograms are kept in single or double
+//     precision,
+//   - the sum of squared weights is stored only once a weight
+//     different from 1 has been filled (as in TH1::Fill()),
+//   - 2d histograms store their filled bins only.
+//
+// The contents are converted into a standard TH1D/TH2D by CopyTo()
+// when the output file is written or the histogram is requested (see
+// AtlHistogramTool). The bin numbering and the statistics (entries,
+// sums of weights and moments) are the same as for TH1/TH2, so the
+// written histograms are identical to directly filled ones, apart
+// from the precision of the contents in single-precision mode.
+//
+// Usage:
+// ======
+// AtlHistBinning *binning = new AtlHistBinning(40, 0., 200.);
+// AtlCompactHist *hc = new AtlCompactHist(binning, kTRUE);
+// hc->Fill(pt, w);
+// ...
+// TH1 *h = binning->CreateHistogram("h_pt", "Pt");
+// hc->CopyTo(h);
+//
+#ifndef ATLAS_AtlCompactHist
+#include <AtlCompactHist.h>
+#endif
+#include <TH1D.h>
+#include <TH2D.h>
+#include <TMath.h>
+
+#ifndef __CINT__
+ClassImp(AtlHistBinning);
+ClassImp(AtlCompactHist);
+#endif
+
+//____________________________________________________________________
+
+AtlHistBinning::AtlHistBinning(Int_t nbinsx, Double_t xlow, Double_t xup,
+			       Int_t nbinsy, Double_t ylow, Double_t yup,
+			       const Double_t *ybins) :
+    TNamed(GetSignature(nbinsx, xlow, xup, nbinsy, ylow, yup, ybins).Data(), ""),
+    fNbinsX(nbinsx), fXlow(xlow), fXup(xup), fNbinsY(nbinsy),
+    fYlow(ylow), fYup(yup) {
+    //
+    // Default constructor
+    //
+    if ( ybins != 0 ) {
+	fYbins.assign(ybins, ybins + nbinsy + 1);
+	fYlow = fYbins.front();
+	fYup  = fYbins.back();
+    }
+}
+
+//____________________________________________________________________
+
+TString AtlHistBinning::GetSignature(Int_t nbinsx, Double_t xlow, Double_t xup,
+				     Int_t nbinsy, Double_t ylow, Double_t yup,
+				     const Double_t *ybins) {
+    //
+    // Unique name of the given binning
+    //
+    TString sig = Form("%d:%.17g:%.17g", nbinsx, xlow, xup);
+    if ( nbinsy > 0 ) {
+	if ( ybins == 0 ) {
+	    sig.Append(Form("|%d:%.17g:%.17g", nbinsy, ylow, yup));
+	} else {
+	    sig.Append(Form("|%d", nbinsy));
+	    for ( Int_t i = 0; i <= nbinsy; i++ )
+		sig.Append(Form(":%.17g", ybins[i]));
+	}
+    }
+    return sig;
+}
+
+//____________________________________________________________________
+
+Int_t AtlHistBinning::FindBinY(Double_t y) const {
+    //
+    // Bin number incl. under- and overflow (same as
+    // TAxis::FindFixBin())
+    //
+    if ( y < fYlow ) return 0;
+    if ( !(y < fYup) ) return fNbinsY+1;
+    if ( fYbins.empty() )
+	return 1 + (Int_t)(fNbinsY*(y-fYlow)/(fYup-fYlow));
+    return 1 + TMath::BinarySearch(fNbinsY+1, fYbins.data(), y);
+}
+
+//____________________________________________________________________
+
+TH1* AtlHistBinning::CreateHistogram(const char* name, const char* title) const {
+    //
+    // Create empty TH1D or TH2D with this binning in the current
+    // directory
+    //
+    if ( fNbinsY == 0 )
+	return new TH1D(name, title, fNbinsX, fXlow, fXup);
+    if ( fYbins.empty() )
+	return new TH2D(name, title, fNbinsX, fXlow, fXup, fNbinsY, fYlow, fYup);
+    return new TH2D(name, title, fNbinsX, fXlow, fXup, fNbinsY, fYbins.data());
+}
+
+//____________________________________________________________________
+
+AtlCompactHist::AtlCompactHist(const AtlHistBinning *binning, Bool_t Float) :
+    fBinning(binning), fFloat(Float), fEntries(0.), fTsumw(0.), fTsumw2(0.),
+    fTsumwx(0.), fTsumwx2(0.), fTsumwy(0.), fTsumwy2(0.), fTsumwxy(0.) {
+    //
+    // Default constructor. The contents of 1d histograms are
+    // allocated at once, 2d histograms store filled bins only
+    //
+    fHasSumw2 = kFALSE;
+    if ( !binning->Is2D() ) {
+	if ( fFloat ) {
+	    fContF.assign(binning->GetNcells(), 0.);
+	} else {
+	    fContD.assign(binning->GetNcells(), 0.);
+	}
+    }
+}
+
+//____________________________________________________________________
+
+void AtlCompactHist::AddBin(Int_t bin, Double_t w) {
+    //
+    // Add weight to the given bin. The sum of squared weights is
+    // created on the first weight different from 1 (see
+    // TH1::Fill())
+    //
+    if ( !fHasSumw2 && w != 1. ) {
+	fHasSumw2 = kTRUE;
+	fSumw2F = fContF;
+	fSumw2D = fContD;
+	fSumw2S = fContS;
+    }
+    if ( fBinning->Is2D() ) {
+	fContS[bin] += w;
+	if ( fHasSumw2 ) fSumw2S[bin] += w*w;
+    } else if ( fFloat ) {
+	fContF[bin] += w;
+	if ( fHasSumw2 ) fSumw2F[bin] += w*w;
+    } else {
+	fContD[bin] += w;
+	if ( fHasSumw2 ) fSumw2D[bin] += w*w;
+    }
+}
+
+//____________________________________________________________________
+
+void AtlCompactHist::Fill(Double_t x, Double_t w) {
+    //
+    // Fill 1d histogram
+    //
+    Int_t bin = fBinning->FindBin(x);
+    fEntries++;
+    AddBin(bin, w);
+    if ( !fBinning->IsInRange(bin) ) return;
+    fTsumw   += w;
+    fTsumw2  += w*w;
+    fTsumwx  += w*x;
+    fTsumwx2 += w*x*x;
+}
+
+//____________________________________________________________________
+
+void AtlCompactHist::Fill(Double_t x, Double_t y, Double_t w) {
+    //
+    // Fill 2d histogram
+    //
+    Int_t bin = fBinning->FindBin(x, y);
+    fEntries++;
+    AddBin(bin, w);
+    if ( !fBinning->IsInRange(bin) ) return;
+    fTsumw   += w;
+    fTsumw2  += w*w;
+    fTsumwx  += w*x;
+    fTsumwx2 += w*x*x;
+    fTsumwy  += w*y;
+    fTsumwy2 += w*y*y;
+    fTsumwxy += w*x*y;
+}
+
+//____________________________________________________________________
+
+void AtlCompactHist::CopyTo(TH1 *h) const {
+    //
+    // Copy contents and statistics to the given (empty) histogram
+    // of the same binning
+    //
+
+    // If the histogram stores the sum of squared weights anyway (eg.
+    // because of TH1::SetDefaultSumw2()), it needs to be filled also
+    // for unit weights, where it equals the contents
+    if ( fHasSumw2 ) h->Sumw2();
+    Bool_t unitw2 = ( !fHasSumw2 && h->GetSumw2N() > 0 );
+    if ( fBinning->Is2D() ) {
+	for ( auto &c : fContS ) {
+	    h->SetBinContent(c.first, c.second);
+	    if ( unitw2 ) h->SetBinError(c.first, TMath::Sqrt(TMath::Abs(c.second)));
+	}
+	if ( fHasSumw2 ) {
+	    for ( auto &e : fSumw2S ) h->SetBinError(e.first, TMath::Sqrt(e.second));
+	}
+    } else {
+	for ( Int_t i = 0; i < fBinning->GetNcells(); i++ ) {
+	    Double_t c = fFloat ? fContF[i] : fContD[i];
+	    h->SetBinContent(i, c);
+	    if ( fHasSumw2 ) {
+		h->SetBinError(i, TMath::Sqrt(fFloat ? fSumw2F[i] : fSumw2D[i]));
+	    } else if ( unitw2 ) {
+		h->SetBinError(i, TMath::Sqrt(TMath::Abs(c)));
+	    }
+	}
+    }
+    Double_t stats[7] = { fTsumw, fTsumw2, fTsumwx, fTsumwx2,
+			  fTsumwy, fTsumwy2, fTsumwxy };
+    h->PutStats(stats);
+    h->SetEntries(fEntries);
+}
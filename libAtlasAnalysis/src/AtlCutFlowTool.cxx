@@ -65,6 +65,7 @@
 #include <AtlCutFlowTool.h>
 #endif
 //#include <AtlSelector.h>
+#include <AtlCutRegistry.h>
 #include <TDirectory.h>
 #include <TObjArray.h>
 #include <TString.h>
@@ -81,11 +82,33 @@ AtlCutFlowTool::AtlCutFlowTool(const char* name, const char* title) :
     fHistCutFlowWeighted   = 0;
     fHistCutFlowUnweighted = 0;
     fOutputStreamers = new TObjArray;
-    fRunEvtOutputList = "";
-    fRunEvtOutputFormat = "%d\t%d";
-    fNBins = 1;
-    fLabelsDeflate = kTRUE;
     fPassedSelection = kFALSE;
+
+    // Cuts and their defaults
+    DeclareCuts();
+    AtlCutRegistry::SetDefaults(this, AtlCutFlowTool::Class());
+}
+
+//____________________________________________________________________
+
+void AtlCutFlowTool::DeclareCuts() {
+    //
+    // Declare the cuts of this tool together with their defaults
+    // (see AtlCutRegistry). Done once for all instances
+    //
+    static Bool_t declared = kFALSE;
+    if ( declared ) return;
+    declared = kTRUE;
+    AtlCutRegistry::Declare("AtlCutFlowTool", "fNBins",
+			    AtlCutRegistry::kInt, "1");
+    AtlCutRegistry::Declare("AtlCutFlowTool", "fLabelsDeflate",
+			    AtlCutRegistry::kBool, "kTRUE");
+    AtlCutRegistry::Declare("AtlCutFlowTool", "fRunEvtOutputList",
+			    AtlCutRegistry::kString);
+    AtlCutRegistry::Declare("AtlCutFlowTool", "fRunEvtOutputFormat",
+			    AtlCutRegistry::kString, "%d\t%d");
+    AtlCutRegistry::Declare("AtlCutFlowTool", "fBinLabels",
+			    AtlCutRegistry::kString);
 }
 
 //____________________________________________________________________
@@ -0,0 +1,599 @@
+//____________________________________________________________________
+//
+// Typed registry of the cuts of A++ selectors and tools
+//
+// Cuts of selectors and analysis tools are public data members which
+// are set by name (AtlAppAnalysisTask::SetCut(), SetToolCut()). This
+// class describes each cut once per class by a Spec (name, type,
+// default, offset or setter) and converts the cut values given as
+// strings into typed values. The specs are taken from the class
+// dictionary the first time a cut of a class is used. Cuts which
+// need a default or a special setter (e.g. members which are not
+// plain data) can be declared explicitly with Declare(); declared
+// cuts are inherited by derived classes, and their defaults are set
+// by SetDefaults() (see AtlCutFlowTool).
+//
+// The cuts are validated once when the task tree is built
+// (AtlTopLevelAnalysis::ValidateCuts()). The batch jobs get the
+// parsed values together with the resolved type and data-member
+// offset as a small binary configuration file (see MakeEntry() and
+// WriteConfig()). It is applied by the compiled job driver (see
+// AtlJobRegistry) without any string parsing or dictionary look-up.
+// The configuration therefore belongs to the build of the libraries
+// it has been written with, like the job scripts themselves.
+//
+// Values which are not literals (C++ expressions) and cuts of other
+// types (e.g. TList*) are kept as strings and set via the
+// interpreter, exactly as in the analysis_run.C script.
+//
+// Usage:
+// ======
+// AtlCutRegistry::Declare("MyTool", "fPtMin", AtlCutRegistry::kFloat, "25.");
+// AtlCutRegistry::SetDefaults(mytool, MyTool::Class());
+// ...
+// TString msg;
+// if ( !AtlCutRegistry::Validate(MyTool::Class(), "fPtMin", "30.", msg) )
+//     Error(__FUNCTION__, "%s", msg.Data());
+//
+#ifndef ATLAS_AtlCutRegistry
+#include <AtlCutRegistry.h>
+#endif
+#include <TClass.h>
+#include <TDataMember.h>
+#include <TDataType.h>
+#include <TEnum.h>
+#include <TEnumConstant.h>
+#include <TError.h>
+#include <TList.h>
+#include <TBaseClass.h>
+#include <TROOT.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlCutRegistry);
+#endif
+
+static const UInt_t gConfigMagic   = 0x41505043; // "APPC"
+static const UInt_t gConfigVersion = 2;
+
+//____________________________________________________________________
+
+map<string, AtlCutRegistry::Spec>& AtlCutRegistry::Declared() {
+    //
+    // Explicitly declared cuts (key = class::cut)
+    //
+    static map<string, Spec> declared;
+    return declared;
+}
+
+//____________________________________________________________________
+
+map<string, AtlCutRegistry::Spec>& AtlCutRegistry::Specs() {
+    //
+    // Specs of all cuts used so far (key = class::cut)
+    //
+    static map<string, Spec> specs;
+    return specs;
+}
+
+//____________________________________________________________________
+
+void AtlCutRegistry::Declare(const char* ClassName, const char* Name,
+			     EType type, const char* Default,
+			     Setter_t setter) {
+    //
+    // Declare cut of the given class. Without setter the cut is set
+    // via the offset of the data member of the same name
+    //
+    Spec spec;
+    spec.fName     = Name;
+    spec.fType     = type;
+    spec.fDataType = ( type == kInt ) ? kInt_t : -1;
+    spec.fTypeName = GetTypeName(type);
+    spec.fDefault  = ( Default != 0 ) ? Default : "";
+    spec.fOffset   = 0;
+    spec.fSetter   = setter;
+    Declared()[Form("%s::%s", ClassName, Name)] = spec;
+
+    // Specs resolved before (also of derived classes) may be outdated
+    Specs().clear();
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::SetDefaults(void *obj, TClass *cl) {
+    //
+    // Set all declared cuts of class cl and its base classes which
+    // have a default value. The object obj must be of class cl.
+    // Returns kFALSE if a default is invalid
+    //
+    Bool_t ok = kTRUE;
+    TIter next_base(cl->GetListOfBases());
+    TBaseClass *base = 0;
+    while ( (base = (TBaseClass*)next_base()) ) {
+	TClass *bcl = base->GetClassPointer();
+	if ( bcl == 0 ) continue;
+	ok = SetDefaults((char*)obj + cl->GetBaseClassOffset(bcl), bcl) && ok;
+    }
+    string prefix = Form("%s::", cl->GetName());
+    for ( map<string, Spec>::const_iterator it = Declared().lower_bound(prefix);
+	  it != Declared().end() && it->first.compare(0, prefix.size(), prefix) == 0;
+	  ++it ) {
+	if ( it->second.fDefault.empty() ) continue;
+	const char* name = it->second.fName.c_str();
+	const Spec *spec = GetSpec(cl, name);
+	Value val;
+	if ( spec == 0 || !Parse(spec, it->second.fDefault.c_str(), val)
+	     || !Apply(obj, cl, name, val) ) {
+	    ::Error("AtlCutRegistry::SetDefaults",
+		    "Cannot set default \"%s\" of cut %s::%s",
+		    it->second.fDefault.c_str(), cl->GetName(), name);
+	    ok = kFALSE;
+	}
+    }
+    return ok;
+}
+
+//____________________________________________________________________
+
+const AtlCutRegistry::Spec* AtlCutRegistry::FindDeclared(TClass *cl,
+							 const char* Name) {
+    //
+    // Find declared cut in the given class or its base classes
+    //
+    map<string, Spec>::const_iterator it =
+	Declared().find(Form("%s::%s", cl->GetName(), Name));
+    if ( it != Declared().end() ) return &it->second;
+    TIter next_base(cl->GetListOfBases());
+    TBaseClass *base = 0;
+    while ( (base = (TBaseClass*)next_base()) ) {
+	if ( base->GetClassPointer() == 0 ) continue;
+	const Spec *spec = FindDeclared(base->GetClassPointer(), Name);
+	if ( spec != 0 ) return spec;
+    }
+    return 0;
+}
+
+//____________________________________________________________________
+
+const AtlCutRegistry::Spec* AtlCutRegistry::GetSpec(TClass *cl,
+						    const char* Name) {
+    //
+    // Spec of the given cut of class cl (0 if there is no such cut)
+    //
+    string key = Form("%s::%s", cl->GetName(), Name);
+    map<string, Spec>::const_iterator it = Specs().find(key);
+    if ( it != Specs().end() ) return &it->second;
+
+    const Spec *decl = FindDeclared(cl, Name);
+    TClass *owner = cl->GetBaseDataMember(Name);
+    TDataMember *mem = ( owner != 0 ) ? owner->GetDataMember(Name) : 0;
+    if ( mem == 0 && ( decl == 0 || decl->fSetter == 0 ) ) return 0;
+
+    Spec spec;
+    if ( decl != 0 ) {
+	spec = *decl;
+    } else {
+	spec.fName     = Name;
+	spec.fType     = kOther;
+	spec.fDataType = -1;
+	spec.fTypeName = mem->GetTrueTypeName();
+	spec.fSetter   = 0;
+    }
+    spec.fOffset = ( mem != 0 ) ? cl->GetDataMemberOffset(Name) : 0;
+    if ( decl == 0 && spec.fOffset > 0 && mem->GetArrayDim() == 0 ) {
+	TDataType *dt = mem->IsBasic() ? mem->GetDataType() : 0;
+	if ( mem->IsEnum() ) {
+	    spec.fType     = kEnum;
+	    spec.fTypeName = mem->GetTypeName();
+	} else if ( dt != 0 && !mem->IsaPointer() ) {
+	    switch ( dt->GetType() ) {
+		case kBool_t:
+		    spec.fType = kBool; break;
+		case kChar_t: case kUChar_t: case kShort_t: case kUShort_t:
+		case kInt_t: case kUInt_t: case kLong_t: case kULong_t:
+		case kLong64_t: case kULong64_t:
+		    spec.fType = kInt;
+		    spec.fDataType = dt->GetType();
+		    break;
+		case kFloat_t: case kFloat16_t:
+		    spec.fType = kFloat; break;
+		case kDouble_t: case kDouble32_t:
+		    spec.fType = kDouble; break;
+		default:
+		    break;
+	    }
+	} else if ( spec.fTypeName == "TString" ) {
+	    spec.fType = kString;
+	} else if ( spec.fTypeName == "TString*" ) {
+	    spec.fType = kStringAppend;
+	}
+    }
+    return &(Specs()[key] = spec);
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::Parse(const Spec *spec, const char* Text,
+			     Value &val) {
+    //
+    // Convert the given cut value (as written in a C++ statement) into
+    // a typed value. Expressions are kept as string (type kOther).
+    // Returns kFALSE if the value is invalid
+    //
+    TString t = TString(Text).Strip(TString::kBoth);
+    TString s = t;
+    if ( s.Length() > 1 && s.BeginsWith("\"") && s.EndsWith("\"") )
+	s = s(1, s.Length()-2);
+    val.fType = spec->fType;
+    val.fInt  = 0;
+    val.fReal = 0.;
+    val.fStr  = "";
+
+    switch ( spec->fType ) {
+	case kBool:
+	case kInt:
+	case kFloat:
+	case kDouble: {
+	    if ( t == "kTRUE" || t == "true" ) {
+		val.fInt = 1; val.fReal = 1.;
+		return kTRUE;
+	    }
+	    if ( t == "kFALSE" || t == "false" ) return kTRUE;
+	    char *end = 0;
+	    val.fReal = strtod(t.Data(), &end);
+	    while ( end != 0 && *end != '\0' && strchr("fFlLuU", *end) ) end++;
+	    if ( end != t.Data() && end != 0 && *end == '\0' ) {
+		val.fInt = ( t.IsDec() ) ? strtoll(t.Data(), 0, 10)
+		    : (Long64_t)val.fReal;
+		return kTRUE;
+	    }
+	    // Not a literal
+	    val.fType = kOther;
+	    val.fStr  = t.Data();
+	    return kTRUE;
+	}
+	case kEnum: {
+	    if ( t.IsDec() ) {
+		val.fInt = t.Atoll();
+		return kTRUE;
+	    }
+	    TEnum *en = TEnum::GetEnum(spec->fTypeName.c_str());
+	    TString cname = t(t.Last(':')+1, t.Length());
+	    TEnumConstant *c = ( en != 0 )
+		? (TEnumConstant*)en->GetConstant(cname.Data()) : 0;
+	    if ( c != 0 ) {
+		val.fInt = c->GetValue();
+		return kTRUE;
+	    }
+	    // Unknown constant (error) or expression
+	    Bool_t IsName = kTRUE;
+	    for ( Ssiz_t i = 0; i < t.Length(); i++ ) {
+		if ( !isalnum(t[i]) && t[i] != '_' && t[i] != ':' ) IsName = kFALSE;
+	    }
+	    if ( IsName ) return kFALSE;
+	    val.fType = kOther;
+	    val.fStr  = t.Data();
+	    return kTRUE;
+	}
+	case kString:
+	case kStringAppend:
+	    val.fStr = s.Data();
+	    return kTRUE;
+	default:
+	    val.fStr = t.Data();
+	    return kTRUE;
+    }
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::Validate(TClass *cl, const char* Name,
+				const char* Text, TString &Message) {
+    //
+    // Check that the given cut exists in class cl, can be set and
+    // that the value fits its type. In case of errors kFALSE is
+    // returned together with an error message. Values which are set
+    // via the interpreter are accepted, but reported by the message.
+    //
+    // The result is kept, i.e. each cut value is checked only once,
+    // regardless of the number of tasks using it
+    //
+    static map<string, pair<Bool_t, string> > results;
+    string key = Form("%s::%s=%s", cl->GetName(), Name, Text);
+    map<string, pair<Bool_t, string> >::const_iterator it = results.find(key);
+    if ( it != results.end() ) {
+	Message = it->second.second.c_str();
+	return it->second.first;
+    }
+    Bool_t ok = CheckCut(cl, Name, Text, Message);
+    results[key] = make_pair(ok, string(Message.Data()));
+    return ok;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::CheckCut(TClass *cl, const char* Name,
+				const char* Text, TString &Message) {
+    //
+    // Check the given cut (see Validate())
+    //
+    Message = "";
+    const Spec *spec = GetSpec(cl, Name);
+    if ( spec == 0 ) {
+	Message = Form("Data member of name \"%s\" does not exist in class %s",
+		       Name, cl->GetName());
+	return kFALSE;
+    }
+    if ( spec->fSetter == 0 ) {
+	TDataMember *mem = cl->GetBaseDataMember(Name)->GetDataMember(Name);
+	if ( (mem->Property() & kIsPublic) == 0 ) {
+	    Message = Form("Cut \"%s\" is not a public data member of class %s",
+			   Name, cl->GetName());
+	    return kFALSE;
+	}
+    }
+    Value val;
+    if ( !Parse(spec, Text, val) ) {
+	Message = Form("Invalid value \"%s\" for cut %s::%s of type %s",
+		       Text, cl->GetName(), Name, spec->fTypeName.c_str());
+	return kFALSE;
+    }
+    if ( val.fType == kOther ) {
+	Message = Form("Cut %s::%s = %s is set via the interpreter",
+		       cl->GetName(), Name, Text);
+    }
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::Apply(void *obj, TClass *cl, const char* Name,
+			     const Value &val) {
+    //
+    // Set the given cut of the object obj (of class cl or derived)
+    //
+    const Spec *spec = GetSpec(cl, Name);
+    if ( spec == 0 ) {
+	::Error("AtlCutRegistry::Apply", "Class %s has no cut %s",
+		cl->GetName(), Name);
+	return kFALSE;
+    }
+    if ( spec->fSetter != 0 ) {
+	(spec->fSetter)(obj, val);
+	return kTRUE;
+    }
+    if ( val.fType != kOther
+	 && Store((char*)obj + spec->fOffset, spec->fType, spec->fDataType, val) )
+	return kTRUE;
+
+    // Everything else via the interpreter, with the same semantics
+    // as in analysis_run.C
+    TString cmd = Form("((%s*)%p)->%s", cl->GetName(), obj, Name);
+    if ( spec->fTypeName == "TString*" ) {
+	cmd.Append(Form("->Append(\"%s\");", val.fStr.c_str()));
+    } else if ( spec->fTypeName == "TList*" ) {
+	cmd.Append(Form("->Add(%s);", val.fStr.c_str()));
+    } else {
+	cmd.Append(Form(" = %s;", val.fStr.c_str()));
+    }
+    ::Info("AtlCutRegistry::Apply", "Set %s::%s = %s via the interpreter",
+	   cl->GetName(), Name, val.fStr.c_str());
+    Int_t err = 0;
+    gROOT->ProcessLine(cmd.Data(), &err);
+    return ( err == 0 );
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::Store(char *addr, EType type, Int_t DataType,
+			     const Value &val) {
+    //
+    // Store the given value at the address of a data member of the
+    // given type. Returns kFALSE if the value has to be set via the
+    // interpreter
+    //
+    switch ( type ) {
+	case kBool:
+	    *(Bool_t*)addr = ( val.fReal != 0. );
+	    return kTRUE;
+	case kInt:
+	    switch ( DataType ) {
+		case kChar_t:    *(Char_t*)addr    = val.fInt; break;
+		case kUChar_t:   *(UChar_t*)addr   = val.fInt; break;
+		case kShort_t:   *(Short_t*)addr   = val.fInt; break;
+		case kUShort_t:  *(UShort_t*)addr  = val.fInt; break;
+		case kUInt_t:    *(UInt_t*)addr    = val.fInt; break;
+		case kLong_t:    *(Long_t*)addr    = val.fInt; break;
+		case kULong_t:   *(ULong_t*)addr   = val.fInt; break;
+		case kLong64_t:  *(Long64_t*)addr  = val.fInt; break;
+		case kULong64_t: *(ULong64_t*)addr = val.fInt; break;
+		default:         *(Int_t*)addr     = val.fInt;
+	    }
+	    return kTRUE;
+	case kFloat:
+	    *(Float_t*)addr = val.fReal;
+	    return kTRUE;
+	case kDouble:
+	    *(Double_t*)addr = val.fReal;
+	    return kTRUE;
+	case kEnum:
+	    *(Int_t*)addr = val.fInt;
+	    return kTRUE;
+	case kString:
+	    *(TString*)addr = val.fStr.c_str();
+	    return kTRUE;
+	case kStringAppend:
+	    if ( *(TString**)addr != 0 ) {
+		(*(TString**)addr)->Append(val.fStr.c_str());
+		return kTRUE;
+	    }
+	    // No string object yet, leave it to the interpreter
+	default:
+	    break;
+    }
+    return kFALSE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::MakeEntry(TClass *cl, Int_t Target, const char* Name,
+				 const char* Text, Entry &entry) {
+    //
+    // Convert the given cut value into a configuration entry. Type
+    // and offset of the data member are resolved here, such that the
+    // job can set the cut without any dictionary look-up (see
+    // Apply(void*, TClass*, const Entry&)). Returns kFALSE if the cut
+    // does not exist or the value is invalid
+    //
+    const Spec *spec = GetSpec(cl, Name);
+    if ( spec == 0 || !Parse(spec, Text, entry.fValue) ) return kFALSE;
+    entry.fTarget   = Target;
+    entry.fMember   = Name;
+    entry.fClass    = cl->GetName();
+    entry.fCutType  = spec->fType;
+    entry.fDataType = spec->fDataType;
+    // Setters and interpreted values are resolved in the job
+    entry.fOffset   = ( spec->fSetter == 0 && entry.fValue.fType != kOther )
+	? spec->fOffset : -1;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::Apply(void *obj, TClass *cl, const Entry &entry) {
+    //
+    // Set the cut of the given configuration entry (see MakeEntry())
+    // for the object obj of class cl. The resolved offset is used
+    // directly; the spec is looked up only for cuts set via a setter
+    // or the interpreter
+    //
+    if ( entry.fClass != cl->GetName() ) {
+	::Error("AtlCutRegistry::Apply",
+		"Cut %s has been configured for class %s, but the target is of class %s",
+		entry.fMember.c_str(), entry.fClass.c_str(), cl->GetName());
+	return kFALSE;
+    }
+    if ( entry.fOffset >= 0
+	 && Store((char*)obj + entry.fOffset, entry.fCutType,
+		  entry.fDataType, entry.fValue) )
+	return kTRUE;
+    return Apply(obj, cl, entry.fMember.c_str(), entry.fValue);
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::WriteConfig(const char* File,
+				   const vector<Entry> &entries) {
+    //
+    // Write the given cut values into a binary configuration file
+    //
+    ofstream out(File, ios::binary);
+    if ( !out ) {
+	::Error("AtlCutRegistry::WriteConfig", "Cannot open %s", File);
+	return kFALSE;
+    }
+    UInt_t n = entries.size();
+    out.write((const char*)&gConfigMagic, sizeof(UInt_t));
+    out.write((const char*)&gConfigVersion, sizeof(UInt_t));
+    out.write((const char*)&n, sizeof(UInt_t));
+    for ( UInt_t i = 0; i < n; i++ ) {
+	const Entry &e = entries[i];
+	UChar_t type = e.fValue.fType;
+	UInt_t len = e.fMember.size();
+	out.write((const char*)&e.fTarget, sizeof(Int_t));
+	out.write((const char*)&type, sizeof(UChar_t));
+	out.write((const char*)&len, sizeof(UInt_t));
+	out.write(e.fMember.data(), len);
+	out.write((const char*)&e.fValue.fInt, sizeof(Long64_t));
+	out.write((const char*)&e.fValue.fReal, sizeof(Double_t));
+	len = e.fValue.fStr.size();
+	out.write((const char*)&len, sizeof(UInt_t));
+	out.write(e.fValue.fStr.data(), len);
+	UChar_t cuttype = e.fCutType;
+	Long64_t offset = e.fOffset;
+	len = e.fClass.size();
+	out.write((const char*)&len, sizeof(UInt_t));
+	out.write(e.fClass.data(), len);
+	out.write((const char*)&cuttype, sizeof(UChar_t));
+	out.write((const char*)&e.fDataType, sizeof(Int_t));
+	out.write((const char*)&offset, sizeof(Long64_t));
+    }
+    return out.good();
+}
+
+//____________________________________________________________________
+
+Bool_t AtlCutRegistry::ReadConfig(const char* File, vector<Entry> &entries) {
+    //
+    // Read cut values from a binary configuration file written by
+    // WriteConfig()
+    //
+    entries.clear();
+    ifstream in(File, ios::binary);
+    UInt_t magic = 0, version = 0, n = 0;
+    in.read((char*)&magic, sizeof(UInt_t));
+    in.read((char*)&version, sizeof(UInt_t));
+    in.read((char*)&n, sizeof(UInt_t));
+    if ( !in || magic != gConfigMagic || version != gConfigVersion ) {
+	::Error("AtlCutRegistry::ReadConfig",
+		"%s is not a valid A++ configuration file", File);
+	return kFALSE;
+    }
+    entries.resize(n);
+    for ( UInt_t i = 0; i < n && in; i++ ) {
+	Entry &e = entries[i];
+	UChar_t type = 0;
+	UInt_t len = 0;
+	in.read((char*)&e.fTarget, sizeof(Int_t));
+	in.read((char*)&type, sizeof(UChar_t));
+	in.read((char*)&len, sizeof(UInt_t));
+	e.fMember.resize(len);
+	in.read(&e.fMember[0], len);
+	e.fValue.fType = (EType)type;
+	in.read((char*)&e.fValue.fInt, sizeof(Long64_t));
+	in.read((char*)&e.fValue.fReal, sizeof(Double_t));
+	in.read((char*)&len, sizeof(UInt_t));
+	e.fValue.fStr.resize(len);
+	if ( len > 0 ) in.read(&e.fValue.fStr[0], len);
+	UChar_t cuttype = 0;
+	Long64_t offset = -1;
+	in.read((char*)&len, sizeof(UInt_t));
+	e.fClass.resize(len);
+	if ( len > 0 ) in.read(&e.fClass[0], len);
+	in.read((char*)&cuttype, sizeof(UChar_t));
+	in.read((char*)&e.fDataType, sizeof(Int_t));
+	in.read((char*)&offset, sizeof(Long64_t));
+	e.fCutType = (EType)cuttype;
+	e.fOffset  = offset;
+    }
+    if ( !in ) {
+	::Error("AtlCutRegistry::ReadConfig", "%s is truncated", File);
+	entries.clear();
+	return kFALSE;
+    }
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+const char* AtlCutRegistry::GetTypeName(EType type) {
+    //
+    // Name of the given cut type
+    //
+    switch ( type ) {
+	case kBool:         return "Bool_t";
+	case kInt:          return "Int_t";
+	case kFloat:        return "Float_t";
+	case kDouble:       return "Double_t";
+	case kEnum:         return "enum";
+	case kString:       return "TString";
+	case kStringAppend: return "TString*";
+	default:            return "other";
+    }
+}
@@ -54,6 +54,7 @@ AtlDataMCPlotterTask::AtlDataMCPlotterTask(const char* name,
     fUseOverflowUnderflow    = kFALSE;
     fDrawSignalOverlay       = kFALSE;
     fScaleOverlay            = 1.;
+    fIncremental             = kFALSE;
     
     SetBatchNodeAll(kTRUE);
     
@@ -252,6 +253,9 @@ void AtlDataMCPlotterTask::CreateRootScript(Option_t *option) {
     } else {
 	out << "pl->SetDrawSignificance(kFALSE);" << endl;
     }
+    if ( fIncremental ) {
+	out << "pl->SetIncremental(kTRUE);" << endl;
+    }
     
     // Add ntuple plot commands (if any)
     if ( fNtuplePlotCmds->GetEntries() > 0 ) {
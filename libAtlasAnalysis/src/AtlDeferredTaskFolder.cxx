@@ -0,0 +1,89 @@
+//____________________________________________________________________
+//
+// Folder of analysis tasks created on demand
+//
+// AtlTopLevelAnalysis::BuildTree() creates one such folder per jet
+// bin, lepton channel and systematic instead of all analysis tasks
+// up front. The folder keeps only the parameters of its tasks. The
+// tasks themselves (incl. the status check of already finished jobs)
+// are created by AtlTopLevelAnalysis::BuildAnalysisTasks() when the
+// folder is executed or opened in the browser, so only the parts of
+// the task tree which are actually submitted are materialised.
+//
+// The tasks are created with the configuration of the top-level
+// analysis at that time.
+//
+// Usage:
+// ======
+// AtlDeferredTaskFolder *folder = new AtlDeferredTaskFolder("NOMINAL", "NOMINAL",
+//                                                           this, jetbin, lep, syst);
+// ParentTask->Add(folder);
+// ...
+// folder->ExecuteTask(); // creates and executes the tasks
+//
+#ifndef ATLAS_AtlDeferredTaskFolder
+#include <AtlDeferredTaskFolder.h>
+#endif
+#include <AtlTopLevelAnalysis.h>
+#include <TBrowser.h>
+
+#ifndef __CINT__
+ClassImp(AtlDeferredTaskFolder);
+#endif
+
+//____________________________________________________________________
+
+AtlDeferredTaskFolder::AtlDeferredTaskFolder(const char* name,
+					     const char* title,
+					     AtlTopLevelAnalysis *TopLevel,
+					     Int_t Jetbin, Int_t LepChannel,
+					     Int_t Systematic) :
+    TTask(name, title) {
+    //
+    // Default constructor
+    //
+    fTopLevel   = TopLevel;
+    fJetbin     = Jetbin;
+    fLepChannel = LepChannel;
+    fSystematic = Systematic;
+    fIsBuilt    = kFALSE;
+}
+
+//____________________________________________________________________
+
+AtlDeferredTaskFolder::~AtlDeferredTaskFolder() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlDeferredTaskFolder::BuildTasks() {
+    //
+    // Create the analysis tasks of this folder (once)
+    //
+    if ( fIsBuilt ) return;
+    fIsBuilt = kTRUE;
+    fTopLevel->BuildAnalysisTasks(this, fJetbin, fLepChannel, fSystematic);
+}
+
+//____________________________________________________________________
+
+void AtlDeferredTaskFolder::Exec(Option_t*) {
+    //
+    // Create the tasks. They are executed afterwards by
+    // TTask::ExecuteTask(s)
+    //
+    BuildTasks();
+}
+
+//____________________________________________________________________
+
+void AtlDeferredTaskFolder::Browse(TBrowser *b) {
+    //
+    // Create the tasks to be shown in the browser
+    //
+    BuildTasks();
+    TTask::Browse(b);
+}
@@ -0,0 +1,319 @@
+//____________________________________________________________________
+//
+// Compact index of selected events
+//
+// Binary replacement for the TEntryList written by the AtlSelector
+// (see AtlSelector::SetWriteEventIndex()). For every input file the
+// index keeps the total number of tree entries and the sorted list of
+// selected local entries, run-length encoded as [first,last]
+// ranges. In addition the (run, event) key of every selected entry is
+// stored in entry order, so that a list can be cross-checked against
+// its input or re-matched by run/event number.
+//
+// A job reading the index (AtlSelector::SetInputEventIndex()) hands
+// the ranges to the input chain as TEntryList and restricts the tree
+// cache of each input file to the span of its selected entries. Only
+// the clusters and baskets containing selected events are read.
+//
+// Usage:
+// ======
+// TFile *f = TFile::Open("selected.root");
+// AtlEventIndex *index = AtlEventIndex::Read(f);
+// index->Print();
+// sel->SetInputEventIndex(index);
+//
+#ifndef ATLAS_AtlEventIndex
+#include <AtlEventIndex.h>
+#endif
+#include <TEntryList.h>
+#include <TFile.h>
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlEventIndex);
+#endif
+
+//____________________________________________________________________
+
+AtlEventIndex::AtlEventIndex() :
+    TNamed() {
+    //
+    // Default constructor
+    //
+    fCurrentFile = -1;
+    fFileRanges.push_back(0);
+}
+
+//____________________________________________________________________
+
+AtlEventIndex::AtlEventIndex(const char* name, const char* title) :
+    TNamed(name, title) {
+    //
+    // Normal constructor
+    //
+    fCurrentFile = -1;
+    fFileRanges.push_back(0);
+}
+
+//____________________________________________________________________
+
+AtlEventIndex::~AtlEventIndex() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlEventIndex::BeginFile(const char* FileName, Long64_t NEntries) {
+    //
+    // Start a new input file. All subsequent entries given to Enter()
+    // are local entries of this file. If the file is already known
+    // (eg. when the selector re-opens a file), the index switches back
+    // to it; new entries then have to be larger than the ones stored
+    // so far.
+    //
+    if ( SetCurrentFile(FileName) ) return;
+    fFileNames.push_back(FileName);
+    fFileEntries.push_back(NEntries);
+    fFileRanges.push_back(fFileRanges.back());
+    fCurrentFile = fFileNames.size() - 1;
+}
+
+//____________________________________________________________________
+
+void AtlEventIndex::Enter(Long64_t entry, UInt_t RunNr, ULong64_t EventNr) {
+    //
+    // Add local entry of the current input file. Consecutive entries
+    // are merged into a single range.
+    //
+    if ( fCurrentFile < 0 ) {
+	Error("Enter", "No input file given. Use BeginFile() first.");
+	return;
+    }
+    if ( fCurrentFile != GetNFiles() - 1 ) {
+	Error("Enter",
+	      "Entries can be added only to the last input file (%s). Skip entry %lld.",
+	      fFileNames.back().c_str(), entry);
+	return;
+    }
+    Int_t first = fFileRanges[fCurrentFile];
+    Int_t last  = fFileRanges[fCurrentFile+1];
+    if ( last > first ) {
+	if ( entry <= fRangeLast[last-1] ) {
+	    Error("Enter", "Entries must be given in ascending order. Skip entry %lld.",
+		  entry);
+	    return;
+	}
+	if ( entry == fRangeLast[last-1] + 1 ) {
+	    fRangeLast[last-1] = entry;
+	    fRunNr.push_back(RunNr);
+	    fEventNr.push_back(EventNr);
+	    return;
+	}
+    }
+    fRangeFirst.push_back(entry);
+    fRangeLast.push_back(entry);
+    fFileRanges[fCurrentFile+1]++;
+    fRunNr.push_back(RunNr);
+    fEventNr.push_back(EventNr);
+}
+
+//____________________________________________________________________
+
+void AtlEventIndex::Add(const AtlEventIndex *list) {
+    //
+    // Append the given index (eg. from a different job). Files
+    // contained in both indices are not merged, the new ranges are
+    // appended to the end.
+    //
+    for ( Int_t i = 0; i < list->GetNFiles(); i++ ) {
+	if ( FindFile(list->GetFileName(i)) >= 0 ) {
+	    Warning("Add", "Input file %s is already contained in index. Skip.",
+		    list->GetFileName(i));
+	    continue;
+	}
+	fFileNames.push_back(list->fFileNames[i]);
+	fFileEntries.push_back(list->fFileEntries[i]);
+	Int_t first = list->fFileRanges[i];
+	Int_t last  = list->fFileRanges[i+1];
+	fRangeFirst.insert(fRangeFirst.end(),
+			   list->fRangeFirst.begin() + first,
+			   list->fRangeFirst.begin() + last);
+	fRangeLast.insert(fRangeLast.end(),
+			  list->fRangeLast.begin() + first,
+			  list->fRangeLast.begin() + last);
+	fFileRanges.push_back(fFileRanges.back() + last - first);
+
+	// Entries of the file inside the run/event arrays
+	Long64_t offset = 0;
+	for ( Int_t r = 0; r < first; r++ )
+	    offset += list->fRangeLast[r] - list->fRangeFirst[r] + 1;
+	Long64_t n = 0;
+	for ( Int_t r = first; r < last; r++ )
+	    n += list->fRangeLast[r] - list->fRangeFirst[r] + 1;
+	fRunNr.insert(fRunNr.end(), list->fRunNr.begin() + offset,
+		      list->fRunNr.begin() + offset + n);
+	fEventNr.insert(fEventNr.end(), list->fEventNr.begin() + offset,
+			list->fEventNr.begin() + offset + n);
+    }
+    fCurrentFile = -1;
+}
+
+//____________________________________________________________________
+
+Int_t AtlEventIndex::FindFile(const char* FileName) const {
+    //
+    // Find index of the given input file (-1 if not found). Only the
+    // full file name is compared, since the entry numbers are valid
+    // for the very same file only
+    //
+    for ( Int_t i = 0; i < GetNFiles(); i++ ) {
+	if ( fFileNames[i] == FileName ) return i;
+    }
+    return -1;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlEventIndex::SetCurrentFile(const char* FileName) {
+    //
+    // Set current input file for subsequent calls of Contains(entry).
+    // Returns kFALSE if the file is not contained in the index.
+    //
+    fCurrentFile = FindFile(FileName);
+    return ( fCurrentFile >= 0 );
+}
+
+//____________________________________________________________________
+
+Bool_t AtlEventIndex::Contains(Long64_t entry) const {
+    //
+    // Is the given local entry of the current file selected ?
+    // (binary search over the sorted ranges of the file)
+    //
+    if ( fCurrentFile < 0 ) return kFALSE;
+    vector<Long64_t>::const_iterator begin = fRangeLast.begin()
+	+ fFileRanges[fCurrentFile];
+    vector<Long64_t>::const_iterator end = fRangeLast.begin()
+	+ fFileRanges[fCurrentFile+1];
+    vector<Long64_t>::const_iterator it = lower_bound(begin, end, entry);
+    if ( it == end ) return kFALSE;
+    return ( fRangeFirst[it - fRangeLast.begin()] <= entry );
+}
+
+//____________________________________________________________________
+
+Bool_t AtlEventIndex::Contains(const char* FileName, Long64_t entry) {
+    //
+    // Is the given local entry of the given input file selected ?
+    //
+    if ( fCurrentFile < 0 || fFileNames[fCurrentFile] != FileName )
+	SetCurrentFile(FileName);
+    return Contains(entry);
+}
+
+//____________________________________________________________________
+
+Long64_t AtlEventIndex::GetFirstEntry(Int_t file) const {
+    //
+    // First selected local entry of the given file (-1 if none)
+    //
+    if ( fFileRanges[file+1] == fFileRanges[file] ) return -1;
+    return fRangeFirst[fFileRanges[file]];
+}
+
+//____________________________________________________________________
+
+Long64_t AtlEventIndex::GetLastEntry(Int_t file) const {
+    //
+    // Last selected local entry of the given file (-1 if none)
+    //
+    if ( fFileRanges[file+1] == fFileRanges[file] ) return -1;
+    return fRangeLast[fFileRanges[file+1]-1];
+}
+
+//____________________________________________________________________
+
+TEntryList* AtlEventIndex::MakeEntryList(const char* TreeName) const {
+    //
+    // Convert the index into a TEntryList which can be applied to a
+    // chain of the given tree name (see TChain::SetEntryList()).
+    // The list is owned by the caller.
+    //
+    TEntryList *list = new TEntryList(GetName(), GetTitle());
+    list->SetDirectory(0);
+    for ( Int_t i = 0; i < GetNFiles(); i++ ) {
+	TEntryList sub("", "", TreeName, GetFileName(i));
+	sub.SetDirectory(0);
+	for ( Int_t r = fFileRanges[i]; r < fFileRanges[i+1]; r++ ) {
+	    for ( Long64_t entry = fRangeFirst[r]; entry <= fRangeLast[r];
+		  entry++ ) {
+		sub.Enter(entry);
+	    }
+	}
+	list->Add(&sub);
+    }
+    return list;
+}
+
+//____________________________________________________________________
+
+void AtlEventIndex::Clear(Option_t *option) {
+    //
+    // Remove all entries
+    //
+    fFileNames.clear();
+    fFileEntries.clear();
+    fFileRanges.clear();
+    fFileRanges.push_back(0);
+    fRangeFirst.clear();
+    fRangeLast.clear();
+    fRunNr.clear();
+    fEventNr.clear();
+    fCurrentFile = -1;
+}
+
+//____________________________________________________________________
+
+void AtlEventIndex::Print(Option_t *option) const {
+    //
+    // Print summary of the index. Use option "all" for printing all
+    // entry ranges as well
+    //
+    TString opt = option;
+    opt.ToLower();
+    cout << endl
+	 << "Event index \"" << GetName() << "\": "
+	 << GetN() << " entries in " << GetNRanges() << " ranges from "
+	 << GetNFiles() << " input files" << endl;
+    for ( Int_t i = 0; i < GetNFiles(); i++ ) {
+	Long64_t n = 0;
+	for ( Int_t r = fFileRanges[i]; r < fFileRanges[i+1]; r++ )
+	    n += fRangeLast[r] - fRangeFirst[r] + 1;
+	cout << "  " << GetFileName(i) << " : " << n << "/"
+	     << fFileEntries[i] << " entries" << endl;
+	if ( opt.Contains("all") ) {
+	    for ( Int_t r = fFileRanges[i]; r < fFileRanges[i+1]; r++ ) {
+		cout << "    [" << fRangeFirst[r] << ", "
+		     << fRangeLast[r] << "]" << endl;
+	    }
+	}
+    }
+    cout << endl;
+}
+
+//____________________________________________________________________
+
+AtlEventIndex* AtlEventIndex::Read(TFile *file, const char* name) {
+    //
+    // Read event index from the given file. The returned object is
+    // owned by the caller. Returns 0 if no index is found.
+    //
+    AtlEventIndex *index = 0;
+    file->GetObject(name, index);
+    return index;
+}
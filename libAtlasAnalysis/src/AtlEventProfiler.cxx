@@ -0,0 +1,316 @@
+//____________________________________________________________________
+//
+// Per-event processing time profile of the A++ event loop
+//
+// Optional timing hook of AtlSelector::Process() (see
+// AtlSelector::SetEventProfiling()). The selector marks the end of
+// each processing stage (reading, systematics, object definition,
+// scale factors, pre-analysis, main analysis, selection/filling,
+// post-analysis). The profiler fills one log-scaled processing-time
+// histogram per stage plus one for the whole event into the folder
+// "EventProfile" of the output file and keeps the N slowest events
+// (run, event, input file and entry) together with their stage
+// breakdown.
+//
+// At the end of the job the profiler itself is stored in the output
+// file ("app_eventprofile") and the slowest events can be copied into
+// a small file with the same tree structure as the input for offline
+// profiling (DumpSlowEvents()).
+//
+// Usage:
+// ======
+// sel->SetEventProfiling(20, "slow_events.root");
+// ...
+// TFile *f = TFile::Open("output.root");
+// AtlEventProfiler *prof = (AtlEventProfiler*)f->Get("app_eventprofile");
+// prof->Print();
+//
+#ifndef ATLAS_AtlEventProfiler
+#include <AtlEventProfiler.h>
+#endif
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TMath.h>
+#include <TTree.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlEventProfiler);
+#endif
+
+//____________________________________________________________________
+
+AtlEventProfiler::AtlEventProfiler(const char* name, const char* title,
+				   Int_t NSlowest) :
+    TNamed(name, title) {
+    //
+    // Default constructor
+    //
+    fNSlowest = NSlowest;
+    for ( Int_t i = 0; i <= kNStages; i++ ) fHistTime[i] = 0;
+    Clear();
+}
+
+//____________________________________________________________________
+
+AtlEventProfiler::~AtlEventProfiler() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::BookHistograms(TDirectory *dir) {
+    //
+    // Book the processing-time histograms in the folder
+    // "EventProfile" of the given directory. The bins are equidistant
+    // in log10(t/s) from 1 us to 100 s
+    //
+    const Int_t nbins = 80;
+    Double_t edges[nbins+1];
+    for ( Int_t i = 0; i <= nbins; i++ ) {
+	edges[i] = TMath::Power(10., -6. + 8.*i/nbins);
+    }
+
+    TDirectory *savdir = gDirectory;
+    dir->cd();
+    gDirectory->mkdir("EventProfile", "Per-event processing time");
+    gDirectory->cd("EventProfile");
+    for ( Int_t i = 0; i <= kNStages; i++ ) {
+	fHistTime[i] = new TH1F(Form("time_%s", GetStageName(i)),
+				Form("Processing time per event (%s)", GetStageName(i)),
+				nbins, edges);
+	fHistTime[i]->SetXTitle("t (s)");
+	fHistTime[i]->SetYTitle("Number of Events");
+    }
+    savdir->cd();
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::BeginEvent() {
+    //
+    // Start timing of a new event
+    //
+    fT0 = fTLast = Now();
+    for ( Int_t i = 0; i < kNStages; i++ ) fStageTime[i] = -1.;
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::Mark(EStage stage) {
+    //
+    // Mark the end of the given stage. The time since the previous
+    // mark (or the begin of the event) is booked for this stage
+    //
+    Double_t t = Now();
+    fStageTime[stage] = t - fTLast;
+    fTLast = t;
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::EndEvent(UInt_t RunNr, ULong64_t EventNr,
+				Long64_t Entry, TTree *CurrentTree) {
+    //
+    // Finish timing of the current event. Stages which have not been
+    // reached (event rejected before) are not filled
+    //
+    Double_t total = Now() - fT0;
+    fNEvents++;
+    for ( Int_t i = 0; i < kNStages; i++ ) {
+	if ( fStageTime[i] < 0. ) continue;
+	fSumTime[i] += fStageTime[i];
+	if ( fStageTime[i] > fMaxTime[i] ) fMaxTime[i] = fStageTime[i];
+	if ( fHistTime[i] != 0 ) fHistTime[i]->Fill(fStageTime[i]);
+    }
+    fSumTime[kNStages] += total;
+    if ( total > fMaxTime[kNStages] ) fMaxTime[kNStages] = total;
+    if ( fHistTime[kNStages] != 0 ) fHistTime[kNStages]->Fill(total);
+
+    // Keep the N slowest events (sorted by descending time)
+    Int_t n = fSlowTotal.size();
+    if ( fNSlowest <= 0 || ( n == fNSlowest && total <= fSlowTotal[n-1] ) ) return;
+    Int_t pos = n;
+    while ( pos > 0 && fSlowTotal[pos-1] < total ) pos--;
+    fSlowTotal.insert(fSlowTotal.begin() + pos, total);
+    fSlowRunNr.insert(fSlowRunNr.begin() + pos, RunNr);
+    fSlowEventNr.insert(fSlowEventNr.begin() + pos, EventNr);
+    fSlowEntry.insert(fSlowEntry.begin() + pos, Entry);
+    const char* file = ( CurrentTree != 0 && CurrentTree->GetCurrentFile() != 0 )
+	? CurrentTree->GetCurrentFile()->GetName() : "";
+    fSlowFile.insert(fSlowFile.begin() + pos, file);
+    fSlowStages.insert(fSlowStages.begin() + pos*kNStages,
+		       fStageTime, fStageTime + kNStages);
+    if ( fTreeName.IsNull() && CurrentTree != 0 ) fTreeName = CurrentTree->GetName();
+    if ( n == fNSlowest ) {
+	fSlowTotal.pop_back();
+	fSlowRunNr.pop_back();
+	fSlowEventNr.pop_back();
+	fSlowEntry.pop_back();
+	fSlowFile.pop_back();
+	fSlowStages.resize(fNSlowest*kNStages);
+    }
+}
+
+//____________________________________________________________________
+
+Int_t AtlEventProfiler::DumpSlowEvents(const char* DumpFile) {
+    //
+    // Copy the slowest events from their input files into the given
+    // file (default: fDumpFile). All branches of the input tree are
+    // copied. Returns the number of copied events
+    //
+    TString fname = ( DumpFile != 0 ) ? TString(DumpFile) : fDumpFile;
+    if ( fname.IsNull() || fSlowTotal.size() == 0 ) return 0;
+
+    TDirectory *savdir = gDirectory;
+    TFile *fout = new TFile(fname.Data(), "recreate");
+    if ( fout->IsZombie() ) {
+	Error(__FUNCTION__, "Could not open output file %s", fname.Data());
+	delete fout;
+	savdir->cd();
+	return 0;
+    }
+    TTree *tout = 0;
+    Int_t ncopied = 0;
+
+    // Process all input files in order of their first appearance
+    std::vector<Bool_t> done(fSlowFile.size(), kFALSE);
+    for ( size_t i = 0; i < fSlowFile.size(); i++ ) {
+	if ( done[i] ) continue;
+	TFile *fin = TFile::Open(fSlowFile[i].c_str());
+	TTree *tin = ( fin != 0 && !fin->IsZombie() )
+	    ? dynamic_cast<TTree*>(fin->Get(fTreeName.Data())) : 0;
+	if ( tin == 0 ) {
+	    Error(__FUNCTION__, "Could not read tree %s from file %s. Skip.",
+		  fTreeName.Data(), fSlowFile[i].c_str());
+	    for ( size_t j = i; j < fSlowFile.size(); j++ )
+		if ( fSlowFile[j] == fSlowFile[i] ) done[j] = kTRUE;
+	    delete fin;
+	    continue;
+	}
+	tin->SetBranchStatus("*", kTRUE);
+	if ( tout == 0 ) {
+	    fout->cd();
+	    tout = tin->CloneTree(0);
+	} else {
+	    tin->CopyAddresses(tout);
+	}
+	for ( size_t j = i; j < fSlowFile.size(); j++ ) {
+	    if ( fSlowFile[j] != fSlowFile[i] ) continue;
+	    tin->GetEntry(fSlowEntry[j]);
+	    tout->Fill();
+	    done[j] = kTRUE;
+	    ncopied++;
+	}
+	tin->CopyAddresses(tout, kTRUE);
+	delete fin;
+    }
+    fout->cd();
+    if ( tout != 0 ) tout->Write();
+    Write();
+    delete fout;
+    savdir->cd();
+    Info(__FUNCTION__, "Copied %d slowest events to %s", ncopied, fname.Data());
+    return ncopied;
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::Clear(Option_t */*option*/) {
+    //
+    // Reset profile
+    //
+    fNEvents = 0;
+    for ( Int_t i = 0; i <= kNStages; i++ ) {
+	fSumTime[i] = 0.;
+	fMaxTime[i] = 0.;
+    }
+    for ( Int_t i = 0; i < kNStages; i++ ) fStageTime[i] = -1.;
+    fT0 = fTLast = 0.;
+    fSlowTotal.clear();
+    fSlowRunNr.clear();
+    fSlowEventNr.clear();
+    fSlowEntry.clear();
+    fSlowFile.clear();
+    fSlowStages.clear();
+}
+
+//____________________________________________________________________
+
+void AtlEventProfiler::Print(Option_t */*option*/) const {
+    //
+    // Print mean and max. time per stage and the slowest events. The
+    // format flags and precision of cout are restored afterwards
+    //
+    ios_base::fmtflags flags = cout.flags();
+    streamsize precision = cout.precision();
+    cout << endl
+	 << "========================================================" << endl
+	 << "  Event loop profile (" << fNEvents << " events)" << endl
+	 << "========================================================" << endl
+	 << "  Stage           mean (ms)      max (ms)" << endl;
+    for ( Int_t i = 0; i <= kNStages; i++ ) {
+	cout << "  " << setw(14) << left << GetStageName(i) << right
+	     << setw(10) << setprecision(4)
+	     << ( fNEvents > 0 ? 1.e3*fSumTime[i]/fNEvents : 0. )
+	     << setw(14) << setprecision(4) << 1.e3*fMaxTime[i] << endl;
+    }
+    if ( fSlowTotal.size() > 0 ) {
+	cout << endl << "  Slowest events:" << endl;
+	for ( size_t i = 0; i < fSlowTotal.size(); i++ ) {
+	    cout << "  " << setw(3) << i+1
+		 << "  t = " << setw(9) << setprecision(4) << fSlowTotal[i] << " s"
+		 << "  run " << fSlowRunNr[i] << "  event " << fSlowEventNr[i]
+		 << "  entry " << fSlowEntry[i] << " in " << fSlowFile[i] << endl
+		 << "       ";
+	    for ( Int_t j = 0; j < kNStages; j++ ) {
+		Double_t t = fSlowStages[i*kNStages + j];
+		if ( t < 0. ) continue;
+		cout << " " << GetStageName(j) << "=" << setprecision(3) << t;
+	    }
+	    cout << endl;
+	}
+    }
+    cout << "========================================================" << endl
+	 << endl;
+    cout.flags(flags);
+    cout.precision(precision);
+}
+
+//____________________________________________________________________
+
+const char* AtlEventProfiler::GetStageName(Int_t stage) {
+    //
+    // Name of the given stage (kNStages = whole event)
+    //
+    switch ( stage ) {
+	case kRead:         return "read";
+	case kSystematics:  return "systematics";
+	case kObjects:      return "objects";
+	case kScaleFactors: return "scalefactors";
+	case kPreAnalysis:  return "preanalysis";
+	case kMainAnalysis: return "mainanalysis";
+	case kSelection:    return "selection";
+	case kPostAnalysis: return "postanalysis";
+	case kNStages:      return "total";
+	default:            return "unknown";
+    }
+}
+
+//____________________________________________________________________
+
+Double_t AtlEventProfiler::Now() {
+    //
+    // Monotonic wall-clock time in seconds
+    //
+    return std::chrono::duration<Double_t>(
+	std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -428,7 +428,10 @@ void AtlEvtReaderD3PDCKM::BuildMCParticles() {
       
       
       HepMCParticle* mcdaughter = (HepMCParticle*)fEvent->GetMCParticles()->At(v_mc_child_index->at(i).at(j));
-      if ( mcdaughter != 0 ) mcParticles->AddDaughter(mcdaughter);
+      if ( mcdaughter != 0 ) {
+	mcParticles->AddDaughter(mcdaughter);
+	fEvent->AddMCRelation(i, v_mc_child_index->at(i).at(j));
+      }
     }    
     
     
@@ -444,7 +447,10 @@ void AtlEvtReaderD3PDCKM::BuildMCParticles() {
     
     for (UInt_t j = 0; j < v_mc_parent_index->at(i).size(); ++j) {
       HepMCParticle* mcmother = (HepMCParticle*)fEvent->GetMCParticles()->At(v_mc_parent_index->at(i).at(j));
-      if ( mcmother != 0 ) mcParticles->AddMother(mcmother);
+      if ( mcmother != 0 ) {
+	mcParticles->AddMother(mcmother);
+	fEvent->AddMCRelation(v_mc_parent_index->at(i).at(j), i, kFALSE);
+      }
     }    
     
   }
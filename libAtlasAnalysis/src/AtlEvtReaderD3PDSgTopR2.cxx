@@ -429,6 +429,7 @@ AtlEvtReaderD3PDSgTopR2::AtlEvtReaderD3PDSgTopR2(AtlSelector * parent,
     vers.Remove(0, 1); // Remove "v" at the beginning
     fD3PDversion = vers.Atoi();
     TString systName(systematicName);
+    fSystematicName = systName.IsNull() ? TString("nominal") : systName;
     fPeriodCount = -1;
     fForceContinBTag = kTRUE; // hardcode switch here for now
     fMCWeightPositionString = "";
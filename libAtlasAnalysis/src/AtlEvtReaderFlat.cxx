@@ -0,0 +1,274 @@
+//____________________________________________________________________
+//
+// Event reader for flat columnar ntuples used by AtlSelector
+//
+// Reads back the output of AtlEvtWriterFlat (input mode
+// kFlatNtuple). Isolation variables, scale factors etc. are not part
+// of the format and are set to NAN.
+//
+// The b-tag decision stored by the writing analysis (jet_btagged) is
+// assigned to the tagger given by SetBTagger(), in the same way as
+// for the Run-2 working-point taggers (weight 1 = tagged, 0 = not
+// tagged).
+//
+// Events which contained more objects than stored in the ntuple
+// cannot be rebuilt with the correct object multiplicities. By
+// default the job is aborted when such an event is read. With
+// SetAllowTruncated() only the stored leading objects are created
+// and a warning is given once.
+//
+#ifndef ATLAS_AtlEvtReaderFlat
+#include <AtlEvtReaderFlat.h>
+#endif
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TSystem.h>
+#include <cmath>
+
+#ifndef __CINT__
+ClassImp(AtlEvtReaderFlat);
+#endif
+
+//____________________________________________________________________
+
+AtlEvtReaderFlat::AtlEvtReaderFlat(AtlSelector *parent) :
+    AtlEvtReaderD3PDBase(parent) {
+    //
+    // Default constructor
+    //
+    fBTagger = AtlBTag::kDL1r_77;
+    fJetType = AtlJet::kDL1r;
+    fAllowTruncated = kFALSE;
+    fWarnTruncated  = kTRUE;
+}
+
+//____________________________________________________________________
+
+AtlEvtReaderFlat::~AtlEvtReaderFlat() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::SetBranches(TTree *t) {
+    //
+    // Set branch assignments of the input flat ntuple. Only the
+    // columns needed for building the event are switched on, all
+    // other columns (eg. user-defined columns) are not read.
+    //
+    InitBranches(t);
+
+    // Event header
+    SetupBranch(t, "run_nr",        &v_run_nr,        &b_run_nr);
+    SetupBranch(t, "evt_nr",        &v_evt_nr,        &b_evt_nr);
+    SetupBranch(t, "channel_nr",    &v_channel_nr,    &b_channel_nr);
+    SetupBranch(t, "is_mc",         &v_is_mc,         &b_is_mc);
+    SetupBranch(t, "evt_weight",    &v_evt_weight,    &b_evt_weight);
+    SetupBranch(t, "mc_weight",     &v_mc_weight,     &b_mc_weight);
+    SetupBranch(t, "pileup_weight", &v_pileup_weight, &b_pileup_weight);
+
+    // Missing Et
+    SetupBranch(t, "met_et",  &v_met_et,  &b_met_et);
+    SetupBranch(t, "met_phi", &v_met_phi, &b_met_phi);
+
+    // Electrons
+    SetupBranch(t, "el_n",   &v_el_n,   &b_el_n);
+    SetupBranch(t, "el_e",   v_el_e,    &b_el_e);
+    SetupBranch(t, "el_pt",  v_el_pt,   &b_el_pt);
+    SetupBranch(t, "el_eta", v_el_eta,  &b_el_eta);
+    SetupBranch(t, "el_phi", v_el_phi,  &b_el_phi);
+    SetupBranch(t, "el_chg", v_el_chg,  &b_el_chg);
+
+    // Muons
+    SetupBranch(t, "mu_n",   &v_mu_n,   &b_mu_n);
+    SetupBranch(t, "mu_e",   v_mu_e,    &b_mu_e);
+    SetupBranch(t, "mu_pt",  v_mu_pt,   &b_mu_pt);
+    SetupBranch(t, "mu_eta", v_mu_eta,  &b_mu_eta);
+    SetupBranch(t, "mu_phi", v_mu_phi,  &b_mu_phi);
+    SetupBranch(t, "mu_chg", v_mu_chg,  &b_mu_chg);
+
+    // Jets
+    SetupBranch(t, "jet_n",       &v_jet_n,      &b_jet_n);
+    SetupBranch(t, "jet_e",       v_jet_e,       &b_jet_e);
+    SetupBranch(t, "jet_pt",      v_jet_pt,      &b_jet_pt);
+    SetupBranch(t, "jet_eta",     v_jet_eta,     &b_jet_eta);
+    SetupBranch(t, "jet_phi",     v_jet_phi,     &b_jet_phi);
+    SetupBranch(t, "jet_btagged", v_jet_btagged, &b_jet_btagged);
+    SetupBranch(t, "jet_btagw",   v_jet_btagw,   &b_jet_btagw);
+    SetupBranch(t, "jet_flav",    v_jet_flav,    &b_jet_flav);
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildEvent() {
+    //
+    // Build A++ event from flat ntuple
+    //
+    if ( v_el_n > fgMaxLeptons || v_mu_n > fgMaxLeptons
+	 || v_jet_n > fgMaxJets ) {
+	if ( !fAllowTruncated ) {
+	    Error(__FUNCTION__,
+		  "Event %llu (run %u) contains %d electrons, %d muons and %d jets, but only %d electrons/muons and %d jets are stored in the flat ntuple. Use SetAllowTruncated() to read the leading objects only. Abort!",
+		  v_evt_nr, v_run_nr, v_el_n, v_mu_n, v_jet_n,
+		  fgMaxLeptons, fgMaxJets);
+	    gSystem->Abort(0);
+	}
+	if ( fWarnTruncated ) {
+	    Warning(__FUNCTION__,
+		    "Event %llu contains more objects than stored in the flat ntuple. Only the leading objects are used (warning given only once).",
+		    v_evt_nr);
+	    fWarnTruncated = kFALSE;
+	}
+    }
+
+    BuildEventHeader();
+    BuildEnergySum();
+    BuildElectrons();
+    BuildMuons();
+    BuildJets();
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildEventHeader() {
+    //
+    // Build A++ event header
+    //
+    fIsMC = v_is_mc;
+    fEvent->SetEventHeader(
+	/* RunNr = */ v_run_nr,
+	/* EventNr = */ v_evt_nr,
+	/* LumiBlock = */ 0,
+	/* BeamEnergy = */ 6500.,
+	/* IsMC = */ v_is_mc,
+	/* EventType = */ AtlEventHeader::kPhysics,
+	/* MCWeight = */ v_mc_weight,
+	/* PileupWeight = */ v_pileup_weight,
+	/* ZVertexWeight = */ 1.,
+	/* MMWeight_nominal = */ NAN,
+	/* MMWeight_fake_mc_up = */ NAN,
+	/* MMWeight_fake_mc_down = */ NAN,
+	/* MMWeight_fake_alternate = */ NAN,
+	/* MMWeight_real_alternate = */ NAN,
+	/* TruthWeightCorrection = */ 1.);
+    AtlEventHeader *eventHeader = fEvent->GetEventHeader();
+    eventHeader->SetChannelNumber(v_channel_nr);
+
+    // The stored event weight contains all weights applied by the
+    // writing job
+    eventHeader->SetPreTagEvtWeight(v_evt_weight);
+    eventHeader->SetTagEvtWeight(v_evt_weight);
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildEnergySum() {
+    //
+    // Build A++ energy sum
+    //
+    fEvent->GetEnergySum()->SetMissingEtMagPhi(v_met_et, v_met_phi);
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildElectrons() {
+    //
+    // Build list of leading A++ electrons
+    //
+    Int_t el_n = TMath::Min(v_el_n, fgMaxLeptons);
+    TLorentzVector p;
+    for ( Int_t el_i = 0; el_i < el_n; el_i++ ) {
+	AtlElectron *electron = fEvent->AddElectron(
+	    /* Px = */ NAN,
+	    /* Py = */ NAN,
+	    /* Pz = */ 1.e-99,
+	    /* E = */ 1.e-99,
+	    /* IsPositron = */ ( v_el_chg[el_i] > 0 ),
+	    /* EMWeight = */ NAN,
+	    /* BkgWeight = */ NAN,
+	    /* OQFlag = */ 0,
+	    /* IsEMBitField = */ 0,
+	    /* IsEM = */ AtlEMShower::kElectronTight,
+	    /* Author = */ AtlElectron::kHighPtElectron,
+	    /* PCluster = */ TLorentzVector(NAN, NAN, NAN, NAN));
+	p.SetPtEtaPhiE(v_el_pt[el_i], v_el_eta[el_i], v_el_phi[el_i],
+		       v_el_e[el_i]);
+	electron->SetP(p);
+	electron->SetIsTriggerMatched(kTRUE);
+    }
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildMuons() {
+    //
+    // Build list of leading A++ muons
+    //
+    Int_t mu_n = TMath::Min(v_mu_n, fgMaxLeptons);
+    TLorentzVector p;
+    for ( Int_t mu_i = 0; mu_i < mu_n; mu_i++ ) {
+	AtlMuon *muon = fEvent->AddMuon(
+	    /* Px = */ NAN,
+	    /* Py = */ NAN,
+	    /* Pz = */ 1.e-99,
+	    /* E = */ 1.e-99,
+	    /* IsMuPlus = */ ( v_mu_chg[mu_i] > 0 ),
+	    /* EtCone10 = */ NAN,
+	    /* EtCone20 = */ NAN,
+	    /* EtCone30 = */ NAN,
+	    /* EtCone40 = */ NAN,
+	    /* NtrkCone10 = */ -999,
+	    /* NtrkCone20 = */ -999,
+	    /* NtrkCone30 = */ -999,
+	    /* NtrkCone40 = */ -999,
+	    /* PtCone10 = */ NAN,
+	    /* PtCone20 = */ NAN,
+	    /* PtCone30 = */ NAN,
+	    /* PtCone40 = */ NAN,
+	    /* Author = */ AtlMuon::kMuidCo,
+	    /* Quality = */ AtlMuon::kTight,
+	    /* MatchingChi2 = */ NAN,
+	    /* MatchingNDoF = */ -999,
+	    /* IsCombinedMuon = */ kTRUE,
+	    /* PMuonSpecExtrapol = */ TLorentzVector(NAN, NAN, NAN, NAN),
+	    /* MuonSpecExtrapolCharge = */ 0);
+	p.SetPtEtaPhiE(v_mu_pt[mu_i], v_mu_eta[mu_i], v_mu_phi[mu_i],
+		       v_mu_e[mu_i]);
+	muon->SetP(p);
+	muon->SetIsTriggerMatched(kTRUE);
+    }
+}
+
+//____________________________________________________________________
+
+void AtlEvtReaderFlat::BuildJets() {
+    //
+    // Build list of leading A++ jets. The stored b-tag decision is
+    // assigned to the tagger given by SetBTagger()
+    //
+    Int_t jet_n = TMath::Min(v_jet_n, fgMaxJets);
+    TLorentzVector p;
+    for ( Int_t jet_i = 0; jet_i < jet_n; jet_i++ ) {
+	AtlJet *jet = fEvent->AddJet(
+	    /* type = */ fJetType,
+	    /* E = */ 1.e-99,
+	    /* Px = */ NAN,
+	    /* Py = */ NAN,
+	    /* Pz = */ 1.e-99,
+	    /* JetQuality = */ AtlJet::kIsGood,
+	    /* P_EMSCALE = */ TLorentzVector(NAN, NAN, NAN, NAN),
+	    /* P_JESCorrSCALE = */ TLorentzVector(NAN, NAN, NAN, NAN),
+	    /* EMJES_EtaCorr = */ NAN,
+	    /* BCH_CORR_CELL = */ NAN,
+	    /* BCH_CORR_JET = */ NAN,
+	    /* eta_offsetJES = */ NAN);
+	p.SetPtEtaPhiE(v_jet_pt[jet_i], v_jet_eta[jet_i], v_jet_phi[jet_i],
+		       v_jet_e[jet_i]);
+	jet->SetP(p);
+	jet->AddTag(fBTagger, ( v_jet_btagged[jet_i] ? 1. : 0. ), kTRUE);
+	if ( fIsMC )
+	    jet->SetTruthFlavour((AtlJet::EFlavour)v_jet_flav[jet_i]);
+    }
+}
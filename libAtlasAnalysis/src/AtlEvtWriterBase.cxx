@@ -1,6 +1,15 @@
 //____________________________________________________________________
 //
 // Abstract base class for writing events with the AtlSelector
+//
+// The compression and auto-flush settings of the output tree can be
+// chosen with SetCompression() and SetAutoFlush(). For skims the fast
+// algorithm ROOT::kLZ4 is recommended over the default (ZLIB,
+// level 9) of the AtlSelector output file, because the job time is
+// otherwise dominated by the compression of the output baskets.
+// The settings are applied to the branches of the output tree only
+// (see ApplyTreeSettings()), all other objects of the output file
+// keep the compression of the file.
 // 
 
 //  
@@ -11,6 +20,7 @@
 #ifndef ATLAS_AtlEvtWriterBase
 #include <AtlEvtWriterBase.h>
 #endif
+#include <TBranch.h>
 
 #ifndef __CINT__
 ClassImp(AtlEvtWriterBase);
@@ -24,6 +34,8 @@ AtlEvtWriterBase::AtlEvtWriterBase() {
     //
     fTree = 0;
     fEvent = 0;
+    fCompressionSettings = -1;
+    fAutoFlush = 0;
 }
 
 //____________________________________________________________________
@@ -47,4 +59,29 @@ TTree* AtlEvtWriterBase::CreateTree(const char* name, const char* title,
     return fTree;
 }
 
+//____________________________________________________________________
+
+void AtlEvtWriterBase::ApplyTreeSettings() {
+    //
+    // Apply compression and auto-flush settings to the output tree.
+    // The compression is set per branch (incl. sub-branches), the
+    // output file itself is not touched. Hence this must be called
+    // after all branches have been booked (see AtlSelector::Begin())
+    //
+    if ( fTree == 0 ) return;
+    if ( fCompressionSettings >= 0 ) {
+	TIter next_branch(fTree->GetListOfBranches());
+	TBranch *br = 0;
+	while ( (br = (TBranch*)next_branch()) ) {
+	    br->SetCompressionSettings(fCompressionSettings);
+	}
+	Info(__FUNCTION__, "Output tree compression settings = %d",
+	     fCompressionSettings);
+    }
+    if ( fAutoFlush != 0 ) {
+	fTree->SetAutoFlush(fAutoFlush);
+	Info(__FUNCTION__, "Output tree auto-flush = %lld", fAutoFlush);
+    }
+}
+
 
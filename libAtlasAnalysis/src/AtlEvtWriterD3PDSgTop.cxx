@@ -1,8 +1,31 @@
 //____________________________________________________________________
 //
 // Event writer for SgTop-D3PDs used by AtlSelector
-// 
-//  
+//
+// Fast skim mode:
+// ===============
+// By default all branches of the input tree are switched on and every
+// accepted event is copied by TTree::Fill(), i.e. every branch of
+// every event is read, unpacked, re-packed and compressed again.
+// For skims of high-acceptance samples this makes the job CPU-bound.
+//
+// With SetFastSkim() the analysis reads only the branches it needs
+// during the event loop. The remaining input branches are read by the
+// writer for the accepted events only (TBranch::GetEntry() ignoring
+// the branch status), before the event is copied by TTree::Fill() as
+// usual. Hence the auto-flush and auto-save settings of the output
+// tree apply unchanged. For skims of low-acceptance samples most of
+// the input baskets are never read nor unpacked.
+//
+// Note that the baskets are not copied as they are. Every accepted
+// event is still unpacked and compressed again, since ROOT can clone
+// baskets of whole files or trees only (TTree::CopyEntries() with
+// option "fast"), not of a selection of entries.
+//
+// Use SetCompression() (eg. ROOT::kLZ4) and SetAutoFlush() of the
+// base class to choose faster compression settings for the skim.
+//
+//
 // Author: Oliver Maria Kind <mailto: kind@mail.desy.de>
 // Update: $Id$
 // Copyright: 2013 (C) Oliver Maria Kind
@@ -10,6 +33,9 @@
 #ifndef ATLAS_AtlEvtWriterD3PDSgTop
 #include <AtlEvtWriterD3PDSgTop.h>
 #endif
+#include <TBranch.h>
+#include <TList.h>
+#include <TObjString.h>
 #include <iostream>
 
 using namespace std;
@@ -25,6 +51,12 @@ AtlEvtWriterD3PDSgTop::AtlEvtWriterD3PDSgTop() {
     // Default constructor
     //
     fCloneOnly = kFALSE;
+    fFastSkim = kFALSE;
+    fInputTree = 0;
+    fLazyBranches = new TList;
+    fLazyBranches->SetOwner(kTRUE);
+    fLazyTreeNumber = -1;
+    fNLazyEntries = 0;
 }
 
 //____________________________________________________________________
@@ -33,6 +65,7 @@ AtlEvtWriterD3PDSgTop::~AtlEvtWriterD3PDSgTop() {
     //
     // Default constructor
     //
+    delete fLazyBranches;
 }
 
 //____________________________________________________________________
@@ -63,24 +96,104 @@ void AtlEvtWriterD3PDSgTop::WriteEvent() {
     // Write event
     //
     fEventWeight = fEvent->GetTagEvtWeight();
+    if ( fFastSkim && fLazyBranches->GetEntries() > 0 ) {
+	// Read the branches not used by the analysis for this event
+	TTree *cur = fInputTree->GetTree();
+	if ( fInputTree->GetTreeNumber() != fLazyTreeNumber ) {
+	    ConnectLazyBranches(cur);
+	    fLazyTreeNumber = fInputTree->GetTreeNumber();
+	}
+	Long64_t entry = cur->GetReadEntry();
+	TIter next_name(fLazyBranches);
+	TObjString *br_name = 0;
+	while ( (br_name = (TObjString*)next_name()) ) {
+	    TBranch *br = cur->GetBranch(br_name->GetName());
+	    if ( br != 0 ) br->GetEntry(entry, 1);
+	}
+	fNLazyEntries++;
+    }
     fTree->Fill();
 }
 
 //____________________________________________________________________
 
+void AtlEvtWriterD3PDSgTop::ConnectLazyBranches(TTree *tree) {
+    //
+    // Connect the branches of the given input tree which are not read
+    // by the analysis to the output tree (fast skim only). The input
+    // chain updates the addresses of the active branches of its
+    // clones only, when switching to the next file.
+    //
+    TIter next_name(fLazyBranches);
+    TObjString *br_name = 0;
+    while ( (br_name = (TObjString*)next_name()) )
+	tree->SetBranchStatus(br_name->GetName(), kTRUE);
+    tree->CopyAddresses(fTree);
+    next_name.Reset();
+    while ( (br_name = (TObjString*)next_name()) )
+	tree->SetBranchStatus(br_name->GetName(), kFALSE);
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterD3PDSgTop::Terminate() {
+    //
+    // Print fast skim summary
+    //
+    if ( !fFastSkim ) return;
+    Info(__FUNCTION__, "Fast skim: %d input branches read for %lld accepted entries only",
+	 fLazyBranches->GetEntries(), fNLazyEntries);
+}
+
+//____________________________________________________________________
+
 TTree* AtlEvtWriterD3PDSgTop::CreateTree(const char* name,
                                          const char* title,
 					 TTree *InputTree) {
     //
     // Create output tree
     //
+    // In fast skim mode the branch status of the input tree set by
+    // the analysis is restored after cloning the tree structure. The
+    // inactive branches are read by WriteEvent() for accepted events.
+    //
+    fInputTree = InputTree;
+    TList active;
+    active.SetOwner(kTRUE);
+    if ( fFastSkim ) {
+	TIter next_branch(InputTree->GetListOfBranches());
+	TBranch *br = 0;
+	while ( (br = (TBranch*)next_branch()) ) {
+	    if ( InputTree->GetBranchStatus(br->GetName()) )
+		active.Add(new TObjString(br->GetName()));
+	    else
+		fLazyBranches->Add(new TObjString(br->GetName()));
+	}
+    }
+
     InputTree->SetBranchStatus("*", kTRUE);
     fTree = InputTree->CloneTree(0);
     if ( fTree == 0 ) {
 	// TTree::CloneTree() cannot cope with empty trees. Bypass by
 	// using TTree::CopyTree()
     	fTree = InputTree->CopyTree("","");
+	if ( fFastSkim ) {
+	    Warning(__FUNCTION__, "Cannot clone empty input tree. Switch off fast skim mode.");
+	    fFastSkim = kFALSE;
+	    fLazyBranches->Delete();
+	}
     }
     fTree->SetNameTitle(name, title);
+
+    if ( fFastSkim ) {
+	InputTree->SetBranchStatus("*", kFALSE);
+	TIter next_name(&active);
+	TObjString *br_name = 0;
+	while ( (br_name = (TObjString*)next_name()) ) {
+	    InputTree->SetBranchStatus(br_name->GetName(), kTRUE);
+	}
+	Info(__FUNCTION__, "Fast skim mode: %d of %d input branches read by the analysis",
+	     active.GetEntries(), active.GetEntries() + fLazyBranches->GetEntries());
+    }
     return fTree;
 }
@@ -17,27 +17,27 @@ AtlEvtWriterD3PDSgTopThinned::AtlEvtWriterD3PDSgTopThinned()
     , fBJets(0)
     , fLeptons(0)
     , fSubselectionFlags(new TMap)
-    , v_jet_pt(new Float_t(kMaxJets))
-    , v_jet_eta(new Float_t(kMaxJets))
-    , v_jet_phi(new Float_t(kMaxJets))
-    , v_jet_btag(new Int_t(kMaxJets))
-    , v_lep_pt(new Float_t(kMaxLeptons))
-    , v_lep_eta(new Float_t(kMaxLeptons))
-    , v_lep_phi(new Float_t(kMaxLeptons))
-    , v_lep_pdgId(new Int_t(kMaxLeptons))
+    , v_jet_pt(new Float_t[kMaxJets])
+    , v_jet_eta(new Float_t[kMaxJets])
+    , v_jet_phi(new Float_t[kMaxJets])
+    , v_jet_btag(new Int_t[kMaxJets])
+    , v_lep_pt(new Float_t[kMaxLeptons])
+    , v_lep_eta(new Float_t[kMaxLeptons])
+    , v_lep_phi(new Float_t[kMaxLeptons])
+    , v_lep_pdgId(new Int_t[kMaxLeptons])
 {
     fSubselectionFlags->SetOwnerKeyValue();
 }
 
 AtlEvtWriterD3PDSgTopThinned::~AtlEvtWriterD3PDSgTopThinned() {
-    delete v_jet_pt;
-    delete v_jet_eta;
-    delete v_jet_phi;
-    delete v_jet_btag;
-    delete v_lep_pt;
-    delete v_lep_eta;
-    delete v_lep_phi;
-    delete v_lep_pdgId;
+    delete [] v_jet_pt;
+    delete [] v_jet_eta;
+    delete [] v_jet_phi;
+    delete [] v_jet_btag;
+    delete [] v_lep_pt;
+    delete [] v_lep_eta;
+    delete [] v_lep_phi;
+    delete [] v_lep_pdgId;
     delete fSubselectionFlags;
 }
 
@@ -0,0 +1,303 @@
+//____________________________________________________________________
+//
+// Event writer for flat columnar ntuples used by AtlSelector
+//
+// The output tree contains one column (branch) per variable. Objects
+// are stored as fixed-size arrays holding the leading fgMaxLeptons
+// electrons/muons and fgMaxJets jets, unused array elements are set
+// to -999. The total number of objects is kept in el_n, mu_n and
+// jet_n, the b-tag decision of the analysis in jet_btagged. Events
+// with more objects than stored are counted and reported at the end
+// of the job; AtlEvtReaderFlat refuses to read them unless told
+// otherwise, since their object multiplicities cannot be
+// reproduced. There are no vector or object branches, thus the columns
+// can be scanned without the class dictionaries and without
+// streaming of variable-length containers, eg.
+//
+//   t->Draw("jet_pt[0]", "evt_weight*(jet_n>=2 && bjet_n==1)");
+//
+// This makes the format well suited for tools reading the same
+// ntuple many times (eg. TTree::Draw() scans). The ntuple can be read
+// back by AtlSelector with input mode kFlatNtuple (see
+// AtlEvtReaderFlat).
+//
+// Note that the existing consumers of the MEM ntuples
+// (AtlEvtReaderMemR2, AtlBDTAnalysisTask and the ntuple plots of
+// HepDataMCPlotter) expect the layout of AtlEvtWriterMem and cannot
+// read this format. Hence kMemNtuple stays the output mode of
+// AtlMemNtupleProduction for the MEM/BDT chain.
+//
+// Additional analysis variables (eg. BDT input variables) are booked
+// as scalar columns with AddColumn() before the tree is booked.
+//
+// Large baskets and LZ4 compression are used by default, since
+// decompression speed rather than file size limits repeated column
+// scans. The compression is set for the branches of the ntuple only
+// (see AtlEvtWriterBase::ApplyTreeSettings()). Use SetCompression()
+// and SetAutoFlush() to change this.
+//
+// Usage (in the analysis selector):
+// =================================
+// SetOutputMode(kFlatNtuple);
+// ...
+// AtlEvtWriterFlat *wr = new AtlEvtWriterFlat;
+// wr->AddColumn("bdt_MtW", &fMtW);
+// fEvtWriter = wr;
+// ...
+// wr->SetJets(fJets, fBJets); // in ProcessFill()
+//
+#ifndef ATLAS_AtlEvtWriterFlat
+#include <AtlEvtWriterFlat.h>
+#endif
+#include <AtlEvent.h>
+#include <TList.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#ifndef __CINT__
+ClassImp(AtlEvtWriterFlat);
+#endif
+
+//____________________________________________________________________
+
+AtlEvtWriterFlat::AtlEvtWriterFlat() {
+    //
+    // Default constructor
+    //
+    fBTagger   = AtlBTag::kDL1r_77;
+    fJetType   = AtlJet::kDL1r;
+    fElectrons = 0;
+    fMuons     = 0;
+    fJets      = 0;
+    fBJets     = 0;
+    fNTruncated = 0;
+    SetCompression(ROOT::kLZ4, 4);
+}
+
+//____________________________________________________________________
+
+AtlEvtWriterFlat::~AtlEvtWriterFlat() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::AddColumn(const char* name, Float_t *value) {
+    //
+    // Add scalar column to the output tree. The given variable is
+    // written for each event. Must be called before BookTree()
+    //
+    if ( fTree != 0 ) {
+	Error(__FUNCTION__, "Output tree booked already. Cannot add column \"%s\". Abort!",
+	      name);
+	gSystem->Abort(1);
+    }
+    fColumnNames.push_back(name);
+    fColumnValues.push_back(value);
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::BookColumn(const char* name, void *address,
+				  const char* leaflist) {
+    //
+    // Book single column
+    //
+    fTree->Branch(name, address, leaflist, fgBasketSize);
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::BookTree(TTree *tree, AtlEvent *evt) {
+    //
+    // Book output flat ntuple
+    //
+    fTree  = tree;
+    fEvent = evt;
+
+    // Evt header
+    BookColumn("run_nr",        &fRunNr,        "run_nr/i");
+    BookColumn("evt_nr",        &fEventNr,      "evt_nr/l");
+    BookColumn("channel_nr",    &fChannelNr,    "channel_nr/i");
+    BookColumn("is_mc",         &fIsMC,         "is_mc/O");
+    BookColumn("evt_weight",    &fEventWeight,  "evt_weight/F");
+    BookColumn("mc_weight",     &fMCWeight,     "mc_weight/F");
+    BookColumn("pileup_weight", &fPileupWeight, "pileup_weight/F");
+
+    // Missing Et
+    BookColumn("met_et",  &fMET_Et,  "met_et/F");
+    BookColumn("met_phi", &fMET_Phi, "met_phi/F");
+
+    // Electrons
+    BookColumn("el_n",  &fElectronN,   "el_n/I");
+    BookColumn("el_e",   fElectronE,   Form("el_e[%d]/F",   fgMaxLeptons));
+    BookColumn("el_pt",  fElectronPt,  Form("el_pt[%d]/F",  fgMaxLeptons));
+    BookColumn("el_eta", fElectronEta, Form("el_eta[%d]/F", fgMaxLeptons));
+    BookColumn("el_phi", fElectronPhi, Form("el_phi[%d]/F", fgMaxLeptons));
+    BookColumn("el_chg", fElectronChg, Form("el_chg[%d]/I", fgMaxLeptons));
+
+    // Muons
+    BookColumn("mu_n",  &fMuonN,   "mu_n/I");
+    BookColumn("mu_e",   fMuonE,   Form("mu_e[%d]/F",   fgMaxLeptons));
+    BookColumn("mu_pt",  fMuonPt,  Form("mu_pt[%d]/F",  fgMaxLeptons));
+    BookColumn("mu_eta", fMuonEta, Form("mu_eta[%d]/F", fgMaxLeptons));
+    BookColumn("mu_phi", fMuonPhi, Form("mu_phi[%d]/F", fgMaxLeptons));
+    BookColumn("mu_chg", fMuonChg, Form("mu_chg[%d]/I", fgMaxLeptons));
+
+    // Jets
+    BookColumn("jet_n",       &fJetN,          "jet_n/I");
+    BookColumn("bjet_n",      &fBJetN,         "bjet_n/I");
+    BookColumn("jet_e",        fJetE,          Form("jet_e[%d]/F",       fgMaxJets));
+    BookColumn("jet_pt",       fJetPt,         Form("jet_pt[%d]/F",      fgMaxJets));
+    BookColumn("jet_eta",      fJetEta,        Form("jet_eta[%d]/F",     fgMaxJets));
+    BookColumn("jet_phi",      fJetPhi,        Form("jet_phi[%d]/F",     fgMaxJets));
+    BookColumn("jet_btagged",  fJetBTagged,    Form("jet_btagged[%d]/O", fgMaxJets));
+    BookColumn("jet_btagw",    fJetBTagWeight, Form("jet_btagw[%d]/F",   fgMaxJets));
+    BookColumn("jet_flav",     fJetFlav,       Form("jet_flav[%d]/I",    fgMaxJets));
+
+    // User columns
+    for ( UInt_t i = 0; i < fColumnNames.size(); i++ ) {
+	BookColumn(fColumnNames[i].Data(), fColumnValues[i],
+		   Form("%s/F", fColumnNames[i].Data()));
+    }
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::WriteEvent() {
+    //
+    // Write event
+    //
+
+    // Evt header
+    AtlEventHeader *header = fEvent->GetEventHeader();
+    fRunNr        = fEvent->RunNr();
+    fEventNr      = fEvent->EventNr();
+    fChannelNr    = header->GetChannelNumber();
+    fIsMC         = fEvent->IsMC();
+    fEventWeight  = fEvent->GetTagEvtWeight();
+    fMCWeight     = header->GetMCWeight();
+    fPileupWeight = header->GetPileupWeight();
+
+    // Missing Et
+    fMET_Et  = fEvent->GetEnergySum()->MissingEt_Mag();
+    fMET_Phi = fEvent->GetEnergySum()->MissingEt_Phi();
+
+    // Electrons
+    for ( Int_t i = 0; i < fgMaxLeptons; i++ ) {
+	fElectronE[i] = fElectronPt[i] = fElectronEta[i] = fElectronPhi[i] = -999.;
+	fElectronChg[i] = 0;
+    }
+    TIter next_el( fElectrons != 0 ? (TCollection*)fElectrons
+		   : (TCollection*)fEvent->GetElectrons());
+    AtlElectron *el = 0;
+    fElectronN = 0;
+    while ( (el = (AtlElectron*)next_el()) ) {
+	if ( fElectronN < fgMaxLeptons ) {
+	    fElectronE[fElectronN]   = el->E();
+	    fElectronPt[fElectronN]  = el->Pt();
+	    fElectronEta[fElectronN] = el->Eta();
+	    fElectronPhi[fElectronN] = el->Phi();
+	    fElectronChg[fElectronN] = ( el->IsPositive() ) ? 1 : -1;
+	}
+	fElectronN++;
+    }
+
+    // Muons
+    for ( Int_t i = 0; i < fgMaxLeptons; i++ ) {
+	fMuonE[i] = fMuonPt[i] = fMuonEta[i] = fMuonPhi[i] = -999.;
+	fMuonChg[i] = 0;
+    }
+    TIter next_mu( fMuons != 0 ? (TCollection*)fMuons
+		   : (TCollection*)fEvent->GetMuons());
+    AtlMuon *mu = 0;
+    fMuonN = 0;
+    while ( (mu = (AtlMuon*)next_mu()) ) {
+	if ( fMuonN < fgMaxLeptons ) {
+	    fMuonE[fMuonN]   = mu->E();
+	    fMuonPt[fMuonN]  = mu->Pt();
+	    fMuonEta[fMuonN] = mu->Eta();
+	    fMuonPhi[fMuonN] = mu->Phi();
+	    fMuonChg[fMuonN] = ( mu->IsPositive() ) ? 1 : -1;
+	}
+	fMuonN++;
+    }
+
+    // Jets
+    for ( Int_t i = 0; i < fgMaxJets; i++ ) {
+	fJetE[i] = fJetPt[i] = fJetEta[i] = fJetPhi[i] = -999.;
+	fJetBTagWeight[i] = -999.;
+	fJetBTagged[i] = kFALSE;
+	fJetFlav[i] = AtlJet::kUnknownFlavour;
+    }
+    TIter next_jet( fJets != 0 ? (TCollection*)fJets
+		    : (TCollection*)fEvent->GetJets(fJetType));
+    AtlJet *jet = 0;
+    fJetN = 0;
+    fBJetN = 0;
+    while ( (jet = (AtlJet*)next_jet()) ) {
+	Bool_t btagged = ( fBJets != 0 && fBJets->Contains(jet) );
+	if ( btagged ) fBJetN++;
+	if ( fJetN < fgMaxJets ) {
+	    const AtlBTag *tag = jet->GetTag(fBTagger);
+	    fJetE[fJetN]          = jet->E();
+	    fJetPt[fJetN]         = jet->Pt();
+	    fJetEta[fJetN]        = jet->Eta();
+	    fJetPhi[fJetN]        = jet->Phi();
+	    fJetBTagWeight[fJetN] = ( tag != 0 ) ? tag->GetWeight() : -999.;
+	    fJetBTagged[fJetN]    = btagged;
+	    fJetFlav[fJetN]       = jet->GetTruthFlavour();
+	}
+	fJetN++;
+    }
+
+    if ( fElectronN > fgMaxLeptons || fMuonN > fgMaxLeptons
+	 || fJetN > fgMaxJets ) fNTruncated++;
+
+    // ===================
+    // Write event to tree
+    // ===================
+    fTree->Fill();
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::Terminate() {
+    //
+    // Report events with more objects than stored
+    //
+    if ( fNTruncated == 0 ) return;
+    Warning(__FUNCTION__,
+	    "%lld events contain more than %d electrons/muons or %d jets. Only the leading objects have been stored.",
+	    fNTruncated, fgMaxLeptons, fgMaxJets);
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::SetElectrons(TList *electrons) {
+    //
+    // Set list of selected electrons
+    //
+    fElectrons = electrons;
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::SetMuons(TList *muons) {
+    //
+    // Set list of selected muons
+    //
+    fMuons = muons;
+}
+
+//____________________________________________________________________
+
+void AtlEvtWriterFlat::SetJets(TList *jets, TList *bjets) {
+    //
+    // Set list of selected jets and b-jets
+    //
+    fJets  = jets;
+    fBJets = bjets;
+}
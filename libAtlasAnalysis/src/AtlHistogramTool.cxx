@@ -71,6 +71,37 @@
 // ...
 // </pre>
 //
+// <p>
+// <h3>Lazy booking:</h3>
+// Tools which book many histograms of which only a few are filled in
+// a given configuration can use Define() instead of Add(). Define()
+// takes the same arguments but only registers the definition of the
+// histogram and returns nothing:
+// <pre>
+// fHistograms1->Define("leptons/h_lep1_Pt", "Leading Lepton Pt", 40, 0., 200.,
+//                      "Leading lepton p_{T} [GeV]", "Events");
+// </pre>
+// The histogram and its folders are created on the first call of
+// Fill() or GetHistogram(). Histograms which are never filled are
+// booked empty at the end of the job, so the output file is the same
+// as with Add(), unless fSkipEmpty is set. In that case histograms
+// without entries are dropped from the output file. Names are checked
+// for clashes with other histograms and folders of the tool at
+// registration already.
+// </p>
+// <p>
+// <h3>Compact storage:</h3>
+// With fCompact set, the contents of defined histograms are kept in
+// compact containers (see AtlCompactHist) until the output file is
+// written or the histogram is requested via GetHistogram(). All
+// histograms of a tool with the same binning share one binning
+// descriptor, 1d contents can be stored in single precision
+// (fFloatContents), the sum of squared weights is stored only when
+// needed and 2d histograms store their filled bins only. The output
+// file contains standard TH1D/TH2D histograms, so HepDataMCPlotter,
+// AtlHistFactoryTask and hadd are not affected.
+// </p>
+//
 // END_HTML
 //  
 //  
@@ -83,6 +114,7 @@
 #endif
 #include <AtlSelector.h>
 #include <TFile.h>
+#include <TObjString.h>
 #include <iostream>
 
 using namespace std;
@@ -93,14 +125,37 @@ ClassImp(AtlHistogramTool);
 
 //____________________________________________________________________
 
+TH1* AtlHistObject::Book() {
+    //
+    // Create the histogram from its definition in the current
+    // directory. Compact contents are copied and released
+    //
+    fHistogram = fBinning->CreateHistogram(gSystem->BaseName(GetName()), GetTitle());
+    fHistogram->SetXTitle(fXTitle.Data());
+    fHistogram->SetYTitle(fYTitle.Data());
+    if ( fBinning->Is2D() ) fHistogram->SetZTitle(fZTitle.Data());
+    if ( fContents != 0 ) {
+	fContents->CopyTo(fHistogram);
+	ClearContents();
+    }
+    return fHistogram;
+}
+
+//____________________________________________________________________
+
 AtlHistogramTool::AtlHistogramTool(const char* name, const char* title) :
     AtlAnalysisTool(name, title) {
     //
     // Default constructor
     //
     fProcessMode = kIndividual;
+    fSkipEmpty = kFALSE;
+    fCompact = kFALSE;
+    fFloatContents = kFALSE;
     fParentDir = 0;
     fHistograms = new THashList();
+    fBinnings = new THashList();
+    fFolders = new THashList();
 }
 
 //____________________________________________________________________
@@ -111,6 +166,10 @@ AtlHistogramTool::~AtlHistogramTool() {
     //
     fHistograms->Delete();
     delete fHistograms;
+    fBinnings->Delete();
+    delete fBinnings;
+    fFolders->Delete();
+    delete fFolders;
 }
 
 //____________________________________________________________________
@@ -137,44 +196,12 @@ TH1D* AtlHistogramTool::Add(const char* hname, const char* title,
     // directories are created automatically if they do not exist. All
     // path names are relative to the parent folder of the tool.
     //
-    
-    // Store current dirctory
-    TDirectory *savdir = gDirectory;
-
-    // Top-level folder exists ?
-    if ( fParentDir == 0 ) {
-	// Go to output file folder and create parent folder
-	fParent->GetOutputFile()->cd();
-	fParentDir = gDirectory->mkdir(GetName(), GetTitle());
-    }
-    fParentDir->cd();
-
-    // Check if the histogram belongs to a subfolder
-    // and create folder if necessary 
-    TString dirname = gSystem->DirName(hname);
-    if ( dirname != "." ) {
-	MkDirWithParents(dirname.Data());
-    }
-
-    // Check if a histogram with the same name already exists in the
-    // current folder
-    const char* bname = gSystem->BaseName(hname); 
-    if ( gDirectory->FindObject(bname) != 0 ) {
-	Error("Add", "Histogram with given name \"%s\" exists already in the current folder"
-	      "\"%s\". Please use a different name. Abort!", bname, gDirectory->GetPath());
-	gSystem->Abort(1);
-    }
-    
-    // Create and add histogram
-    TH1D *h = new TH1D(bname, title, nbinsx, xlow, xup);
-    h->SetXTitle(xtitle);
-    h->SetYTitle(ytitle);
-    fHistograms->Add(new AtlHistObject(hname, title, h));
-
-    // Restore pwd
-    savdir->cd();
-
-    return h;
+    // The histogram is booked at once. Use Define() for lazy
+    // booking.
+    //
+    AtlHistObject *h_obj = Register(hname, title, nbinsx, xlow, xup,
+				    0, 0., 0., 0, xtitle, ytitle, "");
+    return (TH1D*)Book(h_obj);
 }
 
 //____________________________________________________________________
@@ -191,44 +218,12 @@ TH2D* AtlHistogramTool::Add(const char* hname, const char* title,
     // directories are created automatically if they do not exist. All
     // path names are relative to the parent folder of the tool.
     //
-    
-    // Store current dirctory
-    TDirectory *savdir = gDirectory;
-
-    // Top-level folder exists ?
-    if ( fParentDir == 0 ) {
-	// Go to output file folder and create parent folder
-	fParent->GetOutputFile()->cd();
-	fParentDir = gDirectory->mkdir(GetName(), GetTitle());
-    }
-    fParentDir->cd();
-
-    // Check if the histogram belongs to a subfolder
-    // and create folder if necessary 
-    TString dirname = gSystem->DirName(hname);
-    if ( dirname != "." ) {
-	MkDirWithParents(dirname.Data());
-    }
-
-    // Check if a histogram with the same name already exists in the
-    // current folder
-    const char* bname = gSystem->BaseName(hname); 
-    if ( gDirectory->FindObject(bname) != 0 ) {
-	Error("Add", "Histogram with given name \"%s\" exists already in the current folder. Please use a different name. Abort!", bname);
-	gSystem->Abort(1);
-    }
-    
-    // Create and add histogram
-    TH2D *h = new TH2D(bname, title, nbinsx, xlow, xup, nbinsy, ylow, yup);
-    h->SetXTitle(xtitle);
-    h->SetYTitle(ytitle);
-    h->SetZTitle(ztitle);
-    fHistograms->Add(new AtlHistObject(hname, title, h));
-
-    // Restore pwd
-    savdir->cd();
-
-    return h;
+    // The histogram is booked at once. Use Define() for lazy
+    // booking.
+    //
+    AtlHistObject *h_obj = Register(hname, title, nbinsx, xlow, xup,
+				    nbinsy, ylow, yup, 0, xtitle, ytitle, ztitle);
+    return (TH2D*)Book(h_obj);
 }
 
 //____________________________________________________________________
@@ -245,6 +240,120 @@ TH2D* AtlHistogramTool::Add(const char* hname, const char* title,
     // directories are created automatically if they do not exist. All
     // path names are relative to the parent folder of the tool.
     //
+    // The histogram is booked at once. Use Define() for lazy
+    // booking.
+    //
+    AtlHistObject *h_obj = Register(hname, title, nbinsx, xlow, xup,
+				    nbinsy, 0., 0., ybins, xtitle, ytitle, ztitle);
+    return (TH2D*)Book(h_obj);
+}
+
+//____________________________________________________________________
+
+void AtlHistogramTool::Define(const char* hname, const char* title,
+			      Int_t nbinsx, Double_t xlow, Double_t xup,
+			      const char* xtitle, const char* ytitle) {
+    //
+    // Define TH1D histogram
+    //
+    // Same as Add(), but the histogram is booked on its first fill
+    // (see the class description)
+    //
+    Register(hname, title, nbinsx, xlow, xup, 0, 0., 0., 0,
+	     xtitle, ytitle, "");
+}
+
+//____________________________________________________________________
+
+void AtlHistogramTool::Define(const char* hname, const char* title,
+			      Int_t nbinsx, Double_t xlow, Double_t xup,
+			      Int_t nbinsy, Double_t ylow, Double_t yup,
+			      const char* xtitle, const char* ytitle,
+			      const char* ztitle) {
+    //
+    // Define TH2D histogram
+    //
+    // Same as Add(), but the histogram is booked on its first fill
+    // (see the class description)
+    //
+    Register(hname, title, nbinsx, xlow, xup, nbinsy, ylow, yup, 0,
+	     xtitle, ytitle, ztitle);
+}
+
+//____________________________________________________________________
+
+void AtlHistogramTool::Define(const char* hname, const char* title,
+			      Int_t nbinsx, Double_t xlow, Double_t xup,
+			      Int_t nbinsy, const Double_t *ybins,
+			      const char* xtitle, const char* ytitle,
+			      const char* ztitle) {
+    //
+    // Define TH2D histogram with variable y bins
+    //
+    // Same as Add(), but the histogram is booked on its first fill
+    // (see the class description)
+    //
+    Register(hname, title, nbinsx, xlow, xup, nbinsy, 0., 0., ybins,
+	     xtitle, ytitle, ztitle);
+}
+
+//____________________________________________________________________
+
+AtlHistObject* AtlHistogramTool::Register(const char* hname, const char* title,
+					  Int_t nbinsx, Double_t xlow, Double_t xup,
+					  Int_t nbinsy, Double_t ylow, Double_t yup,
+					  const Double_t *ybins, const char* xtitle,
+					  const char* ytitle, const char* ztitle) {
+    //
+    // Add histogram definition to the list of histograms. Histograms
+    // with the same binning share one binning object.
+    //
+    // The name must neither be used by another histogram nor by a
+    // folder of the tool, and none of its folders may have the name
+    // of a histogram. This is checked here, so that lazily booked
+    // histograms cannot fail when being filled
+    //
+    if ( fHistograms->FindObject(hname) != 0 ) {
+	Error("Add", "Histogram with given name \"%s\" exists already. Please use a different name. Abort!",
+	      hname);
+	gSystem->Abort(1);
+    }
+    if ( fFolders->FindObject(hname) != 0 ) {
+	Error("Add", "Histogram name \"%s\" is used by a folder already. Please use a different name. Abort!",
+	      hname);
+	gSystem->Abort(1);
+    }
+    TString dirname = gSystem->DirName(hname);
+    while ( dirname != "." && dirname != "/" && !dirname.IsNull() ) {
+	if ( fHistograms->FindObject(dirname.Data()) != 0 ) {
+	    Error("Add", "Folder \"%s\" of histogram \"%s\" has the name of a histogram. Please use a different name. Abort!",
+		  dirname.Data(), hname);
+	    gSystem->Abort(1);
+	}
+	if ( fFolders->FindObject(dirname.Data()) != 0 ) break;
+	fFolders->Add(new TObjString(dirname.Data()));
+	dirname = gSystem->DirName(dirname.Data());
+    }
+    TString sig = AtlHistBinning::GetSignature(nbinsx, xlow, xup,
+					       nbinsy, ylow, yup, ybins);
+    AtlHistBinning *binning = (AtlHistBinning*)fBinnings->FindObject(sig.Data());
+    if ( binning == 0 ) {
+	binning = new AtlHistBinning(nbinsx, xlow, xup, nbinsy, ylow, yup, ybins);
+	fBinnings->Add(binning);
+    }
+    AtlHistObject *h_obj = new AtlHistObject(hname, title, binning,
+					     xtitle, ytitle, ztitle);
+    fHistograms->Add(h_obj);
+    return h_obj;
+}
+
+//____________________________________________________________________
+
+TH1* AtlHistogramTool::Book(AtlHistObject *h_obj) {
+    //
+    // Create the histogram of the given definition inside its
+    // folder. Missing folders are created
+    //
     
     // Store current dirctory
     TDirectory *savdir = gDirectory;
@@ -259,25 +368,23 @@ TH2D* AtlHistogramTool::Add(const char* hname, const char* title,
 
     // Check if the histogram belongs to a subfolder
     // and create folder if necessary 
-    TString dirname = gSystem->DirName(hname);
+    TString dirname = gSystem->DirName(h_obj->GetName());
     if ( dirname != "." ) {
 	MkDirWithParents(dirname.Data());
     }
 
-    // Check if a histogram with the same name already exists in the
-    // current folder
-    const char* bname = gSystem->BaseName(hname); 
+    // Check if an object with the same name already exists in the
+    // current folder (clashes within the tool are excluded by
+    // Register() already)
+    const char* bname = gSystem->BaseName(h_obj->GetName()); 
     if ( gDirectory->FindObject(bname) != 0 ) {
-	Error("Add", "Histogram with given name \"%s\" exists already in the current folder. Please use a different name. Abort!", bname);
+	Error("Add", "Histogram with given name \"%s\" exists already in the current folder"
+	      "\"%s\". Please use a different name. Abort!", bname, gDirectory->GetPath());
 	gSystem->Abort(1);
     }
     
-    // Create and add histogram
-    TH2D *h = new TH2D(bname, title, nbinsx, xlow, xup, nbinsy, ybins);
-    h->SetXTitle(xtitle);
-    h->SetYTitle(ytitle);
-    h->SetZTitle(ztitle);
-    fHistograms->Add(new AtlHistObject(hname, title, h));
+    // Create histogram
+    TH1 *h = h_obj->Book();
 
     // Restore pwd
     savdir->cd();
@@ -303,6 +410,13 @@ void AtlHistogramTool::Fill(const char* name, Double_t x, Double_t w) {
 	gSystem->Abort(1);
     }
     TH1D *h = (TH1D*)h_obj->GetHistogram();
+    if ( h == 0 ) {
+	if ( fCompact ) {
+	    h_obj->GetContents(fFloatContents)->Fill(x, w);
+	    return;
+	}
+	h = (TH1D*)Book(h_obj);
+    }
     h->Fill(x, w);
 }
 
@@ -325,6 +439,13 @@ void AtlHistogramTool::Fill(const char* name, Double_t x, Double_t y,
 	gSystem->Abort(1);
     }
     TH2D *h = (TH2D*)h_obj->GetHistogram();
+    if ( h == 0 ) {
+	if ( fCompact ) {
+	    h_obj->GetContents(fFloatContents)->Fill(x, y, w);
+	    return;
+	}
+	h = (TH2D*)Book(h_obj);
+    }
     h->Fill(x, y, w);
 }
 
@@ -360,6 +481,63 @@ TDirectory* AtlHistogramTool::MkDirWithParents(const char* dir) {
 
 //____________________________________________________________________
 
+TH1* AtlHistogramTool::GetHistogram(const char* name) {
+    //
+    // Return the given histogram. Defined histograms which are not
+    // booked yet or kept in compact storage are created now
+    //
+    AtlHistObject *h_obj = (AtlHistObject*)fHistograms->FindObject(name);
+    if ( h_obj == 0 ) {
+	Error("GetHistogram",
+	      "Histogram \"%s\" not found. Check histogram name! Abort.",
+	      name);
+	gSystem->Abort(1);
+    }
+    TH1 *h = h_obj->GetHistogram();
+    if ( h == 0 ) h = Book(h_obj);
+    return h;
+}
+
+//____________________________________________________________________
+
+void AtlHistogramTool::Terminate() {
+    //
+    // Terminate tool. Compact contents are converted into standard
+    // histograms to be written. Defined histograms which have never
+    // been filled are booked now, unless empty histograms are to be
+    // skipped. Histograms without entries are removed from the output
+    // file if requested
+    //
+    Int_t nbooked = 0, nlazy = 0, nskipped = 0;
+    AtlHistObject *h_obj = 0;
+    TIter next_hist(fHistograms);
+    while ( (h_obj = (AtlHistObject*)next_hist()) ) {
+	TH1 *h = h_obj->GetHistogram();
+	if ( h == 0 ) {
+	    if ( fSkipEmpty && !h_obj->HasContents() ) {
+		nskipped++;
+		continue;
+	    }
+	    h = Book(h_obj);
+	    nlazy++;
+	}
+	if ( fSkipEmpty && h->GetEntries() == 0 ) {
+	    delete h; // removes the histogram from its folder
+	    h_obj->SetHistogram(0);
+	    nskipped++;
+	    continue;
+	}
+	nbooked++;
+    }
+    if ( nlazy > 0 || nskipped > 0 ) {
+	Info("Terminate", "Writing %d of %d registered histograms (%d booked at the end, %d empty ones skipped, %d binnings).",
+	     nbooked, fHistograms->GetEntries(), nlazy, nskipped,
+	     fBinnings->GetEntries());
+    }
+}
+
+//____________________________________________________________________
+
 void AtlHistogramTool::Print() const {
     //
     // Print tool configuration
@@ -367,6 +545,16 @@ void AtlHistogramTool::Print() const {
     Info("Print", "Registered analysis tool \"%s\" of type AtlHistogramTool with the following configuration:",
 	 GetName());
     cout << endl;
-    fParentDir->ls();
+    Int_t nlazy = 0;
+    TIter next_hist(fHistograms);
+    AtlHistObject *h_obj = 0;
+    while ( (h_obj = (AtlHistObject*)next_hist()) ) {
+	if ( h_obj->GetHistogram() == 0 ) nlazy++;
+    }
+    if ( nlazy > 0 ) {
+	cout << "  Lazy booking: " << nlazy << " of " << fHistograms->GetEntries()
+	     << " registered histograms not booked yet" << endl;
+    }
+    if ( fParentDir != 0 ) fParentDir->ls();
     cout << endl;
 }
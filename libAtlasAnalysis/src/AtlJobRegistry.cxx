@@ -0,0 +1,565 @@
+//____________________________________________________________________
+//
+// Compiled factories and job driver for A++ analysis jobs
+//
+// Batch jobs are normally run by interpreting the analysis_run.C
+// script written by AtlAppAnalysisTask, i.e. every job pays for
+// starting the interpreter and parsing the selector, reader and
+// tool headers before the first event is read. This class lets a
+// small compiled executable (see libSingleTop/cmd/aplusplus-run.cxx)
+// set up the very same job from a plain-text job description
+// (analysis_run.job, written by AtlAppAnalysisTask::CreateJobDescription()).
+//
+// Selectors, event readers and analysis tools are created by
+// factories registered under their class name. Cuts are set via
+// AtlCutRegistry, either by name from the job description or, as
+// written by AtlAppAnalysisTask, from an already validated binary
+// configuration file. Classes without factory and cuts which are
+// not plain data fall back to the interpreter for that single
+// statement.
+//
+// Job description format (one statement per line, fields separated
+// by tabs, lines starting with '#' are comments):
+//
+//   Selector   <class>
+//   Output     <output file>
+//   Reader     <class>  <ctor args without the parent selector>
+//   ReaderSet  <member> <value>
+//   UseJobInfo <0|1>
+//   Tree       <input tree name> (default: taken from the reader)
+//   Input      <input file>
+//   InputList  <text file with comma/newline-separated input files>
+//   EntryList  <file containing app_entrylist>
+//   AntiList   <0|1>
+//   Set        <selector member> <value>
+//   Tool       <class>  <name> <title>
+//   ToolSet    <tool name> <member> <value>
+//   Config     <binary cut configuration (see AtlCutRegistry::WriteConfig())>
+//   Option     <option passed to TChain::Process()>
+//   NEvents, FirstEntry, NthEvent, Debug, WriteEntryList,
+//   WriteEventIndex, PrintEvent, PrintObjectTable <value>
+//   OutputTree <name> <title>
+//   EventProfiling <N slowest> <dump file>
+//
+// Usage:
+// ======
+// int main(int argc, char **argv) {
+//     AtlJobRegistry::RegisterAtlasAnalysis();
+//     AtlJobRegistry::RegisterSelector("MyAnalysis",
+//                                      AtlJobRegistry::NewSelector<MyAnalysis>);
+//     return AtlJobRegistry::RunJob(argv[1]);
+// }
+//
+#ifndef ATLAS_AtlJobRegistry
+#include <AtlJobRegistry.h>
+#endif
+#include <AtlSelector.h>
+#include <AtlEvtReaderBase.h>
+#include <AtlAnalysisTool.h>
+#include <AtlCutRegistry.h>
+#include <AtlBDecayGenTool.h>
+#include <AtlCtrlPlots.h>
+#include <AtlCutFlowTool.h>
+#include <AtlEvtReaderD3PDJetLepton.h>
+#include <AtlEvtReaderD3PDSgTopR2.h>
+#include <AtlExampleAnalysis.h>
+#include <AtlObjRecoScaleFactorTool.h>
+#include <AtlObjectsDefinitionToolR2.h>
+#include <AtlObjectsToolD3PDSgTop.h>
+#include <AtlQCDMMTool.h>
+#include <AtlRunEvtSelectionTool.h>
+#include <AtlSystematicsTool.h>
+#include <AtlTriggerTool.h>
+#include <TChain.h>
+#include <TClass.h>
+#include <TEntryList.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TROOT.h>
+#include <fstream>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlJobRegistry);
+#endif
+
+//____________________________________________________________________
+
+map<string, AtlJobRegistry::SelectorFactory_t>& AtlJobRegistry::Selectors() {
+    //
+    // Registered selector factories
+    //
+    static map<string, SelectorFactory_t> selectors;
+    return selectors;
+}
+
+//____________________________________________________________________
+
+map<string, AtlJobRegistry::ReaderFactory_t>& AtlJobRegistry::Readers() {
+    //
+    // Registered event reader factories
+    //
+    static map<string, ReaderFactory_t> readers;
+    return readers;
+}
+
+//____________________________________________________________________
+
+map<string, AtlJobRegistry::ToolFactory_t>& AtlJobRegistry::Tools() {
+    //
+    // Registered analysis tool factories
+    //
+    static map<string, ToolFactory_t> tools;
+    return tools;
+}
+
+//____________________________________________________________________
+
+vector<string>& AtlJobRegistry::Fallbacks() {
+    //
+    // Classes of the current job created via the interpreter
+    //
+    static vector<string> fallbacks;
+    return fallbacks;
+}
+
+//____________________________________________________________________
+
+void AtlJobRegistry::RegisterSelector(const char* ClassName,
+				      SelectorFactory_t factory) {
+    //
+    // Register factory for the given selector class
+    //
+    Selectors()[ClassName] = factory;
+}
+
+//____________________________________________________________________
+
+void AtlJobRegistry::RegisterReader(const char* ClassName,
+				    ReaderFactory_t factory) {
+    //
+    // Register factory for the given event reader class
+    //
+    Readers()[ClassName] = factory;
+}
+
+//____________________________________________________________________
+
+void AtlJobRegistry::RegisterTool(const char* ClassName,
+				  ToolFactory_t factory) {
+    //
+    // Register factory for the given analysis tool class
+    //
+    Tools()[ClassName] = factory;
+}
+
+//____________________________________________________________________
+
+void AtlJobRegistry::RegisterAtlasAnalysis() {
+    //
+    // Register the selectors, readers and tools of libAtlasAnalysis
+    //
+    RegisterSelector("AtlExampleAnalysis", NewSelector<AtlExampleAnalysis>);
+
+    RegisterReader("AtlEvtReaderD3PDSgTopR2", NewD3PDReaderR2<AtlEvtReaderD3PDSgTopR2>);
+    RegisterReader("AtlEvtReaderD3PDJetLepton", NewD3PDReaderR2<AtlEvtReaderD3PDJetLepton>);
+
+    RegisterTool("AtlBDecayGenTool",           NewTool<AtlBDecayGenTool>);
+    RegisterTool("AtlCtrlPlots",               NewTool<AtlCtrlPlots>);
+    RegisterTool("AtlCutFlowTool",             NewTool<AtlCutFlowTool>);
+    RegisterTool("AtlObjRecoScaleFactorTool",  NewTool<AtlObjRecoScaleFactorTool>);
+    RegisterTool("AtlObjectsDefinitionToolR2", NewTool<AtlObjectsDefinitionToolR2>);
+    RegisterTool("AtlObjectsToolD3PDSgTop",    NewTool<AtlObjectsToolD3PDSgTop>);
+    RegisterTool("AtlQCDMMTool",               NewTool<AtlQCDMMTool>);
+    RegisterTool("AtlRunEvtSelectionTool",     NewTool<AtlRunEvtSelectionTool>);
+    RegisterTool("AtlSystematicsTool",         NewTool<AtlSystematicsTool>);
+    RegisterTool("AtlTriggerTool",             NewTool<AtlTriggerTool>);
+}
+
+//____________________________________________________________________
+
+AtlSelector* AtlJobRegistry::CreateSelector(const char* ClassName,
+					    const char* OutputFile) {
+    //
+    // Create selector of the given class. Unregistered classes are
+    // created via the interpreter
+    //
+    map<string, SelectorFactory_t>::iterator it = Selectors().find(ClassName);
+    if ( it != Selectors().end() ) return (it->second)(OutputFile);
+    ::Warning("AtlJobRegistry::CreateSelector",
+	      "No factory registered for selector %s. Use interpreter.",
+	      ClassName);
+    Fallbacks().push_back(ClassName);
+    return (AtlSelector*)gROOT->ProcessLineFast(Form("new %s(\"%s\");",
+						     ClassName, OutputFile));
+}
+
+//____________________________________________________________________
+
+AtlEvtReaderBase* AtlJobRegistry::CreateReader(const char* ClassName,
+					       AtlSelector *parent,
+					       const char* Args,
+					       TString &TreeName) {
+    //
+    // Create event reader of the given class. The constructor
+    // arguments (without the parent selector) are given as one
+    // comma-separated string, as for AtlAppAnalysisTask::SetEvtReader().
+    // The name of the tree to be read is returned in TreeName (if
+    // known). Unregistered classes or argument lists the factory does
+    // not understand are handled via the interpreter
+    //
+    TreeName = "";
+    map<string, ReaderFactory_t>::iterator it = Readers().find(ClassName);
+    if ( it != Readers().end() ) {
+	AtlEvtReaderBase *reader = (it->second)(parent, SplitArgs(Args), TreeName);
+	if ( reader != 0 ) return reader;
+    }
+    ::Warning("AtlJobRegistry::CreateReader",
+	      "No factory for reader %s(%s). Use interpreter.",
+	      ClassName, Args);
+    Fallbacks().push_back(ClassName);
+    TString cmd = Form("new %s((AtlSelector*)%p", ClassName, (void*)parent);
+    if ( Args != 0 && strlen(Args) > 0 ) cmd.Append(Form(", %s", Args));
+    cmd.Append(");");
+    AtlEvtReaderBase *reader = (AtlEvtReaderBase*)gROOT->ProcessLineFast(cmd.Data());
+    TClass *cl = TClass::GetClass(ClassName);
+    if ( reader != 0 && cl != 0 && cl->GetMethodAllAny("GetTreeName") != 0 ) {
+	TreeName = (const char*)gROOT->ProcessLineFast(Form("((%s*)%p)->GetTreeName();",
+							     ClassName, (void*)reader));
+    }
+    return reader;
+}
+
+//____________________________________________________________________
+
+AtlAnalysisTool* AtlJobRegistry::CreateTool(const char* ClassName,
+					    const char* name,
+					    const char* title) {
+    //
+    // Create analysis tool of the given class. Unregistered classes
+    // are created via the interpreter
+    //
+    map<string, ToolFactory_t>::iterator it = Tools().find(ClassName);
+    if ( it != Tools().end() ) return (it->second)(name, title);
+    ::Warning("AtlJobRegistry::CreateTool",
+	      "No factory registered for tool %s. Use interpreter.",
+	      ClassName);
+    Fallbacks().push_back(ClassName);
+    return (AtlAnalysisTool*)gROOT->ProcessLineFast(Form("new %s(\"%s\", \"%s\");",
+							 ClassName, name, title));
+}
+
+//____________________________________________________________________
+
+Bool_t AtlJobRegistry::SetMember(void *obj, TClass *cl,
+				 const char* MemberName,
+				 const char* Value) {
+    //
+    // Set the data member of the given name of the object obj (of
+    // class cl or derived) to the given value. The value is given
+    // as in the analysis_run.C script. It is converted and set via
+    // AtlCutRegistry.
+    //
+    // Returns kFALSE in case of error
+    //
+    const AtlCutRegistry::Spec *spec = AtlCutRegistry::GetSpec(cl, MemberName);
+    if ( spec == 0 ) {
+	::Error("AtlJobRegistry::SetMember", "Class %s has no data member %s",
+		cl->GetName(), MemberName);
+	return kFALSE;
+    }
+    AtlCutRegistry::Value val;
+    if ( !AtlCutRegistry::Parse(spec, Value, val) ) {
+	::Error("AtlJobRegistry::SetMember", "Invalid value %s for %s::%s",
+		Value, cl->GetName(), MemberName);
+	return kFALSE;
+    }
+    return AtlCutRegistry::Apply(obj, cl, MemberName, val);
+}
+
+//____________________________________________________________________
+
+vector<string> AtlJobRegistry::SplitArgs(const char* Args) {
+    //
+    // Split comma-separated argument list (commas inside quotes are
+    // kept). Surrounding white space and quotes are removed
+    //
+    vector<string> args;
+    if ( Args == 0 ) return args;
+    TString arg;
+    Bool_t quoted = kFALSE;
+    for ( const char *c = Args; ; c++ ) {
+	if ( *c == '"' ) quoted = !quoted;
+	if ( *c == '\0' || ( *c == ',' && !quoted ) ) {
+	    arg = arg.Strip(TString::kBoth);
+	    if ( arg.Length() > 1 && arg.BeginsWith("\"") && arg.EndsWith("\"") )
+		arg = arg(1, arg.Length()-2);
+	    if ( arg.Length() > 0 || *c == ',' ) args.push_back(arg.Data());
+	    arg = "";
+	    if ( *c == '\0' ) break;
+	} else {
+	    arg.Append(*c);
+	}
+    }
+    return args;
+}
+
+//____________________________________________________________________
+
+Int_t AtlJobRegistry::RunJob(const char* JobFile) {
+    //
+    // Set up and run the A++ analysis job given by the job
+    // description file (see above). Returns 0 on success
+    //
+    ifstream in(JobFile);
+    if ( !in ) {
+	::Error("AtlJobRegistry::RunJob", "Cannot open job description %s",
+		JobFile);
+	return 1;
+    }
+
+    // Parse job description
+    TString selector, output, reader, readerargs, treename, option, config;
+    Bool_t usejobinfo = kFALSE, antilist = kFALSE;
+    vector<string> inputs, inputlists, entrylists;
+    vector<vector<string> > readersets, selsets, tools, toolsets, selflags;
+    Long64_t nevents = TChain::kBigNumber, firstentry = 0;
+    Int_t debug = 0;
+    TString line;
+    while ( line.ReadLine(in) ) {
+	if ( line.BeginsWith("#") || line.Strip(TString::kBoth).Length() == 0 )
+	    continue;
+	vector<string> f;
+	Ssiz_t start = 0, pos = 0;
+	while ( (pos = line.Index("\t", start)) != kNPOS ) {
+	    f.push_back(TString(line(start, pos-start)).Data());
+	    start = pos+1;
+	}
+	f.push_back(TString(line(start, line.Length()-start)).Data());
+	const TString key = f[0].c_str();
+	const char* v1 = ( f.size() > 1 ) ? f[1].c_str() : "";
+	const char* v2 = ( f.size() > 2 ) ? f[2].c_str() : "";
+
+	if ( key == "Selector" ) {
+	    selector = v1;
+	} else if ( key == "Output" ) {
+	    output = v1;
+	} else if ( key == "Reader" ) {
+	    reader = v1; readerargs = v2;
+	} else if ( key == "ReaderSet" && f.size() > 2 ) {
+	    readersets.push_back(vector<string>(f.begin()+1, f.end()));
+	} else if ( key == "UseJobInfo" ) {
+	    usejobinfo = atoi(v1);
+	} else if ( key == "Tree" ) {
+	    treename = v1;
+	} else if ( key == "Input" ) {
+	    inputs.push_back(v1);
+	} else if ( key == "InputList" ) {
+	    inputlists.push_back(v1);
+	} else if ( key == "EntryList" ) {
+	    entrylists.push_back(v1);
+	} else if ( key == "AntiList" ) {
+	    antilist = atoi(v1);
+	} else if ( key == "Set" && f.size() > 2 ) {
+	    selsets.push_back(vector<string>(f.begin()+1, f.end()));
+	} else if ( key == "Tool" && f.size() > 3 ) {
+	    tools.push_back(vector<string>(f.begin()+1, f.end()));
+	} else if ( key == "ToolSet" && f.size() > 3 ) {
+	    toolsets.push_back(vector<string>(f.begin()+1, f.end()));
+	} else if ( key == "Config" ) {
+	    config = v1;
+	} else if ( key == "Option" ) {
+	    option = v1;
+	} else if ( key == "NEvents" ) {
+	    nevents = strtoll(v1, 0, 10);
+	} else if ( key == "FirstEntry" ) {
+	    firstentry = strtoll(v1, 0, 10);
+	} else if ( key == "Debug" ) {
+	    debug = atoi(v1);
+	} else if ( key == "NthEvent" || key == "OutputTree"
+		    || key == "WriteEntryList" || key == "WriteEventIndex"
+		    || key == "PrintEvent" || key == "PrintObjectTable"
+		    || key == "EventProfiling" ) {
+	    selflags.push_back(f);
+	} else {
+	    ::Warning("AtlJobRegistry::RunJob",
+		      "Unknown statement \"%s\" in %s. Ignored.",
+		      key.Data(), JobFile);
+	}
+    }
+    in.close();
+    if ( selector.IsNull() || output.IsNull() ) {
+	::Error("AtlJobRegistry::RunJob",
+		"No selector or output file given in %s", JobFile);
+	return 1;
+    }
+    if ( debug > 0 ) gDebug = debug;
+
+    // Selector
+    AtlSelector *sel = CreateSelector(selector.Data(), output.Data());
+    if ( sel == 0 ) {
+	::Error("AtlJobRegistry::RunJob", "Could not create selector %s",
+		selector.Data());
+	return 1;
+    }
+
+    // Event reader
+    TString readertree;
+    if ( !reader.IsNull() ) {
+	AtlEvtReaderBase *rd = CreateReader(reader.Data(), sel,
+					    readerargs.Data(), readertree);
+	if ( rd == 0 ) {
+	    ::Error("AtlJobRegistry::RunJob", "Could not create reader %s",
+		    reader.Data());
+	    return 1;
+	}
+	for ( size_t i = 0; i < readersets.size(); i++ ) {
+	    if ( !SetMember(dynamic_cast<void*>(rd), rd->IsA(), readersets[i][0].c_str(),
+			    readersets[i][1].c_str()) ) return 1;
+	}
+	sel->SetEvtReader(rd, usejobinfo);
+    }
+
+    // Entry lists
+    if ( entrylists.size() > 0 ) {
+	TEntryList *elist = new TEntryList();
+	for ( size_t i = 0; i < entrylists.size(); i++ ) {
+	    TFile *f = TFile::Open(entrylists[i].c_str(), "read");
+	    if ( f == 0 || f->IsZombie() ) {
+		::Error("AtlJobRegistry::RunJob", "Cannot open entry-list file %s",
+			entrylists[i].c_str());
+		delete f; delete elist;
+		return 1;
+	    }
+	    TEntryList *l = dynamic_cast<TEntryList*>(f->Get("app_entrylist"));
+	    if ( l == 0 ) {
+		::Error("AtlJobRegistry::RunJob", "No entry list app_entrylist in file %s",
+			entrylists[i].c_str());
+		delete f; delete elist;
+		return 1;
+	    }
+	    elist->Add(l); // copies the list
+	    delete f;
+	}
+	if ( !sel->SetInputEntryList(elist, antilist) ) {
+	    delete elist;
+	    return 1;
+	}
+    }
+
+    // Selector switches
+    for ( size_t i = 0; i < selflags.size(); i++ ) {
+	const vector<string> &f = selflags[i];
+	const TString key = f[0].c_str();
+	const char* v1 = ( f.size() > 1 ) ? f[1].c_str() : "";
+	const char* v2 = ( f.size() > 2 ) ? f[2].c_str() : "";
+	if ( key == "NthEvent" ) {
+	    sel->SetNProcessNthEventsOnly(atoi(v1));
+	} else if ( key == "OutputTree" ) {
+	    sel->SetOutputTree(v1, v2);
+	} else if ( key == "WriteEntryList" ) {
+	    sel->SetWriteEntryList(atoi(v1));
+	} else if ( key == "WriteEventIndex" ) {
+	    sel->SetWriteEventIndex(atoi(v1));
+	} else if ( key == "PrintEvent" ) {
+	    sel->SetPrintEvent(atoi(v1));
+	} else if ( key == "PrintObjectTable" ) {
+	    sel->SetPrintObjectTable(atoi(v1));
+	} else if ( key == "EventProfiling" ) {
+	    sel->SetEventProfiling(atoi(v1), v2);
+	}
+    }
+
+    // Selection cuts
+    for ( size_t i = 0; i < selsets.size(); i++ ) {
+	if ( !SetMember(dynamic_cast<void*>(sel), sel->IsA(), selsets[i][0].c_str(),
+			selsets[i][1].c_str()) ) return 1;
+    }
+
+    // Tools and their cuts
+    map<string, AtlAnalysisTool*> toolmap;
+    vector<AtlAnalysisTool*> toollist;
+    for ( size_t i = 0; i < tools.size(); i++ ) {
+	AtlAnalysisTool *tool = CreateTool(tools[i][0].c_str(),
+					   tools[i][1].c_str(),
+					   tools[i][2].c_str());
+	if ( tool == 0 ) {
+	    ::Error("AtlJobRegistry::RunJob", "Could not create tool %s",
+		    tools[i][0].c_str());
+	    return 1;
+	}
+	sel->AddTool(tool);
+	toolmap[tools[i][1]] = tool;
+	toollist.push_back(tool);
+    }
+    for ( size_t i = 0; i < toolsets.size(); i++ ) {
+	map<string, AtlAnalysisTool*>::iterator it = toolmap.find(toolsets[i][0]);
+	if ( it == toolmap.end() ) {
+	    ::Error("AtlJobRegistry::RunJob", "Unknown tool %s",
+		    toolsets[i][0].c_str());
+	    return 1;
+	}
+	if ( !SetMember(dynamic_cast<void*>(it->second), it->second->IsA(), toolsets[i][1].c_str(),
+			toolsets[i][2].c_str()) ) return 1;
+    }
+
+    // Validated cut configuration. Target 0 is the selector, i>0 the
+    // i-th tool
+    if ( !config.IsNull() ) {
+	vector<AtlCutRegistry::Entry> entries;
+	if ( !AtlCutRegistry::ReadConfig(config.Data(), entries) ) return 1;
+	for ( size_t i = 0; i < entries.size(); i++ ) {
+	    const AtlCutRegistry::Entry &e = entries[i];
+	    TObject *obj = sel;
+	    if ( e.fTarget > 0 && e.fTarget <= (Int_t)toollist.size() ) {
+		obj = toollist[e.fTarget-1];
+	    } else if ( e.fTarget != 0 ) {
+		::Error("AtlJobRegistry::RunJob", "No tool no. %d in %s",
+			e.fTarget, JobFile);
+		return 1;
+	    }
+	    if ( !AtlCutRegistry::Apply(dynamic_cast<void*>(obj), obj->IsA(), e) )
+		return 1;
+	}
+    }
+
+    // Classes without factory slow down every job. Remind the user
+    // to register them (see aplusplus-run.cxx)
+    if ( !Fallbacks().empty() ) {
+	TString classes;
+	for ( size_t i = 0; i < Fallbacks().size(); i++ ) {
+	    if ( i > 0 ) classes.Append(", ");
+	    classes.Append(Fallbacks()[i].c_str());
+	}
+	::Warning("AtlJobRegistry::RunJob",
+		  "%d object(s) created via the interpreter (%s). Register their factories in the job driver to avoid this.",
+		  (Int_t)Fallbacks().size(), classes.Data());
+    }
+
+    // Input chain
+    if ( treename.IsNull() ) treename = readertree;
+    TChain *ch = new TChain(treename.Data());
+    for ( size_t i = 0; i < inputs.size(); i++ ) ch->Add(inputs[i].c_str());
+    for ( size_t i = 0; i < inputlists.size(); i++ ) {
+	ifstream input_files(inputlists[i].c_str());
+	while ( line.ReadLine(input_files) ) {
+	    if ( line.BeginsWith("#") || line.Length() == 0 ) continue;
+	    TObjArray *tokens = line.Tokenize(",");
+	    for ( Int_t j = 0; j < tokens->GetEntriesFast(); j++ )
+		ch->Add(((TObjString*)tokens->At(j))->GetString().Data());
+	    delete tokens;
+	}
+    }
+
+    // Process chain
+    Long64_t status = ch->Process((TSelector*)sel, option.Data(), nevents, firstentry);
+    delete ch;
+    if ( status < 0 ) {
+	::Error("AtlJobRegistry::RunJob", "Processing of the input chain failed");
+	return 1;
+    }
+    return 0;
+}
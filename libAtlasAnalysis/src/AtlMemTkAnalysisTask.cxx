@@ -48,6 +48,10 @@ AtlMemTkAnalysisTask::AtlMemTkAnalysisTask(const char* name, const char* title)
     fTarBallOnly = kFALSE;
     fGridAnalysisOnGrid = kFALSE;
     fGridUsePrecompiledMem = kTRUE;
+    fFirstEntry = 0;
+    fNEntries = -1;
+    fInputTreeName = "physics";
+    fTimingFile = "";
 
     // Set environment variables for common libraries
     AddUserEnv("LIBATLASANALYSIS");
@@ -226,27 +230,36 @@ void AtlMemTkAnalysisTask::CreateRunScript(Option_t *option) {
         Error("CreateRunScript", "No MemTk run script defined. Abort!");
         gSystem->Abort();
     }
+    TString inputfile = ((TObjString*) fInputFiles->At(0))->GetString();
+    if ( fIsTest ) {
+        // use this if analysis was also run with "test"
+        inputfile.Append("_test");
+    }
+
+    // Cost-aware splitting: the sub-job runs over a copy of its entry
+    // range only, MemTk itself does not split any further
+    Bool_t use_range = ( fNEntries >= 0 );
+    if ( use_range ) {
+        WriteEntryRangeSkim(out, inputfile.Data(), "subjob_input.root");
+    }
+
 //    out << "cp " << fMemTkRunScript->Data() << " analysis_run.C"
     out << "cp $LIBMEM/test/" << fMemTkRunScript->Data() << " analysis_run.C"
         << endl
         << "sed -i 's|NSUBJOBS|"
-        << fNSubjobs
+        << ( use_range ? 1 : fNSubjobs )
         << "|g' analysis_run.C"
         << endl
         << "sed -i 's|INPUTFILE|"
-        << ((TObjString*) fInputFiles->At(0))->GetString().Data();
-    if ( fIsTest ) {
-        // use this if analysis was also run with "test"
-        out << "_test";
-    }
-    out << "|g' analysis_run.C"
+        << ( use_range ? "subjob_input.root" : inputfile.Data() )
+        << "|g' analysis_run.C"
         << endl
         << "sed -i 's|OUTPUTFILE|"
         << fOutputFileName->Data()
         << "|g' analysis_run.C"
         << endl
         << "sed -i 's|SUBJOBID|"
-        << fJobid
+        << ( use_range ? 1 : fJobid )
         << "|g' analysis_run.C"
         << endl;
     if ( !fD3PDVersion.EqualTo("") ) {
@@ -264,13 +277,68 @@ void AtlMemTkAnalysisTask::CreateRunScript(Option_t *option) {
             << endl;
     }
 
+    // Record the integration time of the processed entry range for
+    // the cost-aware splitting of subsequent runs (only possible if
+    // the range is known, ie. not split by MemTk)
+    Bool_t record_timing = !fTimingFile.IsNull() && ( use_range || fNSubjobs == 1 );
+    if ( record_timing ) {
+        out << "MEMTK_START=`date +%s`" << endl;
+    }
     out << "root -q -l -b analysis_run.C > " << fLogFilePath->Data()
-        << " 2>&1" << endl;
+        << " 2>&1";
+    if ( record_timing ) {
+        out << " && echo \"" << inputfile.Data() << " "
+            << ( use_range ? fFirstEntry : 0 ) << " "
+            << ( use_range ? fNEntries : -1 )
+            << " $((`date +%s` - MEMTK_START))\" >> " << fTimingFile.Data();
+    }
+    out << endl;
+    if ( use_range ) {
+        out << "rm -f subjob_input.root" << endl;
+    }
     out.close();
 }
 
 //____________________________________________________________________
 
+void AtlMemTkAnalysisTask::WriteEntryRangeSkim(ofstream &out,
+                                               const char* InputFile,
+                                               const char* SkimFile) {
+    //
+    // Write the run script commands copying the entry range of this
+    // sub-job from the input tree into SkimFile. All other top-level
+    // objects of the input file (eg. job info histograms) are copied
+    // for the first sub-job only, so that they are not counted twice
+    // when the sub-job outputs are merged.
+    //
+    out << "# Copy entries [" << fFirstEntry << ","
+        << fFirstEntry + fNEntries << ") of the input tree" << endl
+        << "cat > skim_input.C << 'EOF'" << endl
+        << "void skim_input() {" << endl
+        << "    TFile *in = TFile::Open(\"" << InputFile << "\");" << endl
+        << "    TFile *out = new TFile(\"" << SkimFile << "\", \"RECREATE\");" << endl
+        << "    TIter next_key(in->GetListOfKeys());" << endl
+        << "    TKey *key = 0;" << endl
+        << "    while ( (key = (TKey*)next_key()) ) {" << endl
+        << "        if ( out->GetListOfKeys()->FindObject(key->GetName()) ) continue;" << endl
+        << "        TObject *obj = key->ReadObj();" << endl
+        << "        out->cd();" << endl
+        << "        if ( strcmp(key->GetName(), \"" << fInputTreeName.Data() << "\") == 0 ) {" << endl
+        << "            ((TTree*)obj)->CopyTree(\"\", \"\", "
+        << fNEntries << ", " << fFirstEntry << ")->Write();" << endl
+        << "        } else if ( " << fJobid << " == 1 && !obj->InheritsFrom(\"TDirectory\") ) {" << endl
+        << "            obj->Write(key->GetName());" << endl
+        << "        }" << endl
+        << "    }" << endl
+        << "    out->Close();" << endl
+        << "    in->Close();" << endl
+        << "}" << endl
+        << "EOF" << endl
+        << "root -q -l -b skim_input.C > skim_input.log 2>&1 || exit 1" << endl;
+}
+
+//____________________________________________________________________
+
 void AtlMemTkAnalysisTask::CreateGridRunScript() {
     //
     // Create run script for job submission
@@ -342,10 +410,27 @@ void AtlMemTkAnalysisTask::CreateGridRunScript() {
     out << "cp $LIBMEM/test/" << fMemTkRunScript->Data() << " mem_analysis_run.C"
 	<< endl
 	<< "sed -i 's|NSUBJOBS|"
-	<< fNSubjobs
+	<< ( fNEntries >= 0 ? 1 : fNSubjobs )
         << "|g' mem_analysis_run.C"
         << endl;
-    if ( fGridAnalysisOnGrid ) {
+    if ( fNEntries >= 0 ) {
+        // Cost-aware splitting: copy the entry range of this sub-job
+        // from the A++ output (produced by the same grid job or
+        // shipped as input file)
+        const char* inputfile = "app_output.root";
+        if ( !fGridAnalysisOnGrid ) {
+            out << "# Move input file"
+                << endl
+                << "mv " << gSystem->BaseName(((TObjString*) fInputFiles->At(0))->GetString().Data()) << " inputfile_all.root"
+                << endl;
+            inputfile = "inputfile_all.root";
+        }
+        WriteEntryRangeSkim(out, inputfile, "inputfile.root");
+        out << "sed -i 's|INPUTFILE|"
+            << "inputfile.root"
+            << "|g' mem_analysis_run.C"
+            << endl;
+    } else if ( fGridAnalysisOnGrid ) {
         out << "sed -i 's|INPUTFILE|"
             << "app_output.root"
             // << gSystem->BaseName(((TObjString*) fInputFiles->At(0))->GetString().Data())
@@ -367,7 +452,7 @@ void AtlMemTkAnalysisTask::CreateGridRunScript() {
         << "|g' mem_analysis_run.C"
         << endl
 	<< "sed -i 's|SUBJOBID|"
-	<< fJobid
+	<< ( fNEntries >= 0 ? 1 : fJobid )
         << "|g' mem_analysis_run.C"
         << endl;
     if ( !fD3PDVersion.EqualTo("") ) {
@@ -391,6 +476,20 @@ void AtlMemTkAnalysisTask::CreateGridRunScript() {
 
 //____________________________________________________________________
 
+void AtlMemTkAnalysisTask::SetEntryRange(Long64_t FirstEntry, Long64_t NEntries) {
+    //
+    // Restrict the job to the input entries [FirstEntry,
+    // FirstEntry+NEntries) (see AtlMemTkJobSplitter). The sub-job
+    // then runs MemTk over a copy of this range instead of letting
+    // MemTk split the input by event count. NEntries < 0 switches
+    // back to the splitting by MemTk.
+    //
+    fFirstEntry = FirstEntry;
+    fNEntries = NEntries;
+}
+
+//____________________________________________________________________
+
 void AtlMemTkAnalysisTask::AddUserEnv(const char* env) {
     //
     // Add user-defined environment variable for shared library search
@@ -436,7 +535,7 @@ void AtlMemTkAnalysisTask::SubmitGridJob() {
     TString cmd = "";
 
     // go to GRID_HOME directory
-    TString gridhome = gSystem->ExpandPathName("$GRID_HOME");
+    TString gridhome = ExpandPath("$GRID_HOME");
     gSystem->ChangeDirectory(gridhome.Data());
 
     TString pwd = gSystem->Getenv("PWD");
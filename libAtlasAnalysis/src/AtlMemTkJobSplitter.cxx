@@ -0,0 +1,362 @@
+//____________________________________________________________________
+//
+// Cost-aware splitting of MemTk jobs
+//
+// The matrix-element integration time per event differs by orders of
+// magnitude between channels and jet multiplicities. Instead of
+// splitting the MemTk input into sub-jobs of equal event counts
+// (MemMgr::SetNSubjobs()), the splitter estimates the integration
+// cost of every input entry and partitions the input tree into
+// contiguous entry ranges of balanced estimated CPU time.
+//
+// The per-entry cost is estimated in two steps:
+//
+//  1) Probe: the jet multiplicity of every entry is read from the
+//     input tree (expression given by SetJetMultiplicityExpr(),
+//     default "jet_n") and mapped onto a relative cost per event
+//     (see SetJetMultiplicityCost()).
+//
+//  2) Timing: every MemTk job running over an entry range appends
+//     the integration time of its range to a timing file (see
+//     AtlMemTkAnalysisTask::SetTimingFile()). The records of previous
+//     runs are read by ReadTimingFile(). The measured time of a range
+//     is distributed over its entries according to the probe costs;
+//     entries not covered by any record use the probe costs scaled
+//     to the measured time per probe unit.
+//
+// Since the sub-jobs cover contiguous entry ranges in ascending
+// order and their outputs are numbered by job id ("mem_xyz001.root",
+// ...), merging the outputs in file name order (eg. "hadd
+// mem_xyz.root mem_xyz[0-9]*.root") restores the original event order
+// expected by AtlEvtReaderMemR2.
+//
+// Timing file format (one record per line, '#' starts a comment):
+//   <input file> <first entry> <no. of entries (-1 = all)> <seconds>
+//
+// Usage:
+// ======
+// AtlMemTkJobSplitter splitter;
+// splitter.ReadTimingFile("memtk_timing.txt");
+// std::vector<Long64_t> first, n;
+// Int_t nsub = splitter.Split("app_output.root", 20, first, n);
+//
+#ifndef ATLAS_AtlMemTkJobSplitter
+#include <AtlMemTkJobSplitter.h>
+#endif
+#include <TFile.h>
+#include <TTree.h>
+#include <TSystem.h>
+#include <TMath.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlMemTkJobSplitter);
+#endif
+
+//____________________________________________________________________
+
+AtlMemTkJobSplitter::AtlMemTkJobSplitter(const char* name, const char* title) :
+    TNamed(name, title) {
+    //
+    // Default constructor
+    //
+    // The default probe costs grow by roughly one order of magnitude
+    // per additional jet (more partons to integrate over and more
+    // jet-parton assignments)
+    //
+    fTreeName = "physics";
+    fJetMultExpr = "jet_n";
+    fJetMultCost.push_back(1.);     // 0 jets
+    fJetMultCost.push_back(1.);     // 1 jet
+    fJetMultCost.push_back(1.);     // 2 jets
+    fJetMultCost.push_back(10.);    // 3 jets
+    fJetMultCost.push_back(100.);   // >=4 jets
+}
+
+//____________________________________________________________________
+
+AtlMemTkJobSplitter::~AtlMemTkJobSplitter() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlMemTkJobSplitter::SetJetMultiplicityCost(Int_t NJets, Double_t Cost) {
+    //
+    // Set the relative integration cost of an event with the given
+    // jet multiplicity. The cost of the highest multiplicity set is
+    // used for all higher multiplicities.
+    //
+    if ( NJets < 0 || Cost <= 0. ) {
+	Error(__FUNCTION__, "Invalid cost %f for %d jets. Abort!",
+	      Cost, NJets);
+	gSystem->Abort(0);
+    }
+    if ( NJets >= (Int_t)fJetMultCost.size() )
+	fJetMultCost.resize(NJets+1, fJetMultCost.back());
+    fJetMultCost[NJets] = Cost;
+}
+
+//____________________________________________________________________
+
+void AtlMemTkJobSplitter::AddTiming(const char* InputFile, Long64_t FirstEntry,
+				    Long64_t NEntries, Double_t Seconds) {
+    //
+    // Add the measured integration time of an entry range of the
+    // given input file. Later records supersede earlier ones for
+    // overlapping ranges.
+    //
+    fTimingFiles.push_back(InputFile);
+    fTimingFirst.push_back(FirstEntry);
+    fTimingN.push_back(NEntries);
+    fTimingSec.push_back(Seconds);
+}
+
+//____________________________________________________________________
+
+Int_t AtlMemTkJobSplitter::ReadTimingFile(const char* TimingFile) {
+    //
+    // Read the timing records of previous MemTk runs. Returns the
+    // number of records read. A missing file is not an error (no
+    // previous run).
+    //
+    ifstream in(TimingFile);
+    if ( !in.is_open() ) {
+	Info(__FUNCTION__, "No timing file %s found. Use probe costs only.",
+	     TimingFile);
+	return 0;
+    }
+    Int_t nrec = 0;
+    string line;
+    while ( getline(in, line) ) {
+	if ( line.empty() || line[0] == '#' ) continue;
+	istringstream rec(line);
+	string file;
+	Long64_t first = 0, n = 0;
+	Double_t sec = 0.;
+	if ( !(rec >> file >> first >> n >> sec) || first < 0 || sec < 0. ) {
+	    Warning(__FUNCTION__, "Skip malformed record \"%s\" in %s",
+		    line.c_str(), TimingFile);
+	    continue;
+	}
+	AddTiming(file.c_str(), first, n, sec);
+	nrec++;
+    }
+    Info(__FUNCTION__, "Read %d timing records from %s", nrec, TimingFile);
+    return nrec;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlMemTkJobSplitter::ProbeCosts(const char* InputFile,
+				       vector<Double_t> &cost) {
+    //
+    // Compute the probe cost of every entry of the input tree from
+    // its jet multiplicity. If the expression cannot be evaluated, a
+    // uniform cost is used. Returns kFALSE if the input tree cannot be
+    // read.
+    //
+    cost.clear();
+    TFile *f = TFile::Open(InputFile, "READ");
+    if ( f == 0 || f->IsZombie() ) {
+	Error(__FUNCTION__, "Cannot open input file %s", InputFile);
+	delete f;
+	return kFALSE;
+    }
+    TTree *t = dynamic_cast<TTree*>(f->Get(fTreeName.Data()));
+    if ( t == 0 ) {
+	Error(__FUNCTION__, "No tree \"%s\" found in input file %s",
+	      fTreeName.Data(), InputFile);
+	delete f;
+	return kFALSE;
+    }
+    Long64_t nentries = t->GetEntries();
+    cost.assign(nentries, 1.);
+    if ( nentries > 0 ) {
+	// Only the branches of the expression are read
+	t->SetEstimate(nentries+1);
+	Long64_t nsel = t->Draw(fJetMultExpr.Data(), "", "goff");
+	if ( nsel != nentries || t->GetV1() == 0 ) {
+	    Warning(__FUNCTION__,
+		    "Cannot evaluate \"%s\" for all entries of %s. Use uniform probe costs.",
+		    fJetMultExpr.Data(), InputFile);
+	} else {
+	    Double_t *njets = t->GetV1();
+	    Int_t nmax = fJetMultCost.size() - 1;
+	    for ( Long64_t i = 0; i < nentries; i++ ) {
+		Int_t nj = TMath::Max(0, TMath::Min(nmax, (Int_t)njets[i]));
+		cost[i] = fJetMultCost[nj];
+	    }
+	}
+    }
+    delete f;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Int_t AtlMemTkJobSplitter::Split(const char* InputFile, Int_t NSubjobs,
+				 vector<Long64_t> &FirstEntry,
+				 vector<Long64_t> &NEntries) {
+    //
+    // Partition the input tree into at most NSubjobs contiguous entry
+    // ranges of balanced estimated integration time. The ranges are
+    // returned in ascending entry order. Returns the number of
+    // sub-jobs, 0 in case the input cannot be read.
+    //
+    FirstEntry.clear();
+    NEntries.clear();
+
+    vector<Double_t> cost;
+    if ( !ProbeCosts(InputFile, cost) ) return 0;
+    Long64_t nentries = cost.size();
+    if ( nentries == 0 ) {
+	FirstEntry.push_back(0);
+	NEntries.push_back(0);
+	return 1;
+    }
+
+    // Distribute the measured times over the entries of their ranges
+    vector<Double_t> measured(nentries, -1.);
+    Int_t nrec = 0;
+    for ( size_t r = 0; r < fTimingSec.size(); r++ ) {
+	if ( fTimingFiles[r] != InputFile ) continue;
+	Long64_t first = fTimingFirst[r];
+	Long64_t last  = ( fTimingN[r] < 0 ) ? nentries
+	    : TMath::Min(nentries, first + fTimingN[r]);
+	if ( first >= last ) continue;
+	Double_t sum = 0.;
+	for ( Long64_t i = first; i < last; i++ ) sum += cost[i];
+	for ( Long64_t i = first; i < last; i++ )
+	    measured[i] = fTimingSec[r] * cost[i] / sum;
+	nrec++;
+    }
+
+    // Scale the probe costs of uncovered entries to seconds
+    Double_t sum_meas = 0., sum_probe = 0.;
+    for ( Long64_t i = 0; i < nentries; i++ ) {
+	if ( measured[i] < 0. ) continue;
+	sum_meas += measured[i];
+	sum_probe += cost[i];
+    }
+    Double_t scale = ( sum_probe > 0. && sum_meas > 0. )
+	? sum_meas / sum_probe : 1.;
+    Double_t total = 0.;
+    for ( Long64_t i = 0; i < nentries; i++ ) {
+	cost[i] = ( measured[i] < 0. ) ? cost[i] * scale : measured[i];
+	total += cost[i];
+    }
+
+    // Greedy partitioning into contiguous ranges
+    if ( NSubjobs < 1 ) NSubjobs = 1;
+    if ( NSubjobs > nentries ) NSubjobs = nentries;
+    Double_t target = total / NSubjobs;
+    Double_t cum = 0., max_cost = 0., job_cost = 0.;
+    Long64_t first = 0;
+    for ( Long64_t i = 0; i < nentries; i++ ) {
+	cum += cost[i];
+	job_cost += cost[i];
+	Int_t njobs = FirstEntry.size();
+	Long64_t left = nentries - i - 1;
+	// Cut once the cumulative cost reaches the next boundary, but
+	// keep at least one entry for each of the remaining sub-jobs
+	Bool_t cut = ( cum >= target * (njobs + 1) && njobs < NSubjobs - 1 )
+	    || ( left == NSubjobs - njobs - 1 && njobs < NSubjobs - 1 )
+	    || left == 0;
+	if ( cut ) {
+	    FirstEntry.push_back(first);
+	    NEntries.push_back(i + 1 - first);
+	    max_cost = TMath::Max(max_cost, job_cost);
+	    first = i + 1;
+	    job_cost = 0.;
+	}
+    }
+
+    Info(__FUNCTION__,
+	 "Split %lld entries of %s into %d sub-jobs (%d timing records used). Estimated cost: total = %g, max/mean per sub-job = %.2f",
+	 nentries, InputFile, (Int_t)FirstEntry.size(), nrec, total,
+	 ( total > 0. ) ? max_cost / (total / FirstEntry.size()) : 1.);
+    return FirstEntry.size();
+}
+
+//____________________________________________________________________
+
+Int_t AtlMemTkJobSplitter::ReadSplit(const char* SplitFile,
+				     vector<Long64_t> &FirstEntry,
+				     vector<Long64_t> &NEntries) {
+    //
+    // Read the entry ranges of a previous split (see WriteSplit()).
+    // Returns the number of sub-jobs, 0 if the file does not exist.
+    //
+    FirstEntry.clear();
+    NEntries.clear();
+    ifstream in(SplitFile);
+    if ( !in.is_open() ) return 0;
+    Long64_t first = 0, n = 0;
+    while ( in >> first >> n ) {
+	FirstEntry.push_back(first);
+	NEntries.push_back(n);
+    }
+    return FirstEntry.size();
+}
+
+//____________________________________________________________________
+
+Bool_t AtlMemTkJobSplitter::WriteSplit(const char* SplitFile,
+				       const vector<Long64_t> &FirstEntry,
+				       const vector<Long64_t> &NEntries) {
+    //
+    // Store the entry ranges of a split (one sub-job per line). The
+    // ranges of a split must stay fixed as long as any of its sub-jobs
+    // has to be (re-)run, since the outputs of successful sub-jobs are
+    // kept.
+    //
+    gSystem->mkdir(gSystem->DirName(SplitFile), kTRUE);
+    ofstream out(SplitFile);
+    if ( !out.is_open() ) {
+	::Error("AtlMemTkJobSplitter::WriteSplit",
+		"Cannot write split file %s", SplitFile);
+	return kFALSE;
+    }
+    for ( size_t i = 0; i < FirstEntry.size(); i++ )
+	out << FirstEntry[i] << " " << NEntries[i] << endl;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+void AtlMemTkJobSplitter::Clear(Option_t *option) {
+    //
+    // Remove all timing records
+    //
+    fTimingFiles.clear();
+    fTimingFirst.clear();
+    fTimingN.clear();
+    fTimingSec.clear();
+}
+
+//____________________________________________________________________
+
+void AtlMemTkJobSplitter::Print(Option_t *option) const {
+    //
+    // Print splitter configuration
+    //
+    cout << endl
+	 << "MemTk job splitter: " << GetName() << endl
+	 << "  Input tree          : " << fTreeName.Data() << endl
+	 << "  Jet multiplicity    : " << fJetMultExpr.Data() << endl
+	 << "  Probe cost per event: ";
+    for ( size_t i = 0; i < fJetMultCost.size(); i++ ) {
+	cout << i << ( i+1 == fJetMultCost.size() ? "+" : "" )
+	     << "j=" << fJetMultCost[i] << " ";
+    }
+    cout << endl
+	 << "  Timing records      : " << fTimingSec.size() << endl
+	 << endl;
+}
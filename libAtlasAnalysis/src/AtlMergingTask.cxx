@@ -117,7 +117,7 @@ void AtlMergingTask::CreateRunScript(Option_t*) {
     TString expd_infile;
     TObjString* objs = 0;
     while( (objs = (TObjString*)next_file()) ) {
-	expd_infile = TString(gSystem->ExpandPathName(objs->GetString()));
+	expd_infile = TString(ExpandPath(objs->GetString()));
 	out << expd_infile.Data() << " ";
     }
 
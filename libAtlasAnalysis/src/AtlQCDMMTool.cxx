@@ -68,6 +68,9 @@ AtlQCDMMTool::AtlQCDMMTool(const char* name, const char* title) :
     fEfficiencyPath2017 = TString("");
     fEfficiencyPath = TString("");
     fYear = TString("0000"); 
+    fYearCode = 0;
+    fTriggerRunNr = -1;
+    for ( Int_t k = 0; k < 3; k++ ) fTrigBitsEl[k] = fTrigBitsMu[k] = -1;
     // fFakeParamString_fake = TString("NS:pt:dPhi:nbtag");
     // fFakeParamString_real = TString("NS:pt:dR");
     fParamString_fake2015 = TString("2015Test:NS:jetpt:eta:dR");
@@ -143,6 +146,8 @@ Bool_t AtlQCDMMTool::Notify() {
             return kTRUE;
         }
         fYear = year;
+        fYearCode = year.Atoi();
+        fTriggerRunNr = -1; // trigger split changes with the year
         TString eff_path;
         TString eff_fake;
         TString eff_real;
@@ -189,6 +194,49 @@ Bool_t AtlQCDMMTool::Notify() {
 
 //___________________________________________________________
 
+void AtlQCDMMTool::SetupTriggerBits() {
+    //
+    // Resolve the HLT items of the trigger split for the current year
+    // and run into bit numbers. Called once per run so that
+    // AnalyzeEvent() does not need any string-keyed trigger lookup
+    //
+    //   The trigger split is defined in MMEffSet::AddTriggerSplit()
+    //     and it is accessed in MMEffSet::TriggerValue().
+    //   Trigger information available in the ntuples can be found
+    //     in any logfile when running a sample.
+    //
+    const char *el[3] = { 0, 0, 0 };
+    const char *mu[3] = { 0, 0, 0 };
+    if ( fYearCode == 2015 ) {
+	// electrons: no trigger split available in eff files and MMEffSet
+	// muons: third trigger (HLT_mu20_L1MU15) not available in ntuple
+	mu[0] = "HLT_mu20_iloose_L1MU15";
+	mu[1] = "HLT_mu50";
+    } else if ( fYearCode == 2016 ) {
+	// electrons: no big influence; first trigger with e26 instead of e24
+	el[0] = "HLT_e26_lhtight_nod0_ivarloose";
+	el[1] = "HLT_e60_lhmedium_nod0";
+	el[2] = "HLT_e24_lhmedium_L1EM20VH";
+	// muons: third trigger (HLT_mu24) not available; first with mu24->mu26
+	mu[0] = "HLT_mu26_ivarmedium";
+	mu[1] = "HLT_mu50";
+    }
+    fTriggerRunNr = fEvent->RunNr();
+    AtlTrigger *trigger = fEvent->GetTrigger();
+    for ( Int_t k = 0; k < 3; k++ ) {
+	fTrigBitsEl[k] = ( el[k] != 0 ) ? trigger->FindHLTBit(el[k], fTriggerRunNr) : -1;
+	fTrigBitsMu[k] = ( mu[k] != 0 ) ? trigger->FindHLTBit(mu[k], fTriggerRunNr) : -1;
+	if ( el[k] != 0 && fTrigBitsEl[k] < 0 )
+	    Warning(__FUNCTION__, "HLT item %s not found for run %d",
+		    el[k], fTriggerRunNr);
+	if ( mu[k] != 0 && fTrigBitsMu[k] < 0 )
+	    Warning(__FUNCTION__, "HLT item %s not found for run %d",
+		    mu[k], fTriggerRunNr);
+    }
+}
+
+//___________________________________________________________
+
 void AtlQCDMMTool::BookHistograms() {
     //
     // Book histograms
@@ -311,42 +359,16 @@ Bool_t AtlQCDMMTool::AnalyzeEvent() {
 		}
 	    } 
 	    
-	    // set up trigger variable
-	    //   The trigger split is defined in MMEffSet::AddTriggerSplit()
-	    //     and it is accessed in MMEffSet::TriggerValue().
-	    //   Trigger information available in the ntuples can be found
-	    //     in any logfile when running a sample.
+	    // set up trigger variable from the HLT bits resolved once
+	    // per run (see SetupTriggerBits())
 	    // TO DO: use trigger match or trigger pass?
+	    if ( (Int_t)fEvent->RunNr() != fTriggerRunNr )
+		SetupTriggerBits();
+	    const Int_t *trigbits = ( is_electron ) ? fTrigBitsEl : fTrigBitsMu;
 	    int trigmatch = 0;
-	    if ( is_electron && fYear.EqualTo("2015") ) {
-		; // no trigger split available in eff files and MMEffSet
-	    }
-	    if ( is_electron && fYear.EqualTo("2016") ) {
-		// no big influence; first trigger with e26 instead of e24
-		if ( fEvent->HasPassedHLT("HLT_e26_lhtight_nod0_ivarloose") )
-		    trigmatch |= 0x1 << 0;
-		if ( fEvent->HasPassedHLT("HLT_e60_lhmedium_nod0") )
-		    trigmatch |= 0x1 << 1;
-	    	if ( fEvent->HasPassedHLT("HLT_e24_lhmedium_L1EM20VH") )
-		    trigmatch  |= 0x1 << 2;
-	    }
-	    if ( !is_electron && fYear.EqualTo("2015") ) {
-		// third trigger not available in ntuple
-	    	if ( fEvent->HasPassedHLT("HLT_mu20_iloose_L1MU15") )
-		    trigmatch |= 0x1 << 0;
-	    	if ( fEvent->HasPassedHLT("HLT_mu50") )
-		    trigmatch |= 0x1 << 1;
-	    	// if ( fEvent->HasPassedHLT("HLT_mu20_L1MU15") )
-		//     trigmatch  |= 0x1 << 2;
-	    }
-	    if ( !is_electron && fYear.EqualTo("2016") ) {
-		// third trigger not available; first with mu24->mu26 
-	    	if ( fEvent->HasPassedHLT("HLT_mu26_ivarmedium") )
-		    trigmatch |= 0x1 << 0;
-	    	if ( fEvent->HasPassedHLT("HLT_mu50") )
-		    trigmatch |= 0x1 << 1;
-	    	// if ( fEvent->HasPassedHLT("HLT_mu24") )
-		//     trigmatch  |= 0x1 << 2;
+	    for ( Int_t k = 0; k < 3; k++ ) {
+		if ( fEvent->HasPassedHLT(trigbits[k]) )
+		    trigmatch |= 0x1 << k;
 	    }
 
 	    // build MMLepton with:
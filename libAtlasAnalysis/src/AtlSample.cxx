@@ -300,6 +300,363 @@ static const char* fgCategoryNames[13] = {
     "Zjets", "Diboson", "Other", "Wjets", "QCD"
 };
 
+//____________________________________________________________________
+
+static ULong64_t ClassifyType(AtlSample::EType Type) {
+    //
+    // Categories of the given sample type
+    //
+    ULong64_t cat = 0;
+    switch ( Type ) {
+	case AtlSample::kDATA_EGamma:
+	    cat = AtlSample::kCatDATA | AtlSample::kCatDATAEGamma;
+	    break;
+	case AtlSample::kDATA_Muon:
+	    cat = AtlSample::kCatDATA | AtlSample::kCatDATAMuon;
+	    break;
+	case AtlSample::kDATA_TOPQ1:
+	case AtlSample::kDATA_TOPQ2:
+	case AtlSample::kDATA_TOPQ3:
+	    cat = AtlSample::kCatDATA;
+	    break;
+	case AtlSample::kSgTop_tChannel_e:
+	case AtlSample::kSgTop_tChannel_mu:
+	case AtlSample::kSgTop_tChannel_tau:
+	case AtlSample::kSgTop_tChannel_incl:
+	case AtlSample::kSgTop_tChannel_top_incl:
+	case AtlSample::kSgTop_tChannel_antitop_incl:
+	    cat = AtlSample::kCatSgTop | AtlSample::kCatSgTopTChannel;
+	    break;
+	case AtlSample::kSgTop_sChannel_e:
+	case AtlSample::kSgTop_sChannel_mu:
+	case AtlSample::kSgTop_sChannel_tau:
+	case AtlSample::kSgTop_sChannel_incl:
+	    cat = AtlSample::kCatSgTop | AtlSample::kCatSgTopSChannel;
+	    break;
+	case AtlSample::kSgTop_Wt:
+	    cat = AtlSample::kCatSgTop | AtlSample::kCatSgTopWt;
+	    break;
+	case AtlSample::kSgTop_tZj:
+	    cat = AtlSample::kCattZj;
+	    break;
+	case AtlSample::kTtbar:
+	    cat = AtlSample::kCatTtbar;
+	    break;
+	case AtlSample::kTtbarPlusW:
+	case AtlSample::kTtbarPlusZ:
+	    cat = AtlSample::kCatTtbarV;
+	    break;
+	case AtlSample::kWenuNp0:
+	case AtlSample::kWenuNp1:
+	case AtlSample::kWenuNp2:
+	case AtlSample::kWenuNp3:
+	case AtlSample::kWenuNp4:
+	case AtlSample::kWenuNp5:
+	case AtlSample::kWmunuNp0:
+	case AtlSample::kWmunuNp1:
+	case AtlSample::kWmunuNp2:
+	case AtlSample::kWmunuNp3:
+	case AtlSample::kWmunuNp4:
+	case AtlSample::kWmunuNp5:
+	case AtlSample::kWtaunuNp0:
+	case AtlSample::kWtaunuNp1:
+	case AtlSample::kWtaunuNp2:
+	case AtlSample::kWtaunuNp3:
+	case AtlSample::kWtaunuNp4:
+	case AtlSample::kWtaunuNp5:
+	case AtlSample::kWenuInclLight:
+	case AtlSample::kWmunuInclLight:
+	case AtlSample::kWtaunuInclLight:
+	    cat = AtlSample::kCatWjets | AtlSample::kCatWjetsLight;
+	    break;
+	case AtlSample::kWenuNp0_hfor0:
+	case AtlSample::kWenuNp1_hfor0:
+	case AtlSample::kWenuNp2_hfor0:
+	case AtlSample::kWenuNp3_hfor0:
+	case AtlSample::kWenuNp4_hfor0:
+	case AtlSample::kWenuNp5_hfor0:
+	case AtlSample::kWmunuNp0_hfor0:
+	case AtlSample::kWmunuNp1_hfor0:
+	case AtlSample::kWmunuNp2_hfor0:
+	case AtlSample::kWmunuNp3_hfor0:
+	case AtlSample::kWmunuNp4_hfor0:
+	case AtlSample::kWmunuNp5_hfor0:
+	case AtlSample::kWtaunuNp0_hfor0:
+	case AtlSample::kWtaunuNp1_hfor0:
+	case AtlSample::kWtaunuNp2_hfor0:
+	case AtlSample::kWtaunuNp3_hfor0:
+	case AtlSample::kWtaunuNp4_hfor0:
+	case AtlSample::kWtaunuNp5_hfor0:
+	case AtlSample::kWcNp0_hfor0:
+	case AtlSample::kWcNp1_hfor0:
+	case AtlSample::kWcNp2_hfor0:
+	case AtlSample::kWcNp3_hfor0:
+	case AtlSample::kWcNp4_hfor0:
+	case AtlSample::kWccNp0_hfor0:
+	case AtlSample::kWccNp1_hfor0:
+	case AtlSample::kWccNp2_hfor0:
+	case AtlSample::kWccNp3_hfor0:
+	case AtlSample::kWbbNp0_hfor0:
+	case AtlSample::kWbbNp1_hfor0:
+	case AtlSample::kWbbNp2_hfor0:
+	case AtlSample::kWbbNp3_hfor0:
+	    cat = AtlSample::kCatHFOR0;
+	    break;
+	case AtlSample::kWenuNp0_hfor1:
+	case AtlSample::kWenuNp1_hfor1:
+	case AtlSample::kWenuNp2_hfor1:
+	case AtlSample::kWenuNp3_hfor1:
+	case AtlSample::kWenuNp4_hfor1:
+	case AtlSample::kWenuNp5_hfor1:
+	case AtlSample::kWmunuNp0_hfor1:
+	case AtlSample::kWmunuNp1_hfor1:
+	case AtlSample::kWmunuNp2_hfor1:
+	case AtlSample::kWmunuNp3_hfor1:
+	case AtlSample::kWmunuNp4_hfor1:
+	case AtlSample::kWmunuNp5_hfor1:
+	case AtlSample::kWtaunuNp0_hfor1:
+	case AtlSample::kWtaunuNp1_hfor1:
+	case AtlSample::kWtaunuNp2_hfor1:
+	case AtlSample::kWtaunuNp3_hfor1:
+	case AtlSample::kWtaunuNp4_hfor1:
+	case AtlSample::kWtaunuNp5_hfor1:
+	case AtlSample::kWcNp0_hfor1:
+	case AtlSample::kWcNp1_hfor1:
+	case AtlSample::kWcNp2_hfor1:
+	case AtlSample::kWcNp3_hfor1:
+	case AtlSample::kWcNp4_hfor1:
+	case AtlSample::kWccNp0_hfor1:
+	case AtlSample::kWccNp1_hfor1:
+	case AtlSample::kWccNp2_hfor1:
+	case AtlSample::kWccNp3_hfor1:
+	case AtlSample::kWbbNp0_hfor1:
+	case AtlSample::kWbbNp1_hfor1:
+	case AtlSample::kWbbNp2_hfor1:
+	case AtlSample::kWbbNp3_hfor1:
+	    cat = AtlSample::kCatHFOR1;
+	    break;
+	case AtlSample::kWenuNp0_hfor2:
+	case AtlSample::kWenuNp1_hfor2:
+	case AtlSample::kWenuNp2_hfor2:
+	case AtlSample::kWenuNp3_hfor2:
+	case AtlSample::kWenuNp4_hfor2:
+	case AtlSample::kWenuNp5_hfor2:
+	case AtlSample::kWmunuNp0_hfor2:
+	case AtlSample::kWmunuNp1_hfor2:
+	case AtlSample::kWmunuNp2_hfor2:
+	case AtlSample::kWmunuNp3_hfor2:
+	case AtlSample::kWmunuNp4_hfor2:
+	case AtlSample::kWmunuNp5_hfor2:
+	case AtlSample::kWtaunuNp0_hfor2:
+	case AtlSample::kWtaunuNp1_hfor2:
+	case AtlSample::kWtaunuNp2_hfor2:
+	case AtlSample::kWtaunuNp3_hfor2:
+	case AtlSample::kWtaunuNp4_hfor2:
+	case AtlSample::kWtaunuNp5_hfor2:
+	case AtlSample::kWcNp0_hfor2:
+	case AtlSample::kWcNp1_hfor2:
+	case AtlSample::kWcNp2_hfor2:
+	case AtlSample::kWcNp3_hfor2:
+	case AtlSample::kWcNp4_hfor2:
+	case AtlSample::kWccNp0_hfor2:
+	case AtlSample::kWccNp1_hfor2:
+	case AtlSample::kWccNp2_hfor2:
+	case AtlSample::kWccNp3_hfor2:
+	case AtlSample::kWbbNp0_hfor2:
+	case AtlSample::kWbbNp1_hfor2:
+	case AtlSample::kWbbNp2_hfor2:
+	case AtlSample::kWbbNp3_hfor2:
+	    cat = AtlSample::kCatHFOR2;
+	    break;
+	case AtlSample::kWenuNp0_hfor3:
+	case AtlSample::kWenuNp1_hfor3:
+	case AtlSample::kWenuNp2_hfor3:
+	case AtlSample::kWenuNp3_hfor3:
+	case AtlSample::kWenuNp4_hfor3:
+	case AtlSample::kWenuNp5_hfor3:
+	case AtlSample::kWmunuNp0_hfor3:
+	case AtlSample::kWmunuNp1_hfor3:
+	case AtlSample::kWmunuNp2_hfor3:
+	case AtlSample::kWmunuNp3_hfor3:
+	case AtlSample::kWmunuNp4_hfor3:
+	case AtlSample::kWmunuNp5_hfor3:
+	case AtlSample::kWtaunuNp0_hfor3:
+	case AtlSample::kWtaunuNp1_hfor3:
+	case AtlSample::kWtaunuNp2_hfor3:
+	case AtlSample::kWtaunuNp3_hfor3:
+	case AtlSample::kWtaunuNp4_hfor3:
+	case AtlSample::kWtaunuNp5_hfor3:
+	case AtlSample::kWcNp0_hfor3:
+	case AtlSample::kWcNp1_hfor3:
+	case AtlSample::kWcNp2_hfor3:
+	case AtlSample::kWcNp3_hfor3:
+	case AtlSample::kWcNp4_hfor3:
+	case AtlSample::kWccNp0_hfor3:
+	case AtlSample::kWccNp1_hfor3:
+	case AtlSample::kWccNp2_hfor3:
+	case AtlSample::kWccNp3_hfor3:
+	case AtlSample::kWbbNp0_hfor3:
+	case AtlSample::kWbbNp1_hfor3:
+	case AtlSample::kWbbNp2_hfor3:
+	case AtlSample::kWbbNp3_hfor3:
+	    cat = AtlSample::kCatHFOR3;
+	    break;
+	case AtlSample::kWcNp0:
+	case AtlSample::kWcNp1:
+	case AtlSample::kWcNp2:
+	case AtlSample::kWcNp3:
+	case AtlSample::kWcNp4:
+	case AtlSample::kWccNp0:
+	case AtlSample::kWccNp1:
+	case AtlSample::kWccNp2:
+	case AtlSample::kWccNp3:
+	case AtlSample::kWenuInclC:
+	case AtlSample::kWmunuInclC:
+	case AtlSample::kWtaunuInclC:
+	    cat = AtlSample::kCatWjets | AtlSample::kCatWjetsHeavy | AtlSample::kCatWjetsC;
+	    break;
+	case AtlSample::kWbbNp0:
+	case AtlSample::kWbbNp1:
+	case AtlSample::kWbbNp2:
+	case AtlSample::kWbbNp3:
+	case AtlSample::kWenuInclB:
+	case AtlSample::kWmunuInclB:
+	case AtlSample::kWtaunuInclB:
+	    cat = AtlSample::kCatWjets | AtlSample::kCatWjetsHeavy | AtlSample::kCatWjetsB;
+	    break;
+	case AtlSample::kWenuIncl:
+	case AtlSample::kWmunuIncl:
+	case AtlSample::kWtaunuIncl:
+	    cat = AtlSample::kCatWjets;
+	    break;
+	case AtlSample::kZeeNp0:
+	case AtlSample::kZeeNp1:
+	case AtlSample::kZeeNp2:
+	case AtlSample::kZeeNp3:
+	case AtlSample::kZeeNp4:
+	case AtlSample::kZeeNp5:
+	case AtlSample::kZmumuNp0:
+	case AtlSample::kZmumuNp1:
+	case AtlSample::kZmumuNp2:
+	case AtlSample::kZmumuNp3:
+	case AtlSample::kZmumuNp4:
+	case AtlSample::kZmumuNp5:
+	case AtlSample::kZtautauNp0:
+	case AtlSample::kZtautauNp1:
+	case AtlSample::kZtautauNp2:
+	case AtlSample::kZtautauNp3:
+	case AtlSample::kZtautauNp4:
+	case AtlSample::kZtautauNp5:
+	case AtlSample::kZeeInclLight:
+	case AtlSample::kZmumuInclLight:
+	case AtlSample::kZtautauInclLight:
+	case AtlSample::kZnunuInclLight:
+	    cat = AtlSample::kCatZjets | AtlSample::kCatZjetsLF;
+	    break;
+	case AtlSample::kZeeccNp0:
+	case AtlSample::kZeeccNp1:
+	case AtlSample::kZeeccNp2:
+	case AtlSample::kZeeccNp3incl:
+	case AtlSample::kZmumuccNp0:
+	case AtlSample::kZmumuccNp1:
+	case AtlSample::kZmumuccNp2:
+	case AtlSample::kZmumuccNp3incl:
+	case AtlSample::kZtautauccNp0:
+	case AtlSample::kZtautauccNp1:
+	case AtlSample::kZtautauccNp2:
+	case AtlSample::kZtautauccNp3incl:
+	case AtlSample::kZeeInclC:
+	case AtlSample::kZmumuInclC:
+	case AtlSample::kZtautauInclC:
+	case AtlSample::kZnunuInclC:
+	    cat = AtlSample::kCatZjets | AtlSample::kCatZjetsHF | AtlSample::kCatZjetsC;
+	    break;
+	case AtlSample::kZeebbNp0:
+	case AtlSample::kZeebbNp1:
+	case AtlSample::kZeebbNp2:
+	case AtlSample::kZeebbNp3incl:
+	case AtlSample::kZmumubbNp0:
+	case AtlSample::kZmumubbNp1:
+	case AtlSample::kZmumubbNp2:
+	case AtlSample::kZmumubbNp3incl:
+	case AtlSample::kZtautaubbNp0:
+	case AtlSample::kZtautaubbNp1:
+	case AtlSample::kZtautaubbNp2:
+	case AtlSample::kZtautaubbNp3incl:
+	case AtlSample::kZeeInclB:
+	case AtlSample::kZmumuInclB:
+	case AtlSample::kZtautauInclB:
+	case AtlSample::kZnunuInclB:
+	    cat = AtlSample::kCatZjets | AtlSample::kCatZjetsHF | AtlSample::kCatZjetsB;
+	    break;
+	case AtlSample::kZeeIncl:
+	case AtlSample::kZmumuIncl:
+	case AtlSample::kZtautauIncl:
+	    cat = AtlSample::kCatZjets;
+	    break;
+	case AtlSample::kDibosonWW:
+	case AtlSample::kDibosonWZ:
+	case AtlSample::kDibosonZZ:
+	case AtlSample::kWWenuqq:
+	case AtlSample::kWZenuqq:
+	case AtlSample::kWWmunuqq:
+	case AtlSample::kWZmunuqq:
+	case AtlSample::kWWtaunuqq:
+	case AtlSample::kWZtaunuqq:
+	case AtlSample::kZWeeqq:
+	case AtlSample::kZZeeqq:
+	case AtlSample::kZWmumuqq:
+	case AtlSample::kZZmumuqq:
+	case AtlSample::kZWtautauqq:
+	case AtlSample::kZZtautauqq:
+	    cat = AtlSample::kCatDiboson;
+	    break;
+	case AtlSample::kQCDMatrixMethod:
+	    cat = AtlSample::kCatQCD;
+	    break;
+	case AtlSample::kQCDMatrixMethod_Tight:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDTight;
+	    break;
+	case AtlSample::kQCDMatrixMethod_Loose:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDLoose;
+	    break;
+	case AtlSample::kQCDMatrixMethod_EGamma:
+	case AtlSample::kQCDJetElectron_EGamma:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDEGamma;
+	    break;
+	case AtlSample::kQCDMatrixMethod_Muon:
+	case AtlSample::kQCDJetElectron_Muon:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDMuon;
+	    break;
+	case AtlSample::kQCD_AntiMuon:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDMuon | AtlSample::kCatQCDAntiMuon;
+	    break;
+	case AtlSample::kQCD_JetLepton:
+	    cat = AtlSample::kCatQCD | AtlSample::kCatQCDEGamma | AtlSample::kCatQCDJetLepton;
+	    break;
+	case AtlSample::kFCNC_utZ_K01L:
+	case AtlSample::kFCNC_ctZ_K01L:
+	    cat = AtlSample::kCatFCNCtZ;
+	    break;
+	default:
+	    break;
+    }
+    if ( (cat & (AtlSample::kCatDATA | AtlSample::kCatQCD)) == 0 )
+	cat |= AtlSample::kCatMC;
+    return cat;
+}
+
+namespace {
+    // Category bitset of all sample types
+    struct CategoryTable {
+	ULong64_t fCategories[AtlSample::kUndefined+1];
+	CategoryTable() {
+	    for ( Int_t i = 0; i <= AtlSample::kUndefined; i++ )
+		fCategories[i] = ClassifyType((AtlSample::EType)i);
+	}
+    };
+}
+
 #ifndef __CINT__
 ClassImp(AtlSample);
 #endif
@@ -314,6 +671,7 @@ AtlSample::AtlSample(const char* Name, const char* Title,
     //
     // Default constructor
     //
+    fCategories = GetCategories(Type);
     fPaths.SetOwner();
     if ( PathName ) {
         fPaths.Add(new TObjString(PathName));
@@ -380,667 +738,16 @@ const char* AtlSample::GetCategoryName() const {
 
 //____________________________________________________________________
 
-Bool_t AtlSample::IsSgTop() const {
-    //
-    // Is single-top production ?
-    //
-    return ( fType == kSgTop_tChannel_e 
-	     || fType == kSgTop_tChannel_mu
-	     || fType == kSgTop_tChannel_tau
-	     || fType == kSgTop_sChannel_e 
-	     || fType == kSgTop_sChannel_mu
-	     || fType == kSgTop_sChannel_tau
-	     || fType == kSgTop_Wt
-	     || fType == kSgTop_tChannel_incl
-	     || fType == kSgTop_tChannel_top_incl
-	     || fType == kSgTop_tChannel_antitop_incl
-	     || fType == kSgTop_sChannel_incl
-	) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsSgTopTChannel() const {
-    //
-    // Is single-top production ?
-    //
-    return ( fType == kSgTop_tChannel_e 
-	     || fType == kSgTop_tChannel_mu
-	     || fType == kSgTop_tChannel_tau
-	     || fType == kSgTop_tChannel_incl
-	     || fType == kSgTop_tChannel_top_incl
-	     || fType == kSgTop_tChannel_antitop_incl) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsSgTopSChannel() const {
-    //
-    // Is single-top production ?
-    //
-    return ( fType == kSgTop_sChannel_e 
-	     || fType == kSgTop_sChannel_mu
-	     || fType == kSgTop_sChannel_tau
-	     || fType == kSgTop_sChannel_incl ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsSgTopWt() const {
-    //
-    // Is single-top production ?
-    //
-    return ( fType == kSgTop_Wt ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IstZj() const {
-    //
-    // Is single-top tZ SM production ?
-    //
-    return ( fType == kSgTop_tZj ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsTtbar() const {
-    //
-    // Is ttbar production ?
-    //
-    return ( fType == kTtbar ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsTtbarV() const {
-    //
-    // Is ttbar+W|Z production ?
-    //
-    return ( fType == kTtbarPlusW
-	     || fType == kTtbarPlusZ
-	) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsWjetsLight() const {
-    //
-    // Is W+light jets production ?
-    //
-    return ( fType == kWenuNp0
-	     || fType == kWenuNp1
-	     || fType == kWenuNp2
-	     || fType == kWenuNp3
-	     || fType == kWenuNp4
-	     || fType == kWenuNp5
-	     || fType == kWmunuNp0
-	     || fType == kWmunuNp1
-	     || fType == kWmunuNp2
-	     || fType == kWmunuNp3
-	     || fType == kWmunuNp4
-	     || fType == kWmunuNp5
-	     || fType == kWtaunuNp0
-	     || fType == kWtaunuNp1
-	     || fType == kWtaunuNp2
-	     || fType == kWtaunuNp3
-	     || fType == kWtaunuNp4
-	     || fType == kWtaunuNp5
-	     || fType == kWenuInclLight
-	     || fType == kWmunuInclLight
-	     || fType == kWtaunuInclLight ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsWjetsHeavy() const {
-    //
-    // Is W+light jets production ?
-    //
-    return ( fType == kWcNp0
-	     || fType == kWcNp1
-	     || fType == kWcNp2
-	     || fType == kWcNp3
-	     || fType == kWcNp4
-	     || fType == kWccNp0
-	     || fType == kWccNp1
-	     || fType == kWccNp2
-	     || fType == kWccNp3
-	     || fType == kWbbNp0
-	     || fType == kWbbNp1
-	     || fType == kWbbNp2
-	     || fType == kWbbNp3 
-	     || fType == kWenuInclB
-	     || fType == kWenuInclC
-	     || fType == kWmunuInclB
-	     || fType == kWmunuInclC
-	     || fType == kWtaunuInclB
-	     || fType == kWtaunuInclC ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsWjetsC() const {
-    //
-    // Is W + c production ?
-    //
-    return ( fType == kWcNp0
-	     || fType == kWcNp1
-	     || fType == kWcNp2
-	     || fType == kWcNp3
-	     || fType == kWcNp4
-	     || fType == kWccNp0
-	     || fType == kWccNp1
-	     || fType == kWccNp2
-	     || fType == kWccNp3
-	     || fType == kWenuInclC
-	     || fType == kWmunuInclC
-	     || fType == kWtaunuInclC ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsWjetsB() const {
-    //
-    // Is W + b production ?
-    //
-    return ( fType == kWbbNp0
-	     || fType == kWbbNp1
-	     || fType == kWbbNp2
-	     || fType == kWbbNp3 
-	     || fType == kWenuInclB
-	     || fType == kWmunuInclB
-	     || fType == kWtaunuInclB ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsWjets() const {
-    //
-    // Is W production ?
-    //
-    switch ( fType ) {
-    case kWenuIncl:
-    case kWmunuIncl:
-    case kWtaunuIncl:
-        return kTRUE;
-    default:
-        return (IsWjetsLight() || IsWjetsHeavy());
-    }
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsHFOR0() const {
-    //
-    // Is HFOR type 0 ?
-    //
-    return ( fType == kWenuNp0_hfor0
-	     || fType == kWenuNp1_hfor0
-	     || fType == kWenuNp2_hfor0
-	     || fType == kWenuNp3_hfor0
-	     || fType == kWenuNp4_hfor0
-	     || fType == kWenuNp5_hfor0
-	     || fType == kWmunuNp0_hfor0
-	     || fType == kWmunuNp1_hfor0
-	     || fType == kWmunuNp2_hfor0
-	     || fType == kWmunuNp3_hfor0
-	     || fType == kWmunuNp4_hfor0
-	     || fType == kWmunuNp5_hfor0
-	     || fType == kWtaunuNp0_hfor0
-	     || fType == kWtaunuNp1_hfor0
-	     || fType == kWtaunuNp2_hfor0
-	     || fType == kWtaunuNp3_hfor0
-	     || fType == kWtaunuNp4_hfor0
-	     || fType == kWtaunuNp5_hfor0
-	     || fType == kWcNp0_hfor0
-	     || fType == kWcNp1_hfor0
-	     || fType == kWcNp2_hfor0
-	     || fType == kWcNp3_hfor0
-	     || fType == kWcNp4_hfor0
-	     || fType == kWccNp0_hfor0
-	     || fType == kWccNp1_hfor0
-	     || fType == kWccNp2_hfor0
-	     || fType == kWccNp3_hfor0
-	     || fType == kWbbNp0_hfor0
-	     || fType == kWbbNp1_hfor0
-	     || fType == kWbbNp2_hfor0
-	     || fType == kWbbNp3_hfor0 ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsHFOR1() const {
-    //
-    // Is HFOR type 1 ?
-    //
-    return ( fType == kWenuNp0_hfor1
-	     || fType == kWenuNp1_hfor1
-	     || fType == kWenuNp2_hfor1
-	     || fType == kWenuNp3_hfor1
-	     || fType == kWenuNp4_hfor1
-	     || fType == kWenuNp5_hfor1
-	     || fType == kWmunuNp0_hfor1
-	     || fType == kWmunuNp1_hfor1
-	     || fType == kWmunuNp2_hfor1
-	     || fType == kWmunuNp3_hfor1
-	     || fType == kWmunuNp4_hfor1
-	     || fType == kWmunuNp5_hfor1
-	     || fType == kWtaunuNp0_hfor1
-	     || fType == kWtaunuNp1_hfor1
-	     || fType == kWtaunuNp2_hfor1
-	     || fType == kWtaunuNp3_hfor1
-	     || fType == kWtaunuNp4_hfor1
-	     || fType == kWtaunuNp5_hfor1
-	     || fType == kWcNp0_hfor1
-	     || fType == kWcNp1_hfor1
-	     || fType == kWcNp2_hfor1
-	     || fType == kWcNp3_hfor1
-	     || fType == kWcNp4_hfor1
-	     || fType == kWccNp0_hfor1
-	     || fType == kWccNp1_hfor1
-	     || fType == kWccNp2_hfor1
-	     || fType == kWccNp3_hfor1
-	     || fType == kWbbNp0_hfor1
-	     || fType == kWbbNp1_hfor1
-	     || fType == kWbbNp2_hfor1
-	     || fType == kWbbNp3_hfor1 ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsHFOR2() const {
-    //
-    // Is HFOR type 2 ?
-    //
-    return ( fType == kWenuNp0_hfor2
-	     || fType == kWenuNp1_hfor2
-	     || fType == kWenuNp2_hfor2
-	     || fType == kWenuNp3_hfor2
-	     || fType == kWenuNp4_hfor2
-	     || fType == kWenuNp5_hfor2
-	     || fType == kWmunuNp0_hfor2
-	     || fType == kWmunuNp1_hfor2
-	     || fType == kWmunuNp2_hfor2
-	     || fType == kWmunuNp3_hfor2
-	     || fType == kWmunuNp4_hfor2
-	     || fType == kWmunuNp5_hfor2
-	     || fType == kWtaunuNp0_hfor2
-	     || fType == kWtaunuNp1_hfor2
-	     || fType == kWtaunuNp2_hfor2
-	     || fType == kWtaunuNp3_hfor2
-	     || fType == kWtaunuNp4_hfor2
-	     || fType == kWtaunuNp5_hfor2
-	     || fType == kWcNp0_hfor2
-	     || fType == kWcNp1_hfor2
-	     || fType == kWcNp2_hfor2
-	     || fType == kWcNp3_hfor2
-	     || fType == kWcNp4_hfor2
-	     || fType == kWccNp0_hfor2
-	     || fType == kWccNp1_hfor2
-	     || fType == kWccNp2_hfor2
-	     || fType == kWccNp3_hfor2
-	     || fType == kWbbNp0_hfor2
-	     || fType == kWbbNp1_hfor2
-	     || fType == kWbbNp2_hfor2
-	     || fType == kWbbNp3_hfor2 ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsHFOR3() const {
-    //
-    // Is HFOR type 3 ?
-    //
-    return ( fType == kWenuNp0_hfor3
-	     || fType == kWenuNp1_hfor3
-	     || fType == kWenuNp2_hfor3
-	     || fType == kWenuNp3_hfor3
-	     || fType == kWenuNp4_hfor3
-	     || fType == kWenuNp5_hfor3
-	     || fType == kWmunuNp0_hfor3
-	     || fType == kWmunuNp1_hfor3
-	     || fType == kWmunuNp2_hfor3
-	     || fType == kWmunuNp3_hfor3
-	     || fType == kWmunuNp4_hfor3
-	     || fType == kWmunuNp5_hfor3
-	     || fType == kWtaunuNp0_hfor3
-	     || fType == kWtaunuNp1_hfor3
-	     || fType == kWtaunuNp2_hfor3
-	     || fType == kWtaunuNp3_hfor3
-	     || fType == kWtaunuNp4_hfor3
-	     || fType == kWtaunuNp5_hfor3
-	     || fType == kWcNp0_hfor3
-	     || fType == kWcNp1_hfor3
-	     || fType == kWcNp2_hfor3
-	     || fType == kWcNp3_hfor3
-	     || fType == kWcNp4_hfor3
-	     || fType == kWccNp0_hfor3
-	     || fType == kWccNp1_hfor3
-	     || fType == kWccNp2_hfor3
-	     || fType == kWccNp3_hfor3
-	     || fType == kWbbNp0_hfor3
-	     || fType == kWbbNp1_hfor3
-	     || fType == kWbbNp2_hfor3
-	     || fType == kWbbNp3_hfor3 ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsZjets() const {
-    //
-    // Is Z+jets production ?
-    //
-    return ( fType == kZeeNp0
-	     || fType == kZeeNp1
-	     || fType == kZeeNp2
-	     || fType == kZeeNp3
-	     || fType == kZeeNp4
-	     || fType == kZeeNp5
-	     || fType == kZmumuNp0
-	     || fType == kZmumuNp1
-	     || fType == kZmumuNp2
-	     || fType == kZmumuNp3
-	     || fType == kZmumuNp4
-	     || fType == kZmumuNp5
-	     || fType == kZtautauNp0
-	     || fType == kZtautauNp1
-	     || fType == kZtautauNp2
-	     || fType == kZtautauNp3
-	     || fType == kZtautauNp4
-	     || fType == kZtautauNp5
-	     || fType == kZeeccNp0
-	     || fType == kZeeccNp1
-	     || fType == kZeeccNp2
-	     || fType == kZeeccNp3incl
-	     || fType == kZmumuccNp0
-	     || fType == kZmumuccNp1
-	     || fType == kZmumuccNp2
-	     || fType == kZmumuccNp3incl
-	     || fType == kZtautauccNp0
-	     || fType == kZtautauccNp1
-	     || fType == kZtautauccNp2
-	     || fType == kZtautauccNp3incl
-	     || fType == kZeebbNp0
-	     || fType == kZeebbNp1
-	     || fType == kZeebbNp2
-	     || fType == kZeebbNp3incl
-	     || fType == kZmumubbNp0
-	     || fType == kZmumubbNp1
-	     || fType == kZmumubbNp2
-	     || fType == kZmumubbNp3incl
-	     || fType == kZtautaubbNp0
-	     || fType == kZtautaubbNp1
-	     || fType == kZtautaubbNp2
-	     || fType == kZtautaubbNp3incl
-	     || fType == kZeeIncl
-	     || fType == kZeeInclB
-	     || fType == kZeeInclC
-	     || fType == kZeeInclLight
-	     || fType == kZmumuIncl
-	     || fType == kZmumuInclB
-	     || fType == kZmumuInclC
-	     || fType == kZmumuInclLight
-	     || fType == kZtautauIncl
-	     || fType == kZtautauInclB
-	     || fType == kZtautauInclC
-	     || fType == kZtautauInclLight
-	     || fType == kZnunuInclB
-	     || fType == kZnunuInclC
-	     || fType == kZnunuInclLight ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsZjetsLF() const {
-    //
-    // Is Z+jets production ?
-    //
-    return ( fType == kZeeNp0
-	     || fType == kZeeNp1
-	     || fType == kZeeNp2
-	     || fType == kZeeNp3
-	     || fType == kZeeNp4
-	     || fType == kZeeNp5
-	     || fType == kZmumuNp0
-	     || fType == kZmumuNp1
-	     || fType == kZmumuNp2
-	     || fType == kZmumuNp3
-	     || fType == kZmumuNp4
-	     || fType == kZmumuNp5
-	     || fType == kZtautauNp0
-	     || fType == kZtautauNp1
-	     || fType == kZtautauNp2
-	     || fType == kZtautauNp3
-	     || fType == kZtautauNp4
-	     || fType == kZtautauNp5
-	     || fType == kZeeInclLight
-	     || fType == kZmumuInclLight
-	     || fType == kZtautauInclLight
-	     || fType == kZnunuInclLight ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsZjetsHF() const {
-    //
-    // Is Z+jets production ?
-    //
-    return ( fType == kZeeccNp0
-	     || fType == kZeeccNp1
-	     || fType == kZeeccNp2
-	     || fType == kZeeccNp3incl
-	     || fType == kZmumuccNp0
-	     || fType == kZmumuccNp1
-	     || fType == kZmumuccNp2
-	     || fType == kZmumuccNp3incl
-	     || fType == kZtautauccNp0
-	     || fType == kZtautauccNp1
-	     || fType == kZtautauccNp2
-	     || fType == kZtautauccNp3incl
-	     || fType == kZeebbNp0
-	     || fType == kZeebbNp1
-	     || fType == kZeebbNp2
-	     || fType == kZeebbNp3incl
-	     || fType == kZmumubbNp0
-	     || fType == kZmumubbNp1
-	     || fType == kZmumubbNp2
-	     || fType == kZmumubbNp3incl
-	     || fType == kZtautaubbNp0
-	     || fType == kZtautaubbNp1
-	     || fType == kZtautaubbNp2
-	     || fType == kZtautaubbNp3incl
-	     || fType == kZeeInclB
-	     || fType == kZeeInclC
-	     || fType == kZmumuInclB
-	     || fType == kZmumuInclC
-	     || fType == kZtautauInclB
-	     || fType == kZtautauInclC
-	     || fType == kZnunuInclB
-	     || fType == kZnunuInclC ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsZjetsC() const {
-    //
-    // Is Z+jets production ?
-    //
-    return ( fType == kZeeccNp0
-	     || fType == kZeeccNp1
-	     || fType == kZeeccNp2
-	     || fType == kZeeccNp3incl
-	     || fType == kZmumuccNp0
-	     || fType == kZmumuccNp1
-	     || fType == kZmumuccNp2
-	     || fType == kZmumuccNp3incl
-	     || fType == kZtautauccNp0
-	     || fType == kZtautauccNp1
-	     || fType == kZtautauccNp2
-	     || fType == kZtautauccNp3incl
-	     || fType == kZeeInclC
-	     || fType == kZmumuInclC
-	     || fType == kZtautauInclC
-	     || fType == kZnunuInclC ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsZjetsB() const {
-    //
-    // Is Z+jets production ?
-    //
-    return ( fType == kZeebbNp0
-	     || fType == kZeebbNp1
-	     || fType == kZeebbNp2
-	     || fType == kZeebbNp3incl
-	     || fType == kZmumubbNp0
-	     || fType == kZmumubbNp1
-	     || fType == kZmumubbNp2
-	     || fType == kZmumubbNp3incl
-	     || fType == kZtautaubbNp0
-	     || fType == kZtautaubbNp1
-	     || fType == kZtautaubbNp2
-	     || fType == kZtautaubbNp3incl
-	     || fType == kZeeInclB
-	     || fType == kZmumuInclB
-	     || fType == kZtautauInclB
-	     || fType == kZnunuInclB ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsDiboson() const {
-    //
-    // Is Diboson production ?
-    //
-    return ( fType == kDibosonWW
-	     || fType == kDibosonWZ
-	     || fType == kDibosonZZ
-	     || fType == kWWenuqq
-	     || fType == kWZenuqq
-	     || fType == kWWmunuqq
-	     || fType == kWZmunuqq
-	     || fType == kWWtaunuqq
-	     || fType == kWZtaunuqq
-	     || fType == kZWeeqq
-	     || fType == kZZeeqq
-	     || fType == kZWmumuqq
-	     || fType == kZZmumuqq
-	     || fType == kZWtautauqq
-	     || fType == kZZtautauqq ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsFCNCtZ() const {
-    //
-    // Is FCNC tZ production ?
-    //
-    return ( fType == kFCNC_utZ_K01L || fType == kFCNC_ctZ_K01L )  ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsQCD() const {
-    //
-    // Is QCD Multijet production ?
-    //
-    return ( fType == kQCDMatrixMethod
-	     || fType == kQCDMatrixMethod_Tight
-	     || fType == kQCDMatrixMethod_Loose
-	     || fType == kQCDMatrixMethod_EGamma
-	     || fType == kQCDMatrixMethod_Muon
-	     || fType == kQCDJetElectron_EGamma
-	     || fType == kQCDJetElectron_Muon
-	     || fType == kQCD_AntiMuon
-             || fType == kQCD_JetLepton
-        ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsDATA() const {
-    //
-    // Sample is real data ?
-    //
-    switch ( fType ) {
-    case kDATA_EGamma:
-    case kDATA_Muon:
-    case kDATA_TOPQ1:
-    case kDATA_TOPQ2:
-    case kDATA_TOPQ3:
-        return kTRUE;
-    default:
-        return kFALSE;
-    }
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsDATAEGamma() const {
-    //
-    // Sample is Egamma stream (DATA) ?
-    //
-    return ( fType == kDATA_EGamma ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsDATAMuon() const {
-    //
-    // Sample is Muon stream (DATA) ?
-    //
-    return ( fType == kDATA_Muon ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsMC() const {
-    //
-    // Sample is MC ?
-    //
-    return (!IsDATA() && !IsQCD());
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsQCDTight() const {
-    //
-    // Is QCD Multijet (tight) ?
-    //
-    return ( fType == kQCDMatrixMethod_Tight ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsQCDLoose() const {
-    //
-    // Is QCD Multijet (loose) ?
-    //
-    return ( fType == kQCDMatrixMethod_Loose ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsQCDEGamma() const {
-    //
-    // Is QCD Multijet (EGamma) ?
-    //
-    return ( fType == kQCDMatrixMethod_EGamma
-	     || fType == kQCD_JetLepton 
-	     || fType == kQCDJetElectron_EGamma ) ? kTRUE : kFALSE;
-}
-
-//____________________________________________________________________
-
-Bool_t AtlSample::IsQCDMuon() const {
+ULong64_t AtlSample::GetCategories(EType Type) {
     //
-    // Is QCD Multijet (Muon) ?
+    // Return the categories (bitset of ECategory) of the given sample
+    // type. The table is computed once, on first use (samples may be
+    // created during static initialisation), so that the Is...()
+    // queries used when building large task trees are single bit
+    // tests instead of long chains of type comparisons.
     //
-    return ( fType == kQCDMatrixMethod_Muon
-	     || fType == kQCD_AntiMuon
-	     || fType == kQCDJetElectron_Muon ) ? kTRUE : kFALSE;
+    static const CategoryTable table;
+    return table.fCategories[Type];
 }
 
 //____________________________________________________________________
@@ -139,6 +139,48 @@
 // Running your analysis now will only include the events stored in 
 // the list.
 //
+// Event index:
+// ============
+// A more compact alternative to the TEntryList is the AtlEventIndex
+// which stores the selected entries of each input file as sorted
+// entry ranges together with their run and event numbers. Enable
+// writing with sel->SetWriteEventIndex(kTRUE); the index is stored
+// under the name "app_eventindex". A subsequent job reads only the
+// selected events (and only the baskets containing them) with
+// TFile *f = new TFile("outputfile.root","read");
+// sel->SetInputEventIndex(AtlEventIndex::Read(f));
+//
+// Input entry lists can also be handed to the selector directly with
+// sel->SetInputEntryList(elist, Exclude). With Exclude = kFALSE only
+// the listed entries are read (as with ch->SetEntryList()). With
+// Exclude = kTRUE the listed entries are skipped in Process() before
+// anything is read from the tree, so no extra pass over the input is
+// needed to build the complementary list. An excluding list can be
+// combined with an input event index; an input event index, an
+// including list and an entry list of the input chain exclude each
+// other.
+//
+// Event profiling:
+// ================
+// With sel->SetEventProfiling(N, "slow.root") the processing time of
+// every event is measured per stage of Process() (see
+// AtlEventProfiler). Log-scaled timing histograms are written to the
+// folder "EventProfile" of the output file, the N slowest events are
+// listed at the end of the job and copied into the given file for
+// offline profiling.
+//
+// Object references:
+// ==================
+// Links between the objects of an event (eg. decay daughters and
+// vertices of the reconstructed decays) are stored as event-local
+// references (HepEventRef) which are resolved through the current
+// event. Process() makes the selector's event the current event of
+// the calling thread. The remaining TRef based links still require
+// the TRef object count to be reset after each event, which is done
+// by default. Jobs which do not use any TRef (eg. multi-threaded
+// processing) can switch this off with
+// sel->SetResetObjectCount(kFALSE).
+//
 //    Author: Oliver Maria Kind <mailto:kind@mail.desy.de>
 //    Update: $Id$
 //    Copyright: 2008 (C) Oliver Maria Kind
@@ -150,6 +192,7 @@
 #include <TString.h>
 #include <TObjectTable.h>
 #include <iostream>
+#include <algorithm>
 #include <TROOT.h>
 #include <TSystem.h>
 #include <TEntryList.h>
@@ -162,7 +205,12 @@
 #include <AtlEvtWriterD3PDSgTop.h>
 #include <AtlObjectsToolD3PDSgTop.h>
 #include <AtlEvtReaderD3PDCKM.h>
+#include <AtlEvtReaderFlat.h>
+#include <AtlEvtWriterFlat.h>
+#include <AtlEventIndex.h>
+#include <AtlEventProfiler.h>
 #include <TChainElement.h>
+#include <TTreeCache.h>
 
 using namespace std;
 
@@ -214,6 +262,14 @@ AtlSelector::AtlSelector(const char* OutputFilename) :
     fListOfTools = new TList;
     fWriteEntryList = kFALSE;
     fEntryList = 0;
+    fWriteEventIndex = kFALSE;
+    fEventIndex = 0;
+    fInputEventIndex = 0;
+    fInputEntryList = 0;
+    fExcludeInputEntryList = kFALSE;
+    fExclNext = 0;
+    fEventProfiler = 0;
+    fResetObjectCount = kTRUE;
     fPrintEvent = kFALSE;
     fPrintObjectTable = kFALSE;
     fPassedSelection = kFALSE;
@@ -254,6 +310,10 @@ AtlSelector::~AtlSelector() {
     if ( fEvtReader != 0 ) delete fEvtReader;
     if ( fEvtWriter != 0 ) delete fEvtWriter;
     delete fBookkeepingList;
+    if ( fEventIndex != 0 ) delete fEventIndex;
+    if ( fInputEventIndex != 0 ) delete fInputEventIndex;
+    if ( fInputEntryList != 0 ) delete fInputEntryList;
+    if ( fEventProfiler != 0 ) delete fEventProfiler;
     fHistsArrayCutflow->Delete();
     delete fHistsArrayCutflow;
 }
@@ -384,6 +444,47 @@ Bool_t AtlSelector::Notify() {
 	}
     }
 
+    // Start new file in output event index
+    if ( fEventIndex != 0 ) {
+	fEventIndex->BeginFile(fCurrentTree->GetCurrentFile()->GetName(),
+			       fCurrentTree->GetEntries());
+    }
+
+    // Restrict the tree cache to the span of the selected entries of
+    // the input event index
+    if ( fInputEventIndex != 0 ) {
+	if ( fInputEventIndex->SetCurrentFile(fCurrentTree->GetCurrentFile()->GetName()) ) {
+	    Int_t file = fInputEventIndex->GetCurrentFile();
+	    if ( fInputEventIndex->GetFirstEntry(file) >= 0 &&
+		 fCurrentTree->GetReadCache(fCurrentTree->GetCurrentFile()) != 0 ) {
+		fCurrentTree->SetCacheEntryRange(fInputEventIndex->GetFirstEntry(file),
+						 fInputEventIndex->GetLastEntry(file) + 1);
+	    }
+	} else {
+	    Warning("Notify", "Input file %s not contained in the input event index.",
+		    fCurrentTree->GetCurrentFile()->GetName());
+	}
+    }
+
+    // Collect the entries of the current input tree which are to be
+    // skipped (excluding input entry list)
+    if ( fInputEntryList != 0 && fExcludeInputEntryList ) {
+	fExclEntries.clear();
+	fExclNext = 0;
+	TEntryList *sublist = fInputEntryList
+	    ->GetEntryList(fCurrentTree->GetName(),
+			   fCurrentTree->GetCurrentFile()->GetName());
+	if ( sublist != 0 ) {
+	    Long64_t n = sublist->GetN();
+	    fExclEntries.reserve(n);
+	    for ( Long64_t i = 0; i < n; i++ )
+		fExclEntries.push_back(sublist->GetEntry(i));
+	    std::sort(fExclEntries.begin(), fExclEntries.end());
+	}
+	Info("Notify", "Skip %d entries of the current input file (excluding input entry list)",
+	     (Int_t)fExclEntries.size());
+    }
+
     // Do bookkeeping of cut-flow and job info histograms
     DoBookkeeping(fCurrentTree->GetCurrentFile());
 
@@ -472,7 +573,8 @@ void AtlSelector::DoBookkeeping(TFile *InputFile) {
     TH1D *h_cf5 = 0;
     TH1D *h_cf6 = 0;
 
-    if ( fInputMode == kApp || fInputMode == kCustomMem ) {
+    if ( fInputMode == kApp || fInputMode == kCustomMem
+	 || fInputMode == kFlatNtuple ) {
         h = (TH1F*)InputFile->Get("/job_info/h_nevts");
 	if ( h != 0 ) {
 	    Info("DoBookkeeping", "JobInfo histogram in input file found. Disable counting of unfiltered events");
@@ -734,6 +836,10 @@ void AtlSelector::Begin(TTree *tree) {
             fEvtReader = new AtlEvtReaderD3PDCKM(this);
             Info("Begin", "Input file type = kD3PDCKM");
             break;
+        case kFlatNtuple:
+            fEvtReader = new AtlEvtReaderFlat(this);
+            Info("Begin", "Input file type = kFlatNtuple");
+            break;
         case kCustom:
         case kCustomMem:
             fEvtReader = fEvtReaderUser;
@@ -763,6 +869,10 @@ void AtlSelector::Begin(TTree *tree) {
 		    fEvtWriter = new AtlEvtWriterMem();
 		    Info("Begin", "Output tree type: kMemNtuple");
 		    break;
+		case kFlatNtuple:
+		    fEvtWriter = new AtlEvtWriterFlat();
+		    Info("Begin", "Output tree type: kFlatNtuple");
+		    break;
 		case kD3PDSgTop:
 		case kD3PDSgTop_v2:
 		    fEvtWriter = new AtlEvtWriterD3PDSgTop();
@@ -797,6 +907,48 @@ void AtlSelector::Begin(TTree *tree) {
 	fEntryList = new TEntryList("app_entrylist", "A++ event list");
 	fEntryList->SetDirectory(fOutputFile);
     }
+
+    // Create event index (if wished)
+    if ( fWriteEventIndex ) {
+	fEventIndex = new AtlEventIndex("app_eventindex", "A++ event index");
+    }
+
+    // Book event profiling histograms (if wished)
+    if ( fEventProfiler != 0 ) {
+	fEventProfiler->BookHistograms(fOutputFile);
+    }
+
+    // An entry list set for the input chain by the user would be
+    // replaced by the input event index or the including input entry
+    // list
+    if ( fTree->GetEntryList() != 0
+	 && ( fInputEventIndex != 0
+	      || ( fInputEntryList != 0 && !fExcludeInputEntryList ) ) ) {
+	Error("Begin", "The input chain has an entry list already which cannot be combined with the input event index or entry list. Abort!");
+	gSystem->Abort(1);
+    }
+
+    // Apply input event index. The chain then loads only the
+    // selected entries; the bookkeeping is still done for all input
+    // files. An excluding input entry list is applied on top of it
+    // (see Notify())
+    if ( fInputEventIndex != 0 ) {
+	Info("Begin", "Use input event index with %lld entries in %d input files.",
+	     fInputEventIndex->GetN(), fInputEventIndex->GetNFiles());
+	TEntryList *elist = fInputEventIndex->MakeEntryList(fTree->GetName());
+	elist->SetBit(kCanDelete);
+	fTree->SetEntryList(elist);
+    }
+
+    // Apply input entry list. An including list restricts the chain
+    // to the listed entries, an excluding list is applied entry by
+    // entry in Process() (see Notify())
+    if ( fInputEntryList != 0 ) {
+	Info("Begin", "Use input entry list with %lld entries (%s).",
+	     fInputEntryList->GetN(),
+	     ( fExcludeInputEntryList ) ? "excluded" : "included");
+	if ( !fExcludeInputEntryList ) fTree->SetEntryList(fInputEntryList);
+    }
 }
 
 //____________________________________________________________________
@@ -944,6 +1096,7 @@ void AtlSelector::SlaveBegin(TTree */*tree*/) {
 					     fOutputTreeTitle->Data(),
 					     fTree);
 	fEvtWriter->BookTree(fOutputTree, fEvent);
+	fEvtWriter->ApplyTreeSettings();
         Info(__FUNCTION__, "Created output tree %s.", fOutputTreeName->Data());
     }
 }
@@ -973,13 +1126,28 @@ Bool_t AtlSelector::Process(Long64_t entry) {
     if ( gDebug > 1 )
         Info(__FUNCTION__, "Start entry %lld", entry);
     fPassedSelection = kFALSE;
+    // Resolve event-local references against the current event
+    HepEvent::SetCurrentEvent(fEvent);
     // Save current Object count
-    Int_t ObjectNumber = TProcessID::GetObjectCount();
+    Int_t ObjectNumber = ( fResetObjectCount ) ? TProcessID::GetObjectCount() : 0;
+    ULong64_t NStringLookups = AtlTrigger::GetN_StringLookups();
 
     // skip event if using reduced samples
     if ( entry % fNProcessNthEventsOnly != 0 )
         return kFALSE;
 
+    // Skip entries of an excluding input entry list without reading
+    // them. The entries arrive in ascending order, so a moving index
+    // into the sorted list is sufficient
+    if ( fExclNext < fExclEntries.size() ) {
+	while ( fExclNext < fExclEntries.size() && fExclEntries[fExclNext] < entry )
+	    fExclNext++;
+	if ( fExclNext < fExclEntries.size() && fExclEntries[fExclNext] == entry )
+	    return kFALSE;
+    }
+
+    if ( fEventProfiler != 0 ) fEventProfiler->BeginEvent();
+
     // ===================
     // Step 1: Clear event
     // ===================
@@ -1004,6 +1172,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
     
     // Set tree for output entry list
     if ( fWriteEntryList ) fEntryList->SetTree(fTree);
+    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kRead);
     
 
     /*cout<<"EvtNumber="<<fEvent->GetEventHeader()->EventNr();
@@ -1022,6 +1191,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 	if ( tool->IsSystematics() )
 	    tool->Process();
     }
+    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kSystematics);
 
     // =================================
     // Step 4: Print event & Bookkeeping
@@ -1073,6 +1243,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 	if ( tool->IsObjectsDefinition() )
 	    PassedObjSelection = PassedObjSelection & tool->Process();
     }
+    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kObjects);
     
     // =========================
     // Step 6: Obj Selection cut
@@ -1092,6 +1263,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 	    if ( tool->IsScaleFactor() )
 		tool->Process();
 	}
+	if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kScaleFactors);
 
 	// ====================
 	// Step 8: Pre-Analysis
@@ -1112,7 +1284,9 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 	
 	// Perform user-defined pre-analysis. Only events passing this
 	// selection will be completely analyzed
-	if ( ProcessPreCut() == kTRUE ) {
+	Bool_t PassedPreCut = ProcessPreCut();
+	if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kPreAnalysis);
+	if ( PassedPreCut == kTRUE ) {
 	    // Count no. of pre-accepted events
 	    fHistEvents->Fill(6.5, 1.);
 	    fHistEvents->Fill(7.5, fEvent->GetMCWeight());
@@ -1131,6 +1305,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 		if ( tool->IsMainAnalysis() )
 		    tool->Process();
 	    }
+	    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kMainAnalysis);
 	    
 	    // ======================
 	    // Step 10: Post-analysis
@@ -1151,6 +1326,7 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 		fAcceptedEventsW += fEvent->GetPreTagEvtWeight();
 		fAcceptedEventsB += fEvent->GetTagEvtWeight();		
 	    }
+	    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kSelection);
 	    
 	    // Perform post-analysis for each analysis tool
 	    next_tool.Reset();
@@ -1158,17 +1334,21 @@ Bool_t AtlSelector::Process(Long64_t entry) {
 		if ( tool->IsPostAnalysis() )
 		    tool->Process();
 	    }
+	    if ( fEventProfiler != 0 ) fEventProfiler->Mark(AtlEventProfiler::kPostAnalysis);
 	}
     }
+    if ( fEventProfiler != 0 )
+	fEventProfiler->EndEvent(fEvent->RunNr(), fEvent->EventNr(), entry, fCurrentTree);
 
     // Restore Object count
     // To save space in the table keeping track of all referenced objects
     // we assume that our events do not address each other. We reset the
     // object count to what it was at the beginning of the event.
-    TProcessID::SetObjectCount(ObjectNumber);
+    if ( fResetObjectCount ) TProcessID::SetObjectCount(ObjectNumber);
     
     if ( gDebug > 1 )
-        Info(__FUNCTION__, "End entry  %lld", entry);
+        Info(__FUNCTION__, "End entry  %lld (%llu string-keyed trigger lookups)",
+	     entry, AtlTrigger::GetN_StringLookups() - NStringLookups);
     return kTRUE;
 }
 
@@ -1238,6 +1418,8 @@ void AtlSelector::Terminate() {
     Info("Terminate", "Write output file \"%s\".",
 	 fOutputFilename->Data());
     fOutputFile->cd();
+    if ( fEventIndex != 0 ) fEventIndex->Write();
+    if ( fEventProfiler != 0 ) fEventProfiler->Write();
     fOutputFile->Write();
 
     // Stop timer
@@ -1245,6 +1427,12 @@ void AtlSelector::Terminate() {
     
     // Print summary
     PrintSummary();
+
+    // Print event profile and store the slowest events
+    if ( fEventProfiler != 0 ) {
+	fEventProfiler->Print();
+	fEventProfiler->DumpSlowEvents();
+    }
 }
 
 //____________________________________________________________________
@@ -1277,6 +1465,11 @@ void AtlSelector::ProcessFill() {
       fEntryList->Enter(fEntry);
     }
 
+    // Fill event index (optional)
+    if ( fEventIndex != 0 ) {
+	fEventIndex->Enter(fEntry, fEvent->RunNr(), fEvent->EventNr());
+    }
+
 }
 
 //____________________________________________________________________
@@ -1378,7 +1571,11 @@ void AtlSelector::PrintSummary() {
 	 << fAcceptedEventsB << endl
 	 << "Time consumption                          : ";
     fStopwatch.Print();
-    cout << "Job status                                : successful" << endl
+    cout << "String-keyed trigger lookups per event    : "
+	 << ( ( fProcessedEvents > 0 ) ?
+	      (Double_t)AtlTrigger::GetN_StringLookups()/fProcessedEvents : 0. )
+	 << endl
+	 << "Job status                                : successful" << endl
 	 << endl
 	 << "For more information have a look at the histograms inside the"
 	 << endl
@@ -1714,6 +1911,69 @@ void AtlSelector::SetEvtReader(AtlEvtReaderBase * reader, Bool_t use_job_info) {
 
 //____________________________________________________________________
 
+void AtlSelector::SetEventProfiling(Int_t NSlowest, const char* DumpFile) {
+    //
+    // Switch on per-event timing of all processing stages (see
+    // AtlEventProfiler). The NSlowest slowest events are kept and, if
+    // DumpFile is given, copied into this file at the end of the job
+    //
+    if ( fEventProfiler == 0 ) fEventProfiler = new AtlEventProfiler;
+    fEventProfiler->SetNSlowest(NSlowest);
+    fEventProfiler->SetDumpFile(DumpFile);
+}
+
+//____________________________________________________________________
+
+Bool_t AtlSelector::SetInputEventIndex(AtlEventIndex *index) {
+    //
+    // Process only the entries contained in the given event index
+    // (see AtlEventIndex). Ownership of the index is transferred to
+    // AtlSelector!
+    //
+    // The index cannot be combined with an including input entry
+    // list, and it has to be given before the job is started. In
+    // these cases kFALSE is returned and the index stays with the
+    // caller
+    //
+    if ( fEvtReader != 0 ) {
+	Error(__FUNCTION__, "The input event index has to be given before the job is started.");
+	return kFALSE;
+    }
+    if ( index != 0 && fInputEntryList != 0 && !fExcludeInputEntryList ) {
+	Error(__FUNCTION__, "An input event index cannot be combined with an including input entry list.");
+	return kFALSE;
+    }
+    if ( fInputEventIndex != 0 ) delete fInputEventIndex;
+    fInputEventIndex = index;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlSelector::SetInputEntryList(TEntryList *list, Bool_t Exclude) {
+    //
+    // Process only the entries contained in the given entry list
+    // (Exclude = kFALSE) or all entries except those contained in the
+    // list (Exclude = kTRUE). The entry numbers are local to the trees
+    // of the input chain, as written by SetWriteEntryList().
+    // Ownership of the list is transferred to AtlSelector!
+    //
+    // An excluding list can be combined with an input event index,
+    // an including one cannot. In that case kFALSE is returned and
+    // the list stays with the caller
+    //
+    if ( list != 0 && !Exclude && fInputEventIndex != 0 ) {
+	Error(__FUNCTION__, "An including input entry list cannot be combined with an input event index.");
+	return kFALSE;
+    }
+    if ( fInputEntryList != 0 ) delete fInputEntryList;
+    fInputEntryList = list;
+    fExcludeInputEntryList = Exclude;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
 void AtlSelector::SetInputMode(EIOMode inputMode) {
 	//
 	// Sets the input mode.
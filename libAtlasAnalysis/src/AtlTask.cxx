@@ -53,6 +53,7 @@
 #include <TH1D.h>
 #include <TH2F.h>
 #include <TH2D.h>
+#include <map>
 
 using namespace std;
 
@@ -319,9 +320,14 @@ void AtlTask::Exec(Option_t *option) {
     }
 
     // Create paths
-    CreateJobHome();
-    if ( !fGridJob ) CreateLogFilePath();
-    if ( !fGridJob ) CreateOutFilePath();
+    success = CreateJobHome();
+    if ( success && !fGridJob ) CreateLogFilePath();
+    if ( success && !fGridJob ) success = CreateOutFilePath();
+    if ( !success ) {
+	Error("Exec", "Task \"%s\" execution failed.", GetName());
+	cout << endl;
+	return;
+    }
     
     // Start job
     if ( fInteractiveJob ) {
@@ -368,15 +374,16 @@ void AtlTask::SetJobHome(const char* JobHome) {
 
 //____________________________________________________________________
 
-void AtlTask::CreateJobHome() {
+Bool_t AtlTask::CreateJobHome() {
     //
     // Create working directory for this job (for log files etc) In
     // case no directory was given so far by SetJobHome() create a
-    // directory with the job's name in the current working directory
+    // directory with the job's name in the current working directory.
+    // Returns kFALSE if the directory cannot be created
     //
     if ( fJobHome == 0 ) {
 	if ( fGridJob ) {
-	    fJobHome = new TString(gSystem->ExpandPathName("$GRID_HOME/submitscripts"));
+	    fJobHome = new TString(ExpandPath("$GRID_HOME/submitscripts"));
 	} else {
 	    fJobHome = new TString(gSystem->pwd());
 	}
@@ -387,7 +394,12 @@ void AtlTask::CreateJobHome() {
     Info("CreateJobHome", "Create job working directory\n%s",
 	 fJobHome->Data());
     gSystem->Exec(Form("rm -fr %s", fJobHome->Data()));
-    gSystem->Exec(Form("mkdir -p %s", fJobHome->Data()));
+    if ( gSystem->mkdir(fJobHome->Data(), kTRUE) != 0 ) {
+	Error("CreateJobHome", "Cannot create job working directory %s",
+	      fJobHome->Data());
+	return kFALSE;
+    }
+    return kTRUE;
 }
 
 //____________________________________________________________________
@@ -436,13 +448,14 @@ void AtlTask::CreateLogFilePath() {
 
 //____________________________________________________________________
 
-void AtlTask::CreateOutFilePath() {
+Bool_t AtlTask::CreateOutFilePath() {
     //
     // Create path to the output file(s).  In case the already given
     // outfile name is absolute (ie starts with'/') do nothing.
-    // Otherwise prepend the JobHome path
+    // Otherwise prepend the JobHome path. Returns kFALSE if the
+    // directory cannot be created
     //
-    TString expd_name(gSystem->ExpandPathName(fOutputFileName->Data()));
+    TString expd_name(ExpandPath(fOutputFileName->Data()));
     if ( !expd_name.BeginsWith("/") ) {
 	fOutputFileName->Prepend("/");
 	fOutputFileName->Prepend(fJobHome->Data());
@@ -450,9 +463,17 @@ void AtlTask::CreateOutFilePath() {
     if ( fIsTest ) {
 	fOutputFileName->Append("_test");
     }
-    Info("CreateOutFilePath", "Create outfile path:\n%s",
-	 gSystem->DirName(fOutputFileName->Data()));
-    gSystem->Exec(Form("mkdir -p %s",  gSystem->DirName(fOutputFileName->Data())));
+    TString outdir = gSystem->DirName(fOutputFileName->Data());
+    Info("CreateOutFilePath", "Create outfile path:\n%s", outdir.Data());
+
+    // Note that TSystem::mkdir() fails also for existing directories
+    if ( gSystem->mkdir(outdir.Data(), kTRUE) != 0
+	 && gSystem->AccessPathName(outdir.Data()) ) {
+	Error("CreateOutFilePath", "Cannot create output directory %s",
+	      outdir.Data());
+	return kFALSE;
+    }
+    return kTRUE;
 }
 
 //____________________________________________________________________
@@ -466,11 +487,10 @@ Bool_t AtlTask::SubmitBatchJob() {
     //
 
     TString jobsub_cmd("condor_qsub ");
-    TString expd_outfile(gSystem->ExpandPathName(fOutputFileName->Data()));
     TString expd_infile;
     if ( fInputFiles->GetEntries() > 0 )
-	expd_infile = TString(gSystem->ExpandPathName(((TObjString*)fInputFiles
-						       ->At(0))->GetString()));
+	expd_infile = TString(ExpandPath(((TObjString*)fInputFiles
+					  ->At(0))->GetString()));
 
     TString host2(gSystem->HostName());
     if ( host2.Contains("lx") ) {
@@ -550,9 +570,6 @@ void AtlTask::SubmitNAFBatchJob() {
     // to guess the node name from the input file list
     //
     TString jobsub_cmd("qsub ");
-    TString expd_outfile(gSystem->ExpandPathName(fOutputFileName->Data()));
-    TString expd_infile(gSystem->ExpandPathName(((TObjString*)fInputFiles
-						 ->At(0))->GetString()));
     
     jobsub_cmd.Append(fRunScript->Data());
     Info("SubmitBatchJob", "Execute %s", jobsub_cmd.Data());
@@ -569,7 +586,7 @@ void AtlTask::SubmitGridJob() {
     jobsub_cmd.Append(GetName());
     jobsub_cmd.Append(".run");
     Info("SubmitGridJob", "Execute %s", jobsub_cmd.Data());
-    gSystem->ChangeDirectory(gSystem->ExpandPathName("$GRID_HOME"));
+    gSystem->ChangeDirectory(ExpandPath("$GRID_HOME"));
     gSystem->Exec(jobsub_cmd.Data());
 }
 
@@ -631,6 +648,28 @@ void AtlTask::CopyFolder(TDirectory *SrcDir, TDirectory *DestDir,
 
 //____________________________________________________________________
 
+const char* AtlTask::ExpandPath(const char* path) {
+    //
+    // Expand shell variables and "~" in the given path name (see
+    // TSystem::ExpandPathName()). The results are cached, since the
+    // same few paths ($GRID_HOME, the output dirs etc.) are expanded
+    // again and again when building and submitting large task trees.
+    //
+    // Note that changes of the environment during the session are
+    // not taken into account.
+    //
+    static std::map<TString, TString> expanded_paths;
+    std::map<TString, TString>::iterator it = expanded_paths.find(path);
+    if ( it == expanded_paths.end() ) {
+	TString expd_path(path);
+	gSystem->ExpandPathName(expd_path);
+	it = expanded_paths.insert(std::make_pair(TString(path), expd_path)).first;
+    }
+    return it->second.Data();
+}
+
+//____________________________________________________________________
+
 void AtlTask::SetGridRootVersion(const char* RootVersion) {
     //
     // Set grid root version
@@ -671,7 +710,7 @@ void AtlTask::SetGridSuffix(const char* Suffix) {
 
 //____________________________________________________________________
 
-Bool_t AtlTask::WriteEnvSetup(std::ofstream & out) const {
+Bool_t AtlTask::WriteEnvSetup(std::ostream & out) const {
     //
     // Generates the shell command(s) that set up the current A++/ROOT/... environment.
     // Returns kFALSE if it's not known how to set up the environment.
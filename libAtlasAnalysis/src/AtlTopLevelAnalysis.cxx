@@ -23,14 +23,17 @@
 #include <TObjString.h>
 #include <TROOT.h>
 #include <TRegexp.h>
+#include <TStopwatch.h>
 #include <TString.h>
 #include <TSystem.h>
 #include <AtlDataMCPlotterTask.h>
+#include <AtlDeferredTaskFolder.h>
 #include <AtlHistFactoryBreakdownTask.h>
 #include <AtlHistFactoryPlotterTask.h>
 #include <AtlHistFactoryTask.h>
 #include <AtlHistFactoryYieldTableTask.h>
 #include <AtlMemTkAnalysisTask.h>
+#include <AtlMemTkJobSplitter.h>
 #include <HepNtuplePlotCmd.h>
 
 using namespace std;
@@ -336,12 +339,16 @@ AtlTopLevelAnalysis::AtlTopLevelAnalysis(const char* name,
     fNProcessNthEventsOnly = 1;
     fMaxEventsPerSubjob = 0;
     fSampleSizes = new TObjArray();
+    fMemTkJobSplitter = 0;
     
     fMeasurement = 0;
 
     fDebug = 0;
     fDebugBuild = 0;
     fBatchNodeAutomatic = kTRUE;
+    fDryRun = kFALSE;
+    fDeferTasks = kTRUE;
+    fNDryRunTasks = 0;
 
     // defaults for the plotter task
     // fSkipData      = kTRUE;
@@ -358,6 +365,7 @@ AtlTopLevelAnalysis::AtlTopLevelAnalysis(const char* name,
     fDrawSignalOverlay       = kFALSE;
     fScaleOverlay            = 1.;
     fDrawSignificance        = kFALSE;
+    fIncrementalPlots        = kFALSE;
 
     fSelectedVariations = new TList();
 }
@@ -390,6 +398,7 @@ AtlTopLevelAnalysis::~AtlTopLevelAnalysis() {
     delete fOutputFilePrefix;
     delete fTreeName;
     delete fSampleSizes;
+    if ( fMemTkJobSplitter != 0 ) delete fMemTkJobSplitter;
 
     if ( fGridRootVersion != 0 ) delete fGridRootVersion;
     if ( fGridCmtVersion  != 0 ) delete fGridCmtVersion; 
@@ -474,9 +483,27 @@ void AtlTopLevelAnalysis::BuildTree(Bool_t OpenBrowser) {
     //
     // Build task tree
     //
+    // The no. of tasks and the time needed for building the tree are
+    // printed at the end.
+    //
+    // The analysis tasks of each systematic folder are created only
+    // when the folder is executed or browsed (see
+    // AtlDeferredTaskFolder), unless switched off by
+    // SetDeferTasks(kFALSE). Tasks of already successful jobs are
+    // never created.
+    //
+    // In dry-run mode (see SetDryRun()) the analysis tasks are only
+    // counted but not created, and no browser is opened.
+    //
+    TStopwatch stopwatch;
+    stopwatch.Start();
 
     // Reset any existing structure
     fTasks->Delete();
+    fNDryRunTasks = 0;
+
+    // Check all cuts once, before any job is created
+    if ( fBuildAnalysisTree || fBuildMemDiscAnalysisTree ) ValidateCuts();
 
     // Build Hfor Splitting tasks
     if ( fBuildHforTree ) {
@@ -538,6 +565,19 @@ void AtlTopLevelAnalysis::BuildTree(Bool_t OpenBrowser) {
 	Add(task_HistFactory);
 	BuildHistFactoryTree(task_HistFactory);
     }
+    stopwatch.Stop();
+    if ( fDryRun ) {
+	Info(__FUNCTION__, "Dry run: %d analysis tasks (not created), %d other tasks",
+	     fNDryRunTasks, CountTasks(this));
+    } else {
+	Int_t ndeferred = 0;
+	Int_t ntasks = CountTasks(this, &ndeferred);
+	Info(__FUNCTION__, "%d tasks created, %d folders of analysis tasks deferred",
+	     ntasks, ndeferred);
+    }
+    Info(__FUNCTION__, "Task tree built in %.2f s (real time), %.2f s (cpu time)",
+	 stopwatch.RealTime(), stopwatch.CpuTime());
+    if ( fDryRun ) return;
 
     // Open task structure in ROOT browser
     gROOT->GetListOfTasks()->Add(this);
@@ -549,6 +589,46 @@ void AtlTopLevelAnalysis::BuildTree(Bool_t OpenBrowser) {
 
 //____________________________________________________________________
 
+void AtlTopLevelAnalysis::ValidateCuts() {
+    //
+    // Check the selector and tool cuts (see AtlCutRegistry). This is
+    // done once for the whole task tree; the analysis tasks and their
+    // jobs re-use the result. Abort in case of errors, i.e. before
+    // any job is submitted
+    //
+    if ( fSelector == 0 ) return;
+    if ( !AtlAppAnalysisTask::ValidateCuts(fSelector->Data(), fListOfCuts,
+					   fListOfTools, fListOfToolCuts,
+					   kTRUE) ) {
+	Error(__FUNCTION__, "Invalid cuts. Abort!");
+	gSystem->Abort();
+    }
+    Info(__FUNCTION__, "%d selector and %d tool cuts checked",
+	 fListOfCuts->GetEntries(), fListOfToolCuts->GetEntries());
+}
+
+//____________________________________________________________________
+
+Int_t AtlTopLevelAnalysis::CountTasks(TTask *task, Int_t *NDeferred) const {
+    //
+    // Count all (executable) tasks below the given task folder. The
+    // no. of folders whose tasks have not been created yet is added
+    // to NDeferred, if given
+    //
+    Int_t ntasks = 0;
+    TIter next_task(task->GetListOfTasks());
+    TTask *t = 0;
+    while ( (t = (TTask*)next_task()) ) {
+	if ( t->InheritsFrom(AtlTask::Class()) ) ntasks++;
+	if ( NDeferred != 0 && t->InheritsFrom(AtlDeferredTaskFolder::Class())
+	     && !((AtlDeferredTaskFolder*)t)->IsBuilt() ) (*NDeferred)++;
+	ntasks += CountTasks(t, NDeferred);
+    }
+    return ntasks;
+}
+
+//____________________________________________________________________
+
 void AtlTopLevelAnalysis::BuildHforSplittingTree(TTask *ParentTask) {
     //
     // Build Hfor Splitting Tree with systematic subfolders
@@ -742,7 +822,7 @@ void AtlTopLevelAnalysis::BuildHforSplittingTasks(TTask *ParentTask,
     while ( (sample = (AtlSample*)next_sample()) ) {
 	if ( sample->IsMC() ) {
 	    // only W+jets samples
-	    if ( !sample->IsWjetsLight() && !sample->IsWjetsHeavy() ) { continue; }
+	    if ( !sample->HasAnyCategory(AtlSample::kCatWjetsLight | AtlSample::kCatWjetsHeavy) ) { continue; }
 	    // build category folder
 	    	    
 	    // Add Hfor Splitting Task
@@ -871,29 +951,43 @@ void AtlTopLevelAnalysis::BuildSystematicsFolders(TTask *ParentTask,
 			   (syst == kEES_DOWN) || (syst == kEES_UP) ) ) {
 			continue;
 		}
-            Info(__FUNCTION__, "Creating tasks for systematic %s", GetSystematicName(syst));
-	    TTask *task_systdir = new TTask(Form("%s",
-						 GetSystematicName(syst)),
-					    Form("%s",
-						 GetSystematicName(syst)));
-	    ParentTask->Add(task_systdir);
-	    BuildUserTasks(task_systdir, Jetbin, LepChannel, syst);
+	    BuildSystematicFolder(ParentTask, Jetbin, LepChannel, syst);
 	}
     }
 
     // Create folders for all selected-by-name systematics
     for ( TIter next(fSelectedVariations); TObject * handle = next(); ) {
         Int_t syst = fgDynamicSystematicTable.GetIdByHandle(handle);
-        Info(__FUNCTION__, "Creating tasks for systematic %s", GetSystematicName(syst));
-        TTask * task_systdir = new TTask(GetSystematicName(syst), GetSystematicName(syst));
-        ParentTask->Add(task_systdir);
-        BuildUserTasks(task_systdir, Jetbin, LepChannel, syst);
+        BuildSystematicFolder(ParentTask, Jetbin, LepChannel, syst);
     }
 
 }
 
 //____________________________________________________________________
 
+void AtlTopLevelAnalysis::BuildSystematicFolder(TTask *ParentTask,
+						Int_t Jetbin,
+						Int_t LepChannel,
+						Int_t Systematic) {
+    //
+    // Build folder of the given systematic with its user tasks. The
+    // creation of analysis tasks is deferred until the folder is
+    // executed (see AtlDeferredTaskFolder)
+    //
+    const char* name = GetSystematicName(Systematic);
+    if ( fBuildMode == kAnalysis && fDeferTasks && !fDryRun ) {
+	ParentTask->Add(new AtlDeferredTaskFolder(name, name, this, Jetbin,
+						  LepChannel, Systematic));
+	return;
+    }
+    Info(__FUNCTION__, "Creating tasks for systematic %s", name);
+    TTask *task_systdir = new TTask(name, name);
+    ParentTask->Add(task_systdir);
+    BuildUserTasks(task_systdir, Jetbin, LepChannel, Systematic);
+}
+
+//____________________________________________________________________
+
 Int_t AtlTopLevelAnalysis::GetSystematicIdByName(char const * name) {
     //
     // Translate name of variation into
@@ -1012,17 +1106,12 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
 	      sample->IsSystematicSample()) )    //    if using nominal or not a sample systematic
 	    continue;
 	
-	// ---------------------------------------
-	//  General Setup for DATA and MC Samples
-	// ---------------------------------------
-	
-	task_app = new AtlAppAnalysisTask(sample->GetName(), GetSystematicName(Systematic)); //sample->GetTitle());
-	task_app->SetDebug(fDebug);
-	task_app->SetDebugBuild(fDebugBuild);
-	if(!fGridJob) task_app->SetPriority(fPriority);
-
-        task_app->SetBatchNodeAll(fOverrideBatchNodeAll);
-        task_app->SetXsection(sample->GetXsection());
+	// ---------------------------------------------------------
+	//  Task descriptor (MC weights, output paths) for DATA and
+	//  MC samples. The task itself is created only if it has to
+	//  be run, i.e. not for already successful jobs or in
+	//  dry-run mode
+	// ---------------------------------------------------------
 
         // Special treatment for MC weight systematics, starting in v29
         // MC weight systematics are named MCWEIGHT_<weight_name>
@@ -1037,6 +1126,10 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
         TString weightName = "";
         Int_t EvtReaderMCWeightPosition = -1;
         Double_t EvtReaderMCWeightTotalEvents = -1.;
+        Int_t nsyst = 0; // no. of multiplied MC weight systematics
+        Double_t total_events_nominal = -1.;
+        TString weight_pos_vec_str;
+        TString weight_total_vec_str;
         if ( systName.BeginsWith("MCWEIGHT_") ) {
             if ( systName.BeginsWith("MCWEIGHT_FIXEDPOS_") ) {
                 // position is in systName
@@ -1051,17 +1144,13 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
             // find totalevents by position
             EvtReaderMCWeightTotalEvents = GetMCWeightTotalEvents(samplename.Data(), EvtReaderMCWeightPosition);
             if ( EvtReaderMCWeightTotalEvents < 0 ) continue;
-            task_app->SetEvtReaderMCWeightPosition(
-                EvtReaderMCWeightPosition);
-            task_app->SetEvtReaderMCWeightTotalEvents(
-                EvtReaderMCWeightTotalEvents);
         } else if ( systName.BeginsWith("MCWEIGHTS_") ) {
             // deconstruct MCWEIGHTS_N_X_name1Xname2X...XnameN:
             // - get number of systematics and separator
             std::unique_ptr<TObjArray> tokens(systName.Tokenize("_"));
             TString nsyst_str = static_cast<TObjString*>(tokens->At(1))->GetString();
             TString sep = static_cast<TObjString*>(tokens->At(2))->GetString();
-            Int_t nsyst = nsyst_str.Atoi();
+            nsyst = nsyst_str.Atoi();
             if ( nsyst < 2 or nsyst > 9 ) {
                 Error(__FUNCTION__, "Using n=%d weights is not supported. Skip!", nsyst);
                 continue;
@@ -1079,8 +1168,6 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
             Int_t weight_pos = -1;
             Double_t weight_total = -1.;
             Int_t err_code = 0;
-            TString weight_pos_vec_str;
-            TString weight_total_vec_str;
             for ( Int_t i = 0; i<tokens->GetEntries(); i++ ) {
                 auto obj = tokens2->At(i);
                 TString weight_syst_name = static_cast<TObjString*>(obj)->GetString();
@@ -1113,12 +1200,8 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
             }
 
 
-            // - pass positions and totals to task
-            task_app->SetEvtReaderMCWeightPosition(-nsyst);
-            Double_t total_events_nominal =  GetMCWeightTotalEvents(samplename.Data(), 0);
-            task_app->SetEvtReaderMCWeightTotalEvents(total_events_nominal);
-            task_app->SetEvtReaderMCWeightPositionString(weight_pos_vec_str);
-            task_app->SetEvtReaderMCWeightTotalEventsString(weight_total_vec_str);
+            // - positions and totals are passed to the task below
+            total_events_nominal = GetMCWeightTotalEvents(samplename.Data(), 0);
        }
 
         // Set output paths
@@ -1150,6 +1233,53 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
                                                  Jetbin, LepChannel,
                                                  Systematic, sample->GetName() );
         }
+
+        // skip job if already successful
+        if ( GetTaskStatus(jobHome, outfileName, outfile, kTRUE) ) {
+            delete outfile;
+            delete outfileName;
+            delete tmphist;
+            delete tempPath;
+            delete jobHome;
+            continue;
+        }
+
+	// Dry run: count the task only
+	if ( fDryRun ) {
+	    fNDryRunTasks++;
+	    delete outfile;
+	    delete outfileName;
+	    delete tmphist;
+	    delete tempPath;
+	    delete jobHome;
+	    continue;
+	}
+
+	// ---------------------------------------
+	//  General Setup for DATA and MC Samples
+	// ---------------------------------------
+	
+	task_app = new AtlAppAnalysisTask(sample->GetName(), GetSystematicName(Systematic)); //sample->GetTitle());
+	task_app->SetDebug(fDebug);
+	task_app->SetDebugBuild(fDebugBuild);
+	if(!fGridJob) task_app->SetPriority(fPriority);
+
+        task_app->SetBatchNodeAll(fOverrideBatchNodeAll);
+        task_app->SetXsection(sample->GetXsection());
+
+	// Pass MC weight systematics to the task
+	if ( EvtReaderMCWeightPosition >= 0 ) {
+	    task_app->SetEvtReaderMCWeightPosition(
+		EvtReaderMCWeightPosition);
+	    task_app->SetEvtReaderMCWeightTotalEvents(
+		EvtReaderMCWeightTotalEvents);
+	} else if ( nsyst > 0 ) {
+	    task_app->SetEvtReaderMCWeightPosition(-nsyst);
+	    task_app->SetEvtReaderMCWeightTotalEvents(total_events_nominal);
+	    task_app->SetEvtReaderMCWeightPositionString(weight_pos_vec_str);
+	    task_app->SetEvtReaderMCWeightTotalEventsString(weight_total_vec_str);
+	}
+
 	task_app->SetOutputFile( outfile->Data() );
 	task_app->SetTempOutputFile( tmphist->Data() );
 	task_app->SetTempOutputPath( tempPath->Data() );
@@ -1345,7 +1475,7 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
                 assert(!readerArgs);
                 readerArgs = Form("%s::kMC", reader.Data());
             }
-            if ( sample->IsDATA() || sample->IsQCD() ) {
+            if ( sample->HasAnyCategory(AtlSample::kCatDATA | AtlSample::kCatQCD) ) {
                 assert(!readerArgs);
                 readerArgs = Form("%s::kRealData", reader.Data());
             }
@@ -1376,16 +1506,6 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
 	task_app->AddToolCuts(fListOfToolCuts);
 	task_app->AddUserEnvs(fListOfUserEnvs);
 
-        // skip job if already successful
-        if ( GetTaskStatus(jobHome, outfileName, outfile, kTRUE) ) {
-            delete outfile;
-            delete outfileName;
-            delete tmphist;
-            delete tempPath;
-            delete jobHome;
-            continue;
-        }
-	
 	// clean up TString
 	delete outfile;
 	delete outfileName;
@@ -1481,12 +1601,12 @@ void AtlTopLevelAnalysis::BuildAnalysisTasks(TTask *ParentTask,
 	    TIter next_tool(fListOfTools);
 	    TObject *tool = 0;
 	    Bool_t qcdtool = kFALSE;
-            if ( sample->IsQCDJetLepton() || sample->IsQCDAntiMuon() ) 
+            if ( sample->HasAnyCategory(AtlSample::kCatQCDJetLepton | AtlSample::kCatQCDAntiMuon) ) 
                 qcdtool = kTRUE;
             while ( (tool = next_tool()) ) {
 		if ( ((TString)tool->ClassName()).Contains("AtlQCDMMTool") ) {
 		    qcdtool = kTRUE;
-                    if ( sample->IsQCDJetLepton() || sample->IsQCDAntiMuon() )
+                    if ( sample->HasAnyCategory(AtlSample::kCatQCDJetLepton | AtlSample::kCatQCDAntiMuon) )
                         task_app->SetToolCut( tool->GetName(), "fProcessMode", "AtlAnalysisTool::kOff");
                 }
 		// Do not turn off, but choose Nominal Mode
@@ -2220,10 +2340,7 @@ const char* AtlTopLevelAnalysis::GetInputFileName(AtlSample *sample, Int_t lep,
 	// Input tree is always in the nominal file
 	// Files for systematics do not exist anymore
 
-	if ( sample->IsHFOR0() ||
-	     sample->IsHFOR1() ||
-	     sample->IsHFOR2() ||
-	     sample->IsHFOR3() ) {
+	if ( sample->HasAnyCategory(AtlSample::kCatHFOR) ) {
 		Info("GetInputFileName ","%d" ,sample->GetType());
 	    Error("GetInputFileName",
 		  "HFOR splitting not yet supported. Abort!");
@@ -2463,8 +2580,8 @@ void AtlTopLevelAnalysis::BuildPlottingTasks(TTask *ParentTask,
 	//     continue; // skip data on request
 
         // Skip systematics for data and QCD samples
-        if ( sample->IsDATA() && Systematic != kNOMINAL ) { continue; }
-        if ( sample->IsQCD() && Systematic != kNOMINAL ) { continue; }
+        if ( sample->HasAnyCategory(AtlSample::kCatDATA | AtlSample::kCatQCD)
+             && Systematic != kNOMINAL ) { continue; }
 
 	// Skip egamma/muon stream if neccessary
 	UInt_t lep = 0x1 << LepChannel;
@@ -2738,6 +2855,7 @@ void AtlTopLevelAnalysis::BuildPlottingTasks(TTask *ParentTask,
     task_plot->SetDrawSignalOverlay(fDrawSignalOverlay);
     task_plot->SetScaleOverlay(fScaleOverlay);
     task_plot->SetDrawSignificance(fDrawSignificance);
+    task_plot->SetIncremental(fIncrementalPlots);
     
     // clean up TString
     delete outfile;
@@ -2800,6 +2918,15 @@ void AtlTopLevelAnalysis::BuildMemTkAnalysisTasks(TTask *ParentTask,
     TString *ana_outfile;
     TString *ana_outfileName;
 
+    // Integration times of previous runs for the cost-aware splitting
+    TString timing_file = Form("%s/%s/MemTkAnalysis/memtk_timing.txt",
+			       fJobHomeDir->Data(), GetName());
+    timing_file.ReplaceAll("//","/");
+    if ( fMemTkJobSplitter != 0 ) {
+	fMemTkJobSplitter->Clear();
+	fMemTkJobSplitter->ReadTimingFile(timing_file.Data());
+    }
+
     while ( (sample = (AtlSample*)next_sample()) ) {
 	
 	if ( fUseHforSamples )
@@ -3023,6 +3150,32 @@ void AtlTopLevelAnalysis::BuildMemTkAnalysisTasks(TTask *ParentTask,
             if ( NSubJobsAuto > 1 )
                 Nsubjobs = NSubJobsAuto;
 
+            // Cost-aware splitting into entry ranges of balanced
+            // estimated integration time. The split of a sample is
+            // kept fixed once done, since the outputs of successful
+            // subjobs are not re-produced.
+            std::vector<Long64_t> first_entry, n_entries;
+            if ( fMemTkJobSplitter != 0 ) {
+                TString split_file(jobHome->Data());
+                split_file.Append("/memtk_split.txt");
+                split_file.ReplaceAll("//","/");
+                Int_t nsplit = AtlMemTkJobSplitter::ReadSplit(split_file.Data(),
+                                                              first_entry, n_entries);
+                if ( nsplit == 0 ) {
+                    nsplit = fMemTkJobSplitter->Split(ana_outfile->Data(), Nsubjobs,
+                                                      first_entry, n_entries);
+                    if ( nsplit > 0 )
+                        AtlMemTkJobSplitter::WriteSplit(split_file.Data(),
+                                                        first_entry, n_entries);
+                }
+                if ( nsplit > 0 ) {
+                    Nsubjobs = nsplit;
+                } else {
+                    Warning(__FUNCTION__, "Cannot split %s by integration cost. Split by event count instead.",
+                            ana_outfile->Data());
+                }
+            }
+
             Info(__FUNCTION__, "Using %d subjobs for sample %s", Nsubjobs, sample->GetName());
                    
 	    TTask *t = 0;
@@ -3113,6 +3266,12 @@ void AtlTopLevelAnalysis::BuildMemTkAnalysisTasks(TTask *ParentTask,
 		task_tmp->AddUserEnvs(fListOfUserEnvs);
 		    
 		task_tmp->SetJobId(i);
+		if ( !first_entry.empty() ) {
+		    task_tmp->SetEntryRange(first_entry[i-1], n_entries[i-1]);
+		}
+		if ( fMemTkJobSplitter != 0 ) {
+		    task_tmp->SetTimingFile(timing_file.Data());
+		}
 
 		// skip job if already successful
 		if ( GetTaskStatus(jobHome2, outfileName2, outfile2) ) {
@@ -3144,6 +3303,10 @@ void AtlTopLevelAnalysis::BuildMemTkAnalysisTasks(TTask *ParentTask,
 	    task_app->SetMemTkRunScript(fMemTkRunScript->Data());
             task_app->SetMemTkTreatAllJetsAsBJets(fMemTkTreatAllJetsAsBJets);
             task_app->SetD3PDVersion(GetSgTopVersion()->Data());
+	    if ( fMemTkJobSplitter != 0 ) {
+		// record the integration time for later splittings
+		task_app->SetTimingFile(timing_file.Data());
+	    }
 
 	    // skip job if already successful
 	    if ( GetTaskStatus(jobHome, outfileName, outfile) ) {
@@ -3465,7 +3628,7 @@ void AtlTopLevelAnalysis::BuildMemDiscAnalysisTasks(TTask *ParentTask,
                 assert(!readerArgs);
                 readerArgs = Form("%s::kMC", reader.Data());
             }
-            if ( sample->IsDATA() || sample->IsQCD() ) {
+            if ( sample->HasAnyCategory(AtlSample::kCatDATA | AtlSample::kCatQCD) ) {
                 assert(!readerArgs);
                 readerArgs = Form("%s::kRealData", reader.Data());
             }
@@ -3496,7 +3659,7 @@ void AtlTopLevelAnalysis::BuildMemDiscAnalysisTasks(TTask *ParentTask,
 
         // if DATA or QCD take nominal
         // SF systematics also use nominal
-        if ( sample->IsDATA() || sample->IsQCD() ||
+        if ( sample->HasAnyCategory(AtlSample::kCatDATA | AtlSample::kCatQCD) ||
              IsScaleFactorSystematic(Systematic) ||
              IsBTagEVScaleFactorSystematic(Systematic) ||
              Systematic == kPdf_up || Systematic == kPdf_down ) {
@@ -3616,12 +3779,12 @@ void AtlTopLevelAnalysis::BuildMemDiscAnalysisTasks(TTask *ParentTask,
 	    TIter next_tool(fListOfTools);
 	    TObject *tool = 0;
 	    Bool_t qcdtool = kFALSE;
-            if ( sample->IsQCDJetLepton() || sample->IsQCDAntiMuon() )
+            if ( sample->HasAnyCategory(AtlSample::kCatQCDJetLepton | AtlSample::kCatQCDAntiMuon) )
                 qcdtool = kTRUE;
 	    while ( (tool = next_tool()) ) {
 	    	if ( ((TString)tool->ClassName()).Contains("AtlQCDMMTool") ) {
 	    	    qcdtool = kTRUE;
-                    if ( sample->IsQCDJetLepton() || sample->IsQCDAntiMuon() )
+                    if ( sample->HasAnyCategory(AtlSample::kCatQCDJetLepton | AtlSample::kCatQCDAntiMuon) )
                         task_memdisc->SetToolCut( tool->GetName(), "fProcessMode", "AtlAnalysisTool::kOff");
                 }
 	    	// Do not turn off, but choose Nominal Mode
@@ -5170,25 +5333,35 @@ Bool_t AtlTopLevelAnalysis::GetTaskStatus(TString *jobHome,
     }
 
     // Check result in logfile
-    TString jobstatus = TString();
+    //
+    // The job summary and status are printed at the very end of the
+    // job, so only the tail of the logfile is read. It is enlarged
+    // until the line is found (i.e. the whole file is read for
+    // unfinished jobs only). With require_success the last "Job
+    // status" line must report a successful job, otherwise a printed
+    // "Job Summary" is sufficient
+    Bool_t jobstatus = kFALSE;
     if ( logfile_exists ) {
-        FILE *flog;
-        if ( require_success ) {
-            flog = gSystem->OpenPipe(
-		Form("tac %s | grep -m1 \"Job status\" | grep -c successful ",
-		     logfile.Data() ), "r" );
-        }
-        else {
-            flog = gSystem->OpenPipe(
-                Form("grep -c \"Job Summary\" %s",
-                     logfile.Data() ), "r" );
-        }
-	jobstatus.Gets(flog);
-	gSystem->ClosePipe(flog);
+	const char* marker = require_success ? "Job status" : "Job Summary";
+	std::ifstream flog(logfile.Data(), std::ios::binary);
+	std::string tail;
+	Long_t ntail = 0;
+	while ( flog && ntail < size ) {
+	    ntail = TMath::Min(size, TMath::Max(4*ntail, (Long_t)65536));
+	    tail.resize(ntail);
+	    flog.seekg(size - ntail);
+	    flog.read(&tail[0], ntail);
+	    size_t pos = tail.rfind(marker);
+	    if ( pos == std::string::npos ) continue;
+	    jobstatus = !require_success ||
+		( tail.substr(pos, tail.find('\n', pos) - pos).find("successful")
+		  != std::string::npos );
+	    break;
+	}
     }
 
     // Evaluate job status
-    if ( outfile_exists && logfile_exists && jobstatus.Contains("1") ) {
+    if ( outfile_exists && logfile_exists && jobstatus ) {
         Info(__FUNCTION__, "Already done; skipping job for file %s",
              outfileName->Data());
 	return kTRUE;
@@ -5261,6 +5434,20 @@ void AtlTopLevelAnalysis::SetMemTkRunScript(const char* script) {
 
 //____________________________________________________________________
 
+void AtlTopLevelAnalysis::SetMemTkJobSplitter(AtlMemTkJobSplitter *splitter) {
+    //
+    // Split MemTk jobs into entry ranges of balanced estimated
+    // integration time instead of equal event counts (see
+    // AtlMemTkJobSplitter). The number of subjobs per sample is
+    // taken from the SetNSubJobs...() settings. The splitter is
+    // owned by the top-level analysis.
+    //
+    if ( fMemTkJobSplitter != 0 ) delete fMemTkJobSplitter;
+    fMemTkJobSplitter = splitter;
+}
+
+//____________________________________________________________________
+
 Bool_t AtlTopLevelAnalysis::IsIgnored(AtlSample * sample) {
     //
     // Whether the sample should be ignored by the Build*Tasks methods.
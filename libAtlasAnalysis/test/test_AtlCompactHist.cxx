@@ -0,0 +1,132 @@
+//____________________________________________________________________
+//
+// Round-trip test of AtlCompactHist
+//
+// Histograms are filled both directly and via AtlCompactHist and
+// converted with CopyTo(). Contents, errors, entries and statistics
+// must agree, in particular for unit weights with
+// TH1::SetDefaultSumw2(kTRUE) as set by AtlSelector.
+//
+// Usage:
+// ======
+// test_AtlCompactHist
+//
+#include <AtlCompactHist.h>
+#include <TH1D.h>
+#include <TH2D.h>
+#include <TMath.h>
+#include <TRandom3.h>
+#include <iostream>
+
+using namespace std;
+
+static Int_t gNFailed = 0;
+
+//____________________________________________________________________
+
+static void Check(const char* Test, const char* What, Double_t Value,
+		  Double_t Ref) {
+    //
+    // Compare value with reference
+    //
+    if ( TMath::Abs(Value - Ref) <= 1.e-9*(TMath::Abs(Ref) + 1.) ) return;
+    cerr << Test << ": " << What << " = " << Value << ", expected "
+	 << Ref << endl;
+    gNFailed++;
+}
+
+//____________________________________________________________________
+
+static void Compare(const char* Test, TH1 *h, TH1 *ref) {
+    //
+    // Compare the converted histogram with the directly filled one
+    //
+    Int_t ncells = ( ref->GetDimension() == 1 ) ? ref->GetNbinsX()+2
+	: (ref->GetNbinsX()+2)*(ref->GetNbinsY()+2);
+    for ( Int_t i = 0; i < ncells; i++ ) {
+	Check(Test, Form("content of bin %d", i), h->GetBinContent(i),
+	      ref->GetBinContent(i));
+	Check(Test, Form("error of bin %d", i), h->GetBinError(i),
+	      ref->GetBinError(i));
+    }
+    Check(Test, "entries", h->GetEntries(), ref->GetEntries());
+    Check(Test, "mean", h->GetMean(), ref->GetMean());
+    Check(Test, "rms", h->GetRMS(), ref->GetRMS());
+    Check(Test, "integral", h->Integral(), ref->Integral());
+}
+
+//____________________________________________________________________
+
+static void Test1D(const char* Test, Bool_t Float, Bool_t UnitWeights) {
+    //
+    // 1d round trip
+    //
+    TRandom3 rnd(4711);
+    AtlHistBinning binning(20, 0., 200.);
+    AtlCompactHist hc(&binning, Float);
+    TH1D *ref = new TH1D(Form("%s_ref", Test), "", 20, 0., 200.);
+    for ( Int_t i = 0; i < 10000; i++ ) {
+	Double_t x = rnd.Exp(50.);
+	Double_t w = UnitWeights ? 1. : rnd.Gaus(1., 0.2);
+	hc.Fill(x, w);
+	ref->Fill(x, w);
+    }
+    TH1 *h = binning.CreateHistogram(Test, "");
+    hc.CopyTo(h);
+    if ( UnitWeights ) {
+	// Errors of unit-weight histograms must be sqrt(N)
+	for ( Int_t i = 1; i <= 20; i++ )
+	    Check(Test, Form("sqrt(N) error of bin %d", i), h->GetBinError(i),
+		  TMath::Sqrt(ref->GetBinContent(i)));
+    }
+    Compare(Test, h, ref);
+    delete h;
+    delete ref;
+}
+
+//____________________________________________________________________
+
+static void Test2D(const char* Test, Bool_t UnitWeights) {
+    //
+    // 2d (sparse) round trip
+    //
+    TRandom3 rnd(4711);
+    AtlHistBinning binning(20, 0., 200., 10, -2.5, 2.5);
+    AtlCompactHist hc(&binning);
+    TH2D *ref = new TH2D(Form("%s_ref", Test), "", 20, 0., 200., 10, -2.5, 2.5);
+    for ( Int_t i = 0; i < 10000; i++ ) {
+	Double_t x = rnd.Exp(50.);
+	Double_t y = rnd.Gaus(0., 1.5);
+	Double_t w = UnitWeights ? 1. : rnd.Gaus(1., 0.2);
+	hc.Fill(x, y, w);
+	ref->Fill(x, y, w);
+    }
+    TH1 *h = binning.CreateHistogram(Test, "");
+    hc.CopyTo(h);
+    Compare(Test, h, ref);
+    delete h;
+    delete ref;
+}
+
+//____________________________________________________________________
+
+int main() {
+    //
+    // Run all tests, with and without default sum of squared weights
+    //
+    TH1::AddDirectory(kFALSE);
+    for ( Int_t sumw2 = 0; sumw2 < 2; sumw2++ ) {
+	TH1::SetDefaultSumw2(sumw2);
+	Test1D(Form("h1_double_unit_%d", sumw2),  kFALSE, kTRUE);
+	Test1D(Form("h1_double_weight_%d", sumw2), kFALSE, kFALSE);
+	Test1D(Form("h1_float_unit_%d", sumw2),   kTRUE,  kTRUE);
+	Test2D(Form("h2_unit_%d", sumw2),   kTRUE);
+	Test2D(Form("h2_weight_%d", sumw2), kFALSE);
+    }
+    if ( gNFailed > 0 ) {
+	cerr << gNFailed << " check(s) failed" << endl;
+	return 1;
+    }
+    cout << "All checks passed" << endl;
+    return 0;
+}
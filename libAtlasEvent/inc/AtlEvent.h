@@ -20,6 +20,9 @@
 #ifndef ATLAS_AtlMCJet
 #include <AtlMCJet.h>
 #endif
+#ifndef ATLAS_AtlMCTruthIndex
+#include <AtlMCTruthIndex.h>
+#endif
 #ifndef ATLAS_AtlIDTrack
 #include <AtlIDTrack.h>
 #endif
@@ -130,6 +133,9 @@
 #endif
 #include <TMatrixDSym.h>
 #include <TMatrixDSymEigen.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 class HepDatabasePDG;
 class TSystem;
@@ -139,6 +145,34 @@ class TDirectory;
 
 class AtlEvent : public HepEvent {
 
+public:
+    // Collection ids of event-local references (HepEventRef).
+    // The numbers are stored in the output files and must not be changed
+    enum ERefCollection {
+	kRefMCParticles      = 0,
+	kRefMCVertices       = 1,
+	kRefIDTracks         = 2,
+	kRefElectrons        = 3,
+	kRefMuons            = 4,
+	kRefTaus             = 5,
+	kRefPhotons          = 6,
+	kRefVertices         = 7,
+	kRefTopPairs         = 8,
+	kRefTopDecays        = 9,
+	kRefWDecaysLNu       = 10,
+	kRefWDecaysJJ        = 11,
+	kRefNeutrinos        = 12,
+	kRefZ0Decays         = 13,
+	kRefPhiDecaysKK      = 14,
+	kRefK0sDecaysPiPi    = 15,
+	kRefPhotonConv       = 16,
+	kRefLambdaDecaysPiPi = 17,
+	kRefD0DecaysKPi      = 18,
+	kRefDstarDecaysDPi   = 19,
+	kRefNumCollections,
+	kRefJets             = 100 // + AtlJet::EType
+    };
+
 private:
     AtlEventHeader  fEventHeader;         // Event header
     AtlTrigger     *fTrigger;             // Trigger decisions
@@ -248,6 +282,10 @@ private:
 
     // SgTop D3PD variables
     Bool_t fIsEleMuOverlap;
+
+    AtlMCTruthIndex *fMCTruthIndex;   //! Index of the MC truth record (built on demand)
+    mutable std::unordered_map<const TObject*, std::pair<Short_t, Int_t> > fRefIndex; //! Collection id and index of all referencable objects (built on demand)
+    mutable std::vector<Int_t> fRefIndexSizes; //! Collection sizes when fRefIndex was built
     
 public:
     AtlEvent();
@@ -255,6 +293,11 @@ public:
     virtual void Clear(Option_t *option = "");
     virtual void Print(Option_t *option = "all") const;
     void Init();
+    virtual TObject* GetRefObject(Short_t Collection, Int_t Index) const;
+    virtual Bool_t FindRef(const TObject *obj, Short_t &Collection,
+			   Int_t &Index) const;
+    TClonesArray* GetRefCollection(Short_t Collection) const;
+    Bool_t BuildRefIndex(Bool_t Force = kFALSE) const;
 
     //
     // Event building functions
@@ -267,6 +310,9 @@ public:
 				 Bool_t IsGenStable, Bool_t IsGenSimulStable,
 				 Bool_t IsGenInteracting, Bool_t IsConversion,
 				 Bool_t IsBremsstrahlung);
+    inline void AddMCRelation(Int_t Mother, Int_t Daughter,
+			      Bool_t FromMother = kTRUE)
+	    { fMCTruthIndex->AddRelation(Mother, Daughter, FromMother); }
     HepMCVertex* AddMCVertex(Float_t x, Float_t y, Float_t z);
 
     // Reconstructed objects
@@ -501,8 +547,15 @@ public:
 
     // Truth information
     TList*         GetMCParticles(const char* PrtType) const;
+    TList*         GetMCParticles(Int_t PdgCode) const;
+    const AtlMCTruthIndex* GetMCTruthIndex() const;
     HepMCParticle* GetMCParticle_ById(Int_t Id) const;
     TList*         GetMCGenealogy(HepMCParticle *prt) const;
+    TList*         GetMCAncestors(HepMCParticle *prt) const;
+    TList*         GetMCDescendants(HepMCParticle *prt) const;
+    HepMCParticle* GetMCFirstCopy(HepMCParticle *prt) const;
+    HepMCParticle* GetMCLastCopy(HepMCParticle *prt) const;
+    Int_t          GetMCParticleIndex(HepMCParticle *prt) const;
     TLorentzVector GetMCSumEnergy_NonInt() const;
     Float_t        GetMCSumEnergy_NonInt_Eta() const;
     Float_t        GetMCSumEnergy_NonInt_Phi() const;
@@ -738,6 +791,14 @@ public:
 	// Has passed given higher level trigger ?
 	return GetTrigger()->HasPassedHLT(HLTItemName, RunNr(), kTRUE);
     }
+    inline Bool_t HasPassedL1(Int_t L1Bit) const {
+	// Has passed 1st level trigger with given (pre-resolved) bit number ?
+	return GetTrigger()->HasPassedL1(L1Bit);
+    }
+    inline Bool_t HasPassedHLT(Int_t HLTBit) const {
+	// Has passed higher level trigger with given (pre-resolved) bit number ?
+	return GetTrigger()->HasPassedHLT(HLTBit);
+    }
     inline Bool_t HasMatchedL1(AtlTriggerMatch *RecoObject, const char* L1ItemName) {
 	//
 	// Test trigger matching of reconstructed object and given L1
@@ -776,7 +837,7 @@ public:
                               TList *CheckList = 0) const;
     void PrintTriggerMatches(AtlTriggerMatch *obj) const;
     
-    ClassDef(AtlEvent,67) // ATLAS event class
+    ClassDef(AtlEvent,68) // ATLAS event class
 };
 
 #endif
@@ -0,0 +1,112 @@
+#ifndef ATLAS_AtlMCTruthIndex
+#define ATLAS_AtlMCTruthIndex
+#ifndef ROOT_TObject
+#include <TObject.h>
+#endif
+#ifndef ROOT_TBits
+#include <TBits.h>
+#endif
+#include <unordered_map>
+#include <vector>
+
+class TClonesArray;
+
+class AtlMCTruthIndex : public TObject {
+
+  private:
+    Bool_t    fIsValid;       // Index up-to-date ?
+    UInt_t    fRunNr;         // Run number of the indexed event
+    ULong64_t fEventNr;       // Event number of the indexed event
+    Int_t     fN_MCParticles; // No. of indexed MC particles
+    std::vector<Int_t> fPdg;        // PDG code of each particle
+    std::vector<Int_t> fPdgCodes;   // Sorted list of all PDG codes present in the event
+    std::vector<Int_t> fPdgOffsets; // Offsets into fPdgEntries for each PDG code (size = fPdgCodes.size()+1)
+    std::vector<Int_t> fPdgEntries; // Particle indices grouped by PDG code (in record order)
+    std::vector<Int_t> fTops;       // Indices of all top quarks (t, then t_bar)
+    std::vector<Int_t> fWBosons;    // Indices of all W bosons (W+, then W-)
+    std::vector<Int_t> fBQuarks;    // Indices of all b quarks (b, then b_bar)
+    TBits     fGenStable;     // Particles with IsGenStable() set
+    TBits     fGenerator;     // Particles with IsGenerator() set
+    std::vector<Int_t> fRelMothers;    // Mother indices of the relations added by the reader (from the mother side)
+    std::vector<Int_t> fRelDaughters;  // Daughter indices of the relations added by the reader (from the mother side)
+    std::vector<Int_t> fRelUpMothers;   // Mother indices of the relations added by the reader (from the daughter side)
+    std::vector<Int_t> fRelUpDaughters; // Daughter indices of the relations added by the reader (from the daughter side)
+    std::vector<Int_t> fParentOffsets; // Offsets into fParents for each particle (size = fN_MCParticles+1)
+    std::vector<Int_t> fParents;       // Mother indices of all particles (CSR)
+    std::vector<Int_t> fChildOffsets;  // Offsets into fChildren for each particle (size = fN_MCParticles+1)
+    std::vector<Int_t> fChildren;      // Daughter indices of all particles (CSR)
+    std::unordered_map<const TObject*, Int_t> fPosition; // Position of each particle in the MC record
+
+  public:
+    AtlMCTruthIndex();
+    virtual ~AtlMCTruthIndex();
+    void Build(TClonesArray *MCParticles, Int_t N_MCParticles,
+	       UInt_t RunNr, ULong64_t EventNr);
+    virtual void Clear(Option_t *option = "");
+    void AddRelation(Int_t Mother, Int_t Daughter, Bool_t FromMother = kTRUE);
+    const Int_t* GetIndices(Int_t PdgCode, Int_t &N) const;
+    Int_t GetN(Int_t PdgCode) const;
+    void GetAncestors(Int_t i, std::vector<Int_t> &list) const;
+    void GetDescendants(Int_t i, std::vector<Int_t> &list) const;
+    Int_t GetFirstCopy(Int_t i) const;
+    Int_t GetLastCopy(Int_t i) const;
+    Bool_t IsGoodMother(Int_t i) const;
+    Int_t FindIndex(const TObject *prt) const;
+    inline const Int_t* GetParents(Int_t i, Int_t &N) const {
+	//
+	// Return indices of the mothers of particle i
+	//
+	N = fParentOffsets[i+1] - fParentOffsets[i];
+	return fParents.data() + fParentOffsets[i];
+    }
+    inline const Int_t* GetChildren(Int_t i, Int_t &N) const {
+	//
+	// Return indices of the daughters of particle i
+	//
+	N = fChildOffsets[i+1] - fChildOffsets[i];
+	return fChildren.data() + fChildOffsets[i];
+    }
+    inline Int_t GetN_Parents(Int_t i) const
+	    { return fParentOffsets[i+1] - fParentOffsets[i]; }
+    inline Int_t GetN_Children(Int_t i) const
+	    { return fChildOffsets[i+1] - fChildOffsets[i]; }
+    inline Int_t GetParent(Int_t i) const {
+	//
+	// Return index of the first mother of particle i (-1 if none)
+	//
+	return ( GetN_Parents(i) > 0 ) ? fParents[fParentOffsets[i]] : -1;
+    }
+    inline Bool_t IsValid(UInt_t RunNr, ULong64_t EventNr,
+			  Int_t N_MCParticles) const {
+	//
+	// Does the index belong to the given event ?
+	//
+	return fIsValid && fRunNr == RunNr && fEventNr == EventNr
+	    && fN_MCParticles == N_MCParticles;
+    }
+    inline void Invalidate() { fIsValid = kFALSE; }
+    inline Int_t GetN_MCParticles() const { return fN_MCParticles; }
+    inline Int_t GetPdgCode(Int_t i) const { return fPdg[i]; }
+    inline Bool_t IsGenStable(Int_t i) const { return fGenStable.TestBitNumber(i); }
+    inline Bool_t IsGenerator(Int_t i) const { return fGenerator.TestBitNumber(i); }
+    inline const TBits& GetGenStable() const { return fGenStable; }
+    inline const TBits& GetGenerator() const { return fGenerator; }
+    inline const std::vector<Int_t>& GetTops() const { return fTops; }
+    inline const std::vector<Int_t>& GetWBosons() const { return fWBosons; }
+    inline const std::vector<Int_t>& GetBQuarks() const { return fBQuarks; }
+
+  private:
+    void Reset();
+    void AddShortcut(std::vector<Int_t> &list, Int_t PdgCode);
+    void BuildGraph(TClonesArray *MCParticles);
+    void AddRelations(const std::vector<Int_t> &from_m,
+		      const std::vector<Int_t> &from_d,
+		      std::vector<Int_t> &mothers,
+		      std::vector<Int_t> &daughters) const;
+    void BuildCSR(const std::vector<Int_t> &from, const std::vector<Int_t> &to,
+		  std::vector<Int_t> &offsets, std::vector<Int_t> &entries);
+
+    ClassDef(AtlMCTruthIndex,0) // Per-event index of the MC truth record
+};
+#endif
+
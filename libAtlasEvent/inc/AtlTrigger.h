@@ -46,6 +46,7 @@ class AtlTrigger : public TObject {
     const char *fHLTNameCache; //! Last inquired HLT item name for caching reasons
     Int_t       fHLTBitCache;  //! Cache for last inquired HLT item bit number
     static AtlTriggerConf *fgTriggerConf;  //! Trigger configuration dbase
+    static ULong64_t fgN_StringLookups;    //! No. of trigger item lookups by name (for debugging)
     
 public:
     AtlTrigger();
@@ -102,6 +103,42 @@ public:
 	// and given run number
 	return GetHLTItem(name, RunNr, UseCache)->HasPassed();
     }
+    inline Bool_t HasPassedL1(Int_t Bit) const {
+	//
+	// Returns decision for level 1 trigger item with given bit
+	// number (see FindL1Bit()). False for invalid bit numbers
+	//
+	if ( Bit < 0 || Bit >= fL1Items->GetEntriesFast() ) return kFALSE;
+	AtlTriggerItem *item = (AtlTriggerItem*)fL1Items->UncheckedAt(Bit);
+	return ( item != 0 ) && item->HasPassed();
+    }
+    inline Bool_t HasPassedHLT(Int_t Bit) const {
+	//
+	// Returns decision for higher level trigger item with given
+	// bit number (see FindHLTBit()). False for invalid bit numbers
+	//
+	if ( Bit < 0 || Bit >= fHLTItems->GetEntriesFast() ) return kFALSE;
+	AtlTriggerItem *item = (AtlTriggerItem*)fHLTItems->UncheckedAt(Bit);
+	return ( item != 0 ) && item->HasPassed();
+    }
+    inline Int_t FindL1Bit(const char* name, Int_t RunNr) {
+	//
+	// Resolve bit number of level 1 trigger item <name> for the
+	// given run once, eg. when the run changes. Returns -1 if the
+	// item does not exist
+	//
+	return GetL1TriggerBit(name, RunNr, kFALSE);
+    }
+    inline Int_t FindHLTBit(const char* name, Int_t RunNr) {
+	//
+	// Resolve bit number of higher level trigger item <name> for
+	// the given run once, eg. when the run changes. Returns -1 if
+	// the item does not exist
+	//
+	return GetHLTTriggerBit(name, RunNr, kFALSE);
+    }
+    inline static ULong64_t GetN_StringLookups() { return fgN_StringLookups; }
+    inline static void ResetN_StringLookups() { fgN_StringLookups = 0; }
     inline Bool_t IsPhysicsStream()      const { return fStream & kPhysics; }
     inline Bool_t IsMuonsStream()        const { return fStream & kMuons; }
     inline Bool_t IsEgammaStream()       const { return fStream & kEgamma; }
@@ -88,6 +88,11 @@ AtlEvent::AtlEvent() {
     fDstarDecaysDPi      = new TClonesArray("AtlDstarDecayDPi",0);
     fVertices            = new TClonesArray("HepVertex",       1);
     fTrigger             = new AtlTrigger;
+    fMCTruthIndex        = new AtlMCTruthIndex;
+
+    // Resolve event-local references against this event unless
+    // another event has been set already
+    if ( GetCurrentEvent() == 0 ) SetCurrentEvent(this);
 }
 
 //____________________________________________________________________
@@ -148,6 +153,8 @@ AtlEvent::~AtlEvent() {
     delete fDstarDecaysDPi;
     delete fVertices;
     delete fTrigger;
+    delete fMCTruthIndex;
+    if ( GetCurrentEvent() == this ) SetCurrentEvent(0);
 }
 
 //____________________________________________________________________
@@ -187,6 +194,7 @@ void AtlEvent::Clear(Option_t *option) {
     fAtlFastJets         ->Clear("C");
     fMCParticles         ->Clear("C");
     fMCVertices          ->Clear("C");
+    fMCTruthIndex        ->Clear();
     fIDTracks            ->Clear("C");
     fPixelHits           ->Clear("C");
     fSCTHits             ->Clear("C");
@@ -628,6 +636,7 @@ HepMCParticle* AtlEvent::AddMCParticle(Int_t PdgCode, Float_t Px, Float_t Py,
     //
     // Add MC truth particle to the list of particles
     //
+    fMCTruthIndex->Invalidate();
     TClonesArray &mcparticles = *fMCParticles;
     HepMCParticle *mcprt = new(mcparticles[fN_MCParticles++])
 	HepMCParticle(fN_MCParticles, PdgCode, Px, Py, Pz, E, MCStatus,
@@ -1143,28 +1152,30 @@ TList* AtlEvent::GetMCTops(Bool_t good) const {
 	gSystem->Abort(0);
     }
     TList *ListMCTops = new TList;
-    ListMCTops->AddAll(GetMCParticles("t"));
-    ListMCTops->AddAll(GetMCParticles("t_bar"));
+    const std::vector<Int_t> &tops = GetMCTruthIndex()->GetTops();
+    for ( UInt_t i = 0; i < tops.size(); i++ )
+	ListMCTops->Add(fMCParticles->At(tops[i]));
     
     if (good){
 	TList *GoodTops = new TList;
-	HepMCParticle *top = 0;
-	TIter nexttop(ListMCTops);
-	while ((top=(HepMCParticle*)nexttop())){
+	const AtlMCTruthIndex *index = GetMCTruthIndex();
+	for ( UInt_t i = 0; i < tops.size(); i++ ) {
 	    Bool_t containsW=kFALSE;
 	    Bool_t containsQuark=kFALSE;
-	    Int_t NDaughters=top->GetN_Daughters();
+	    Int_t NDaughters = 0;
+	    const Int_t *daughters = index->GetChildren(tops[i], NDaughters);
 	    if (NDaughters<2) continue;
-	    if (!top->IsGenerator()) continue;
-	    if (!top->IsGoodMother()) continue;
+	    if (!index->IsGenerator(tops[i])) continue;
+	    if (!index->IsGoodMother(tops[i])) continue;
 	    for (Int_t j=0;j<NDaughters;j++){
-		if (((HepMCParticle*)top->GetDaughters()->At(j))->IsWBoson()) containsW=kTRUE;  
-		if (((HepMCParticle*)top->GetDaughters()->At(j))->IsQuark()&& !((HepMCParticle*)top->GetDaughters()->At(j))->IsTopQuark()) containsQuark=kTRUE; 
+		HepMCParticle *daughter = (HepMCParticle*)fMCParticles->At(daughters[j]);
+		if (daughter->IsWBoson()) containsW=kTRUE;  
+		if (daughter->IsQuark() && !daughter->IsTopQuark()) containsQuark=kTRUE; 
 	    }//end for j
 	    if (containsW && containsQuark){
-		GoodTops->Add(top);	      
+		GoodTops->Add(fMCParticles->At(tops[i]));	      
 	    }
-	}//end while 
+	}//end for i
 	delete ListMCTops;
 	return GoodTops;
     }//good
@@ -1188,10 +1199,14 @@ HepMCParticle* AtlEvent::GetGoodMother(HepMCParticle *particle){
 	return null;
     }
     
-    HepMCParticle *daughter = particle;
-    while ( !daughter->IsGoodMother() ) {
-	if( daughter->GetN_Daughters() != 0 ) {
-	    daughter = (HepMCParticle*)daughter->GetDaughters()->At(0);
+    const AtlMCTruthIndex *index = GetMCTruthIndex();
+    Int_t daughter = GetMCParticleIndex(particle);
+    if ( daughter < 0 ) return null;
+    for ( Int_t step = 0; !index->IsGoodMother(daughter); step++ ) {
+	Int_t n = 0;
+	const Int_t *children = index->GetChildren(daughter, n);
+	if( n != 0 && step < fN_MCParticles ) {
+	    daughter = children[0];
         }
         else {
 	    Error("GetGoodMother","This particle has daughters that are no good mothers because they do not have any daughters. DEAD END");
@@ -1199,7 +1214,7 @@ HepMCParticle* AtlEvent::GetGoodMother(HepMCParticle *particle){
         }
     }
     
-    return daughter;
+    return (HepMCParticle*)fMCParticles->At(daughter);
 }
 
 //____________________________________________________________________
@@ -1254,17 +1269,61 @@ TList* AtlEvent::GetMCParticles(const char* PrtType) const {
     // !!! (not its contents!) when it is not needed anymore !!!
     // !!! to avoid memory leaks.                            !!!
     //
+    return GetMCParticles(HepDatabasePDG::Instance()->GetParticle(PrtType)
+			  ->PdgCode());
+}
+
+//____________________________________________________________________
+
+TList* AtlEvent::GetMCParticles(Int_t PdgCode) const {
+    //
+    // Return list of all MC particles with given PDG code (in the
+    // order of the MC truth record)
+    //
+    // !!! The user is responsible for deleting this list    !!!
+    // !!! (not its contents!) when it is not needed anymore !!!
+    // !!! to avoid memory leaks.                            !!!
+    //
     TList *particles = new TList;
-    for ( Int_t i = 0; i < fN_MCParticles; i++ ) {
-	HepMCParticle *prt = (HepMCParticle*)fMCParticles->At(i);
-	if ( HepDatabasePDG::Instance()->GetParticle(PrtType)->PdgCode()
-	     == prt->GetPdgCode() ) particles->Add(prt);
-    }
+    Int_t n = 0;
+    const Int_t *idx = GetMCTruthIndex()->GetIndices(PdgCode, n);
+    for ( Int_t i = 0; i < n; i++ )
+	particles->Add(fMCParticles->At(idx[i]));
     return particles;
 }
 
 //____________________________________________________________________
 
+const AtlMCTruthIndex* AtlEvent::GetMCTruthIndex() const {
+    //
+    // Return index of the MC truth record. The index is built on the
+    // first call after the MC record has been filled (or read) and
+    // re-used for all further truth queries of the same event
+    //
+    if ( !fMCTruthIndex->IsValid(RunNr(), EventNr(), fN_MCParticles) )
+	fMCTruthIndex->Build(fMCParticles, fN_MCParticles,
+			     RunNr(), EventNr());
+    return fMCTruthIndex;
+}
+
+//____________________________________________________________________
+
+Int_t AtlEvent::GetMCParticleIndex(HepMCParticle *prt) const {
+    //
+    // Return position of the given particle in the array of MC
+    // particles. An error is given and -1 is returned if the particle
+    // is not part of the MC record of this event
+    //
+    Int_t i = GetMCTruthIndex()->FindIndex(prt);
+    if ( i < 0 && prt != 0 )
+	Error("GetMCParticleIndex",
+	      "MC particle %d is not part of the MC record of this event.",
+	      prt->GetId());
+    return i;
+}
+
+//____________________________________________________________________
+
 void AtlEvent::PrintMCParticles(const char* PrtType) const {
     //
     // Print all MC particle of given type
@@ -1378,16 +1437,90 @@ TList* AtlEvent::GetMCGenealogy(HepMCParticle *prt) const {
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     //
     TList *history = new TList;
-    while ( prt != 0 ) {
-	history->Add(prt);
-	HepMCParticle *mother = prt->DaughterOf();
-	prt = mother;
+    if ( prt == 0 ) return history;
+    history->Add(prt);
+    const AtlMCTruthIndex *index = GetMCTruthIndex();
+    Int_t i = GetMCParticleIndex(prt);
+    if ( i < 0 ) return history;
+    for ( Int_t step = 0; step < fN_MCParticles; step++ ) {
+	i = index->GetParent(i);
+	if ( i < 0 ) break;
+	history->Add(fMCParticles->At(i));
     }
     return history;
 }
 
 //____________________________________________________________________
 
+TList* AtlEvent::GetMCAncestors(HepMCParticle *prt) const {
+    //
+    // Get list of all ancestors (all mothers, grandmothers etc.) of
+    // given MC particle, nearest ancestors first. In contrast to
+    // GetMCGenealogy() all mothers are followed, not only the first one
+    //
+    // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    // !!! The user is responsible for deleting the returned list     !!!
+    // !!! (not the list elements!) afterwards to avoid memory leaks. !!!
+    // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    //
+    TList *ancestors = new TList;
+    Int_t i = GetMCParticleIndex(prt);
+    if ( i < 0 ) return ancestors;
+    std::vector<Int_t> list;
+    GetMCTruthIndex()->GetAncestors(i, list);
+    for ( UInt_t k = 0; k < list.size(); k++ )
+	ancestors->Add(fMCParticles->At(list[k]));
+    return ancestors;
+}
+
+//____________________________________________________________________
+
+TList* AtlEvent::GetMCDescendants(HepMCParticle *prt) const {
+    //
+    // Get list of all descendants of given MC particle, direct
+    // daughters first
+    //
+    // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    // !!! The user is responsible for deleting the returned list     !!!
+    // !!! (not the list elements!) afterwards to avoid memory leaks. !!!
+    // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+    //
+    TList *descendants = new TList;
+    Int_t i = GetMCParticleIndex(prt);
+    if ( i < 0 ) return descendants;
+    std::vector<Int_t> list;
+    GetMCTruthIndex()->GetDescendants(i, list);
+    for ( UInt_t k = 0; k < list.size(); k++ )
+	descendants->Add(fMCParticles->At(list[k]));
+    return descendants;
+}
+
+//____________________________________________________________________
+
+HepMCParticle* AtlEvent::GetMCFirstCopy(HepMCParticle *prt) const {
+    //
+    // Return first copy of the given MC particle in the decay chain
+    // (eg. the top quark as produced in the hard process)
+    //
+    Int_t i = GetMCParticleIndex(prt);
+    if ( i < 0 ) return prt;
+    return (HepMCParticle*)fMCParticles->At(GetMCTruthIndex()->GetFirstCopy(i));
+}
+
+//____________________________________________________________________
+
+HepMCParticle* AtlEvent::GetMCLastCopy(HepMCParticle *prt) const {
+    //
+    // Return last copy of the given MC particle in the decay chain
+    // (eg. the top quark right before its decay)
+    //
+    Int_t i = GetMCParticleIndex(prt);
+    if ( i < 0 ) return prt;
+    return (HepMCParticle*)fMCParticles->At(GetMCTruthIndex()->GetLastCopy(i));
+}
+
+//____________________________________________________________________
+
 void AtlEvent::PrintMCGenealogy(HepMCParticle *prt) const {
     //
     // Print all anchestors of given MC particle
@@ -1553,6 +1686,12 @@ AtlJet* AtlEvent::GetLeadingJet(AtlJet::EType type) const {
     //
     // Get jet of given type with largest Et
     //
+    // The jet container itself is left unchanged, i.e. it is no
+    // longer sorted by this function. Its order is kept such that
+    // event-local references to the jets (HepEventRef) stay
+    // valid. Use GetJets(type, Et_min, ...) for a list of jets sorted
+    // in descending order of Et
+    //
     if ( GetN_Jets(type) < 1 ) {
 	Warning("GetLeadingJet",
 		"No jets of type \"%s\" in this event!",
@@ -1560,10 +1699,12 @@ AtlJet* AtlEvent::GetLeadingJet(AtlJet::EType type) const {
 	return 0;
     }
     TClonesArray *jets = GetJets(type);
-    if ( !jets->IsSorted() ) jets->Sort();
-    // Note that currently TCloneArrays can only be sorted in
-    // ascending order :(
-    return (AtlJet*)jets->Last();
+    AtlJet *leading = (AtlJet*)jets->UncheckedAt(0);
+    for ( Int_t i = 1; i < jets->GetEntriesFast(); i++ ) {
+	AtlJet *jet = (AtlJet*)jets->UncheckedAt(i);
+	if ( jet->Compare(leading) > 0 ) leading = jet;
+    }
+    return leading;
 }
 
 //____________________________________________________________________
@@ -1772,6 +1913,117 @@ TClonesArray* AtlEvent::GetJets(AtlJet::EType type) const {
 
 //____________________________________________________________________
 
+TClonesArray* AtlEvent::GetRefCollection(Short_t Collection) const {
+    //
+    // Return the collection with the given id of event-local
+    // references (see ERefCollection). Returns 0 for unknown ids
+    //
+    if ( Collection >= kRefJets && Collection < kRefJets + AtlJet::kNumTypes )
+	return GetJets((AtlJet::EType)(Collection - kRefJets));
+    switch ( Collection ) {
+	case kRefMCParticles:      return fMCParticles;
+	case kRefMCVertices:       return fMCVertices;
+	case kRefIDTracks:         return fIDTracks;
+	case kRefElectrons:        return fElectrons;
+	case kRefMuons:            return fMuons;
+	case kRefTaus:             return fTaus;
+	case kRefPhotons:          return fPhotons;
+	case kRefVertices:         return fVertices;
+	case kRefTopPairs:         return fTopPairs;
+	case kRefTopDecays:        return fTopDecays;
+	case kRefWDecaysLNu:       return fWDecaysLNu;
+	case kRefWDecaysJJ:        return fWDecaysJJ;
+	case kRefNeutrinos:        return fNeutrinos;
+	case kRefZ0Decays:         return fZ0Decays;
+	case kRefPhiDecaysKK:      return fPhiDecaysKK;
+	case kRefK0sDecaysPiPi:    return fK0sDecaysPiPi;
+	case kRefPhotonConv:       return fPhotonConv;
+	case kRefLambdaDecaysPiPi: return fLambdaDecaysPiPi;
+	case kRefD0DecaysKPi:      return fD0DecaysKPi;
+	case kRefDstarDecaysDPi:   return fDstarDecaysDPi;
+	default:                   return 0;
+    }
+}
+
+//____________________________________________________________________
+
+TObject* AtlEvent::GetRefObject(Short_t Collection, Int_t Index) const {
+    //
+    // Resolve an event-local reference (HepEventRef). Returns 0 if the
+    // collection does not exist or has less entries
+    //
+    TClonesArray *arr = GetRefCollection(Collection);
+    if ( arr == 0 || Index < 0 || Index >= arr->GetEntriesFast() ) return 0;
+    return arr->UncheckedAt(Index);
+}
+
+//____________________________________________________________________
+
+Bool_t AtlEvent::FindRef(const TObject *obj, Short_t &Collection,
+			 Int_t &Index) const {
+    //
+    // Find collection id and index of the given object for an
+    // event-local reference (HepEventRef). The objects are looked up
+    // in an index of all collections which is rebuilt whenever the
+    // size of a collection or the position of an object has
+    // changed. Returns kFALSE if the object is not part of this event
+    //
+    auto it = fRefIndex.find(obj);
+    if ( it != fRefIndex.end() ) {
+	TClonesArray *arr = GetRefCollection(it->second.first);
+	if ( arr != 0 && it->second.second < arr->GetEntriesFast()
+	     && arr->UncheckedAt(it->second.second) == obj ) {
+	    Collection = it->second.first;
+	    Index = it->second.second;
+	    return kTRUE;
+	}
+	// Object has been moved (eg. by sorting)
+	BuildRefIndex(kTRUE);
+    } else {
+	if ( !BuildRefIndex() ) return kFALSE;
+    }
+    it = fRefIndex.find(obj);
+    if ( it == fRefIndex.end() ) return kFALSE;
+    Collection = it->second.first;
+    Index = it->second.second;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlEvent::BuildRefIndex(Bool_t Force) const {
+    //
+    // Build the index of all objects which can be addressed by
+    // event-local references. Unless forced, the index is rebuilt
+    // only if the size of any collection has changed. Returns kTRUE
+    // if the index has been rebuilt
+    //
+    Int_t ncoll = kRefNumCollections + AtlJet::kNumTypes;
+    std::vector<Int_t> sizes(ncoll, -1);
+    for ( Int_t id = 0; id < ncoll; id++ ) {
+	Short_t coll = ( id < kRefNumCollections ) ? id
+	    : kRefJets + id - kRefNumCollections;
+	TClonesArray *arr = GetRefCollection(coll);
+	if ( arr != 0 ) sizes[id] = arr->GetEntriesFast();
+    }
+    if ( !Force && sizes == fRefIndexSizes ) return kFALSE;
+
+    fRefIndex.clear();
+    for ( Int_t id = 0; id < ncoll; id++ ) {
+	Short_t coll = ( id < kRefNumCollections ) ? id
+	    : kRefJets + id - kRefNumCollections;
+	TClonesArray *arr = GetRefCollection(coll);
+	for ( Int_t i = 0; i < sizes[id]; i++ ) {
+	    TObject *o = arr->UncheckedAt(i);
+	    if ( o != 0 ) fRefIndex.emplace(o, std::make_pair(coll, i));
+	}
+    }
+    fRefIndexSizes.swap(sizes);
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
 TList* AtlEvent::GetElectrons(AtlElectron::EAuthor author,
 			      AtlEMShower::EIsEM IsEM, Float_t Pt_min,
 			      Float_t Pt_max, Float_t Eta_min,
@@ -2170,11 +2422,10 @@ TList* AtlEvent::GetStableMCParticles() const {
     // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     //
     TList *particles = new TList;
-    HepMCParticle *prt = 0;
-    for ( Int_t i = 0; i < GetN_MCParticles(); i++ ) {
-	prt = (HepMCParticle*)GetMCParticles()->At(i);
-	if ( prt->IsGenStable() ) particles->Add(prt);
-    } 
+    const TBits &stable = GetMCTruthIndex()->GetGenStable();
+    for ( UInt_t i = stable.FirstSetBit(); i < stable.GetNbits();
+	  i = stable.FirstSetBit(i+1) )
+	particles->Add(fMCParticles->At(i));
     return particles;
 }
 
@@ -2202,12 +2453,15 @@ TList* AtlEvent::FindMCParticlesByName(const char* PdgName,
     Int_t PdgCode = HepDatabasePDG::Instance()->GetParticle(PdgName)->PdgCode();
     TList *particles = new TList;
     HepMCParticle *prt = 0;
-    for ( Int_t i = 0; i < GetN_MCParticles(); i++ ) {
-	prt = (HepMCParticle*)GetMCParticles()->At(i);
-	if ( prt->GetPdgCode() != PdgCode ) continue;
-	if ( RemoveDouble && prt->GetN_Daughters() == 1 ) {
-	    if ( ((HepMCParticle*)prt->GetDaughters()->First())
-		 ->GetPdgCode() == PdgCode ) continue;
+    const AtlMCTruthIndex *index = GetMCTruthIndex();
+    Int_t n = 0;
+    const Int_t *idx = index->GetIndices(PdgCode, n);
+    for ( Int_t i = 0; i < n; i++ ) {
+	prt = (HepMCParticle*)fMCParticles->At(idx[i]);
+	if ( RemoveDouble && index->GetN_Children(idx[i]) == 1 ) {
+	    Int_t nchildren = 0;
+	    if ( index->GetPdgCode(index->GetChildren(idx[i], nchildren)[0])
+		 == PdgCode ) continue;
 	}
 	particles->Add(prt);
     }
@@ -0,0 +1,446 @@
+//____________________________________________________________________
+//
+// Per-event index of the MC truth record
+//
+// The index is built once per event from the array of MC particles
+// and provides
+//
+//   - for each PDG code present in the event the contiguous list of
+//     particle indices (in record order),
+//   - bitmaps of the particles with IsGenStable() and IsGenerator()
+//     set,
+//   - shortcuts to all top quarks, W bosons and b quarks,
+//   - the mother/daughter relations as index arrays in compressed
+//     sparse row (CSR) layout, ie. for particle i the mothers are
+//     fParents[fParentOffsets[i]..fParentOffsets[i+1]-1] and likewise
+//     for the daughters.
+//
+// The relations are supplied by the event readers via
+// AtlEvent::AddMCRelation() while filling the MC record. If no
+// relations were given (eg. for A++ events read from file), they are
+// taken once from the TRef links of the HepMCParticle objects when the
+// index is built; links to particles outside of the MC record are
+// reported as an error. In both cases the daughters and mothers of
+// each particle are kept in the order given by the reader or the
+// TRefArrays, ie. GetChildren(i, n)[0] is the first daughter as
+// returned by HepMCParticle::GetDaughters()->At(0). Afterwards all genealogy queries (GetAncestors(),
+// GetDescendants(), GetFirstCopy(), GetLastCopy(), IsGoodMother())
+// work on plain integer arrays without dereferencing any TRef.
+//
+// All indices refer to the position of the particle in the
+// TClonesArray of MC particles (AtlEvent::GetMCParticles()). The
+// index is owned by AtlEvent and built on demand by
+// AtlEvent::GetMCTruthIndex(); it is not streamed.
+//
+#ifndef ATLAS_AtlMCTruthIndex
+#include <AtlMCTruthIndex.h>
+#endif
+#include <HepMCParticle.h>
+#include <TClonesArray.h>
+#include <TRefArray.h>
+#include <algorithm>
+#include <set>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlMCTruthIndex);
+#endif
+
+//____________________________________________________________________
+
+AtlMCTruthIndex::AtlMCTruthIndex() {
+    //
+    // Default constructor
+    //
+    fIsValid       = kFALSE;
+    fRunNr         = 0;
+    fEventNr       = 0;
+    fN_MCParticles = 0;
+}
+
+//____________________________________________________________________
+
+AtlMCTruthIndex::~AtlMCTruthIndex() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::Clear(Option_t *option) {
+    //
+    // Clear index and the mother/daughter relations given by the
+    // reader. The allocated memory is kept for the next event
+    //
+    Reset();
+    fRelMothers.clear();
+    fRelDaughters.clear();
+    fRelUpMothers.clear();
+    fRelUpDaughters.clear();
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::Reset() {
+    //
+    // Reset index (but keep the relations given by the reader)
+    //
+    fIsValid       = kFALSE;
+    fRunNr         = 0;
+    fEventNr       = 0;
+    fN_MCParticles = 0;
+    fPdgCodes.clear();
+    fPdgOffsets.clear();
+    fPdgEntries.clear();
+    fTops.clear();
+    fWBosons.clear();
+    fBQuarks.clear();
+    fGenStable.ResetAllBits();
+    fGenerator.ResetAllBits();
+    fPdg.clear();
+    fParentOffsets.clear();
+    fParents.clear();
+    fChildOffsets.clear();
+    fChildren.clear();
+    fPosition.clear();
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::AddRelation(Int_t Mother, Int_t Daughter,
+				  Bool_t FromMother) {
+    //
+    // Add mother-daughter relation given by the positions of both
+    // particles in the MC record. To be called by the event reader.
+    //
+    // Relations taken from the daughter list of the mother
+    // (FromMother = kTRUE) define the order of the daughters,
+    // relations taken from the mother list of the daughter
+    // (FromMother = kFALSE) the order of the mothers
+    //
+    if ( FromMother ) {
+	fRelMothers.push_back(Mother);
+	fRelDaughters.push_back(Daughter);
+    } else {
+	fRelUpMothers.push_back(Mother);
+	fRelUpDaughters.push_back(Daughter);
+    }
+    fIsValid = kFALSE;
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::Build(TClonesArray *MCParticles, Int_t N_MCParticles,
+			    UInt_t RunNr, ULong64_t EventNr) {
+    //
+    // Build index from the given MC truth record
+    //
+    Reset();
+    fRunNr         = RunNr;
+    fEventNr       = EventNr;
+    fN_MCParticles = N_MCParticles;
+
+    // Sorted list of PDG codes and status bitmaps
+    vector<Int_t> &pdg = fPdg;
+    pdg.resize(N_MCParticles);
+    fPosition.reserve(N_MCParticles);
+    for ( Int_t i = 0; i < N_MCParticles; i++ ) {
+	HepMCParticle *prt = (HepMCParticle*)MCParticles->At(i);
+	fPosition[prt] = i;
+	pdg[i] = prt->GetPdgCode();
+	if ( prt->IsGenStable() ) fGenStable.SetBitNumber(i);
+	if ( prt->IsGenerator() ) fGenerator.SetBitNumber(i);
+    }
+    fPdgCodes = pdg;
+    sort(fPdgCodes.begin(), fPdgCodes.end());
+    fPdgCodes.erase(unique(fPdgCodes.begin(), fPdgCodes.end()),
+		    fPdgCodes.end());
+
+    // Count particles per PDG code and convert counts into offsets
+    Int_t ncodes = fPdgCodes.size();
+    vector<Int_t> slot(N_MCParticles);
+    fPdgOffsets.assign(ncodes+1, 0);
+    for ( Int_t i = 0; i < N_MCParticles; i++ ) {
+	slot[i] = lower_bound(fPdgCodes.begin(), fPdgCodes.end(), pdg[i])
+	    - fPdgCodes.begin();
+	fPdgOffsets[slot[i]+1]++;
+    }
+    for ( Int_t k = 0; k < ncodes; k++ )
+	fPdgOffsets[k+1] += fPdgOffsets[k];
+
+    // Fill particle indices, keeping the record order within each code
+    fPdgEntries.resize(N_MCParticles);
+    vector<Int_t> pos(fPdgOffsets.begin(), fPdgOffsets.end()-1);
+    for ( Int_t i = 0; i < N_MCParticles; i++ )
+	fPdgEntries[pos[slot[i]]++] = i;
+
+    // Shortcuts
+    AddShortcut(fTops,     6);
+    AddShortcut(fTops,    -6);
+    AddShortcut(fWBosons, 24);
+    AddShortcut(fWBosons, -24);
+    AddShortcut(fBQuarks,  5);
+    AddShortcut(fBQuarks, -5);
+
+    // Mother/daughter relations
+    BuildGraph(MCParticles);
+
+    fIsValid = kTRUE;
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::BuildGraph(TClonesArray *MCParticles) {
+    //
+    // Build CSR arrays of mothers and daughters. Relations are taken
+    // from the reader if given, otherwise from the TRef links of the
+    // particles. Double and out-of-range relations are dropped. The
+    // order of the daughters (mothers) of each particle is the order
+    // in which they were given by the reader or stored in the
+    // daughter (mother) TRefArray
+    //
+
+    // Relations listed from the mother side (daughter lists) and from
+    // the daughter side (mother lists). The daughter lists define the
+    // order of the children, the mother lists the order of the parents
+    Bool_t UseTRefs = ( fRelMothers.size() == 0 && fRelUpMothers.size() == 0 );
+    vector<Int_t> dau_m(fRelMothers), dau_d(fRelDaughters);
+    vector<Int_t> mot_m(fRelUpMothers), mot_d(fRelUpDaughters);
+    for ( Int_t i = 0; UseTRefs && i < fN_MCParticles; i++ ) {
+	HepMCParticle *prt = (HepMCParticle*)MCParticles->At(i);
+	TRefArray *links = prt->GetDaughters();
+	for ( Int_t j = 0; j < links->GetEntriesFast(); j++ ) {
+	    Int_t d = FindIndex(links->At(j));
+	    if ( d < 0 ) {
+		Error("BuildGraph", "Daughter %d of MC particle %d is not part of the MC record (run %u, event %llu).",
+		      j, i, fRunNr, fEventNr);
+		continue;
+	    }
+	    dau_m.push_back(i);
+	    dau_d.push_back(d);
+	}
+	links = prt->GetMothers();
+	for ( Int_t j = 0; j < links->GetEntriesFast(); j++ ) {
+	    Int_t m = FindIndex(links->At(j));
+	    if ( m < 0 ) {
+		Error("BuildGraph", "Mother %d of MC particle %d is not part of the MC record (run %u, event %llu).",
+		      j, i, fRunNr, fEventNr);
+		continue;
+	    }
+	    mot_m.push_back(m);
+	    mot_d.push_back(i);
+	}
+    }
+    vector<Int_t> mothers, daughters;
+    AddRelations(dau_m, dau_d, mothers, daughters);
+    AddRelations(mot_m, mot_d, mothers, daughters);
+    BuildCSR(mothers, daughters, fChildOffsets, fChildren);
+    mothers.clear();
+    daughters.clear();
+    AddRelations(mot_m, mot_d, mothers, daughters);
+    AddRelations(dau_m, dau_d, mothers, daughters);
+    BuildCSR(daughters, mothers, fParentOffsets, fParents);
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::AddRelations(const vector<Int_t> &from_m,
+				   const vector<Int_t> &from_d,
+				   vector<Int_t> &mothers,
+				   vector<Int_t> &daughters) const {
+    //
+    // Append the relations from_m[k] -> from_d[k] to the given lists,
+    // keeping their order. Out-of-range relations and relations
+    // present already are skipped
+    //
+    set< pair<Int_t,Int_t> > known;
+    for ( UInt_t k = 0; k < mothers.size(); k++ )
+	known.insert(make_pair(mothers[k], daughters[k]));
+    for ( UInt_t k = 0; k < from_m.size(); k++ ) {
+	if ( from_m[k] < 0 || from_m[k] >= fN_MCParticles
+	     || from_d[k] < 0 || from_d[k] >= fN_MCParticles )
+	    continue;
+	if ( !known.insert(make_pair(from_m[k], from_d[k])).second ) continue;
+	mothers.push_back(from_m[k]);
+	daughters.push_back(from_d[k]);
+    }
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::BuildCSR(const vector<Int_t> &from,
+			       const vector<Int_t> &to,
+			       vector<Int_t> &offsets,
+			       vector<Int_t> &entries) {
+    //
+    // Fill CSR arrays for the relations from[k] -> to[k]. The order of
+    // the relations is kept within each row
+    //
+    offsets.assign(fN_MCParticles+1, 0);
+    for ( UInt_t k = 0; k < from.size(); k++ )
+	offsets[from[k]+1]++;
+    for ( Int_t i = 0; i < fN_MCParticles; i++ )
+	offsets[i+1] += offsets[i];
+    entries.resize(from.size());
+    vector<Int_t> pos(offsets.begin(), offsets.end()-1);
+    for ( UInt_t k = 0; k < from.size(); k++ )
+	entries[pos[from[k]]++] = to[k];
+}
+
+//____________________________________________________________________
+
+Int_t AtlMCTruthIndex::FindIndex(const TObject *prt) const {
+    //
+    // Return position of the given particle in the MC record (-1 if
+    // not found)
+    //
+    if ( prt == 0 ) return -1;
+    unordered_map<const TObject*, Int_t>::const_iterator it = fPosition.find(prt);
+    return ( it != fPosition.end() ) ? it->second : -1;
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::AddShortcut(vector<Int_t> &list, Int_t PdgCode) {
+    //
+    // Append indices of all particles of given PDG code to list
+    //
+    Int_t n = 0;
+    const Int_t *idx = GetIndices(PdgCode, n);
+    list.insert(list.end(), idx, idx+n);
+}
+
+//____________________________________________________________________
+
+const Int_t* AtlMCTruthIndex::GetIndices(Int_t PdgCode, Int_t &N) const {
+    //
+    // Return pointer to the (record-ordered) indices of all particles
+    // with the given PDG code. The number of indices is returned in N.
+    // The pointer is valid until the index is rebuilt
+    //
+    N = 0;
+    vector<Int_t>::const_iterator it = lower_bound(fPdgCodes.begin(),
+						    fPdgCodes.end(), PdgCode);
+    if ( it == fPdgCodes.end() || *it != PdgCode ) return 0;
+    Int_t k = it - fPdgCodes.begin();
+    N = fPdgOffsets[k+1] - fPdgOffsets[k];
+    return fPdgEntries.data() + fPdgOffsets[k];
+}
+
+//____________________________________________________________________
+
+Int_t AtlMCTruthIndex::GetN(Int_t PdgCode) const {
+    //
+    // Return no. of particles with the given PDG code
+    //
+    Int_t n = 0;
+    GetIndices(PdgCode, n);
+    return n;
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::GetAncestors(Int_t i, vector<Int_t> &list) const {
+    //
+    // Fill list with the indices of all ancestors of particle i
+    // (breadth-first, ie. nearest ancestors first)
+    //
+    list.clear();
+    TBits visited(fN_MCParticles);
+    visited.SetBitNumber(i);
+    list.push_back(i);
+    for ( UInt_t k = 0; k < list.size(); k++ ) {
+	Int_t n = 0;
+	const Int_t *parents = GetParents(list[k], n);
+	for ( Int_t j = 0; j < n; j++ ) {
+	    if ( visited.TestBitNumber(parents[j]) ) continue;
+	    visited.SetBitNumber(parents[j]);
+	    list.push_back(parents[j]);
+	}
+    }
+    list.erase(list.begin());
+}
+
+//____________________________________________________________________
+
+void AtlMCTruthIndex::GetDescendants(Int_t i, vector<Int_t> &list) const {
+    //
+    // Fill list with the indices of all descendants of particle i
+    // (breadth-first, ie. direct daughters first)
+    //
+    list.clear();
+    TBits visited(fN_MCParticles);
+    visited.SetBitNumber(i);
+    list.push_back(i);
+    for ( UInt_t k = 0; k < list.size(); k++ ) {
+	Int_t n = 0;
+	const Int_t *children = GetChildren(list[k], n);
+	for ( Int_t j = 0; j < n; j++ ) {
+	    if ( visited.TestBitNumber(children[j]) ) continue;
+	    visited.SetBitNumber(children[j]);
+	    list.push_back(children[j]);
+	}
+    }
+    list.erase(list.begin());
+}
+
+//____________________________________________________________________
+
+Int_t AtlMCTruthIndex::GetFirstCopy(Int_t i) const {
+    //
+    // Return index of the first copy of particle i in the decay chain,
+    // ie. follow the mothers as long as one of them has the same PDG
+    // code
+    //
+    for ( Int_t step = 0; step < fN_MCParticles; step++ ) {
+	Int_t n = 0, next = -1;
+	const Int_t *parents = GetParents(i, n);
+	for ( Int_t j = 0; j < n; j++ ) {
+	    if ( fPdg[parents[j]] == fPdg[i] ) {
+		next = parents[j];
+		break;
+	    }
+	}
+	if ( next < 0 ) break;
+	i = next;
+    }
+    return i;
+}
+
+//____________________________________________________________________
+
+Int_t AtlMCTruthIndex::GetLastCopy(Int_t i) const {
+    //
+    // Return index of the last copy of particle i in the decay chain,
+    // ie. follow the daughters as long as one of them has the same PDG
+    // code
+    //
+    for ( Int_t step = 0; step < fN_MCParticles; step++ ) {
+	Int_t n = 0, next = -1;
+	const Int_t *children = GetChildren(i, n);
+	for ( Int_t j = 0; j < n; j++ ) {
+	    if ( fPdg[children[j]] == fPdg[i] ) {
+		next = children[j];
+		break;
+	    }
+	}
+	if ( next < 0 ) break;
+	i = next;
+    }
+    return i;
+}
+
+//____________________________________________________________________
+
+Bool_t AtlMCTruthIndex::IsGoodMother(Int_t i) const {
+    //
+    // True if particle i has a daughter and does not give birth to a
+    // particle of the same kind (cf. HepMCParticle::IsGoodMother())
+    //
+    Int_t n = 0;
+    const Int_t *children = GetChildren(i, n);
+    if ( n == 0 ) return kFALSE;
+    return ( fPdg[children[0]] != fPdg[i] );
+}
@@ -26,6 +26,7 @@ ClassImp(AtlTrigger);
 #endif
 
 AtlTriggerConf *AtlTrigger::fgTriggerConf = 0;
+ULong64_t AtlTrigger::fgN_StringLookups = 0;
 
 //____________________________________________________________________
 
@@ -138,11 +139,17 @@ Int_t AtlTrigger::GetL1TriggerBit(const char *name, Int_t RunNr,
     // to have a very fast event selection based on the given trigger
     // decision.
     //
+    // Every call is counted as string-keyed lookup (see
+    // GetN_StringLookups()). Tools inquiring several items per event
+    // should resolve the bits once per run with FindL1Bit() and use
+    // HasPassedL1(Int_t) instead.
+    //
     // In case no trigger configuration had been loaded yet, try to
     // get it from the current directory
     //
 
     // Check cache
+    fgN_StringLookups++;
     if ( UseCache == kTRUE && strcmp(name, fL1NameCache) == 0 )
 	return fL1BitCache;
 
@@ -170,6 +177,11 @@ Int_t AtlTrigger::GetHLTTriggerBit(const char *name, Int_t RunNr,
     // AtlEvent::HasPassedHLT() to have a very fast event selection
     // based on the given trigger decision.
     //
+    // Every call is counted as string-keyed lookup (see
+    // GetN_StringLookups()). Tools inquiring several items per event
+    // should resolve the bits once per run with FindHLTBit() and use
+    // HasPassedHLT(Int_t) instead.
+    //
     // In case no trigger configuration had been loaded yet, try to
     // get it from the current directory
     //
@@ -177,6 +189,7 @@ Int_t AtlTrigger::GetHLTTriggerBit(const char *name, Int_t RunNr,
     //
     
     // Check cache
+    fgN_StringLookups++;
     if ( UseCache == kTRUE && strcmp(name, fHLTNameCache) == 0 )
 	return fHLTBitCache;
 
@@ -70,6 +70,8 @@ class AtlD0Finder : public AtlKinFitterTool {
 
     // combinatorial background (same charged particles)
     TList *fBkgLambdaDecays;           // List of combinatorial bkg.
+    TKinFitter *fFitterKPi;            // Re-used fitter for the K pi hypothesis
+    TKinFitter *fFitterPiK;            // Re-used fitter for the pi K hypothesis
 
     // Lambda -> pipi(Bkg)
     TH1F *fHistLambdareco_m_PPi_bkg;       // Reconstructed invariant mass of the Lambda decaying into proton+pion
@@ -206,8 +208,9 @@ public:
     Float_t              fD0_Pi_min;                  // Minimum D0 (track parameter) of Pion
     Float_t              fZDiff_max;
 
-    TKinFitter PerformFit(AtlIDTrack *trk1, AtlIDTrack *trk2, TLorentzVector &FitP_trk1, TLorentzVector &FitP_trk2,
-              TMatrixD *cov_trk1, TMatrixD *cov_trk2);
+    TKinFitter* PerformFit(TKinFitter *fitter, AtlIDTrack *trk1, AtlIDTrack *trk2,
+			   TLorentzVector &FitP_trk1, TLorentzVector &FitP_trk2,
+			   TMatrixD *cov_trk1, TMatrixD *cov_trk2);
     Int_t DoTruthMatch(AtlIDTrack *trk1, AtlIDTrack *trk2, HepVertex *Vtx);
     void FillMCHistograms(AtlD0DecayKPi *decay, Bool_t signal);
     Bool_t IsConversion(AtlIDTrack *trk1, AtlIDTrack *trk2);
@@ -178,6 +178,7 @@ class AtlK0sFinder : public AtlKinFitterTool {
   Float_t  fK0s_M_min;                   // Lower boundary for allowed Z mass range
   Float_t  fK0s_M_max;                  // Upper boundary for allowed Z mass range
   Float_t  fm_pi;                       // Pion mass hypothesis
+  Float_t  fm_K0s;                      // K0s mass hypothesis (mass constraint and pre-fit window)
 
   Float_t  fVertexChi2ovNDoF_max;       // Quality of Vertex fit
   Float_t  fTrackChi2ovNDoF_max;        // Quality of Track fit
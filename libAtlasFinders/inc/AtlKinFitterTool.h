@@ -71,6 +71,9 @@
 #ifndef ROOT_TH1I
 #include <TH1I.h>
 #endif
+#ifndef ATLAS_AtlV0Candidates
+#include <AtlV0Candidates.h>
+#endif
 
 class TFile;
 class TH1F;
@@ -201,6 +204,10 @@ class AtlKinFitterTool : public AtlAnalysisTool {
     Double_t fB_Mass;     // Assumed mass of b-jet = mass of b-quark
     Double_t fTop_Mass;   // Pole mass of the t-quark used in the fit
     Double_t fTop_Width;  // Width of the t-quark used in the fit
+
+    // V0 finders
+    Double_t fV0PreFitMassWindow; // Max. distance (GeV) of the two-prong mass from the nominal mass
+                                  // before running the kinematic fit (<= 0: no pre-selection)
     
   public:
     AtlKinFitterTool(const char* name, const char* title);
@@ -221,6 +228,7 @@ class AtlKinFitterTool : public AtlAnalysisTool {
     void LoadCovMatrices();
     void GuessTopDecayNeutrinoEtaE(Double_t& EtaStart, Double_t& EStart, TVector2 Et_Miss,
 				   HepParticle *Lepton, AtlJet *BJet);
+    AtlV0Candidates* GetV0Candidates() const;
     
     inline Float_t GetChi2() const { return fChi2; }
     inline Int_t GetNDoF() const { return fNDoF; }
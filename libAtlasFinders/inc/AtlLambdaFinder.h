@@ -74,6 +74,8 @@ class AtlLambdaFinder : public AtlKinFitterTool {
 
     // combinatorial background (same charged particles)
     TList *fBkgLambdaDecays;           // List of combinatorial bkg.
+    TKinFitter *fFitterPPi;            // Re-used fitter for the p pi hypothesis
+    TKinFitter *fFitterPiP;            // Re-used fitter for the pi p hypothesis
 
     // Lambda -> pipi(Bkg)
     TH1F *fHistLambdareco_m_PPi_bkg;       // Reconstructed invariant mass of the Lambda decaying into proton+pion
@@ -214,8 +216,9 @@ public:
     Float_t              fGamma_dang_low;             // First boundary (-1.0-...) for cos(photo conversion decay angle)
     Float_t              fGamma_dang_high;            // Second boundary (...-1.0) for cos(photo conversion decay angle)
 
-    TKinFitter PerformFit(AtlIDTrack *trk1, AtlIDTrack *trk2, TLorentzVector &FitP_trk1, TLorentzVector &FitP_trk2,
-              TMatrixD *cov_trk1, TMatrixD *cov_trk2);
+    TKinFitter* PerformFit(TKinFitter *fitter, AtlIDTrack *trk1, AtlIDTrack *trk2,
+			   TLorentzVector &FitP_trk1, TLorentzVector &FitP_trk2,
+			   TMatrixD *cov_trk1, TMatrixD *cov_trk2);
     Int_t DoTruthMatch(AtlIDTrack *trk1, AtlIDTrack *trk2, HepVertex *Vtx);
     void FillMCHistograms(AtlLambdaDecayPPi *decay, Bool_t signal);
     Bool_t IsConversionVertex(HepVertex *vtx);
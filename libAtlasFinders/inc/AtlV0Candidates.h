@@ -0,0 +1,76 @@
+#ifndef ATLAS_AtlV0Candidates
+#define ATLAS_AtlV0Candidates
+#ifndef ROOT_TLorentzVector
+#include <TLorentzVector.h>
+#endif
+#include <vector>
+
+class AtlEvent;
+class AtlIDTrack;
+class HepVertex;
+
+class AtlV0Candidates {
+
+  public:
+    enum EHypothesis {
+	kPiPi = 0, // K0s -> pi+pi-
+	kPPi,      // Lambda -> p pi, track 1 = proton
+	kPiP,      // Lambda -> p pi, track 2 = proton
+	kKK,       // phi -> K+K-
+	kKPi,      // K*, D0 -> K pi, track 1 = kaon
+	kPiK,      // K*, D0 -> K pi, track 2 = kaon
+	kEE,       // gamma -> e+e-
+	kNHypotheses
+    };
+    enum EFlags {
+	kSecondary      = BIT(0), // Vertex is a secondary vertex
+	kOppositeCharge = BIT(1)  // Daughter tracks have opposite charge
+    };
+
+  private:
+    AtlEvent *fEvent;      // Event the candidates have been built for
+    Long64_t  fEntry;      // Tree entry of this event (-1 if unknown)
+    UInt_t    fRunNr;      // Run number of this event
+    ULong64_t fEventNr;    // Event number of this event
+    std::vector<HepVertex*>  fVtx;  // Vertex of each candidate
+    std::vector<AtlIDTrack*> fTrk1; // First daughter track of each candidate
+    std::vector<AtlIDTrack*> fTrk2; // Second daughter track of each candidate
+    std::vector<UChar_t>  fFlags;   // Candidate flags (see EFlags)
+    std::vector<Double_t> fP1Sq;    // |p1|^2 of each candidate
+    std::vector<Double_t> fP2Sq;    // |p2|^2 of each candidate
+    std::vector<Double_t> fP1P2;    // p1*p2 of each candidate
+    std::vector<Double_t> fMass;    // Invariant masses, kNHypotheses per candidate
+    std::vector<Int_t>    fVtxIndex; // Candidate index of each vertex of the event (-1 = none)
+
+    static const Double_t fgMass[kNHypotheses][2]; // Daughter masses of all hypotheses
+
+  public:
+    AtlV0Candidates();
+    virtual ~AtlV0Candidates();
+    void Build(AtlEvent *evt, Long64_t Entry = -1);
+    Int_t Find(HepVertex *Vtx) const;
+    Double_t GetMass(Int_t i, Double_t m1, Double_t m2) const;
+    TLorentzVector GetP(Int_t i, Double_t m1, Double_t m2) const;
+    static AtlV0Candidates* Get(AtlEvent *evt, Long64_t Entry = -1);
+    static const char* GetHypothesisName(EHypothesis hyp);
+
+    inline Int_t GetN() const { return fVtx.size(); }
+    inline HepVertex* GetVtx(Int_t i) const { return fVtx[i]; }
+    inline AtlIDTrack* GetTrack1(Int_t i) const { return fTrk1[i]; }
+    inline AtlIDTrack* GetTrack2(Int_t i) const { return fTrk2[i]; }
+    inline Bool_t IsSecondary(Int_t i) const { return fFlags[i] & kSecondary; }
+    inline Bool_t IsOppositeCharge(Int_t i) const { return fFlags[i] & kOppositeCharge; }
+    inline Double_t GetMass(Int_t i, EHypothesis hyp) const
+    { return fMass[i*kNHypotheses + hyp]; }
+    inline Bool_t IsInMassWindow(Int_t i, EHypothesis hyp,
+				 Double_t Mmin, Double_t Mmax) const {
+	Double_t m = GetMass(i, hyp);
+	return ( m >= Mmin ) && ( m < Mmax );
+    }
+    inline static Double_t GetDaughterMass(EHypothesis hyp, Int_t daughter)
+    { return fgMass[hyp][daughter]; }
+
+    ClassDef(AtlV0Candidates,0) // Shared two-prong vertex candidates of the V0 finders
+};
+#endif
+
@@ -501,15 +501,15 @@ void AtlConvFinder::ReconstructConvCutBased(){
     // Storing Prim. Vtx
     PrimVtx = fEvent->GetPrimaryVtx();
     
-    // Vertex Loop
-    for(Int_t i = 0; i < fEvent->GetN_Vertices(); i++){
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for(Int_t i = 0; i < v0->GetN(); i++){
 
 	// Get Vtx and associated Daughters
-	Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
-	if(Vtx->GetNDaughters() != 2) continue;
+	Vtx = v0->GetVtx(i);
 	SetCutFlow("Sec Vtx with 2 Daughters");
-	trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-	trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+	trk1 = v0->GetTrack1(i);
+	trk2 = v0->GetTrack2(i);
 		
 	// Cut on R_Vtx
 	if ( Vtx->GetPos().Perp() < fR_Vtx_min ) continue;
@@ -640,11 +640,11 @@ void AtlConvFinder::ReconstructConvKinFit(){
     //storing primary Vtx
     PrimVtx = fEvent->GetPrimaryVtx();
     
-    // Vertex-Loop
-    for ( Int_t i = 0; i < fEvent->GetN_Vertices(); i++){
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for ( Int_t i = 0; i < v0->GetN(); i++){
 	
-	Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
-	if ( !(Vtx->GetNDaughters() == 2) ) continue;
+	Vtx = v0->GetVtx(i);
 	SetCutFlow("Sec. Vtx with 2 Dght.");
 
 	// Cut on R_Vtx
@@ -657,8 +657,8 @@ void AtlConvFinder::ReconstructConvKinFit(){
 	SetCutFlow("Decay Len.");
 
 	// Get Momenta of Daughter Tracks
-	trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-	trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+	trk1 = v0->GetTrack1(i);
+	trk2 = v0->GetTrack2(i);
 	// Momenta of outgoing pion tracks
 	if ( (trk1->Pt() > fSignale_Pt_max) ||
 	     (trk1->Pt() < fSignale_Pt_min) ) continue;
@@ -680,6 +680,11 @@ void AtlConvFinder::ReconstructConvKinFit(){
 	}
 	SetCutFlow("MC exists");
 
+	// Loose mass window before the kinematic fit (optional)
+	if ( fV0PreFitMassWindow > 0.
+	     && TMath::Abs(v0->GetMass(i, fm_e, fm_e) - fm_PolMass) > fV0PreFitMassWindow )
+	    continue;
+
 	// covariance matrices, taken from track fit
 	trk1->GetCovMatrixPtEtaPhi(cov_trk1);
 	trk2->GetCovMatrixPtEtaPhi(cov_trk2);
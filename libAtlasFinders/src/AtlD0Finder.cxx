@@ -37,6 +37,8 @@ AtlD0Finder::AtlD0Finder(const char* name, const char* title) :
     SetMode(kKinFit);
     SetDebugOutput(kFALSE);
     fBkgLambdaDecays = new TList;
+    fFitterKPi = new TKinFitter;
+    fFitterPiK = new TKinFitter;
 }
 
 //____________________________________________________________________
@@ -46,6 +48,8 @@ AtlD0Finder::~AtlD0Finder() {
     // Default destructor
     //
     fBkgLambdaDecays->Delete(); delete fBkgLambdaDecays;
+    delete fFitterKPi;
+    delete fFitterPiK;
     if (IsDebugRun() ) fDebugStream.close();
 }
 
@@ -584,17 +588,18 @@ void AtlD0Finder::ReconstructLambdaCutBased(){
 
     PrimaryVtx = fEvent->GetPrimaryVtx();
 
-    // Vertex-Loop
-    for (i = 0; i < fEvent->GetN_Vertices(); i++) {
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for (i = 0; i < v0->GetN(); i++) {
 
-      Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
+      Vtx = v0->GetVtx(i);
       // regard only high-quality secondary vertices containing 2 outgoing tracks
-      if ( !( (Vtx->IsSecondary()) && (Vtx->GetNDaughters()==2) ))  continue;
+      if ( !v0->IsSecondary(i) )  continue;
       if ( Vtx->GetChi2overNDoF() > fVertexChi2ovNDoF_max )  continue;
 
       // get outgoing tracks and test their quality
-      trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-      trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+      trk1 = v0->GetTrack1(i);
+      trk2 = v0->GetTrack2(i);
       if ( trk1->GetChi2_Vtx() / trk1->GetNDoF_Vtx() > fTrackChi2ovNDoF_max ) continue;
       if ( trk2->GetChi2_Vtx() / trk2->GetNDoF_Vtx() > fTrackChi2ovNDoF_max ) continue;
 
@@ -818,20 +823,20 @@ void AtlD0Finder::ReconstructLambdaKinFit() {
 	// Define momentum used as output of the fit
 	TLorentzVector FitP_trk1k;
 	TLorentzVector FitP_trk2pi;
-	TKinFitter fitterKPi = PerformFit(trk1, trk2, FitP_trk1k, FitP_trk2pi, &cov_trk1, &cov_trk2);
+	TKinFitter *fitterKPi = PerformFit(fFitterKPi, trk1, trk2, FitP_trk1k, FitP_trk2pi, &cov_trk1, &cov_trk2);
 	
 	TLorentzVector FitP_trk1pi;
 	TLorentzVector FitP_trk2k;
-	TKinFitter fitterPiK = PerformFit(trk2, trk1, FitP_trk1pi, FitP_trk2k, &cov_trk2, &cov_trk1);
+	TKinFitter *fitterPiK = PerformFit(fFitterPiK, trk2, trk1, FitP_trk1pi, FitP_trk2k, &cov_trk2, &cov_trk1);
           
 	// abort, if a fit failed severely (chi2 < 0)
-	if ( (fitterKPi.getS() < 0.) || (fitterPiK.getS() < 0.) ) {
+	if ( (fitterKPi->getS() < 0.) || (fitterPiK->getS() < 0.) ) {
 	    Error("ReconstructLambdaKinFit", "fitter.getS()<0. Abort!");
 	    gSystem->Abort(0);
 	}
 	// skip event, if neither fit converged
-	Bool_t convKPi = (fitterKPi.getStatus() == 0);
-	Bool_t convPiK = (fitterPiK.getStatus() == 0);
+	Bool_t convKPi = (fitterKPi->getStatus() == 0);
+	Bool_t convPiK = (fitterPiK->getStatus() == 0);
 	if ( (!convKPi) && (!convPiK) ) continue;
 	SetCutFlow("#geq 1 Fit ok");
 	fN_Fits++;
@@ -839,14 +844,14 @@ void AtlD0Finder::ReconstructLambdaKinFit() {
 	// Reconstruct Lambda 4-momentum
 	// and set Chi2 and NDoF from the converged fit.
 	// If both fits converged, prefer the lower chi2/ndof.
-	Float_t Chi2overNDoF_KPi = fitterKPi.getS()/fitterKPi.getNDF();
-	Float_t Chi2overNDoF_PiK = fitterPiK.getS()/fitterPiK.getNDF();
+	Float_t Chi2overNDoF_KPi = fitterKPi->getS()/fitterKPi->getNDF();
+	Float_t Chi2overNDoF_PiK = fitterPiK->getS()/fitterPiK->getNDF();
 	HepParticle Fit_Daughter1; // save momenta from the better fit
 	HepParticle Fit_Daughter2; // is filled in the following if-condition
 	if ( convKPi && ( (!convPiK) || ( Chi2overNDoF_KPi <= Chi2overNDoF_PiK ) ) ) {
 	    p_D0 = FitP_trk1k + FitP_trk2pi;
-	    fChi2 = fitterKPi.getS();
-	    fNDoF = fitterKPi.getNDF();
+	    fChi2 = fitterKPi->getS();
+	    fNDoF = fitterKPi->getNDF();
 	    HepParticle FitDaughter1(1, FitP_trk1k.Px(), FitP_trk1k.Py(), FitP_trk1k.Pz(), 
 				     FitP_trk1k.E(),  (trk1->GetQovP() < 0.) ? -321 : 321);
 	    HepParticle FitDaughter2(2, FitP_trk2pi.Px(), FitP_trk2pi.Py(), FitP_trk2pi.Pz(), 
@@ -855,8 +860,8 @@ void AtlD0Finder::ReconstructLambdaKinFit() {
 	    Fit_Daughter2 = FitDaughter2;
 	} else {
 	    p_D0 = FitP_trk1pi + FitP_trk2k;
-	    fChi2 = fitterPiK.getS();
-	    fNDoF = fitterPiK.getNDF();
+	    fChi2 = fitterPiK->getS();
+	    fNDoF = fitterPiK->getNDF();
 	    HepParticle FitDaughter1(1, FitP_trk1pi.Px(), FitP_trk1pi.Py(), FitP_trk1pi.Pz(), 
 				     FitP_trk1pi.E(), (trk1->GetQovP() < 0.) ? -211 : 211);
 	    HepParticle FitDaughter2(2, FitP_trk2k.Px(), FitP_trk2k.Py(), FitP_trk2k.Pz(), 
@@ -959,41 +964,53 @@ void AtlD0Finder::FindSharedTracks() {
 
 //____________________________________________________________________    
 
-TKinFitter AtlD0Finder::PerformFit(AtlIDTrack *trk1, AtlIDTrack *trk2, TLorentzVector& FitP_trk1, TLorentzVector& FitP_trk2,
+TKinFitter* AtlD0Finder::PerformFit(TKinFitter *fitter, AtlIDTrack *trk1, AtlIDTrack *trk2,
+				   TLorentzVector& FitP_trk1, TLorentzVector& FitP_trk2,
 				   TMatrixD *cov_trk1, TMatrixD *cov_trk2) {
   //
   // Perform a kinematic fit with the given tracks to test the lambda mass hyptothesis
   // assuming that track1 is the proton and track2 is the pion.
   //
+  // The fit particles and the mass constraint are created with the
+  // first fit and are re-used (re-targeted to the given tracks) by all
+  // subsequent fits of the same fitter.
+  //
+
+  // Define particles necessary for execution of the fit on first use.
+  // The fitter owns (and deletes) them
+  if ( !fitter->hasTopology() ) {
+      TFitParticlePtEtaPhi *FitExec_trk1 = new TFitParticlePtEtaPhi("FitExec_trk1", "FitExec_trk1 for D0Fit", 0, fm_kaon, 0);
+      TFitParticlePtEtaPhi *FitExec_trk2 = new TFitParticlePtEtaPhi("FitExec_trk2", "FitExec_trk2 for D0Fit", 0, fm_pi, 0);
+      TFitConstraintM *MD0Cons = new TFitConstraintM("D0MassConstraint","D0MassConstraintGaus", 0, 0, fm_D0);
+      MD0Cons->addParticles1(FitExec_trk1, FitExec_trk2);
+      fitter->setOwner();
+      fitter->addMeasParticle(FitExec_trk1);
+      fitter->addMeasParticle(FitExec_trk2);
+      fitter->addConstraint(MD0Cons);
+      
+      fitter->setMaxNbIter(50);   // maximum number of iterations
+      fitter->setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
+      fitter->setMaxF(1e-4);      // maximum value of constraints
+      fitter->setVerbosity(0);    // verbosity level
+  }
 
-  // Define particles necessary for execution of the fit
-  // Using proton/pion mass hypothesis; fit variables are pt, eta, phi
+  // Re-target the particles to the given tracks
+  // Using kaon/pion mass hypothesis; fit variables are pt, eta, phi
+  TFitParticlePtEtaPhi *FitExec_trk1 = (TFitParticlePtEtaPhi*)fitter->getParticle(0);
+  TFitParticlePtEtaPhi *FitExec_trk2 = (TFitParticlePtEtaPhi*)fitter->getParticle(1);
   TVector3 dummy1 = trk1->P(); // instead of const cast
-  TFitParticlePtEtaPhi FitExec_trk1("FitExec_trk1", "FitExec_trk1 for D0Fit", &dummy1, fm_kaon, cov_trk1);
+  FitExec_trk1->setIni4Vec(&dummy1, fm_kaon);
+  FitExec_trk1->setCovMatrix(cov_trk1);
   TVector3 dummy2 = trk2->P(); // instead of const cast
-  TFitParticlePtEtaPhi FitExec_trk2("FitExec_trk2", "FitExec_trk2 for D0Fit", &dummy2, fm_pi, cov_trk2);
-  
-  // Definition of Lambda mass constraint
-  TFitConstraintM MD0Cons("D0MassConstraint","D0MassConstraintGaus", 0, 0, fm_D0);
-  MD0Cons.addParticles1(&FitExec_trk1, &FitExec_trk2);
-    
-  // fitting characteristics
-  TKinFitter fitter;
-  fitter.addMeasParticle(&FitExec_trk1);
-  fitter.addMeasParticle(&FitExec_trk2);
-  fitter.addConstraint(&MD0Cons);
-    
-  fitter.setMaxNbIter(50);   // maximum number of iterations
-  fitter.setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
-  fitter.setMaxF(1e-4);      // maximum value of constraints
-  fitter.setVerbosity(0);    // verbosity level
+  FitExec_trk2->setIni4Vec(&dummy2, fm_pi);
+  FitExec_trk2->setCovMatrix(cov_trk2);
     
   // Kinematic Fitting
-  fitter.fit();
+  fitter->fit();
 
   // Copy fitted 4-vectors (circumvent const cast)
-  FitP_trk1 = *FitExec_trk1.getCurr4Vec();
-  FitP_trk2 = *FitExec_trk2.getCurr4Vec();
+  FitP_trk1 = *FitExec_trk1->getCurr4Vec();
+  FitP_trk2 = *FitExec_trk2->getCurr4Vec();
 
   return fitter;
 }
@@ -38,6 +38,8 @@ AtlK0StarFinder::AtlK0StarFinder(const char* name, const char* title) :
     SetMode(kKinFit);
     SetDebugOutput(kFALSE);
     fBkgLambdaDecays = new TList;
+    fFitterPPi = new TKinFitter;
+    fFitterPiP = new TKinFitter;
 }
 
 //____________________________________________________________________
@@ -47,6 +49,8 @@ AtlK0StarFinder::~AtlK0StarFinder() {
     // Default destructor
     //
     fBkgLambdaDecays->Delete(); delete fBkgLambdaDecays;
+    delete fFitterPPi;
+    delete fFitterPiP;
     if (IsDebugRun() ) fDebugStream.close();
 }
 
@@ -421,11 +425,11 @@ Bool_t AtlK0StarFinder::AnalyzeEvent() {
     if (fEvent->IsMC()) {
 	// Count all k0star decays in MC events to allow computation of the efficiency.
 	Int_t NKStarTrue = 0;
-	for (Int_t i = 0; i < fEvent->GetN_Vertices(); i++) {
-	    HepVertex *vtx = (HepVertex*)fEvent->GetVertices()->At(i);
-	    if ( !( (vtx->IsSecondary()) && (vtx->GetNDaughters()==2) ))  continue;
-	    AtlIDTrack *trk1 = (AtlIDTrack*)vtx->GetDaughters()->At(0);
-	    AtlIDTrack *trk2 = (AtlIDTrack*)vtx->GetDaughters()->At(1);
+	AtlV0Candidates *v0 = GetV0Candidates();
+	for (Int_t i = 0; i < v0->GetN(); i++) {
+	    if ( !v0->IsSecondary(i) )  continue;
+	    AtlIDTrack *trk1 = v0->GetTrack1(i);
+	    AtlIDTrack *trk2 = v0->GetTrack2(i);
 	    if(  trk1->HasValidTruthMatch(fMatchingProb_min)
 		 && trk2->HasValidTruthMatch(fMatchingProb_min) ) {
 		if( (trk1->GetMCParticle()->GetMother() == NULL) || (trk2->GetMCParticle()->GetMother() == NULL) ) {
@@ -475,17 +479,18 @@ void AtlK0StarFinder::ReconstructLambdaCutBased(){
 
     PrimaryVtx = fEvent->GetPrimaryVtx();
 
-    // Vertex-Loop
-    for (i = 0; i < fEvent->GetN_Vertices(); i++) {
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for (i = 0; i < v0->GetN(); i++) {
 
-      Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
+      Vtx = v0->GetVtx(i);
       // regard only high-quality secondary vertices containing 2 outgoing tracks
-      if ( !( (Vtx->IsSecondary()) && (Vtx->GetNDaughters()==2) ))  continue;
+      if ( !v0->IsSecondary(i) )  continue;
       if ( Vtx->GetChi2overNDoF() > fVertexChi2ovNDoF_max )  continue;
 
       // get outgoing tracks and test their quality
-      trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-      trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+      trk1 = v0->GetTrack1(i);
+      trk2 = v0->GetTrack2(i);
       if ( trk1->GetChi2_Vtx() / trk1->GetNDoF_Vtx() > fTrackChi2ovNDoF_max ) continue;
       if ( trk2->GetChi2_Vtx() / trk2->GetNDoF_Vtx() > fTrackChi2ovNDoF_max ) continue;
 
@@ -553,11 +558,18 @@ Bool_t AtlK0StarFinder::IsKaonVertex(HepVertex *vtx) {
 	if (((AtlK0sDecayPiPi*)k0s->At(i))->GetVtx() == vtx)
 	    return kTRUE;
     }
-    TLorentzVector p1, p2, p;
-    p1.SetVectM(((AtlIDTrack*)vtx->GetDaughters()->At(0))->P(), fm_pi);
-    p2.SetVectM(((AtlIDTrack*)vtx->GetDaughters()->At(1))->P(), fm_pi);
-    p = p1 + p2;
-    if ((p.M() < 0.45) || ((p.M() > 0.492) && (p.M() < 0.503)))
+    AtlV0Candidates *v0 = GetV0Candidates();
+    Int_t cand = v0->Find(vtx);
+    Double_t m = 0.;
+    if ( cand >= 0 ) {
+	m = v0->GetMass(cand, fm_pi, fm_pi);
+    } else {
+	TLorentzVector p1, p2;
+	p1.SetVectM(((AtlIDTrack*)vtx->GetDaughters()->At(0))->P(), fm_pi);
+	p2.SetVectM(((AtlIDTrack*)vtx->GetDaughters()->At(1))->P(), fm_pi);
+	m = (p1 + p2).M();
+    }
+    if ((m < 0.45) || ((m > 0.492) && (m < 0.503)))
 	return kTRUE;
     return kFALSE;
 }
@@ -592,6 +604,10 @@ Bool_t AtlK0StarFinder::IsConversionVertex(HepVertex *vtx) {
     // there are no conversion vertices.
     //
    
+    AtlV0Candidates *v0 = GetV0Candidates();
+    Int_t cand = v0->Find(vtx);
+    if ( cand >= 0 ) return (v0->GetMass(cand, fm_e, fm_e) < fPhotonMass_max);
+
     AtlIDTrack *trk1 = (AtlIDTrack*)vtx->GetDaughters()->At(0);
     AtlIDTrack *trk2 = (AtlIDTrack*)vtx->GetDaughters()->At(1);
     TLorentzVector p_e1, p_e2, p_g;
@@ -627,20 +643,21 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
   // Get primary vertex
   PrimVtx = fEvent->GetPrimaryVtx();
 
-  // Vertex-Loop
-  for ( Int_t i = 0; i < fEvent->GetN_Vertices(); i++){
+  // Loop over all two-prong vertices
+  AtlV0Candidates *v0 = GetV0Candidates();
+  for ( Int_t i = 0; i < v0->GetN(); i++){
     
-    Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
+    Vtx = v0->GetVtx(i);
 
     // Analyse only secondary vertices containing 2 outgoing tracks
-    if ( !( (Vtx->IsSecondary()) && (Vtx->GetNDaughters() == 2) )) continue;
+    if ( !v0->IsSecondary(i) ) continue;
     SetCutFlow("Sec. Vtx w/ 2 Dght.");
     // cut vertex fit's chi2/ndof
     if ( Vtx->GetChi2overNDoF() > fVertexChi2ovNDoF_max ) continue;
     SetCutFlow("Vtx #chi^{2}");
 
-    trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-    trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+    trk1 = v0->GetTrack1(i);
+    trk2 = v0->GetTrack2(i);
     // cut track fit's chi2/ndof
     if (  (trk1->Chi2ovNDoF() > fTrackChi2ovNDoF_max) ||
 	 (trk2->Chi2ovNDoF() > fTrackChi2ovNDoF_max) ) continue;
@@ -668,6 +685,13 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
 	Double_t p = p1*p2;
 	fHistK0Starreco_m_kaon_pi->Fill(p, GetPreTagEvtWeight());
     }
+
+    // Loose mass window for both kaon assignments before the
+    // kinematic fit (optional)
+    if ( fV0PreFitMassWindow > 0.
+	 && TMath::Abs(v0->GetMass(i, fm_proton, fm_pi) - fm_lambda) > fV0PreFitMassWindow
+	 && TMath::Abs(v0->GetMass(i, fm_pi, fm_proton) - fm_lambda) > fV0PreFitMassWindow )
+	continue;
     
     // Definition of covariance matrices, taken from track fit
     trk1->GetCovMatrixPtEtaPhi(cov_trk1);
@@ -676,20 +700,20 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
     // Define momentum used as output of the fit
     TLorentzVector FitP_trk1pr;
     TLorentzVector FitP_trk2pi;
-    TKinFitter fitterPPi = PerformFit(trk1, trk2, FitP_trk1pr, FitP_trk2pi, &cov_trk1, &cov_trk2);
+    TKinFitter *fitterPPi = PerformFit(fFitterPPi, trk1, trk2, FitP_trk1pr, FitP_trk2pi, &cov_trk1, &cov_trk2);
 
     TLorentzVector FitP_trk1pi;
     TLorentzVector FitP_trk2pr;
-    TKinFitter fitterPiP = PerformFit(trk2, trk1, FitP_trk1pi, FitP_trk2pr, &cov_trk2, &cov_trk1);
+    TKinFitter *fitterPiP = PerformFit(fFitterPiP, trk2, trk1, FitP_trk1pi, FitP_trk2pr, &cov_trk2, &cov_trk1);
           
     // abort, if a fit failed severely (chi2 < 0)
-    if ( (fitterPPi.getS() < 0.) || (fitterPiP.getS() < 0.) ) {
+    if ( (fitterPPi->getS() < 0.) || (fitterPiP->getS() < 0.) ) {
       Error("ReconstructLambdaKinFit", "fitter.getS()<0. Abort!");
       continue;
     }
     // skip event, if neither fit converged
-    Bool_t convPPi = (fitterPPi.getStatus() == 0);
-    Bool_t convPiP = (fitterPiP.getStatus() == 0);
+    Bool_t convPPi = (fitterPPi->getStatus() == 0);
+    Bool_t convPiP = (fitterPiP->getStatus() == 0);
     if ( (!convPPi) && (!convPiP) ) continue;
     SetCutFlow("#geq 1 Fit ok");
     fN_Fits++;
@@ -697,14 +721,14 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
     // Reconstruct Lambda 4-momentum
     // and set Chi2 and NDoF from the converged fit.
     // If both fits converged, prefer the lower chi2/ndof.
-    Float_t Chi2overNDoF_PPi = fitterPPi.getS()/fitterPPi.getNDF();
-    Float_t Chi2overNDoF_PiP = fitterPiP.getS()/fitterPiP.getNDF();
+    Float_t Chi2overNDoF_PPi = fitterPPi->getS()/fitterPPi->getNDF();
+    Float_t Chi2overNDoF_PiP = fitterPiP->getS()/fitterPiP->getNDF();
     HepParticle Fit_Daughter1; // save momenta from the better fit
     HepParticle Fit_Daughter2; // is filled in the following if-condition
     if ( convPPi && ( (!convPiP) || ( Chi2overNDoF_PPi <= Chi2overNDoF_PiP ) ) ) {
       p_Lambda = FitP_trk1pr + FitP_trk2pi;
-      fChi2 = fitterPPi.getS();
-      fNDoF = fitterPPi.getNDF();
+      fChi2 = fitterPPi->getS();
+      fNDoF = fitterPPi->getNDF();
       HepParticle FitDaughter1(1, FitP_trk1pr.Px(), FitP_trk1pr.Py(), FitP_trk1pr.Pz(), 
 			       FitP_trk1pr.E(), (trk1->GetQovP() < 0.) ? -2212 : 2212);
       HepParticle FitDaughter2(2, FitP_trk2pi.Px(), FitP_trk2pi.Py(), FitP_trk2pi.Pz(), 
@@ -713,8 +737,8 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
       Fit_Daughter2 = FitDaughter2;
     } else {
       p_Lambda = FitP_trk1pi + FitP_trk2pr;
-      fChi2 = fitterPiP.getS();
-      fNDoF = fitterPiP.getNDF();
+      fChi2 = fitterPiP->getS();
+      fNDoF = fitterPiP->getNDF();
       HepParticle FitDaughter1(1,FitP_trk1pi.Px(), FitP_trk1pi.Py(), FitP_trk1pi.Pz(), 
 			       FitP_trk1pi.E(), (trk1->GetQovP() < 0.) ?  -211 :  211);
       HepParticle FitDaughter2(2, FitP_trk2pr.Px(), FitP_trk2pr.Py(), FitP_trk2pr.Pz(), 
@@ -815,41 +839,53 @@ void AtlK0StarFinder::ReconstructLambdaKinFit() {
 
 //____________________________________________________________________    
 
-TKinFitter AtlK0StarFinder::PerformFit(AtlIDTrack *trk1, AtlIDTrack *trk2, TLorentzVector& FitP_trk1, TLorentzVector& FitP_trk2,
-				       TMatrixD *cov_trk1, TMatrixD *cov_trk2) {
+TKinFitter* AtlK0StarFinder::PerformFit(TKinFitter *fitter, AtlIDTrack *trk1, AtlIDTrack *trk2,
+				   TLorentzVector& FitP_trk1, TLorentzVector& FitP_trk2,
+				   TMatrixD *cov_trk1, TMatrixD *cov_trk2) {
   //
   // Perform a kinematic fit with the given tracks to test the lambda mass hyptothesis
   // assuming that track1 is the proton and track2 is the pion.
   //
+  // The fit particles and the mass constraint are created with the
+  // first fit and are re-used (re-targeted to the given tracks) by all
+  // subsequent fits of the same fitter.
+  //
 
-  // Define particles necessary for execution of the fit
+  // Define particles necessary for execution of the fit on first use.
+  // The fitter owns (and deletes) them
+  if ( !fitter->hasTopology() ) {
+      TFitParticlePtEtaPhi *FitExec_trk1 = new TFitParticlePtEtaPhi("FitExec_trk1", "FitExec_trk1 for LambdaFit", 0, fm_proton, 0);
+      TFitParticlePtEtaPhi *FitExec_trk2 = new TFitParticlePtEtaPhi("FitExec_trk2", "FitExec_trk2 for LambdaFit", 0, fm_pi, 0);
+      TFitConstraintMBW *MLambdaCons = new TFitConstraintMBW("LambdaMassConstraint","LambdaMassConstraintGaus", 0, fm_lambda, 0.0462);
+      MLambdaCons->addParticles1(FitExec_trk1, FitExec_trk2);
+      fitter->setOwner();
+      fitter->addMeasParticle(FitExec_trk1);
+      fitter->addMeasParticle(FitExec_trk2);
+      fitter->addConstraint(MLambdaCons);
+      
+      fitter->setMaxNbIter(50);   // maximum number of iterations
+      fitter->setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
+      fitter->setMaxF(1e-4);      // maximum value of constraints
+      fitter->setVerbosity(0);    // verbosity level
+  }
+
+  // Re-target the particles to the given tracks
   // Using proton/pion mass hypothesis; fit variables are pt, eta, phi
+  TFitParticlePtEtaPhi *FitExec_trk1 = (TFitParticlePtEtaPhi*)fitter->getParticle(0);
+  TFitParticlePtEtaPhi *FitExec_trk2 = (TFitParticlePtEtaPhi*)fitter->getParticle(1);
   TVector3 dummy1 = trk1->P(); // instead of const cast
-  TFitParticlePtEtaPhi FitExec_trk1("FitExec_trk1", "FitExec_trk1 for LambdaFit", &dummy1, fm_proton, cov_trk1);
+  FitExec_trk1->setIni4Vec(&dummy1, fm_proton);
+  FitExec_trk1->setCovMatrix(cov_trk1);
   TVector3 dummy2 = trk2->P(); // instead of const cast
-  TFitParticlePtEtaPhi FitExec_trk2("FitExec_trk2", "FitExec_trk2 for LambdaFit", &dummy2, fm_pi, cov_trk2);
-  
-  // Definition of Lambda mass constraint
-  TFitConstraintMBW MLambdaCons("LambdaMassConstraint","LambdaMassConstraintGaus", 0, fm_lambda, 0.0462);
-  MLambdaCons.addParticles1(&FitExec_trk1, &FitExec_trk2);
-    
-  // fitting characteristics
-  TKinFitter fitter;
-  fitter.addMeasParticle(&FitExec_trk1);
-  fitter.addMeasParticle(&FitExec_trk2);
-  fitter.addConstraint(&MLambdaCons);
-    
-  fitter.setMaxNbIter(50);   // maximum number of iterations
-  fitter.setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
-  fitter.setMaxF(1e-4);      // maximum value of constraints
-  fitter.setVerbosity(0);    // verbosity level
+  FitExec_trk2->setIni4Vec(&dummy2, fm_pi);
+  FitExec_trk2->setCovMatrix(cov_trk2);
     
   // Kinematic Fitting
-  fitter.fit();
+  fitter->fit();
 
   // Copy fitted 4-vectors (circumvent const cast)
-  FitP_trk1 = *FitExec_trk1.getCurr4Vec();
-  FitP_trk2 = *FitExec_trk2.getCurr4Vec();
+  FitP_trk1 = *FitExec_trk1->getCurr4Vec();
+  FitP_trk2 = *FitExec_trk2->getCurr4Vec();
 
   return fitter;
 }
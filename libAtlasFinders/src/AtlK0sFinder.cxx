@@ -51,6 +51,9 @@ AtlK0sFinder::AtlK0sFinder(const char* name, const char* title) :
     fBkgK0sDecays = new TList;
     fNK0s = 0;
 
+    // K0s mass used for the mass constraint and the pre-fit window
+    fm_K0s = 0.497;
+
     // Bkg Decay Angle analysis
     NLambdapos           = 0;
     NLambdaBarpos        = 0;
@@ -782,18 +785,17 @@ void AtlK0sFinder::ReconstructK0sCutBased(){
     //storing primary Vtx
     PrimVtx = fEvent->GetPrimaryVtx();
     
-    // Vertex-Loop
-    for ( i = 0; i < fEvent->GetN_Vertices(); i++ ) {
-	
-	Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
-
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for ( i = 0; i < v0->GetN(); i++ ) {
 	
 	// regarding only sec vtx containing 2 outgoing tracks
-	if ( !( (Vtx->IsSecondary()) && (Vtx->GetNDaughters() == 2) )) continue;
+	if ( !v0->IsSecondary(i) ) continue;
 	SetCutFlow("Sec Vtx & 2 Dght");
 
-	trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-	trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+	Vtx  = v0->GetVtx(i);
+	trk1 = v0->GetTrack1(i);
+	trk2 = v0->GetTrack2(i);
 	
 	// Momenta of outgoing pion tracks
 	if ( (trk1->Pt() > fSignalPion_Pt_max) ||
@@ -965,17 +967,17 @@ void AtlK0sFinder::ReconstructK0sKinFit(){
      //storing primary Vtx
     PrimVtx = fEvent->GetPrimaryVtx();
         
-    // Vertex-Loop
-    for ( Int_t i = 0; i < fEvent->GetN_Vertices(); i++){
-	
-	Vtx = (HepVertex*)fEvent->GetVertices()->At(i);
+    // Loop over all two-prong vertices
+    AtlV0Candidates *v0 = GetV0Candidates();
+    for ( Int_t i = 0; i < v0->GetN(); i++){
 	
 	// regarding only sec vtx containing 2 outgoing tracks
-	if ( !( (Vtx->IsSecondary()) && (Vtx->GetNDaughters() == 2) )) continue;
+	if ( !v0->IsSecondary(i) ) continue;
 	SetCutFlow("Sec. Vtx & 2 Dght.");
 
-	trk1 = (AtlIDTrack*)Vtx->GetDaughters()->At(0);
-	trk2 = (AtlIDTrack*)Vtx->GetDaughters()->At(1);
+	Vtx  = v0->GetVtx(i);
+	trk1 = v0->GetTrack1(i);
+	trk2 = v0->GetTrack2(i);
 	
 	// Momenta of outgoing pion tracks
 	if ( (trk1->Pt() > fSignalPion_Pt_max) ||
@@ -1009,6 +1011,11 @@ void AtlK0sFinder::ReconstructK0sKinFit(){
 		   trk2->HasValidTruthMatch(0.0001)) )  continue;
 	}
 	SetCutFlow("MC exists");
+
+	// Loose mass window before the kinematic fit (optional)
+	if ( fV0PreFitMassWindow > 0.
+	     && TMath::Abs(v0->GetMass(i, fm_pi, fm_pi) - fm_K0s) > fV0PreFitMassWindow )
+	    continue;
 		
 	// covariance matrices, taken from track fit
 	trk1->GetCovMatrixPtEtaPhi(cov_trk1);
@@ -1028,7 +1035,7 @@ void AtlK0sFinder::ReconstructK0sKinFit(){
 					  &dummy2,fm_pi,&cov_trk2);
 	
 	// definition of K0s mass constraint
-	TFitConstraintM MK0sCons("K0sMassConstraint","K0sMassConstraintGaus",0,0,0.497);
+	TFitConstraintM MK0sCons("K0sMassConstraint","K0sMassConstraintGaus",0,0,fm_K0s);
 	MK0sCons.addParticles1(&FitExec_trk1,&FitExec_trk2);
 	
 	// fitting characteristics
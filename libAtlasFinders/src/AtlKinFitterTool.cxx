@@ -25,6 +25,12 @@
 // The histograms are used to plot efficiencies and purities which is done by
 // AtlKinFitterTool::Terminate() using the BayesDivide() functionality.
 //
+// The two-prong vertex candidates shared by the V0 finders (K0s,
+// Lambda, K*, D0, photon conversions) are obtained via
+// GetV0Candidates() (see AtlV0Candidates). With fV0PreFitMassWindow > 0
+// the finders skip the kinematic fit of candidates far away from the
+// nominal mass.
+//
 //
 // Author: Oliver Maria Kind <mailto: kind@mail.desy.de>
 // Update: $Id$
@@ -37,6 +43,7 @@
 #include <TFile.h>
 #include <TH2F.h>
 #include <TGraphAsymmErrors.h>
+#include <TTree.h>
 #include <iostream>
 #include <TRandom3.h>
 
@@ -75,6 +82,8 @@ AtlKinFitterTool::AtlKinFitterTool(const char* name, const char* title) :
     fB_Mass    = pdg->GetParticle("b")->Mass();
     fTop_Mass  = pdg->GetParticle("t")->Mass();
     fTop_Width = pdg->GetParticle("t")->Width();
+
+    fV0PreFitMassWindow = 0.;
 }
 
 //____________________________________________________________________
@@ -100,6 +109,17 @@ void AtlKinFitterTool::SetCutDefaults() {
 
 //____________________________________________________________________
 
+AtlV0Candidates* AtlKinFitterTool::GetV0Candidates() const {
+    //
+    // Return the two-prong vertex candidates of the current event.
+    // The candidates are shared with all other finders and are built
+    // only once per event
+    //
+    return AtlV0Candidates::Get(fEvent, ( fTree != 0 ) ? fTree->GetReadEntry() : -1);
+}
+
+//____________________________________________________________________
+
 void AtlKinFitterTool::BookHistograms() {
     //
     // Book KinFitter histograms
@@ -1948,8 +1948,57 @@ void AtlSgTop_tChannelFinder::DoFit() {
     // neutrino and b-jet combination
     //
 
-    // Re-set and init fitter
-    fKinFitter->reset();
+    // Build the fit topology (particles and constraints) with the
+    // first fit. The objects are owned by the fitter and are re-used
+    // (re-targeted to the current combination) by all further fits
+    if ( !fKinFitter->hasTopology() ) {
+	fKinFitter->reset();
+	fKinFitter->setOwner();
+	
+	// ================
+	// Define particles
+	// ================
+	// Necessary for execution of the fit
+	TFitParticlePtEtaPhi *KinFit_lepton = new TFitParticlePtEtaPhi("KinFit_lepton", "Charged lepton",
+								       0, 0., 0);
+	TFitParticlePtThetaPhi *KinFit_nu = new TFitParticlePtThetaPhi("KinFit_nu", "Neutrino",
+								       0, 0., 0);
+	TFitParticlePtEtaPhi *KinFit_bjet = new TFitParticlePtEtaPhi("KinFit_bjet", "BJet",
+								     0, 0., 0);
+	fKinFitter->addMeasParticle(KinFit_lepton);
+	fKinFitter->addMeasParticle(KinFit_nu);
+	fKinFitter->setParamUnmeas(KinFit_nu, 1); // Theta (component 1) of neutrino unmeasured
+	fKinFitter->addMeasParticle(KinFit_bjet);
+	
+	// ==================
+	// Define Constraints
+	// ==================
+	
+	// Definition of top-quark and W-boson mass constraints
+	TFitConstraintM *MassConstraint_W = 0;
+	TFitConstraintM *MassConstraint_t = 0;
+	if ( fModeMass == kGauss ) {
+	    MassConstraint_W = new TFitConstraintMGaus("WMassConstraint",
+						       "WMassConstraintGauss",
+						       0, 0, fW_Mass, fW_Width);
+	    MassConstraint_t = new TFitConstraintMGaus("TopMassConstraint",
+						       "TopMassConstraintGauss",
+						       0, 0, fTop_Mass, fTop_Width);
+	} else if ( fModeMass == kBW ) {
+	    MassConstraint_W = new TFitConstraintMBW2("WMassConstraint",
+						      "WMassConstraintBW",
+						      0, fW_Mass, fW_Width);
+	    MassConstraint_t = new TFitConstraintMBW2("TopMassConstraint",
+						      "TopMassConstraintBW",
+						      0, fTop_Mass, fTop_Width);
+	}
+	MassConstraint_W->addParticles1(KinFit_lepton, KinFit_nu);
+	MassConstraint_t->addParticles1(KinFit_lepton, KinFit_nu, KinFit_bjet);
+	fKinFitter->addConstraint(MassConstraint_W);
+	fKinFitter->addConstraint(MassConstraint_t);
+    }
+
+    // Init fitter
     fKinFitter->setMaxNbIter(fMaxNbIter);  // maximum number of iterations
     fKinFitter->setMaxDeltaS(5.e-5); // maximum deviation of the minimum function within two iterations
     fKinFitter->setMaxF(1.e-4);      // maximum value of constraints
@@ -1962,51 +2011,20 @@ void AtlSgTop_tChannelFinder::DoFit() {
     TVector3 p3_neutrino = TVector3(fNeutrino->P3());
     TVector3 p3_bjet     = TVector3(fBJet->P3());
 
-    
-    // ================
-    // Define particles
-    // ================
-    // Necessary for execution of the fit
-    TFitParticlePtEtaPhi KinFit_lepton("KinFit_lepton", "Charged lepton",
-				       &p3_lepton, fLepton->Mass("PDG"), &fCovLepton);
-    TFitParticlePtThetaPhi KinFit_nu("KinFit_nu", "Neutrino",
-				     &p3_neutrino, 0., &fCovNeutrino);
-    TFitParticlePtEtaPhi KinFit_bjet("KinFit_bjet", "BJet",
-				     &p3_bjet, fB_Mass, &fCovBJet); // use b-quark mass
-    fKinFitter->addMeasParticle(&KinFit_lepton);
-    fKinFitter->addMeasParticle(&KinFit_nu);
-    fKinFitter->setParamUnmeas(&KinFit_nu, 1); // Theta (component 1) of neutrino unmeasured
-    fKinFitter->addMeasParticle(&KinFit_bjet);
-
-
-    // ==================
-    // Define Constraints
-    // ==================
-
-    // Definition of top-quark and W-boson mass constraints
-    TFitConstraintM *MassConstraint_W = 0;
-    TFitConstraintM *MassConstraint_t = 0;
-    if ( fModeMass == kGauss ) {
-	MassConstraint_W = new TFitConstraintMGaus("WMassConstraint",
-						   "WMassConstraintGauss",
-						   0, 0, fW_Mass, fW_Width);
-	MassConstraint_t = new TFitConstraintMGaus("TopMassConstraint",
-						   "TopMassConstraintGauss",
-						   0, 0, fTop_Mass, fTop_Width);
-    } else if ( fModeMass == kBW ) {
-	MassConstraint_W = new TFitConstraintMBW2("WMassConstraint",
-						 "WMassConstraintBW",
-						 0, fW_Mass, fW_Width);
-	MassConstraint_t = new TFitConstraintMBW2("TopMassConstraint",
-						 "TopMassConstraintBW",
-						 0, fTop_Mass, fTop_Width);
-    }
-
-        
-    MassConstraint_W->addParticles1(&KinFit_lepton, &KinFit_nu);
-    MassConstraint_t->addParticles1(&KinFit_lepton, &KinFit_nu, &KinFit_bjet);
-    fKinFitter->addConstraint(MassConstraint_W);
-    fKinFitter->addConstraint(MassConstraint_t);
+    // =====================================
+    // Re-target particles and constraints
+    // =====================================
+    TFitParticlePtEtaPhi *KinFit_lepton = (TFitParticlePtEtaPhi*)fKinFitter->getParticle(0);
+    TFitParticlePtThetaPhi *KinFit_nu   = (TFitParticlePtThetaPhi*)fKinFitter->getParticle(1);
+    TFitParticlePtEtaPhi *KinFit_bjet   = (TFitParticlePtEtaPhi*)fKinFitter->getParticle(2);
+    KinFit_lepton->setIni4Vec(&p3_lepton, fLepton->Mass("PDG"));
+    KinFit_lepton->setCovMatrix(&fCovLepton);
+    KinFit_nu->setIni4Vec(&p3_neutrino, 0.);
+    KinFit_nu->setCovMatrix(&fCovNeutrino);
+    KinFit_bjet->setIni4Vec(&p3_bjet, fB_Mass); // use b-quark mass
+    KinFit_bjet->setCovMatrix(&fCovBJet);
+    TFitConstraintM *MassConstraint_W = (TFitConstraintM*)fKinFitter->getConstraint(0);
+    TFitConstraintM *MassConstraint_t = (TFitConstraintM*)fKinFitter->getConstraint(1);
 
     // definition of transverse momentum-conservation
 
@@ -2096,9 +2114,6 @@ void AtlSgTop_tChannelFinder::DoFit() {
 //	gSystem->Abort(0);
     }
 
-    // Clean-up
-    delete MassConstraint_W;
-    delete MassConstraint_t;
 }
 
 //____________________________________________________________________
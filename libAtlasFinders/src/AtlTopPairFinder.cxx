@@ -685,14 +685,6 @@ void AtlTopPairFinder::DoFit() {
   fHadjet2pull.Zero();  
   fHadbjetpull.Zero();  
     
-  // Re-set and init fitter
-  fKinFitter->reset();
-  fKinFitter->setMaxNbIter(fIterMax);    // maximum number of iterations
-  fKinFitter->setMaxDeltaS(5.e-5);  // maximum deviation of the minimum function
-                                    // within two iterations
-  fKinFitter->setMaxF(1.e-4);       // maximum value of constraints
-  fKinFitter->setVerbosity(0);      // verbosity level
-
   if ( fUseLeptonCovRand )
       // Get its covariance matrix
       AtlKinFitterTool::GetLeptonCovMatRand(fLepton,cov_lep);
@@ -721,6 +713,77 @@ void AtlTopPairFinder::DoFit() {
     return;  
   }
 
+  // ===================================================
+  // Define particles and constraints (first fit only)
+  // ===================================================
+  // The objects are owned by the fitter and are re-used
+  // (re-targeted to the current combination) by all further fits
+  if ( !fKinFitter->hasTopology() ) {
+    fKinFitter->reset();
+    fKinFitter->setOwner();
+
+    // Necessary for execution of the fit
+    TFitParticlePtEtaPhi   *KinFit_lepton  = new TFitParticlePtEtaPhi  ("KinFit_lepton", "Charged lepton", 0, 0., 0);
+    TFitParticlePtThetaPhi *KinFit_nu      = new TFitParticlePtThetaPhi("KinFit_nu", "Neutrino", 0, 0., 0);
+    TFitParticlePtEtaPhi   *KinFit_LepBJet = new TFitParticlePtEtaPhi  ("KinFit_LepBJet", "LepBJet", 0, 0., 0);
+    TFitParticlePtEtaPhi   *KinFit_HadJet1 = new TFitParticlePtEtaPhi  ("KinFit_HadJet1", "HadJet1", 0, 0., 0);
+    TFitParticlePtEtaPhi   *KinFit_HadJet2 = new TFitParticlePtEtaPhi  ("KinFit_HadJet2", "HadJet1", 0, 0., 0);
+    TFitParticlePtEtaPhi   *KinFit_HadBJet = new TFitParticlePtEtaPhi  ("KinFit_HadBJet", "HadBJet", 0, 0., 0);
+
+    // Add particles to fitter
+    fKinFitter->addMeasParticle(KinFit_lepton);
+    fKinFitter->addMeasParticle(KinFit_nu);
+    fKinFitter->setParamUnmeas(KinFit_nu, 1); // eta (component 1) of neutrino unmeasured
+    fKinFitter->addMeasParticle(KinFit_LepBJet);
+    fKinFitter->addMeasParticle(KinFit_HadJet1);
+    fKinFitter->addMeasParticle(KinFit_HadJet2);
+    fKinFitter->addMeasParticle(KinFit_HadBJet);
+
+    // Definition of top-quark and W-boson mass constraints
+
+    // W-boson mass constraint
+    TFitConstraintMGaus *ConstraintLepM_W = new TFitConstraintMGaus("WMassConstraint Leptonic", "WMassConstraintGaus Leptonic", 
+								    0, 0, fW_Mass, fW_Width);
+    TFitConstraintMGaus *ConstraintHadM_W = new TFitConstraintMGaus("WMassConstraint Hadronic", "WMassConstraintGaus Hadronic",
+								    0, 0, fW_Mass, fW_Width);
+    ConstraintLepM_W->addParticles1(KinFit_lepton, KinFit_nu);
+    ConstraintHadM_W->addParticles1(KinFit_HadJet1, KinFit_HadJet2);
+    fKinFitter->addConstraint(ConstraintLepM_W);
+    fKinFitter->addConstraint(ConstraintHadM_W);
+
+    // setting which constraint is used
+    if ( fTmassconstraint == kSameTmass){
+      // Same top mass fit constraint
+      TFitConstraintM *ConstraintM_t = new TFitConstraintM( "MassConstraint Tops", "Mass-Constraint Tops", 0, 0, 0.);
+      ConstraintM_t->addParticles1(KinFit_lepton, KinFit_nu, KinFit_LepBJet);
+      ConstraintM_t->addParticles2(KinFit_HadJet1, KinFit_HadJet2, KinFit_HadBJet);
+      fKinFitter->addConstraint(ConstraintM_t);
+    }
+    else if ( fTmassconstraint == kFixedTmass ){
+      // fixed top mass fit constraint
+      TFitConstraintMGaus *ConstraintLepM_t = new TFitConstraintMGaus( "MassConstraint Tops", "Mass-Constraint Tops",
+								       0, 0, fTop_Mass, fTop_Width);
+      TFitConstraintMGaus *ConstraintHadM_t = new TFitConstraintMGaus( "MassConstraint Tops", "Mass-Constraint Tops",
+								       0, 0, fTop_Mass, fTop_Width);
+      ConstraintLepM_t->addParticles1(KinFit_lepton, KinFit_nu, KinFit_LepBJet);
+      ConstraintHadM_t->addParticles1(KinFit_HadJet1, KinFit_HadJet2, KinFit_HadBJet);
+      fKinFitter->addConstraint(ConstraintLepM_t);
+      fKinFitter->addConstraint(ConstraintHadM_t);
+    }
+    else{
+      Error("DoFit",
+      "No valid mass constraint given. Abort!");
+    }
+  }
+
+  // Init fitter (after the topology set-up, since reset() restores
+  // the default settings)
+  fKinFitter->setMaxNbIter(fIterMax);    // maximum number of iterations
+  fKinFitter->setMaxDeltaS(5.e-5);  // maximum deviation of the minimum function
+                                    // within two iterations
+  fKinFitter->setMaxF(1.e-4);       // maximum value of constraints
+  fKinFitter->setVerbosity(0);      // verbosity level
+
   // =============
   // Get 3-momenta
   // =============
@@ -731,75 +794,23 @@ void AtlTopPairFinder::DoFit() {
   TVector3 p3_HadJet1  = TVector3(fHadJet1->P3());
   TVector3 p3_HadJet2  = TVector3(fHadJet2->P3());
   TVector3 p3_HadBJet  = TVector3(fHadBJet->P3());
-  
-  // ================
-  // Define particles
-  // ================
-
-  // Necessary for execution of the fit
-  TFitParticlePtEtaPhi   KinFit_lepton ("KinFit_lepton", "Charged lepton", &p3_lepton, fLepton->Mass("PDG"), &cov_lep);
-  TFitParticlePtThetaPhi KinFit_nu     ("KinFit_nu", "Neutrino", &p3_neutrino, 0., &cov_nu);
-  TFitParticlePtEtaPhi   KinFit_LepBJet("KinFit_LepBJet", "LepBJet", &p3_LepBJet, 4.5, &cov_LepBJet); // use B mass
-  TFitParticlePtEtaPhi   KinFit_HadJet1("KinFit_HadJet1", "HadJet1", &p3_HadJet1, 0, &cov_HadJet1);
-  TFitParticlePtEtaPhi   KinFit_HadJet2("KinFit_HadJet2", "HadJet1", &p3_HadJet2, 0, &cov_HadJet2);
-  TFitParticlePtEtaPhi   KinFit_HadBJet("KinFit_HadBJet", "HadBJet", &p3_HadBJet, 4.5, &cov_HadBJet); // use B mass
-  
-  
-  
-  // Add particles to fitter
-  fKinFitter->addMeasParticle(&KinFit_lepton);
-  fKinFitter->addMeasParticle(&KinFit_nu);
-  fKinFitter->setParamUnmeas(&KinFit_nu, 1); // eta (component 1) of neutrino unmeasured
-  fKinFitter->addMeasParticle(&KinFit_LepBJet);
-  fKinFitter->addMeasParticle(&KinFit_HadJet1);
-  fKinFitter->addMeasParticle(&KinFit_HadJet2);
-  fKinFitter->addMeasParticle(&KinFit_HadBJet);
-
 
   // ==================
-  // Define Constraints
+  // Re-target particles
   // ==================
-  // Definition of top-quark and W-boson mass constraints
-
-  // W-boson mass constraint
-  TFitConstraintMGaus ConstraintLepM_W("WMassConstraint Leptonic", "WMassConstraintGaus Leptonic", 
-                                        0, 0, fW_Mass, fW_Width);
-  TFitConstraintMGaus ConstraintHadM_W("WMassConstraint Hadronic", "WMassConstraintGaus Hadronic",
-                                        0, 0, fW_Mass, fW_Width);
-  
-  ConstraintLepM_W.addParticles1(&KinFit_lepton, &KinFit_nu);
-  ConstraintHadM_W.addParticles1(&KinFit_HadJet1, &KinFit_HadJet2);
-  
-  fKinFitter->addConstraint(&ConstraintLepM_W);
-  fKinFitter->addConstraint(&ConstraintHadM_W);
-  
 
-  // Same top mass fit constraint
-  TFitConstraintM ConstraintM_t( "MassConstraint Tops", "Mass-Constraint Tops", 0, 0, 0.);
-  ConstraintM_t.addParticles1(&KinFit_lepton, &KinFit_nu, &KinFit_LepBJet);
-  ConstraintM_t.addParticles2(&KinFit_HadJet1, &KinFit_HadJet2, &KinFit_HadBJet);
-
-  // fixed top mass fit constraint
-  TFitConstraintMGaus ConstraintLepM_t( "MassConstraint Tops", "Mass-Constraint Tops",
-                                        0, 0, fTop_Mass, fTop_Width);
-  TFitConstraintMGaus ConstraintHadM_t( "MassConstraint Tops", "Mass-Constraint Tops",
-                                        0, 0, fTop_Mass, fTop_Width);
-  ConstraintLepM_t.addParticles1(&KinFit_lepton, &KinFit_nu, &KinFit_LepBJet);
-  ConstraintHadM_t.addParticles1(&KinFit_HadJet1, &KinFit_HadJet2, &KinFit_HadBJet);
-  
-  // setting which constraint is used
-  if ( fTmassconstraint == kSameTmass){
-    fKinFitter->addConstraint(&ConstraintM_t);
-  }
-  else if ( fTmassconstraint == kFixedTmass ){
-    fKinFitter->addConstraint(&ConstraintLepM_t);
-    fKinFitter->addConstraint(&ConstraintHadM_t);
-  }
-  else{
-    Error("DoFit",
-    "No valid mass constraint given. Abort!");
-      
-  }
+  ((TFitParticlePtEtaPhi*)  fKinFitter->getParticle(0))->setIni4Vec(&p3_lepton, fLepton->Mass("PDG"));
+  ((TFitParticlePtThetaPhi*)fKinFitter->getParticle(1))->setIni4Vec(&p3_neutrino, 0.);
+  ((TFitParticlePtEtaPhi*)  fKinFitter->getParticle(2))->setIni4Vec(&p3_LepBJet, 4.5); // use B mass
+  ((TFitParticlePtEtaPhi*)  fKinFitter->getParticle(3))->setIni4Vec(&p3_HadJet1, 0);
+  ((TFitParticlePtEtaPhi*)  fKinFitter->getParticle(4))->setIni4Vec(&p3_HadJet2, 0);
+  ((TFitParticlePtEtaPhi*)  fKinFitter->getParticle(5))->setIni4Vec(&p3_HadBJet, 4.5); // use B mass
+  ((TAbsFitParticle*)fKinFitter->getParticle(0))->setCovMatrix(&cov_lep);
+  ((TAbsFitParticle*)fKinFitter->getParticle(1))->setCovMatrix(&cov_nu);
+  ((TAbsFitParticle*)fKinFitter->getParticle(2))->setCovMatrix(&cov_LepBJet);
+  ((TAbsFitParticle*)fKinFitter->getParticle(3))->setCovMatrix(&cov_HadJet1);
+  ((TAbsFitParticle*)fKinFitter->getParticle(4))->setCovMatrix(&cov_HadJet2);
+  ((TAbsFitParticle*)fKinFitter->getParticle(5))->setCovMatrix(&cov_HadBJet);
   
   
   // =========================
@@ -0,0 +1,205 @@
+//____________________________________________________________________
+//
+// Shared two-prong vertex candidates of the V0 finders
+//
+// The V0 finders (AtlK0sFinder, AtlLambdaFinder, AtlK0StarFinder,
+// AtlConvFinder, AtlD0Finder) all loop over the vertices of the event
+// looking for vertices with exactly two outgoing tracks and compute
+// invariant masses of the track pair under different mass
+// hypotheses. This class does this once per event for all finders:
+// the candidate list holds the vertex and both daughter tracks of
+// every two-prong vertex together with vertex-type and charge flags,
+// the momentum invariants of the pair and the invariant masses of all
+// standard hypotheses (see EHypothesis), computed in a single pass.
+//
+// Masses for other daughter-mass assumptions (eg. the mass values
+// configured in a finder) are obtained from the cached invariants
+// without touching the tracks again (GetMass(i, m1, m2)).
+//
+// The finders obtain the list via AtlKinFitterTool::GetV0Candidates()
+// which rebuilds it only if the event has changed.
+//
+// Usage:
+// ======
+// AtlV0Candidates *v0 = GetV0Candidates();
+// for ( Int_t i = 0; i < v0->GetN(); i++ ) {
+//     if ( !v0->IsSecondary(i) ) continue;
+//     Double_t m = v0->GetMass(i, AtlV0Candidates::kPiPi);
+//     ...
+// }
+//
+#ifndef ATLAS_AtlV0Candidates
+#include <AtlV0Candidates.h>
+#endif
+#include <AtlEvent.h>
+#include <TMath.h>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlV0Candidates);
+#endif
+
+const Double_t AtlV0Candidates::fgMass[AtlV0Candidates::kNHypotheses][2] = {
+    { 0.13957018,     0.13957018     }, // kPiPi
+    { 0.938272013,    0.13957018     }, // kPPi
+    { 0.13957018,     0.938272013    }, // kPiP
+    { 0.493677,       0.493677       }, // kKK
+    { 0.493677,       0.13957018     }, // kKPi
+    { 0.13957018,     0.493677       }, // kPiK
+    { 0.000510998910, 0.000510998910 }  // kEE
+};
+
+//____________________________________________________________________
+
+AtlV0Candidates::AtlV0Candidates() {
+    //
+    // Default constructor
+    //
+    fEvent   = 0;
+    fEntry   = -1;
+    fRunNr   = 0;
+    fEventNr = 0;
+}
+
+//____________________________________________________________________
+
+AtlV0Candidates::~AtlV0Candidates() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlV0Candidates::Build(AtlEvent *evt, Long64_t Entry) {
+    //
+    // Build the candidates of the given event from all vertices with
+    // exactly two outgoing tracks
+    //
+    fEvent   = evt;
+    fEntry   = Entry;
+    fRunNr   = evt->RunNr();
+    fEventNr = evt->EventNr();
+    fVtx.clear();
+    fTrk1.clear();
+    fTrk2.clear();
+    fFlags.clear();
+    fP1Sq.clear();
+    fP2Sq.clear();
+    fP1P2.clear();
+    fVtxIndex.assign(evt->GetN_Vertices(), -1);
+
+    // Collect two-prong vertices and the momentum invariants of their tracks
+    TClonesArray *vertices = evt->GetVertices();
+    for ( Int_t i = 0; i < evt->GetN_Vertices(); i++ ) {
+	HepVertex *vtx = (HepVertex*)vertices->At(i);
+	if ( vtx == 0 || vtx->GetNDaughters() != 2 ) continue;
+	AtlIDTrack *trk1 = (AtlIDTrack*)vtx->GetDaughters()->At(0);
+	AtlIDTrack *trk2 = (AtlIDTrack*)vtx->GetDaughters()->At(1);
+	if ( trk1 == 0 || trk2 == 0 ) continue;
+	const TVector3 &p1 = trk1->P();
+	const TVector3 &p2 = trk2->P();
+	UChar_t flags = 0;
+	if ( vtx->IsSecondary() ) flags |= kSecondary;
+	if ( trk1->QovP()*trk2->QovP() < 0. ) flags |= kOppositeCharge;
+	fVtxIndex[i] = fVtx.size();
+	fVtx.push_back(vtx);
+	fTrk1.push_back(trk1);
+	fTrk2.push_back(trk2);
+	fFlags.push_back(flags);
+	fP1Sq.push_back(p1.Mag2());
+	fP2Sq.push_back(p2.Mag2());
+	fP1P2.push_back(p1.Dot(p2));
+    }
+
+    // Invariant masses of all hypotheses in one pass
+    Int_t n = fVtx.size();
+    fMass.resize(n*kNHypotheses);
+    for ( Int_t i = 0; i < n; i++ ) {
+	Double_t *m = &fMass[i*kNHypotheses];
+	for ( Int_t h = 0; h < kNHypotheses; h++ ) {
+	    Double_t m1sq = fgMass[h][0]*fgMass[h][0];
+	    Double_t m2sq = fgMass[h][1]*fgMass[h][1];
+	    Double_t msq = m1sq + m2sq
+		+ 2.*(TMath::Sqrt((fP1Sq[i] + m1sq)*(fP2Sq[i] + m2sq)) - fP1P2[i]);
+	    m[h] = ( msq > 0. ) ? TMath::Sqrt(msq) : 0.;
+	}
+    }
+}
+
+//____________________________________________________________________
+
+Int_t AtlV0Candidates::Find(HepVertex *Vtx) const {
+    //
+    // Return the candidate index of the given vertex (-1 if the vertex
+    // is not a two-prong vertex of the current event)
+    //
+    if ( fEvent == 0 || Vtx == 0 ) return -1;
+    TClonesArray *vertices = fEvent->GetVertices();
+    for ( Int_t i = 0; i < (Int_t)fVtxIndex.size(); i++ ) {
+	if ( fVtxIndex[i] >= 0 && vertices->At(i) == Vtx ) return fVtxIndex[i];
+    }
+    return -1;
+}
+
+//____________________________________________________________________
+
+Double_t AtlV0Candidates::GetMass(Int_t i, Double_t m1, Double_t m2) const {
+    //
+    // Invariant mass of candidate i assuming the daughter masses m1
+    // (track 1) and m2 (track 2)
+    //
+    Double_t msq = m1*m1 + m2*m2
+	+ 2.*(TMath::Sqrt((fP1Sq[i] + m1*m1)*(fP2Sq[i] + m2*m2)) - fP1P2[i]);
+    return ( msq > 0. ) ? TMath::Sqrt(msq) : 0.;
+}
+
+//____________________________________________________________________
+
+TLorentzVector AtlV0Candidates::GetP(Int_t i, Double_t m1, Double_t m2) const {
+    //
+    // 4-momentum of candidate i assuming the daughter masses m1
+    // (track 1) and m2 (track 2)
+    //
+    TLorentzVector p1, p2;
+    p1.SetVectM(fTrk1[i]->P(), m1);
+    p2.SetVectM(fTrk2[i]->P(), m2);
+    return p1 + p2;
+}
+
+//____________________________________________________________________
+
+AtlV0Candidates* AtlV0Candidates::Get(AtlEvent *evt, Long64_t Entry) {
+    //
+    // Return the candidates of the given event. The candidates are
+    // shared by all finders of the calling thread and are rebuilt
+    // only if the event has changed since the last call
+    //
+    static thread_local AtlV0Candidates candidates;
+    if ( candidates.fEvent != evt
+	 || candidates.fEntry != Entry
+	 || candidates.fRunNr != evt->RunNr()
+	 || candidates.fEventNr != evt->EventNr() ) {
+	candidates.Build(evt, Entry);
+    }
+    return &candidates;
+}
+
+//____________________________________________________________________
+
+const char* AtlV0Candidates::GetHypothesisName(EHypothesis hyp) {
+    //
+    // Name of the given mass hypothesis
+    //
+    switch ( hyp ) {
+	case kPiPi: return "pipi";
+	case kPPi:  return "ppi";
+	case kPiP:  return "pip";
+	case kKK:   return "KK";
+	case kKPi:  return "Kpi";
+	case kPiK:  return "piK";
+	case kEE:   return "ee";
+	default:    return "unknown";
+    }
+}
@@ -813,62 +813,64 @@ void AtlZ0Finder::ReconstructZ0KinFit(TList *SignalLeptons) {
 		l1->GetCovMatrixPtEtaPhi(cov_l1);
 		l2->GetCovMatrixPtEtaPhi(cov_l2);
 		
-		// define particels necessary for execution of the fit
-		TFitParticlePtEtaPhi FitExec_l1("FitExec_l1","FitExec_l1",&p_l1,l1->Mass(),&cov_l1);
-		TFitParticlePtEtaPhi FitExec_l2("FitExec_l2","FitExec_l2",&p_l2,l2->Mass(),&cov_l2);
-		
-		// definition of Z-Boson mass constraint
-		TFitConstraintMGaus MZCons("ZMassConstraint","ZMassConstraintGaus", 0, 0, 91.2, 2.5);
-		MZCons.addParticles1(&FitExec_l1,&FitExec_l2);
-		
-		// definition of transverse momentum-conservation
-		vector<TAbsFitParticle*> vec_constraint;
-		vec_constraint.push_back(&FitExec_l1);
-		vec_constraint.push_back(&FitExec_l2);
-		
-		TFitConstraintEpGaus PxCons(&vec_constraint, TFitConstraintEp::pX,0.0001,8.1);
-		TFitConstraintEpGaus PyCons(&vec_constraint, TFitConstraintEp::pY,0.0001,8.1);
-		
-		// fitting characteristics
-		TKinFitter fitter;
-		
-		fitter.addMeasParticle(&FitExec_l1);
-		fitter.addMeasParticle(&FitExec_l2);
-		
-		fitter.addConstraint(&MZCons);
-		fitter.setMaxNbIter(2000);   // maximum number of iterations
-		fitter.setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
-		fitter.setMaxF(1e-4);      // maximum value of constraints
-		fitter.setVerbosity(0);    // verbosity level
+		// define particles necessary for execution of the fit
+		// on first use; they are owned by the fitter and re-used
+		// (re-targeted to the current lepton pair) by all further fits
+		if ( !fKinFitter->hasTopology() ) {
+		    TFitParticlePtEtaPhi *Fit_l1 = new TFitParticlePtEtaPhi("FitExec_l1","FitExec_l1",0,0.,0);
+		    TFitParticlePtEtaPhi *Fit_l2 = new TFitParticlePtEtaPhi("FitExec_l2","FitExec_l2",0,0.,0);
+		    
+		    // definition of Z-Boson mass constraint
+		    TFitConstraintMGaus *MZCons = new TFitConstraintMGaus("ZMassConstraint","ZMassConstraintGaus", 0, 0, 91.2, 2.5);
+		    MZCons->addParticles1(Fit_l1,Fit_l2);
+		    
+		    // fitting characteristics
+		    fKinFitter->reset();
+		    fKinFitter->setOwner();
+		    fKinFitter->addMeasParticle(Fit_l1);
+		    fKinFitter->addMeasParticle(Fit_l2);
+		    
+		    fKinFitter->addConstraint(MZCons);
+		    fKinFitter->setMaxNbIter(2000);   // maximum number of iterations
+		    fKinFitter->setMaxDeltaS(5e-5); // maximum deviation of the minimum function within two iterations
+		    fKinFitter->setMaxF(1e-4);      // maximum value of constraints
+		    fKinFitter->setVerbosity(0);    // verbosity level
+		}
+		TFitParticlePtEtaPhi *FitExec_l1 = (TFitParticlePtEtaPhi*)fKinFitter->getParticle(0);
+		TFitParticlePtEtaPhi *FitExec_l2 = (TFitParticlePtEtaPhi*)fKinFitter->getParticle(1);
+		FitExec_l1->setIni4Vec(&p_l1,l1->Mass());
+		FitExec_l1->setCovMatrix(&cov_l1);
+		FitExec_l2->setIni4Vec(&p_l2,l2->Mass());
+		FitExec_l2->setCovMatrix(&cov_l2);
 		
 		// Kinematic Fitting
-		fitter.fit();
+		fKinFitter->fit();
 		
 		// Fill Histogram IF(!) the fit converged (fitter.getStatus==0)
-		if ( fitter.getS()<0. ) {
-		    //fitter.printMatrices();
+		if ( fKinFitter->getS()<0. ) {
+		    //fKinFitter->printMatrices();
 		    Error("ReconstructZ0KinFit",
 			  "fitter.getS()<0. Abort!");
 		    gSystem->Abort(0);
 		}
-		if(  fitter.getStatus() ) { cout << endl << "DIVERGENCE" << endl; }
-		if( ! fitter.getStatus() ) {
+		if(  fKinFitter->getStatus() ) { cout << endl << "DIVERGENCE" << endl; }
+		if( ! fKinFitter->getStatus() ) {
 		cout<<endl<<"geht doch weiter"<<endl;
 		// Copy fittet Vectors
 		// define momentum used as output of the fit
 		TLorentzVector FitP_l1;
 		TLorentzVector FitP_l2;
 		
-		FitP_l1=(*FitExec_l1.getCurr4Vec());
-		FitP_l2=(*FitExec_l2.getCurr4Vec());
+		FitP_l1=(*FitExec_l1->getCurr4Vec());
+		FitP_l2=(*FitExec_l2->getCurr4Vec());
 		// Reconstruct Z0 4-momentum
 		p_Z = FitP_l1 + FitP_l2;
-		SetChi2(fitter.getS());
+		SetChi2(fKinFitter->getS());
 		
 	        
-		SetNDoF(fitter.getNDF());
-		SetNbIter(fitter.getNbIter());
-		SetConsValue(fitter.getF());
+		SetNDoF(fKinFitter->getNDF());
+		SetNbIter(fKinFitter->getNbIter());
+		SetConsValue(fKinFitter->getF());
 		
 		
 		// Add Z0 to event fill the signal list
@@ -948,7 +950,7 @@ void AtlZ0Finder::ReconstructZ0KinFit(TList *SignalLeptons) {
 
 
 			// Z Boson
-			ZBoson->SetChi2NDoF(fitter.getS(),fitter.getNDF());
+			ZBoson->SetChi2NDoF(fKinFitter->getS(),fKinFitter->getNDF());
 			
 			MCprt = fEvent->FindMatchedMCParticle((HepParticle*)ZBoson,false,0.3,0.8);  // Z Boson truth matched?
 			if ( (MCprt != 0) && (MCprt->IsZ0Boson()) ) {
@@ -962,7 +964,7 @@ void AtlZ0Finder::ReconstructZ0KinFit(TList *SignalLeptons) {
 
 			Double_t prob;
 			Double_t loss;
-			prob=TMath::Prob(fitter.getS(),fitter.getNDF());
+			prob=TMath::Prob(fKinFitter->getS(),fKinFitter->getNDF());
 
 			
 			if ( l1True!=0 && l1True->IsElectron() && l2True!=0 && l2True->IsElectron() ) {
@@ -14,9 +14,12 @@ class HepVertex;
 class Hep2BodyDecay : public HepDecayParticle {
 
 protected:
-    TRef    *fDaughter1;   // Daughter particle 1
-    TRef    *fDaughter2;   // Daughter particle 2
-    TRef    *fVtx;         // Associated Vertex
+    TRef    *fDaughter1;   // Daughter particle 1 (TRef fallback)
+    TRef    *fDaughter2;   // Daughter particle 2 (TRef fallback)
+    TRef    *fVtx;         // Associated Vertex (TRef fallback)
+    HepEventRef fDaughter1Ref; // Daughter particle 1
+    HepEventRef fDaughter2Ref; // Daughter particle 2
+    HepEventRef fVtxRef;       // Associated Vertex
     Float_t  fDecayLength; // Distance from primary vtx (cm)
     Float_t  fAngleToPrim; // Angular divergence between lambda origin and primary vtx
     Float_t  fDecayAngle;  // Angle between outgoing tracks in lab frame
@@ -44,14 +47,14 @@ public:
     inline Float_t GetDecayLength() const  { return fDecayLength;      }
     inline Float_t GetAngleToPrimary() const    { return fAngleToPrim;       }
     inline Float_t GetTransvDecayLength() const { return fTransvDecayLength; }
-    inline TObject* GetDaughter1()   { return fDaughter1->GetObject(); }
-    inline TObject* GetDaughter2()   { return fDaughter2->GetObject(); }
-    virtual inline TObject* GetVtx() { return fVtx->GetObject();       }
+    inline TObject* GetDaughter1()   { return GetRef(fDaughter1Ref, fDaughter1); }
+    inline TObject* GetDaughter2()   { return GetRef(fDaughter2Ref, fDaughter2); }
+    virtual inline TObject* GetVtx() { return GetRef(fVtxRef, fVtx);             }
     inline HepParticle GetReFitDaughter1() { return fReFitDaughter1;   }
     inline HepParticle GetReFitDaughter2() { return fReFitDaughter2;   }
     inline Bool_t   HasSharedTracks()      { return fHasSharedTracks;  }
     
-    ClassDef(Hep2BodyDecay,4); // Base two body decay class
+    ClassDef(Hep2BodyDecay,5); // Base two body decay class
 };
 #endif
 
@@ -11,11 +11,15 @@
 #ifndef ROOT_TRef
 #include <TRef.h>
 #endif
+#ifndef HEP_HepEventRef
+#include <HepEventRef.h>
+#endif
 
 class HepDecayParticle : public HepParticle {
 
 protected:
-    TRef   *fMCDecay; // Matched MC truth decay (if any)
+    TRef   *fMCDecay; // Matched MC truth decay (if any, TRef fallback)
+    HepEventRef fMCDecayRef; // Matched MC truth decay (if any)
     Float_t fChi2;    // Chi2 of the kinematic fit
     Int_t   fNDoF;    // No. of degrees per freedom of the kinematic fit
     Float_t fProb;    // Chi2 probability of the kinematic fit
@@ -37,8 +41,16 @@ public:
     inline Float_t GetChi2overNDoF() const {
 	return ( fNDoF == 0 ) ? 0. : fChi2/fNDoF;
     }
+    inline TObject* GetMCDecay() const { return GetRef(fMCDecayRef, fMCDecay); }
+    inline void SetMCDecay(TObject *MCDecay) { SetRef(fMCDecayRef, fMCDecay, MCDecay); }
+
+protected:
+    void SetRef(HepEventRef &Ref, TRef *&OldRef, TObject *obj);
+    TObject* GetRef(const HepEventRef &Ref, const TRef *OldRef) const;
+
+public:
     
-    ClassDef(HepDecayParticle,3) // Base class for particle decays
+    ClassDef(HepDecayParticle,4) // Base class for particle decays
 };
 #endif
 
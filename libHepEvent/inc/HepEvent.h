@@ -16,6 +16,11 @@ private:
 public:
     HepEvent();
     virtual ~HepEvent();
+    virtual TObject* GetRefObject(Short_t Collection, Int_t Index) const;
+    virtual Bool_t FindRef(const TObject *obj, Short_t &Collection,
+			   Int_t &Index) const;
+    static HepEvent* GetCurrentEvent();
+    static void SetCurrentEvent(HepEvent *evt);
 
     ClassDef(HepEvent,2) // Abstract HEP event class
 };
@@ -0,0 +1,32 @@
+#ifndef HEP_HepEventRef
+#define HEP_HepEventRef
+#ifndef ROOT_TObject
+#include <TObject.h>
+#endif
+
+class HepEvent;
+
+class HepEventRef {
+
+private:
+    Short_t fCollection; // Id of the event collection (-1 = none, see HepEvent::GetRefObject())
+    Int_t   fIndex;      // Index of the referenced object inside the collection
+
+public:
+    HepEventRef();
+    HepEventRef(TObject *obj, const HepEvent *evt = 0);
+    virtual ~HepEventRef();
+    Bool_t Set(TObject *obj, const HepEvent *evt = 0);
+    TObject* GetObject(const HepEvent *evt = 0) const;
+    inline void Set(Short_t Collection, Int_t Index) {
+	fCollection = Collection; fIndex = Index;
+    }
+    inline void Clear() { fCollection = -1; fIndex = -1; }
+    inline Bool_t IsValid() const { return fCollection >= 0; }
+    inline Short_t GetCollection() const { return fCollection; }
+    inline Int_t GetIndex() const { return fIndex; }
+
+    ClassDef(HepEventRef,1) // Event-local reference to an object of a HEP event
+};
+#endif
+
@@ -14,9 +14,12 @@ class HepVertex;
 class HepK0sDecay : public HepDecayParticle {
 
 private:
-    TRef    *fDaughter1;   // Daughter particle 1
-    TRef    *fDaughter2;   // Daughter particle 2
-    TRef    *fVtx;         // Associated Vertex
+    TRef    *fDaughter1;   // Daughter particle 1 (TRef fallback)
+    TRef    *fDaughter2;   // Daughter particle 2 (TRef fallback)
+    TRef    *fVtx;         // Associated Vertex (TRef fallback)
+    HepEventRef fDaughter1Ref; // Daughter particle 1
+    HepEventRef fDaughter2Ref; // Daughter particle 2
+    HepEventRef fVtxRef;       // Associated Vertex
     Float_t  fDecayLength; // Distance from primary vtx (cm)
     HepParticle fFit_Daughter1; // in case of using the kinematic fitter,
     HepParticle fFit_Daughter2; // storig new momenta and PDGCode
@@ -32,13 +35,13 @@ public:
     Float_t GetLifeTime();
     
     inline Float_t GetDecayLength() const { return fDecayLength; }
-    inline TObject* GetDaughter1()   { return fDaughter1->GetObject(); }
-    inline TObject* GetDaughter2()   { return fDaughter2->GetObject(); }
-    virtual inline TObject* GetVtx() { return fVtx->GetObject();       }
+    inline TObject* GetDaughter1()   { return GetRef(fDaughter1Ref, fDaughter1); }
+    inline TObject* GetDaughter2()   { return GetRef(fDaughter2Ref, fDaughter2); }
+    virtual inline TObject* GetVtx() { return GetRef(fVtxRef, fVtx);             }
     inline HepParticle GetFit_Daughter1() { return fFit_Daughter1;     }
     inline HepParticle GetFit_Daughter2() { return fFit_Daughter2;     }
      
-    ClassDef(HepK0sDecay,3) // Base K0s decay class
+    ClassDef(HepK0sDecay,4) // Base K0s decay class
 };
 #endif
 
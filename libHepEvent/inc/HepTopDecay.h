@@ -28,9 +28,12 @@ class HepTopDecay : public HepDecayParticle {
 			  kOther };
     
   protected:
-    TRef     *fWDecay;      // W decay object associated to this top decay
-    TRef     *fBJetOrig;    // Outgoing original B-jet of this top decay before fit
-    TRef     *fTruthTop;    //Truth Top of reconstructed Top
+    TRef     *fWDecay;      // W decay object associated to this top decay (TRef fallback)
+    TRef     *fBJetOrig;    // Outgoing original B-jet of this top decay before fit (TRef fallback)
+    TRef     *fTruthTop;    //Truth Top of reconstructed Top (TRef fallback)
+    HepEventRef fWDecayRef;   // W decay object associated to this top decay
+    HepEventRef fBJetOrigRef; // Outgoing original B-jet of this top decay before fit
+    HepEventRef fTruthTopRef; // Truth top of reconstructed top
     TLorentzVector fP_BJet; // Improved 4-momentum of outgoing B-jet after fit
     ProductionMode fMode;   // Production process of this top quark 
     
@@ -64,13 +67,13 @@ class HepTopDecay : public HepDecayParticle {
     }
     inline HepWDecay* GetWDecay() const {
 	// Return associated W decay object
-	return (HepWDecay*)fWDecay->GetObject();
+	return (HepWDecay*)GetRef(fWDecayRef, fWDecay);
     }
     inline HepJet* GetBJetOrig() const {
 	//
 	// Return unchanged b-jet connected to this top decay
 	//
-	return (HepJet*)fBJetOrig->GetObject();
+	return (HepJet*)GetRef(fBJetOrigRef, fBJetOrig);
     }
     inline TLorentzVector GetP_BJet() const {
 	//
@@ -89,12 +92,12 @@ class HepTopDecay : public HepDecayParticle {
     inline HepMCParticle* GetTruthTop() const { 
 	// Get truth top-quark of reconstructed top. Pointer is zero if no
 	// truth top exists
-	return (HepMCParticle*)fTruthTop->GetObject();
+	return (HepMCParticle*)GetRef(fTruthTopRef, fTruthTop);
     } 
     inline void SetTruthTop(HepMCParticle *TruthTop)
-    { *fTruthTop = (TObject*)TruthTop;}
+    { SetRef(fTruthTopRef, fTruthTop, (TObject*)TruthTop); }
     inline void SetMode(ProductionMode mode) { fMode = mode; }
     
-    ClassDef(HepTopDecay,6) // Top quark decay class
+    ClassDef(HepTopDecay,7) // Top quark decay class
 };
 #endif
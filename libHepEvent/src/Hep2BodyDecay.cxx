@@ -22,9 +22,9 @@ Hep2BodyDecay::Hep2BodyDecay() {
     //
     // Default constructor
     //
-    fDaughter1 = new TRef;
-    fDaughter2 = new TRef;
-    fVtx       = new TRef;
+    fDaughter1 = 0;
+    fDaughter2 = 0;
+    fVtx       = 0;
 }
 
 //____________________________________________________________________
@@ -37,9 +37,10 @@ Hep2BodyDecay::Hep2BodyDecay(Int_t Id, Float_t Px, Float_t Py, Float_t Pz,
     //
     // Normal constructor
     //
-    fDaughter1 = new TRef; *fDaughter1 = Daughter1;
-    fDaughter2 = new TRef; *fDaughter2 = Daughter2;
-    fVtx       = new TRef; *fVtx       = (TObject*)DecayVtx;
+    // The TRefs are only created if needed (see SetRef())
+    fDaughter1 = 0; SetRef(fDaughter1Ref, fDaughter1, Daughter1);
+    fDaughter2 = 0; SetRef(fDaughter2Ref, fDaughter2, Daughter2);
+    fVtx       = 0; SetRef(fVtxRef, fVtx, (TObject*)DecayVtx);
     fReFitDaughter1 = ReFitDaughter1;
     fReFitDaughter2 = ReFitDaughter2;
     fHasSharedTracks = kFALSE;
@@ -92,6 +93,9 @@ void Hep2BodyDecay::Clear(Option_t *option) {
     delete fDaughter1; fDaughter1 = 0;
     delete fDaughter2; fDaughter2 = 0;
     delete fVtx;       fVtx       = 0;
+    fDaughter1Ref.Clear();
+    fDaughter2Ref.Clear();
+    fVtxRef.Clear();
     fDecayLength = 0.;
     fTransvDecayLength = 0;
     fReFitDaughter1.Clear();
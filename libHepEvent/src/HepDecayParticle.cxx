@@ -1,6 +1,14 @@
 //____________________________________________________________________
 //
 // Base class for reconstructed particle decays (Z->ee, Z->mumu etc.)
+//
+// Links to the decay products, vertices and MC truth objects are
+// stored as event-local references (HepEventRef) whenever the linked
+// object is part of a collection of the current event. This avoids
+// any TRef bookkeeping in the TProcessID tables. Objects which are not
+// part of the event and links read from files written before the
+// introduction of the event-local references are still handled by
+// the old TRef data members (see SetRef() and GetRef()).
 // 
 //
 //  
@@ -25,7 +33,7 @@ HepDecayParticle::HepDecayParticle() {
     //
     // Default constructor
     //
-    fMCDecay = new TRef;
+    fMCDecay = 0;
 }
 
 //____________________________________________________________________
@@ -36,7 +44,7 @@ HepDecayParticle::HepDecayParticle(Int_t Id, Float_t Px, Float_t Py,
     //
     // Normal constructor
     //
-    fMCDecay = new TRef;
+    fMCDecay = 0;
 }
 
 //____________________________________________________________________
@@ -56,4 +64,34 @@ void HepDecayParticle::Clear(Option_t *option) {
     //	
     HepParticle::Clear(option);
     delete fMCDecay; fMCDecay = 0;
+    fMCDecayRef.Clear();
+}
+
+//____________________________________________________________________
+
+void HepDecayParticle::SetRef(HepEventRef &Ref, TRef *&OldRef,
+			      TObject *obj) {
+    //
+    // Link the given object. An event-local reference is used if the
+    // object is part of the current event, a TRef otherwise. The TRef
+    // is created on demand only
+    //
+    if ( Ref.Set(obj) ) {
+	if ( OldRef != 0 ) *OldRef = 0;
+	return;
+    }
+    if ( OldRef == 0 ) OldRef = new TRef;
+    *OldRef = obj;
+}
+
+//____________________________________________________________________
+
+TObject* HepDecayParticle::GetRef(const HepEventRef &Ref,
+				  const TRef *OldRef) const {
+    //
+    // Return the linked object. Falls back to the TRef for objects
+    // outside the event and for old files without event-local references
+    //
+    if ( Ref.IsValid() ) return Ref.GetObject();
+    return ( OldRef != 0 ) ? OldRef->GetObject() : 0;
 }
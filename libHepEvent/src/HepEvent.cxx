@@ -1,6 +1,12 @@
 //____________________________________________________________________
 //
 // Abstract HEP event class
+//
+// Derived event classes can resolve event-local references
+// (HepEventRef) to the objects of their collections by implementing
+// GetRefObject() and FindRef(). The event the references of the
+// calling thread are resolved against by default is set via
+// SetCurrentEvent().
 // 
 
 //  
@@ -16,6 +22,8 @@
 ClassImp(HepEvent);
 #endif
 
+static thread_local HepEvent *gHepCurrentEvent = 0; // Current event of this thread
+
 //____________________________________________________________________
 
 HepEvent::HepEvent() {
@@ -31,3 +39,46 @@ HepEvent::~HepEvent() {
     // Default destructor
     //
 }
+
+//____________________________________________________________________
+
+TObject* HepEvent::GetRefObject(Short_t /*Collection*/,
+				Int_t /*Index*/) const {
+    //
+    // Return the object with the given index in the given collection.
+    // To be implemented by the derived event classes
+    //
+    return 0;
+}
+
+//____________________________________________________________________
+
+Bool_t HepEvent::FindRef(const TObject */*obj*/, Short_t &/*Collection*/,
+			 Int_t &/*Index*/) const {
+    //
+    // Find collection id and index of the given object. Returns kFALSE
+    // if the object is not part of this event. To be implemented by
+    // the derived event classes
+    //
+    return kFALSE;
+}
+
+//____________________________________________________________________
+
+HepEvent* HepEvent::GetCurrentEvent() {
+    //
+    // Return the event against which event-local references
+    // (HepEventRef) of the calling thread are resolved by default
+    //
+    return gHepCurrentEvent;
+}
+
+//____________________________________________________________________
+
+void HepEvent::SetCurrentEvent(HepEvent *evt) {
+    //
+    // Set the event against which event-local references
+    // (HepEventRef) of the calling thread are resolved by default
+    //
+    gHepCurrentEvent = evt;
+}
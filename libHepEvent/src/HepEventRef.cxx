@@ -0,0 +1,91 @@
+//____________________________________________________________________
+//
+// Event-local reference to an object of a HEP event
+//
+// Light-weight replacement of TRef for links between objects stored
+// in the TClonesArrays of the same event (eg. the daughter tracks and
+// the decay vertex of a reconstructed K0s decay). Instead of a
+// process-wide unique object id the reference keeps the id of the
+// collection and the index of the object inside that collection. It
+// is resolved through the owning event (see HepEvent::GetRefObject()
+// and HepEvent::FindRef()), ie. no TProcessID table is needed and
+// creating or reading a reference does not touch any global state.
+//
+// If no event is given, the current event of the calling thread is
+// used (see HepEvent::SetCurrentEvent()). A reference is only
+// meaningful within the event it has been created in.
+//
+// Usage:
+// ======
+// HepEventRef ref;
+// if ( !ref.Set(trk) ) { ... } // trk is not part of the current event
+// AtlIDTrack *trk2 = (AtlIDTrack*)ref.GetObject();
+//
+#ifndef HEP_HepEventRef
+#include <HepEventRef.h>
+#endif
+#ifndef HEP_HepEvent
+#include <HepEvent.h>
+#endif
+
+#ifndef __CINT__
+ClassImp(HepEventRef);
+#endif
+
+//____________________________________________________________________
+
+HepEventRef::HepEventRef() {
+    //
+    // Default constructor
+    //
+    Clear();
+}
+
+//____________________________________________________________________
+
+HepEventRef::HepEventRef(TObject *obj, const HepEvent *evt) {
+    //
+    // Normal constructor
+    //
+    Set(obj, evt);
+}
+
+//____________________________________________________________________
+
+HepEventRef::~HepEventRef() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+Bool_t HepEventRef::Set(TObject *obj, const HepEvent *evt) {
+    //
+    // Point to the given object. The object is looked up in the
+    // collections of the given event (default: current event).
+    // Returns kFALSE and leaves the reference invalid if the object
+    // is not part of the event
+    //
+    Clear();
+    if ( evt == 0 ) evt = HepEvent::GetCurrentEvent();
+    if ( obj == 0 || evt == 0 ) return kFALSE;
+    if ( !evt->FindRef(obj, fCollection, fIndex) ) {
+	Clear();
+	return kFALSE;
+    }
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+TObject* HepEventRef::GetObject(const HepEvent *evt) const {
+    //
+    // Return the referenced object of the given event (default:
+    // current event). Returns 0 if the reference is not valid
+    //
+    if ( !IsValid() ) return 0;
+    if ( evt == 0 ) evt = HepEvent::GetCurrentEvent();
+    if ( evt == 0 ) return 0;
+    return evt->GetRefObject(fCollection, fIndex);
+}
@@ -19,9 +19,9 @@ HepK0sDecay::HepK0sDecay() {
     //
     // Default constructor
     //
-    fDaughter1 = new TRef;
-    fDaughter2 = new TRef;
-    fVtx       = new TRef;
+    fDaughter1 = 0;
+    fDaughter2 = 0;
+    fVtx       = 0;
 
     fFit_Daughter1.Clear();
     fFit_Daughter2.Clear();
@@ -38,9 +38,10 @@ HepK0sDecay::HepK0sDecay(Int_t Id, Float_t Px, Float_t Py, Float_t Pz,
     //
     // Normal constructor
     //
-    fDaughter1 = new TRef; *fDaughter1 = Daughter1;
-    fDaughter2 = new TRef; *fDaughter2 = Daughter2;
-    fVtx       = new TRef; *fVtx       = (TObject*)DecayVtx;
+    // The TRefs are only created if needed (see SetRef())
+    fDaughter1 = 0; SetRef(fDaughter1Ref, fDaughter1, Daughter1);
+    fDaughter2 = 0; SetRef(fDaughter2Ref, fDaughter2, Daughter2);
+    fVtx       = 0; SetRef(fVtxRef, fVtx, (TObject*)DecayVtx);
     fFit_Daughter1 = Fit_Daughter1;
     fFit_Daughter2 = Fit_Daughter2;
     TVector3 d = PrimaryVtx->GetPos() - DecayVtx->GetPos();
@@ -68,6 +69,9 @@ void HepK0sDecay::Clear(Option_t *option) {
     delete fDaughter1; fDaughter1 = 0;
     delete fDaughter2; fDaughter2 = 0;
     delete fVtx;       fVtx       = 0;
+    fDaughter1Ref.Clear();
+    fDaughter2Ref.Clear();
+    fVtxRef.Clear();
     fDecayLength = 0.;
 }
 
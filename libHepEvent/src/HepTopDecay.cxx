@@ -22,9 +22,9 @@ HepTopDecay::HepTopDecay() {
     //
     // Default constructor
     //
-    fWDecay   = new TRef;
-    fBJetOrig = new TRef;
-    fTruthTop = new TRef;
+    fWDecay   = 0;
+    fBJetOrig = 0;
+    fTruthTop = 0;
 }
 
 //____________________________________________________________________
@@ -38,11 +38,12 @@ HepTopDecay::HepTopDecay(Int_t Id, Float_t Px_T, Float_t Py_T, Float_t Pz_T,
     //
     // Normal constructor
     //
-    fWDecay   = new TRef;
-    fBJetOrig = new TRef;
-    fTruthTop = new TRef;
-    *fWDecay   = (TObject*)WDecay;
-    *fBJetOrig = (TObject*)BJetOrig;
+    // The TRefs are only created if needed (see SetRef())
+    fWDecay   = 0;
+    fBJetOrig = 0;
+    fTruthTop = 0;
+    SetRef(fWDecayRef,   fWDecay,   (TObject*)WDecay);
+    SetRef(fBJetOrigRef, fBJetOrig, (TObject*)BJetOrig);
     fP_BJet.SetPxPyPzE(Px_j, Py_j, Pz_j, E_j);
     fMode = mode;
 }
@@ -69,6 +70,9 @@ void HepTopDecay::Clear(Option_t *option) {
     delete fWDecay;   fWDecay   = 0;
     delete fBJetOrig; fBJetOrig = 0;
     delete fTruthTop; fTruthTop = 0;
+    fWDecayRef.Clear();
+    fBJetOrigRef.Clear();
+    fTruthTopRef.Clear();
     fP_BJet.SetPxPyPzE(0, 0, 1, 0);
 }
 
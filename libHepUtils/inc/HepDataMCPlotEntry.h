@@ -0,0 +1,34 @@
+#ifndef HEP_HepDataMCPlotEntry
+#define HEP_HepDataMCPlotEntry
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <vector>
+
+class TKey;
+
+class HepDataMCPlotEntry : public TNamed {
+
+  private:
+    std::vector<TKey*> fKeys;   //! Key of the histogram in each input file (0 = not contained)
+    Int_t              fNFiles; //! No. of input files containing the histogram
+    ULong64_t          fInputHash; //! Hash of the histogram contents in all input files
+
+  public:
+    HepDataMCPlotEntry(const char* name = "", const char* path = "");
+    virtual ~HepDataMCPlotEntry();
+    void SetKey(Int_t FileIndex, TKey *key);
+
+    inline TKey* GetKey(Int_t FileIndex) const {
+	return ( FileIndex >= 0 && FileIndex < (Int_t)fKeys.size() )
+	    ? fKeys[FileIndex] : 0;
+    }
+    inline Int_t GetNFiles() const { return fNFiles; }
+    inline const char* GetPath() const { return GetTitle(); }
+    inline ULong64_t GetInputHash() const { return fInputHash; }
+    inline void SetInputHash(ULong64_t hash) { fInputHash = hash; }
+
+    ClassDef(HepDataMCPlotEntry,0) // Catalogue entry of a DATA/MC plot
+};
+#endif
+
@@ -11,6 +11,9 @@
 #ifndef HEP_HepDataMCFolder
 #include <HepDataMCFolder.h>
 #endif
+#ifndef HEP_HepDataMCPlotEntry
+#include <HepDataMCPlotEntry.h>
+#endif
 #ifndef HEP_HepNtuplePlotCmd
 #include <HepNtuplePlotCmd.h>
 #endif
@@ -32,8 +35,13 @@
 #ifndef TStyle
 #include <TStyle.h>
 #endif
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 class TFile;
+class TH1;
 class TKey;
 class TSystem;
 class HepDataMCSample;
@@ -45,16 +53,24 @@ class TObjArray;
 class HepDataMCPlotter : public TTask {
 
   private:
+    struct KeyRef {
+	Long64_t            fSeek;  // Position of the key in the file
+	HepDataMCPlotEntry *fEntry; // Plot entry
+	TKey               *fKey;   // Key of the histogram
+    };
+
     TFile   *fOutputRootFile;      // Output file containing all plots 
 
     TList   *fListOfDataFileNames; // List of data file names
     TList   *fListOfDataFiles;     // List of data files pointers
-    TList   *fListOfPlots;         // List of DataMC plots
+    TList   *fListOfPlots;         // List of DataMC plots (HepDataMCPlotEntry objects)
     TList   *fListOfInFiles;       // List of all input files
     TList   *fNtuplePlotCmds;      // List of ntuple draw commands used by the plotter tasks
     TList   *fMCSamples;           // List of MC samples (input filenames and drawing attributes)
     TList   *fMCSingleSamples;     // List of MC single samples, not belonging to folder (input filenames and drawing attributes)
     TList   *fMCFolders;           // List of folders to group MC samples
+    std::unordered_map<std::string, HepDataMCPlotEntry*> fPlotCatalogue; //! Plots hashed by "path/name"
+    std::unordered_map<const TFile*, Int_t> fInFileIndex; //! Index of each input file in the plot catalogue
 
     Float_t  fLumiDATA;                // Integrated DATA luminosity (used for over-all normalisation)
     TString *fExportDir;               // Working directory
@@ -79,6 +95,10 @@ class HepDataMCPlotter : public TTask {
     Bool_t   fDrawSignalOverlay;       // Flag for drawing the signal MC (assumed to be the least entry in the MC histogram stack) as overlay instead as part of the stack (default = false)
     Float_t  fScaleOverlay;            // Scale factor of the overlay histogram ( default = 1. )
     Bool_t   fDrawSignificance;        // Draw significance panel
+    Int_t    fNWorkers;                // No. of worker processes for building and exporting the plots (0 = sequential)
+    Int_t    fNPlotsPerBatch;          // No. of plots pre-read and distributed to the workers at a time
+    std::unordered_map<const TNamed*, std::vector<TH1*> > fHistCache; //! Pre-read histograms per plot and input file
+    Bool_t   fIncremental;             // Rebuild only plots with changed input histograms or options (see SetIncremental())
     
   public:
     HepDataMCPlotter(const char* name, const char* title);
@@ -164,6 +184,10 @@ class HepDataMCPlotter : public TTask {
     void SetDrawSignalOverlay(Bool_t status);
     void SetScaleOverlay(Float_t scale);
     inline void SetDrawSignificance(Bool_t b = kTRUE) { fDrawSignificance = b;}
+    void SetNWorkers(Int_t NWorkers, Int_t NPlotsPerBatch = 1000);
+    inline Int_t GetNWorkers() const { return fNWorkers; }
+    inline void SetIncremental(Bool_t Incremental = kTRUE) { fIncremental = Incremental; }
+    inline Bool_t IsIncremental() const { return fIncremental; }
     void SetUseAtlasStyle(Bool_t UseAtlasStyle = kTRUE) { 
 	//
 	// Draw plot in ATLAS style
@@ -189,8 +213,30 @@ class HepDataMCPlotter : public TTask {
     inline TString  GetLuminosityLabel(){ return fLuminosityLabel;}
         
   private:
-    void ReadHistogramsFromDir(TDirectory *dir);
+    void ReadHistogramsFromDir(TDirectory *dir, Int_t FileIndex);
     void BuildListOfPlots();
+    void ExecParallel(const std::vector<TNamed*> &plots,
+		      std::vector<Bool_t> &ok);
+    Bool_t MergeRootPart(TDirectory *from, TDirectory *to);
+    void SortKeysByPosition(const std::vector<HepDataMCPlotEntry*> &entries,
+			    std::vector< std::vector<KeyRef> > &keys) const;
+    void PreReadHistograms(const std::vector<TNamed*> &plots,
+			   Int_t first, Int_t last);
+    void ComputeInputHashes();
+    ULong64_t GetOptionsHash() const;
+    TString GetManifestName() const;
+    void ReadManifest(std::unordered_map<std::string, ULong64_t> &manifest) const;
+    void WriteManifest(const std::vector< std::pair<std::string, ULong64_t> > &records) const;
+    static ULong64_t HashBytes(const void *buf, Long64_t len,
+			       ULong64_t hash = 14695981039346656037ULL);
+    void ClearHistCache();
+    Bool_t ProcessPlot(TNamed *PlotName, Bool_t ExportROOT,
+		       Bool_t ExportGraphics, Bool_t ExportLegend);
+    void ExportPlot(HepDataMCPlot *Plot, TNamed *PlotName, Bool_t ExportROOT,
+		    Bool_t ExportGraphics, Bool_t ExportLegend);
+    inline Bool_t HasGraphicsExport() const {
+	return fExportEPS || fExportPS || fExportPDF || fExportPNG || fExportC;
+    }
     HepDataMCPlot* BuildPlot(TNamed *PlotName);
     TDirectory* MkDirWithParents(TFile *f, const char* dir);
     void Normalize(TH1F &h, HepDataMCSample *sample, Float_t LumiScale = 1.) const;
@@ -201,7 +247,7 @@ class HepDataMCPlotter : public TTask {
 		   HepDataMCFolder *folder = 0,
 		   Float_t LumiScale = 1.) const;
 
-    ClassDef(HepDataMCPlotter,3) // DATA/MC plotter
+    ClassDef(HepDataMCPlotter,5) // DATA/MC plotter
 };
 #endif
 
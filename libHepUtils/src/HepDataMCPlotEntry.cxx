@@ -0,0 +1,62 @@
+//____________________________________________________________________
+//
+// Catalogue entry of a DATA/MC plot
+//
+// Used by HepDataMCPlotter for the list of plots. Name and title of
+// the entry are the histogram name and its path inside the input
+// files (same convention as the plain TNamed entries used before).
+// In addition the entry keeps the key of the histogram in each input
+// file containing it, such that the histogram can be read without
+// searching the file again. The keys are owned by the (open) input
+// files and are not streamed.
+//
+// Usage:
+// ======
+// HepDataMCPlotEntry *entry = new HepDataMCPlotEntry("h_pt", "/MyTool/Jets");
+// entry->SetKey(ifile, key);
+// ...
+// TKey *key = entry->GetKey(ifile);
+// if ( key != 0 ) h = (TH1*)key->ReadObj();
+//
+#ifndef HEP_HepDataMCPlotEntry
+#include <HepDataMCPlotEntry.h>
+#endif
+#include <TKey.h>
+
+#ifndef __CINT__
+ClassImp(HepDataMCPlotEntry);
+#endif
+
+//____________________________________________________________________
+
+HepDataMCPlotEntry::HepDataMCPlotEntry(const char* name, const char* path) :
+    TNamed(name, path) {
+    //
+    // Default constructor
+    //
+    fNFiles = 0;
+    fInputHash = 0;
+}
+
+//____________________________________________________________________
+
+HepDataMCPlotEntry::~HepDataMCPlotEntry() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotEntry::SetKey(Int_t FileIndex, TKey *key) {
+    //
+    // Set the key of the histogram in the input file with the given
+    // index. In case of several cycles the highest one is kept
+    //
+    if ( FileIndex < 0 ) return;
+    if ( FileIndex >= (Int_t)fKeys.size() ) fKeys.resize(FileIndex+1, 0);
+    TKey *old = fKeys[FileIndex];
+    if ( old != 0 && old->GetCycle() >= key->GetCycle() ) return;
+    if ( old == 0 ) fNFiles++;
+    fKeys[FileIndex] = key;
+}
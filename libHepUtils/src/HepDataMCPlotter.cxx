@@ -44,6 +44,25 @@
 // graphical files an additional file containing only the legend is
 // created in toplevel export directory under the name Legend.eps etc.
 //
+// Parallel mode: Building and drawing a large number of plots takes
+// long. With SetNWorkers() the building and export of the plots is
+// distributed to several worker processes (ROOT graphics is not
+// thread-safe). The histograms are pre-read in batches, file by file
+// in the order of their position inside the file; the workers then
+// build and export their share of the batch. Each worker writes its
+// plots into a part of the .root output file, which the main process
+// merges into the output file. Output names and contents do not
+// depend on the number of workers.
+//
+// Incremental mode: With SetIncremental() the export directory is
+// kept and a manifest ($ExportDir/$Name.manifest) records for each
+// plot a hash of the contents of all contributing input histograms
+// and of the plot options (samples, cross-sections, drawing and export
+// flags). A plot is rebuilt only if its hash differs from the one of
+// the previous run; a summary of rebuilt and reused plots is printed.
+// The .root output file is updated in place. Ntuple plots are always
+// rebuilt.
+//
 // Example 1 (ungrouped histograms):
 // {
 //     HepDataMCPlotter *pl = new HepDataMCPlotter("single-top", "Single-Top Analysis");
@@ -113,6 +132,7 @@
 #include <TStyle.h>
 #include <TObjString.h>
 #include <TCanvas.h>
+#include <TClass.h>
 #include <TROOT.h>
 #include <TObjectTable.h> 
 #include <TLegendEntry.h>
@@ -121,6 +141,12 @@
 #include <TFeldmanCousins.h>
 #include <TStyle.h>
 #include <TTree.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace std;
 
@@ -167,6 +193,9 @@ HepDataMCPlotter::HepDataMCPlotter(const char* name, const char* title) :
     fDrawSignalOverlay = kFALSE;
     fScaleOverlay = 1.;
     fDrawSignificance = kFALSE;
+    fNWorkers = 0;
+    fNPlotsPerBatch = 1000;
+    fIncremental = kFALSE;
 }
 
 //____________________________________________________________________
@@ -177,7 +206,7 @@ HepDataMCPlotter::~HepDataMCPlotter() {
     //
     fListOfDataFileNames->Delete(); delete fListOfDataFileNames;
     fListOfDataFiles->Delete();     delete fListOfDataFiles;
-    delete fListOfPlots;
+    fListOfPlots->Delete(); delete fListOfPlots;
     delete fListOfInFiles;
     fMCSamples->Delete(); delete fMCSamples;
     fMCFolders->Delete(); delete fMCFolders;
@@ -323,6 +352,7 @@ void HepDataMCPlotter::InitInput() {
 	// of using HepDataMCPlotter::Exec() this routine must be 
 	// called first explicitly.
 	//
+    fInFileIndex.clear(); // keys of the plot catalogue refer to the previous input files
     if ( fListOfDataFileNames != 0 ) {
 	TIter next_file(fListOfDataFileNames);
 	TNamed *file = 0;
@@ -399,9 +429,44 @@ void HepDataMCPlotter::Exec(Option_t *option) {
     // Build the list of plots
     BuildListOfPlots();
 
+    // Select the plots to be built. In incremental mode the plots
+    // whose input hash is unchanged w.r.t. the manifest of the
+    // previous run are skipped
+    std::vector<TNamed*> plots;
+    std::vector< std::pair<std::string, ULong64_t> > records;
+    std::vector< std::pair<std::string, ULong64_t> > new_records;
+    Int_t nreused = 0;
+    if ( fIncremental ) {
+	std::unordered_map<std::string, ULong64_t> manifest;
+	TString outfile = Form("%s/%s.root", fExportDir->Data(), GetName());
+	gSystem->ExpandPathName(outfile);
+	if ( !fExportROOT || !gSystem->AccessPathName(outfile.Data()) )
+	    ReadManifest(manifest);
+	ComputeInputHashes();
+	ULong64_t options = GetOptionsHash();
+	TIter next_plot(fListOfPlots);
+	HepDataMCPlotEntry *entry = 0;
+	while ( (entry = (HepDataMCPlotEntry*)next_plot()) ) {
+	    std::string id = std::string(entry->GetPath()) + "/" + entry->GetName();
+	    ULong64_t hash = HashBytes(&options, sizeof(options), entry->GetInputHash());
+	    std::unordered_map<std::string, ULong64_t>::const_iterator it = manifest.find(id);
+	    if ( it != manifest.end() && it->second == hash ) {
+		records.push_back(std::make_pair(id, hash));
+		nreused++;
+	    } else {
+		new_records.push_back(std::make_pair(id, hash));
+		plots.push_back(entry);
+	    }
+	}
+    } else {
+	TIter next_plot(fListOfPlots);
+	TNamed *pname = 0;
+	while ( (pname = (TNamed*)next_plot()) ) plots.push_back(pname);
+    }
+
     // Save a backup copy of the output directory in case the export
-    // directory already exists
-    if ( !gSystem->AccessPathName(gSystem
+    // directory already exists (not in incremental mode)
+    if ( !fIncremental && !gSystem->AccessPathName(gSystem
 				  ->ExpandPathName(fExportDir
 						   ->Data())) ) {
 	Info("Exec", "Save backup copy of export directory \"%s\"",
@@ -415,40 +480,41 @@ void HepDataMCPlotter::Exec(Option_t *option) {
 			   path2.Data()));
 	gSystem->Exec(Form("rm -fr  %s", fExportDir->Data()));
     }
-    gSystem->Exec(Form("mkdir  %s", fExportDir->Data()));
+    gSystem->Exec(Form("mkdir -p %s", fExportDir->Data()));
 
-    // Open .root output file for writing
+    // Open .root output file for writing (update in incremental mode)
     if ( fExportROOT ) {
 	if ( fOutputRootFile != 0 ) delete fOutputRootFile;
 	fOutputRootFile = new TFile(Form("%s/%s.root",
 					 fExportDir->Data(),
-					 GetName()), "recreate");
+					 GetName()),
+				    ( fIncremental ) ? "update" : "recreate");
     }
     
     // Loop over the list of plot names and build all plots and export
     // them
-    TIter next_plot(fListOfPlots);
-    TNamed *pname = 0;
-    TString qcdtool = TString("/QCDMMTool");
-    while ( (pname = (TNamed*)next_plot()) ) {
-	if ( qcdtool.EqualTo(pname->GetTitle()) ) {
-	    Warning(__FUNCTION__, "Using hardcoded tool name to skip "
-		    "histograms created only in QCDMMTool");
-	    continue; 
-	} // SK ugly hack
-	if ( gDebug > 0 ) {
-	    Info(__FUNCTION__, "Start building of plot %s %s",
-		 pname->GetName(), pname->GetTitle());
+    std::vector<Bool_t> ok(plots.size(), kFALSE);
+    if ( fNWorkers > 0 && ( HasGraphicsExport() || fExportROOT ) ) {
+	ExecParallel(plots, ok);
+    } else {
+	for ( size_t i = 0; i < plots.size(); i++ ) {
+	    ok[i] = ProcessPlot(plots[i], fExportROOT, kTRUE, kTRUE);
 	}
-        HepDataMCPlot *pl = BuildPlot(pname);  
-	if ( pl == 0 ) continue;
- 	if ( gDebug > 0 ) {
-	    Info(__FUNCTION__, "Created plot %s %s",
-		 pl->GetName(), pl->GetTitle());
+    }
+    if ( fIncremental ) {
+	// Only successfully built plots are marked as up to date, the
+	// failed ones are rebuilt in the next run
+	Int_t nfailed = 0;
+	for ( size_t i = 0; i < plots.size(); i++ ) {
+	    if ( ok[i] ) {
+		records.push_back(new_records[i]);
+	    } else {
+		nfailed++;
+	    }
 	}
- 	Export(pl, pname);   
- 	delete pl->GetHistDATA();
- 	delete pl;
+	WriteManifest(records);
+	Info("Exec", "Rebuilt %d plot(s), reused %d unchanged plot(s), %d failed plot(s)",
+	     (Int_t)plots.size() - nfailed, nreused, nfailed);
     }
 
     // Loop over the list of ntuple plot commands and create plots
@@ -472,6 +538,7 @@ void HepDataMCPlotter::Exec(Option_t *option) {
     while ( (infile = (TFile*)next_infile()) ) {
 	infile->Close();
     }
+    fInFileIndex.clear();
 
     // Close output .root file
     delete fOutputRootFile; fOutputRootFile = 0;
@@ -485,31 +552,473 @@ void HepDataMCPlotter::Exec(Option_t *option) {
 
 //____________________________________________________________________
 
+Bool_t HepDataMCPlotter::ProcessPlot(TNamed *PlotName, Bool_t ExportROOT,
+				     Bool_t ExportGraphics, Bool_t ExportLegend) {
+    //
+    // Build the given plot, export it (see ExportPlot()) and delete
+    // it again. Returns kFALSE if the plot could not be built
+    //
+    TString qcdtool = TString("/QCDMMTool");
+    if ( qcdtool.EqualTo(PlotName->GetTitle()) ) {
+	Warning(__FUNCTION__, "Using hardcoded tool name to skip "
+		"histograms created only in QCDMMTool");
+	return kTRUE;
+    } // SK ugly hack
+    if ( gDebug > 0 ) {
+	Info(__FUNCTION__, "Start building of plot %s %s",
+	     PlotName->GetName(), PlotName->GetTitle());
+    }
+    HepDataMCPlot *pl = BuildPlot(PlotName);
+    if ( pl == 0 ) return kFALSE;
+    if ( gDebug > 0 ) {
+	Info(__FUNCTION__, "Created plot %s %s",
+	     pl->GetName(), pl->GetTitle());
+    }
+    ExportPlot(pl, PlotName, ExportROOT, ExportGraphics, ExportLegend);
+    delete pl->GetHistDATA();
+    delete pl;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::ExecParallel(const std::vector<TNamed*> &plots,
+				    std::vector<Bool_t> &ok) {
+    //
+    // Build and export the given plots of the catalogue with
+    // fNWorkers worker processes (see SetNWorkers())
+    //
+    // The plots are processed in batches of fNPlotsPerBatch. For each
+    // batch all histograms are pre-read file by file in the order of
+    // their position inside the file. Then the workers are forked; a
+    // worker builds every fNWorkers-th plot of the batch from its
+    // (copy-on-write) copy of the pre-read histograms and exports it
+    // to the graphics formats and to its own part of the .root output
+    // file ($ExportDir/$Name.part<worker>.root). Separate processes
+    // are used since ROOT graphics is not thread-safe. The output file
+    // names do not depend on the worker, the legend files are written
+    // by the worker of the last plot only (same result as in
+    // sequential mode). The parent process only merges the parts into
+    // the .root output file (see MergeRootPart()).
+    //
+    // Each worker reports the indices of its successfully exported
+    // plots through a pipe. On return ok[i] is set for every plot
+    // which has been built and exported completely; plots of crashed
+    // workers or of parts which cannot be merged count as failed.
+    //
+    Int_t nplots = plots.size();
+    Int_t nbatch = ( fNPlotsPerBatch > 0 ) ? fNPlotsPerBatch : nplots;
+    Int_t nfailed = 0;
+    ok.assign(nplots, kFALSE);
+    Info(__FUNCTION__, "Build %d plots using %d worker processes",
+	 nplots, fNWorkers);
+    for ( Int_t first = 0; first < nplots; first += nbatch ) {
+	Int_t last = TMath::Min(first + nbatch, nplots);
+	Info(__FUNCTION__, "Processing plots %d-%d of %d", first+1, last, nplots);
+	PreReadHistograms(plots, first, last);
+
+	// Fork workers
+	cout.flush(); cerr.flush();
+	fflush(stdout); fflush(stderr);
+	std::vector<pid_t> workers;
+	std::vector<int> fds;
+	std::vector<TString> parts;
+	for ( Int_t w = 0; w < fNWorkers; w++ ) {
+	    TString part = Form("%s/%s.part%d.root", fExportDir->Data(),
+				GetName(), w);
+	    gSystem->ExpandPathName(part);
+	    int fd[2];
+	    if ( pipe(fd) != 0 ) {
+		Error(__FUNCTION__, "Could not create pipe for worker %d. Abort!", w);
+		gSystem->Abort(0);
+	    }
+	    pid_t pid = fork();
+	    if ( pid < 0 ) {
+		Error(__FUNCTION__, "Could not fork worker process. Abort!");
+		gSystem->Abort(0);
+	    }
+	    if ( pid == 0 ) {
+		// Worker process: build and export its share of the
+		// batch, report the successful plots and leave without
+		// any ROOT clean-up (the parent still owns the open
+		// files)
+		close(fd[0]);
+		Int_t status = 0;
+		TFile *partfile = 0;
+		if ( fExportROOT ) {
+		    partfile = new TFile(part.Data(), "recreate");
+		    if ( partfile->IsZombie() ) _exit(1);
+		    fOutputRootFile = partfile;
+		}
+		std::vector<Int_t> done;
+		for ( Int_t i = first + w; i < last; i += fNWorkers ) {
+		    if ( ProcessPlot(plots[i], fExportROOT,
+				     kTRUE, (i == nplots-1)) ) {
+			done.push_back(i);
+		    } else {
+			status = 1;
+		    }
+		}
+		// The plots are reported only once the part is complete
+		if ( partfile != 0 ) partfile->Close();
+		for ( size_t k = 0; k < done.size(); k++ ) {
+		    if ( write(fd[1], &done[k], sizeof(Int_t)) != sizeof(Int_t) )
+			status = 1;
+		}
+		close(fd[1]);
+		cout.flush(); cerr.flush();
+		fflush(stdout); fflush(stderr);
+		_exit(status);
+	    }
+	    close(fd[1]);
+	    workers.push_back(pid);
+	    fds.push_back(fd[0]);
+	    parts.push_back(part);
+	}
+
+	// Collect the reports and wait for all workers of this batch
+	std::vector<Bool_t> reported(nplots, kFALSE);
+	for ( size_t w = 0; w < workers.size(); w++ ) {
+	    Int_t i = 0;
+	    while ( read(fds[w], &i, sizeof(i)) == sizeof(i) ) {
+		if ( i >= first && i < last ) reported[i] = kTRUE;
+	    }
+	    close(fds[w]);
+	    int status = 0;
+	    if ( waitpid(workers[w], &status, 0) < 0
+		 || !WIFEXITED(status) || WEXITSTATUS(status) != 0 ) nfailed++;
+	}
+
+	// Merge the parts of the .root output file
+	for ( size_t w = 0; w < workers.size(); w++ ) {
+	    Bool_t merged = kTRUE;
+	    if ( fExportROOT ) {
+		TFile *partfile = TFile::Open(parts[w].Data());
+		if ( partfile == 0 || partfile->IsZombie() ) {
+		    Error(__FUNCTION__, "Cannot open output part %s of worker %d",
+			  parts[w].Data(), (Int_t)w);
+		    merged = kFALSE;
+		} else {
+		    merged = MergeRootPart(partfile, fOutputRootFile);
+		}
+		delete partfile;
+		gSystem->Unlink(parts[w].Data());
+	    }
+	    for ( Int_t i = first + w; i < last; i += fNWorkers )
+		ok[i] = reported[i] && merged;
+	}
+	ClearHistCache();
+    }
+    if ( nfailed > 0 ) {
+	Warning(__FUNCTION__, "%d worker processes reported missing or failed plots",
+		nfailed);
+    }
+}
+
+//____________________________________________________________________
+
+Bool_t HepDataMCPlotter::MergeRootPart(TDirectory *from, TDirectory *to) {
+    //
+    // Copy all plots of the given directory of an output part
+    // written by a worker (see ExecParallel()) into the given
+    // directory of the .root output file, including all
+    // sub-directories. The plots are copied as they are, they are
+    // not built again. Returns kFALSE if an object cannot be read
+    //
+    Bool_t ok = kTRUE;
+    TIter next_key(from->GetListOfKeys());
+    TKey *key = 0;
+    while ( (key = (TKey*)next_key()) ) {
+	TClass *cl = TClass::GetClass(key->GetClassName());
+	if ( cl != 0 && cl->InheritsFrom(TDirectory::Class()) ) {
+	    TDirectory *subdir = to->GetDirectory(key->GetName());
+	    if ( subdir == 0 ) subdir = to->mkdir(key->GetName());
+	    ok = MergeRootPart(from->GetDirectory(key->GetName()), subdir) && ok;
+	    continue;
+	}
+	TObject *obj = key->ReadObj();
+	if ( obj == 0 ) {
+	    Error(__FUNCTION__, "Cannot read %s from %s", key->GetName(),
+		  from->GetPath());
+	    ok = kFALSE;
+	    continue;
+	}
+	to->WriteTObject(obj, key->GetName(), ( fIncremental ) ? "Overwrite" : "");
+	delete obj;
+    }
+    return ok;
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::SortKeysByPosition(const std::vector<HepDataMCPlotEntry*> &entries,
+					  std::vector< std::vector<KeyRef> > &keys) const {
+    //
+    // Collect the keys of the given plot entries per input file,
+    // sorted by their position inside the file (such that each file
+    // is read sequentially)
+    //
+    Int_t nfiles = fInFileIndex.size();
+    keys.assign(nfiles, std::vector<KeyRef>());
+    for ( size_t i = 0; i < entries.size(); i++ ) {
+	for ( Int_t f = 0; f < nfiles; f++ ) {
+	    TKey *key = entries[i]->GetKey(f);
+	    if ( key != 0 ) keys[f].push_back({ key->GetSeekKey(), entries[i], key });
+	}
+    }
+    for ( Int_t f = 0; f < nfiles; f++ ) {
+	std::sort(keys[f].begin(), keys[f].end(),
+		  [](const KeyRef &a, const KeyRef &b) { return a.fSeek < b.fSeek; });
+    }
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::PreReadHistograms(const std::vector<TNamed*> &plots,
+					 Int_t first, Int_t last) {
+    //
+    // Read the histograms of the plots first, ..., last-1 of the
+    // given list from all input files into the histogram cache. The
+    // input files are read one after another and inside each file the
+    // keys are read in the order of their position in the file
+    //
+    Int_t nfiles = fInFileIndex.size();
+    std::vector<HepDataMCPlotEntry*> entries;
+    for ( Int_t i = first; i < last; i++ ) {
+	HepDataMCPlotEntry *entry = dynamic_cast<HepDataMCPlotEntry*>(plots[i]);
+	if ( entry == 0 ) continue;
+	fHistCache[entry].assign(nfiles, 0);
+	entries.push_back(entry);
+    }
+    std::vector< std::vector<KeyRef> > keys;
+    SortKeysByPosition(entries, keys);
+    for ( Int_t f = 0; f < nfiles; f++ ) {
+	for ( size_t k = 0; k < keys[f].size(); k++ ) {
+	    fHistCache[keys[f][k].fEntry][f] = dynamic_cast<TH1*>(keys[f][k].fKey->ReadObj());
+	}
+    }
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::ClearHistCache() {
+    //
+    // Delete all pre-read histograms which have not been used
+    //
+    std::unordered_map<const TNamed*, std::vector<TH1*> >::iterator it;
+    for ( it = fHistCache.begin(); it != fHistCache.end(); ++it ) {
+	for ( size_t f = 0; f < it->second.size(); f++ ) delete it->second[f];
+    }
+    fHistCache.clear();
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::ComputeInputHashes() {
+    //
+    // Compute the input hash of all plots of the catalogue from the
+    // (compressed) contents of their histograms in all input files.
+    // The key headers (containing the time stamp of the file) do not
+    // enter. The files are read one after another and inside each file
+    // the keys are read in the order of their position in the file
+    //
+    Int_t nfiles = fInFileIndex.size();
+    std::vector<HepDataMCPlotEntry*> entries;
+    TIter next_plot(fListOfPlots);
+    HepDataMCPlotEntry *entry = 0;
+    while ( (entry = (HepDataMCPlotEntry*)next_plot()) ) {
+	entry->SetInputHash(HashBytes(0, 0));
+	entries.push_back(entry);
+    }
+    std::vector< std::vector<KeyRef> > keys;
+    SortKeysByPosition(entries, keys);
+    std::vector<char> buf;
+    for ( Int_t f = 0; f < nfiles; f++ ) {
+	for ( size_t k = 0; k < keys[f].size(); k++ ) {
+	    TKey *key = keys[f][k].fKey;
+	    Int_t len = key->GetNbytes() - key->GetKeylen();
+	    buf.resize(TMath::Max(len, 1));
+	    ULong64_t hash = keys[f][k].fEntry->GetInputHash();
+	    hash = HashBytes(&f, sizeof(f), hash);
+	    if ( key->GetFile()->ReadBuffer(buf.data(),
+					    key->GetSeekKey() + key->GetKeylen(),
+					    len) ) {
+		// Unreadable: make sure the plot is rebuilt
+		Warning(__FUNCTION__, "Could not read key %s from file %s",
+			key->GetName(), key->GetFile()->GetName());
+		hash = HashBytes(&key, sizeof(key), hash);
+	    } else {
+		hash = HashBytes(buf.data(), len, hash);
+	    }
+	    keys[f][k].fEntry->SetInputHash(hash);
+	}
+    }
+}
+
+//____________________________________________________________________
+
+ULong64_t HepDataMCPlotter::GetOptionsHash() const {
+    //
+    // Hash of all settings entering the building and export of the
+    // plots (luminosity, labels, export and drawing flags, samples
+    // and folders)
+    //
+    TString opt;
+    opt.Append(Form("%g|%s|%s|%s|", fLumiDATA, fAtlasLabelStatus.Data(),
+		    fCenterOfMassEnergyLabel.Data(), fLuminosityLabel.Data()));
+    opt.Append(Form("%d%d%d%d%d%d|", fExportROOT, fExportEPS, fExportPS,
+		    fExportPDF, fExportPNG, fExportC));
+    opt.Append(Form("%d%d%d%d%d%d%d%d%d%d%d|%g|", fDrawLegend, fGroupHistograms,
+		    fUnifyMCStack, fDrawMCError, fDrawDataZeroEntryErrors,
+		    fLogyaxis, fDrawCMSLumiAtlasLabel, fUseAtlasStyle,
+		    fUseOverflowUnderflow, fDrawSignalOverlay, fDrawSignificance,
+		    fScaleOverlay));
+    TIter next_data(fListOfDataFileNames);
+    TObject *data = 0;
+    while ( (data = next_data()) ) opt.Append(Form("D:%s|", data->GetName()));
+    TIter next_folder(fMCFolders);
+    HepDataMCFolder *folder = 0;
+    HepDataMCSample *sample = 0;
+    while ( (folder = (HepDataMCFolder*)next_folder()) ) {
+	opt.Append(Form("F:%s|%s|%d|%d|%d|%d|%g|", folder->GetName(),
+			folder->GetTitle(), folder->GetAttFill().GetFillColor(),
+			folder->GetAttFill().GetFillStyle(),
+			folder->GetAttLine().GetLineStyle(),
+			folder->GetAttLine().GetLineWidth(),
+			folder->GetNormUncertainty()));
+	TIter next_sample(folder->GetMCSamples());
+	while ( (sample = (HepDataMCSample*)next_sample()) ) {
+	    opt.Append(Form("S:%s|%s|%g|%g|%g|%d|%d|%d|%d|", sample->GetName(),
+			    sample->GetTitle(), sample->GetXsection(),
+			    sample->GetNEvents(), sample->GetLumi(),
+			    sample->GetAttFill().GetFillColor(),
+			    sample->GetAttFill().GetFillStyle(),
+			    sample->GetAttLine().GetLineStyle(),
+			    sample->GetAttLine().GetLineWidth()));
+	}
+    }
+    TIter next_sample(fMCSamples);
+    while ( (sample = (HepDataMCSample*)next_sample()) ) {
+	opt.Append(Form("S:%s|%s|%g|%g|%g|%d|%d|%d|%d|", sample->GetName(),
+			sample->GetTitle(), sample->GetXsection(),
+			sample->GetNEvents(), sample->GetLumi(),
+			sample->GetAttFill().GetFillColor(),
+			sample->GetAttFill().GetFillStyle(),
+			sample->GetAttLine().GetLineStyle(),
+			sample->GetAttLine().GetLineWidth()));
+    }
+    return HashBytes(opt.Data(), opt.Length());
+}
+
+//____________________________________________________________________
+
+TString HepDataMCPlotter::GetManifestName() const {
+    //
+    // Name of the manifest file of the incremental mode
+    //
+    TString fname = Form("%s/%s.manifest", fExportDir->Data(), GetName());
+    gSystem->ExpandPathName(fname);
+    return fname;
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::ReadManifest(std::unordered_map<std::string, ULong64_t> &manifest) const {
+    //
+    // Read the plot hashes of the previous run from the manifest
+    // file (if existing)
+    //
+    std::ifstream in(GetManifestName().Data());
+    if ( !in ) {
+	Info(__FUNCTION__, "No manifest found. Build all plots");
+	return;
+    }
+    std::string line;
+    while ( std::getline(in, line) ) {
+	if ( line.empty() || line[0] == '#' ) continue;
+	size_t pos = line.find(' ');
+	if ( pos == std::string::npos ) continue;
+	manifest[line.substr(pos+1)] = std::strtoull(line.substr(0, pos).c_str(), 0, 16);
+    }
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::WriteManifest(const std::vector< std::pair<std::string, ULong64_t> > &records) const {
+    //
+    // Write the plot hashes of this run to the manifest file. One line
+    // per plot: "<hash (hex)> <path>/<name>"
+    //
+    std::ofstream out(GetManifestName().Data());
+    if ( !out ) {
+	Error(__FUNCTION__, "Could not write manifest file %s",
+	      GetManifestName().Data());
+	return;
+    }
+    out << "# HepDataMCPlotter " << GetName() << ": input hash per plot" << endl;
+    for ( size_t i = 0; i < records.size(); i++ ) {
+	out << std::hex << records[i].second << std::dec
+	    << " " << records[i].first << endl;
+    }
+}
+
+//____________________________________________________________________
+
+ULong64_t HepDataMCPlotter::HashBytes(const void *buf, Long64_t len, ULong64_t hash) {
+    //
+    // 64-bit FNV-1a hash of the given buffer, continuing the given
+    // hash value
+    //
+    const unsigned char *p = (const unsigned char*)buf;
+    for ( Long64_t i = 0; i < len; i++ ) {
+	hash ^= p[i];
+	hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+//____________________________________________________________________
+
 void HepDataMCPlotter::BuildListOfPlots() {
     //
-    // Loop over all histograms in the DATA file (if exisiting) or the
-    // 1st MC file otherwise and create a list containg the names of
-    // all plots
+    // Loop over all histograms in all input files and create a list
+    // containing the names of all plots. The plots are kept in a
+    // hashed catalogue which records for each plot the key of its
+    // histogram in every input file. Each file is scanned only once
     //
+    fListOfPlots->Delete();
+    fPlotCatalogue.clear();
+    fInFileIndex.clear();
     TFile *infile = 0;
     TIter next_infile(fListOfInFiles);
     while ( (infile = (TFile*)next_infile()) ) {
+	if ( fInFileIndex.count(infile) > 0 ) continue; // file listed twice
+	Int_t index = fInFileIndex.size();
+	fInFileIndex[infile] = index;
 	if ( gDebug > 0 ) {
 	    Info("BuildListOfPlots", "Processing input file %s", infile->GetName());
 	}
-	ReadHistogramsFromDir(infile);
+	ReadHistogramsFromDir(infile, index);
     }
+    Info("BuildListOfPlots", "Found %d plots in %d input files",
+	 fListOfPlots->GetEntries(), (Int_t)fInFileIndex.size());
 }
 	
 //____________________________________________________________________
 
-void HepDataMCPlotter::ReadHistogramsFromDir(TDirectory *dir) {
+void HepDataMCPlotter::ReadHistogramsFromDir(TDirectory *dir, Int_t FileIndex) {
     //
     // Read all histograms from given directory
-    // and all its sub-directories
+    // and all its sub-directories of the input file with the given
+    // index in the plot catalogue
+    //
+    // Sub-directories are read via TDirectory::GetDirectory(). They
+    // stay attached to the input file, such that the keys recorded in
+    // the catalogue remain valid until the file is closed.
     //
     dir->cd();
     if ( gDebug > 0 ) Info("ReadHistogramsFromDir", "cd %s", dir->GetName());
+    TString path = HepDataMCPlot::GetPathInsideFile(dir);
 
     TIter next_key(dir->GetListOfKeys());
     TKey *key = 0;
@@ -529,27 +1038,21 @@ void HepDataMCPlotter::ReadHistogramsFromDir(TDirectory *dir) {
 
 	if ( strcmp(key->GetClassName(), "TDirectoryFile") == 0 ) {
 	    // Change into sub-directory
-	    TDirectoryFile *dir = (TDirectoryFile*)key->ReadObj();
-	    ReadHistogramsFromDir(dir);
-	    delete dir;
+	    TDirectory *subdir = dir->GetDirectory(key->GetName());
+	    if ( subdir != 0 ) ReadHistogramsFromDir(subdir, FileIndex);
 	} else if ( (strcmp(key->GetClassName(), "TH1F") == 0)
 		    || (strcmp(key->GetClassName(), "TH1D") == 0) ) {
 	    // Add name and path of 1-dim histogram to list of plots
 	    // if the plot has not been added before already
-	    TString path = HepDataMCPlot::GetPathInsideFile(dir);
-	    
-	    Bool_t alreadyInList = kFALSE;
-	    TIter next_plot(fListOfPlots);
-	    while(TNamed* pl = (TNamed*)next_plot()){
-		if((strcmp(pl->GetName(),key->GetName()) == 0) &&
-		   (strcmp(pl->GetTitle(),path.Data()) == 0))
-		  alreadyInList = kTRUE;
-	    }
-	    if (!alreadyInList) {
-		fListOfPlots->Add(new TNamed(key->GetName(), path.Data()));
+	    std::string id = Form("%s/%s", path.Data(), key->GetName());
+	    HepDataMCPlotEntry *&entry = fPlotCatalogue[id];
+	    if ( entry == 0 ) {
+		entry = new HepDataMCPlotEntry(key->GetName(), path.Data());
+		fListOfPlots->Add(entry);
 		if ( gDebug > 0 ) Info("ReadHistogramsFromDir",
                                        "Add plot %s, %s", key->GetName(), path.Data());
 	    }
+	    entry->SetKey(FileIndex, key);
 	}
     }
 }
@@ -557,8 +1060,28 @@ void HepDataMCPlotter::ReadHistogramsFromDir(TDirectory *dir) {
 //____________________________________________________________________
 
 TH1F* HepDataMCPlotter::GetHistFromFile(TFile *f, TNamed *PlotName) {
+    //
+    // Read the histogram of the given plot from the given input
+    // file. For plots from the catalogue (see BuildListOfPlots()) the
+    // pre-read histogram or the recorded key is used directly,
+    // otherwise the histogram is searched by its path
+    //
     TH1 * h = 0;
-    f->GetObject(Form("%s/%s", PlotName->GetTitle(), PlotName->GetName()), h);
+    HepDataMCPlotEntry *entry = dynamic_cast<HepDataMCPlotEntry*>(PlotName);
+    std::unordered_map<const TFile*, Int_t>::const_iterator it = fInFileIndex.find(f);
+    if ( entry != 0 && it != fInFileIndex.end() ) {
+	// Take over pre-read histogram (see PreReadHistograms())
+	std::unordered_map<const TNamed*, std::vector<TH1*> >::iterator
+	    cached = fHistCache.find(entry);
+	if ( cached != fHistCache.end() ) {
+	    h = cached->second[it->second];
+	    cached->second[it->second] = 0;
+	}
+	TKey *key = entry->GetKey(it->second);
+	if ( h == 0 && key != 0 ) h = dynamic_cast<TH1*>(key->ReadObj());
+    } else {
+	f->GetObject(Form("%s/%s", PlotName->GetTitle(), PlotName->GetName()), h);
+    }
     if ( !h ) {
         if ( gDebug > 0 )
             Warning(__FUNCTION__, "Plot named %s/%s not found in file %s.",
@@ -742,6 +1265,20 @@ void HepDataMCPlotter::Export(HepDataMCPlot *Plot, TNamed *PlotName) {
     // Export the given plot to the .root output file and to the file
     // system in various graphical formats
     //
+    ExportPlot(Plot, PlotName, fExportROOT, kTRUE, kTRUE);
+}
+
+//____________________________________________________________________
+
+void HepDataMCPlotter::ExportPlot(HepDataMCPlot *Plot, TNamed *PlotName,
+				  Bool_t ExportROOT, Bool_t ExportGraphics,
+				  Bool_t ExportLegend) {
+    //
+    // Export the given plot to the .root output file (if ExportROOT
+    // is set) and to the file system in the graphical formats chosen
+    // (if ExportGraphics is set). The legend files in the top-level
+    // export directory are written only if ExportLegend is set
+    //
     
     // Set drawing of MC errors
     Plot->SetDrawMCError(fDrawMCError, kFALSE);
@@ -754,7 +1291,7 @@ void HepDataMCPlotter::Export(HepDataMCPlot *Plot, TNamed *PlotName) {
     
     // Export to .root file
     TDirectory *dir = 0;
-    if ( fExportROOT ) {
+    if ( ExportROOT ) {
 	dir = (TDirectory*)fOutputRootFile
 	    ->FindObject(PlotName->GetTitle());
 	if ( dir == 0 )
@@ -770,13 +1307,13 @@ void HepDataMCPlotter::Export(HepDataMCPlot *Plot, TNamed *PlotName) {
 	    while ( (h = (TH1F*)next_hist()) ) {   
 		h->SetDirectory(dir);
 	    }
-	    Plot->Write();  
+	    Plot->Write(0, ( fIncremental ) ? TObject::kOverwrite : 0);
 	}
     }
     
     // Create a new (corresponding) directory on the file system
     TString fullpath;
-    if ( fExportEPS || fExportPS || fExportPDF || fExportPNG || fExportC ) {
+    if ( ExportGraphics && HasGraphicsExport() ) {
 	fullpath.Append(fExportDir->Data());
 	fullpath.Append(PlotName->GetTitle());
 	gSystem->Exec(Form("mkdir -p %s", fullpath.Data()));
@@ -802,19 +1339,21 @@ void HepDataMCPlotter::Export(HepDataMCPlot *Plot, TNamed *PlotName) {
         c->SaveAs(Form("%s/%s.C",   fullpath.Data(), Plot->GetName()));  
         
         // Export graphics file(s) containing the legend
-        Plot->DrawLegend();
-        Plot->DrawLegendPad();
+	if ( ExportLegend ) {
+	    Plot->DrawLegend();
+	    Plot->DrawLegendPad();
 	    if ( fExportEPS )
-	    c->SaveAs(Form("%s/Legend.eps", fExportDir->Data()));
+		c->SaveAs(Form("%s/Legend.eps", fExportDir->Data()));
 	    if ( fExportPS )
-	    c->SaveAs(Form("%s/Legend.ps",  fExportDir->Data()));
+		c->SaveAs(Form("%s/Legend.ps",  fExportDir->Data()));
 	    if ( fExportPDF )
-	    c->SaveAs(Form("%s/Legend.pdf", fExportDir->Data()));
+		c->SaveAs(Form("%s/Legend.pdf", fExportDir->Data()));
 	    if ( fExportPNG )
 		c->SaveAs(Form("%s/Legend.png", fExportDir->Data()));
 	    if ( fExportC )
 		c->SaveAs(Form("%s/Legend.C",   fExportDir->Data()));
-	    
+	}
+	
 	    // Clean-up of canvas
 	    delete c; 
     }
@@ -843,7 +1382,7 @@ TDirectory* HepDataMCPlotter::MkDirWithParents(TFile *f, const char* dir) {
     TIter next_dir(subdirs);
     TObjString *subdir = 0;
     while ( (subdir = (TObjString*)next_dir()) ) {
-	if ( gDirectory->FindObject(subdir->GetString().Data()) == 0 ) {
+	if ( gDirectory->GetDirectory(subdir->GetString().Data()) == 0 ) {
 	    gDirectory->mkdir(subdir->GetString().Data());
 	}
 	gDirectory->cd(subdir->GetString().Data());
@@ -1082,6 +1621,22 @@ HepDataMCPlot* HepDataMCPlotter::BuildNtuplePlot(HepNtuplePlotCmd *cmd) const {
 
 //____________________________________________________________________
 
+void HepDataMCPlotter::SetNWorkers(Int_t NWorkers, Int_t NPlotsPerBatch) {
+    //
+    // Build and export the plots with the given number of worker
+    // processes (0 = sequential, default). The plots are distributed
+    // to the workers in batches of NPlotsPerBatch plots; all input
+    // histograms of a batch are kept in memory at the same time.
+    // Every worker writes its own part of the .root output file,
+    // hence some temporary disk space is needed in the export
+    // directory
+    //
+    fNWorkers = TMath::Max(NWorkers, 0);
+    fNPlotsPerBatch = NPlotsPerBatch;
+}
+
+//____________________________________________________________________
+
 void HepDataMCPlotter::SetUseOverflowUnderflow(Bool_t status) {
     //
     // Set flag for drawing the under- and overflow bins
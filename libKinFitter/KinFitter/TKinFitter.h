@@ -21,6 +21,7 @@ public :
   ~TKinFitter();
   void reset();
   void resetStatus();
+  void resetFit();
 
   Int_t fit();
 
@@ -44,6 +45,12 @@ public :
   Bool_t getParamMeas( Int_t index );
   Bool_t getParamMeas( TAbsFitParticle* particle, Int_t index );
 
+  // Re-use of an existing fit topology (particles and constraints) for new input
+  void setParticle( Int_t index, const TLorentzVector* pini, const TMatrixD* theCovMatrix );
+  void setOwner( Bool_t isOwner = kTRUE ) { _isOwner = isOwner; } // Fitter deletes its particles and constraints
+  Bool_t isOwner() { return _isOwner; }
+  Bool_t hasTopology() { return ( _particles.size() > 0 ); }      // Particles and constraints defined?
+
   static Int_t GetEtaNuRoot( TLorentzVector P, TVector2 pNu, Double_t M,
 			     Double_t &Root1, Double_t &Root2, Double_t &Minimum );
   // helper class for setting starting value of unmeasured eta in topologies with one non interacting particle
@@ -71,6 +78,7 @@ public :
 
   Int_t getNParticles() { return _particles.size(); }                                // Number of particles
   const TAbsFitParticle* getParticle( Int_t index ) { return _particles[index]; }    // Particle with given index
+  TAbsFitConstraint* getConstraint( Int_t index ) { return _constraints[index]; }    // Constraint with given index
   Int_t getParticleIndex( TAbsFitParticle* particle );                               // Index of given particle
   Int_t getParameterIndex( TAbsFitParticle* particle, Int_t aPar );                  // Index of given particles parameter
 
@@ -110,6 +118,7 @@ protected:
   void countMeasParams();
   void countUnmeasParams();
   void resetParams();
+  void deleteTopology();
 
 private :
 
@@ -161,8 +170,9 @@ private :
   Int_t  _status;            // Status of the last fit;_
   Int_t  _nbIter;            // number of iteration performed in the fit
   Bool_t _matrix_inv_failed; // at least one matrix inversion failed numerically
+  Bool_t _isOwner;           // fitter owns (and deletes) its particles and constraints
 
-  ClassDef(TKinFitter, 2) // Class to perform kinematic fit with non-linear constraints
+  ClassDef(TKinFitter, 3) // Class to perform kinematic fit with non-linear constraints
 };
 
 #endif
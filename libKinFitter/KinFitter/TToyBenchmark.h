@@ -0,0 +1,58 @@
+#ifndef TToyBenchmark_h
+#define TToyBenchmark_h
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#ifndef ROOT_TString
+#include <TString.h>
+#endif
+#ifndef ROOT_TMatrixDfwd
+#include <TMatrixDfwd.h>
+#endif
+#include <vector>
+
+class TLorentzVector;
+class TRandom3;
+
+class TToyBenchmark : public TNamed {
+
+  public:
+    static const Double_t fgMW;   // W mass (GeV)
+    static const Double_t fgGW;   // W width (GeV)
+    static const Double_t fgMTop; // Top-quark mass (GeV)
+    static const Double_t fgGTop; // Top-quark width (GeV)
+    static const Double_t fgMB;   // b-quark mass (GeV)
+    static const Double_t fgMMu;  // Muon mass (GeV)
+
+  private:
+    std::vector<TString>  fResNames;     // Names of the results
+    std::vector<Double_t> fResValues;    // Values of the results
+    std::vector<TString>  fResUnits;     // Units of the results
+    std::vector<Double_t> fResRealTimes; // Real time of each result (s)
+    std::vector<Double_t> fResCpuTimes;  // CPU time of each result (s)
+    Bool_t fVerbose;                     // Print each result when added
+
+  public:
+    TToyBenchmark(const char* Name, Bool_t Verbose = kFALSE);
+    virtual ~TToyBenchmark();
+    void AddResult(const char* Name, Double_t Value, const char* Unit,
+		   Double_t RealTime = 0., Double_t CpuTime = 0.);
+    Bool_t WriteResults(const char* FileName, const char* Config) const;
+    Int_t CompareResults(const char* RefFile, Double_t Tolerance,
+			 Double_t Precision = -1.) const;
+    inline Int_t GetNResults() const { return fResNames.size(); }
+
+    static void Decay(TRandom3 &rnd, const TLorentzVector &parent,
+		      Double_t m1, Double_t m2,
+		      TLorentzVector &d1, TLorentzVector &d2);
+    static TLorentzVector GenParent(TRandom3 &rnd, Double_t M, Double_t PtMean);
+    static void Smear(TRandom3 &rnd, TLorentzVector &p, Double_t M,
+		      Double_t RelPt, Double_t SigEta, Double_t SigPhi,
+		      TMatrixD &cov);
+    static void SmearNu(TRandom3 &rnd, TLorentzVector &p, Double_t RelPt,
+			Double_t SigPhi, TMatrixD &cov);
+    static Bool_t IsThroughput(const char* Unit);
+
+    ClassDef(TToyBenchmark,0) // Toy generation and result bookkeeping of the benchmarks
+};
+#endif
@@ -0,0 +1,618 @@
+//____________________________________________________________________
+//
+// Toy benchmark and validation of the kinematic fitter
+//
+// Headless successor of TToyGentSgTop and TToyGentT. For every fit
+// topology used by the A++ finders (AtlSgTop_tChannelFinder and
+// AtlTopPairFinder, both via AtlKinFitterTool) N toy events are
+// generated. Their measured particles are smeared with the
+// resolutions given to the fitter, and they are fitted using the
+// same TFitParticle parametrisations and constraint types as the
+// finders:
+//
+//   sgtop_gaus   - lepton (PtEtaPhi), neutrino (PtThetaPhi, theta
+//                  unmeasured) and b-jet (PtEtaPhi) with Gaussian W
+//                  and top mass constraints (TFitConstraintMGaus)
+//   sgtop_bw     - the same with Breit-Wigner mass constraints
+//                  (TFitConstraintMBW2)
+//   sgtop_whad   - two jets with Gaussian W mass constraint
+//   ttbar_same   - lepton+jets ttbar with Gaussian W mass
+//                  constraints and equal top masses (TFitConstraintM)
+//   ttbar_fixed  - lepton+jets ttbar with Gaussian W and top mass
+//                  constraints
+//
+// For every topology the fits per second, the mean number of
+// iterations, the convergence rate, the mean chi2 probability and
+// the mean and width of the pulls (fitted - true)/error of all fit
+// parameters are reported. The pulls are computed with respect to
+// the true (unsmeared) parameters, like the "Pull1" histograms of
+// TToyGentT.
+//
+// Every toy event is generated from its own random seed, so all
+// results except for the timings do not depend on the number of
+// worker processes. This allows to check optimisations of the fitter
+// for numerical equivalence by comparing with the results file of a
+// previous release: throughputs must not drop by more than the given
+// tolerance, all other results must agree within the given
+// precision.
+//
+// Usage:
+// ======
+// kinfitter-toys [-n <events>] [-p <workers>] [-s <seed>]
+//                [-o <results file>] [-r <reference file>]
+//                [-x <tolerance>] [-e <precision>]
+//
+//   -n  No. of toy events per topology (default = 20000)
+//   -p  No. of parallel worker processes (default = 1, 0 = all cores)
+//   -s  Random seed (default = 4711)
+//   -o  Results file (default = kinfitter-toys.json)
+//   -r  Results file of a previous release to compare with
+//   -x  Max. allowed relative drop of a throughput (default = 0.1)
+//   -e  Max. allowed relative deviation of all other results
+//       (default = 1e-6)
+//
+#include <TKinFitter.h>
+#include <TAbsFitParticle.h>
+#include <TFitParticlePtEtaPhi.h>
+#include <TFitParticlePtThetaPhi.h>
+#include <TFitConstraintM.h>
+#include <TFitConstraintMBW2.h>
+#include <TFitConstraintMGaus.h>
+#include <TToyBenchmark.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TMatrixD.h>
+#include <TROOT.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include <TVector2.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Kind of the fitted objects (defines parametrisation and resolution)
+enum EObject { kLepton, kNeutrino, kJet };
+
+typedef void (*BuildFunc_t)(TKinFitter&, vector<TAbsFitParticle*>&);
+typedef void (*GenFunc_t)(TRandom3&, vector<TLorentzVector>&);
+
+struct Topology_t {
+    const char*     fName;     // Name of the topology
+    BuildFunc_t     fBuild;    // Set up particles and constraints
+    GenFunc_t       fGen;      // Generate the true 4-vectors
+    vector<EObject> fObjects;  // Kind of the particles (in fit order)
+};
+
+// Layout of the accumulated results of one topology
+enum EAcc {
+    kNFits, kNConv, kNIter, kSumProb, kRealTime, kCpuTime, kRealTimeMax,
+    kNAcc // followed by (n, sum, sum2) of the pulls of all parameters
+};
+
+//____________________________________________________________________
+
+static TLorentzVector GenTop(TRandom3 &rnd) {
+    //
+    // Top quark with Breit-Wigner mass and exponential pt spectrum
+    //
+    Double_t m = TMath::Max(rnd.BreitWigner(TToyBenchmark::fgMTop, TToyBenchmark::fgGTop),
+			    TToyBenchmark::fgMW + TToyBenchmark::fgMB + 1.);
+    return TToyBenchmark::GenParent(rnd, m, 50.);
+}
+
+//____________________________________________________________________
+
+static void GenTopDecay(TRandom3 &rnd, Double_t m1, Double_t m2,
+			TLorentzVector &d1, TLorentzVector &d2, TLorentzVector &b) {
+    //
+    // t -> W b, W -> d1 d2 with Breit-Wigner W mass
+    //
+    TLorentzVector top = GenTop(rnd);
+    Double_t mW = rnd.BreitWigner(TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+    mW = TMath::Min(TMath::Max(mW, m1 + m2 + 1.), top.M() - TToyBenchmark::fgMB - 0.1);
+    TLorentzVector W;
+    TToyBenchmark::Decay(rnd, top, mW, TToyBenchmark::fgMB, W, b);
+    TToyBenchmark::Decay(rnd, W, m1, m2, d1, d2);
+}
+
+//____________________________________________________________________
+
+static void Smear(TRandom3 &rnd, EObject obj, const TLorentzVector &truth,
+		  TLorentzVector &meas, TMatrixD &cov) {
+    //
+    // Smear the true particle in the parameters of its fit
+    // parametrisation and set the covariance matrix accordingly
+    //
+    // The neutrino is given as seen by the finders: only the
+    // transverse momentum is measured, theta is unmeasured
+    //
+    meas = truth;
+    switch ( obj ) {
+    case kLepton:
+	TToyBenchmark::Smear(rnd, meas, truth.M(), 0.02, 1.e-3, 1.e-3, cov);
+	break;
+    case kJet:
+	TToyBenchmark::Smear(rnd, meas, truth.M(), 0.1, 0.05, 0.05, cov);
+	break;
+    case kNeutrino:
+	TToyBenchmark::SmearNu(rnd, meas, 0.2, 0.1, cov);
+	break;
+    }
+}
+
+//____________________________________________________________________
+
+static void SetFitter(TKinFitter &fitter) {
+    //
+    // Fit settings of AtlKinFitterTool
+    //
+    fitter.setOwner();
+    fitter.setMaxNbIter(100);
+    fitter.setMaxDeltaS(5.e-5);
+    fitter.setMaxF(1.e-4);
+    fitter.setVerbosity(0);
+}
+
+//____________________________________________________________________
+
+static void BuildSgTop(TKinFitter &fitter, vector<TAbsFitParticle*> &part,
+		       Bool_t BW) {
+    //
+    // Leptonic top decay of AtlSgTop_tChannelFinder::DoTopFit()
+    //
+    TFitParticlePtEtaPhi   *lep  = new TFitParticlePtEtaPhi("lep", "lep", 0, 0., 0);
+    TFitParticlePtThetaPhi *nu   = new TFitParticlePtThetaPhi("nu", "nu", 0, 0., 0);
+    TFitParticlePtEtaPhi   *bjet = new TFitParticlePtEtaPhi("bjet", "bjet", 0, 0., 0);
+    fitter.addMeasParticle(lep);
+    fitter.addMeasParticle(nu);
+    fitter.setParamUnmeas(nu, 1);
+    fitter.addMeasParticle(bjet);
+    TFitConstraintM *MW = 0;
+    TFitConstraintM *MT = 0;
+    if ( BW ) {
+	MW = new TFitConstraintMBW2("MW", "MW", 0, TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+	MT = new TFitConstraintMBW2("MT", "MT", 0, TToyBenchmark::fgMTop, TToyBenchmark::fgGTop);
+    } else {
+	MW = new TFitConstraintMGaus("MW", "MW", 0, 0, TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+	MT = new TFitConstraintMGaus("MT", "MT", 0, 0, TToyBenchmark::fgMTop, TToyBenchmark::fgGTop);
+    }
+    MW->addParticles1(lep, nu);
+    MT->addParticles1(lep, nu, bjet);
+    fitter.addConstraint(MW);
+    fitter.addConstraint(MT);
+    SetFitter(fitter);
+    part.push_back(lep); part.push_back(nu); part.push_back(bjet);
+}
+
+static void BuildSgTopGaus(TKinFitter &fitter, vector<TAbsFitParticle*> &part) {
+    BuildSgTop(fitter, part, kFALSE);
+}
+
+static void BuildSgTopBW(TKinFitter &fitter, vector<TAbsFitParticle*> &part) {
+    BuildSgTop(fitter, part, kTRUE);
+}
+
+static void GenSgTop(TRandom3 &rnd, vector<TLorentzVector> &p) {
+    p.resize(3);
+    GenTopDecay(rnd, TToyBenchmark::fgMMu, 0., p[0], p[1], p[2]);
+}
+
+//____________________________________________________________________
+
+static void BuildWhad(TKinFitter &fitter, vector<TAbsFitParticle*> &part) {
+    //
+    // Hadronic W decay of AtlSgTop_tChannelFinder::DoWhadFit()
+    //
+    TFitParticlePtEtaPhi *j1 = new TFitParticlePtEtaPhi("j1", "j1", 0, 0., 0);
+    TFitParticlePtEtaPhi *j2 = new TFitParticlePtEtaPhi("j2", "j2", 0, 0., 0);
+    fitter.addMeasParticle(j1);
+    fitter.addMeasParticle(j2);
+    TFitConstraintMGaus *MW = new TFitConstraintMGaus("MW", "MW", 0, 0, TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+    MW->addParticles1(j1, j2);
+    fitter.addConstraint(MW);
+    SetFitter(fitter);
+    part.push_back(j1); part.push_back(j2);
+}
+
+static void GenWhad(TRandom3 &rnd, vector<TLorentzVector> &p) {
+    p.resize(2);
+    TLorentzVector b;
+    GenTopDecay(rnd, 0., 0., p[0], p[1], b);
+}
+
+//____________________________________________________________________
+
+static void BuildTtbar(TKinFitter &fitter, vector<TAbsFitParticle*> &part,
+		       Bool_t SameMass) {
+    //
+    // Lepton+jets ttbar of AtlTopPairFinder (kSameTmass or
+    // kFixedTmass)
+    //
+    TFitParticlePtEtaPhi   *lep  = new TFitParticlePtEtaPhi("lep", "lep", 0, 0., 0);
+    TFitParticlePtThetaPhi *nu   = new TFitParticlePtThetaPhi("nu", "nu", 0, 0., 0);
+    TFitParticlePtEtaPhi   *lepb = new TFitParticlePtEtaPhi("lepb", "lepb", 0, 0., 0);
+    TFitParticlePtEtaPhi   *j1   = new TFitParticlePtEtaPhi("j1", "j1", 0, 0., 0);
+    TFitParticlePtEtaPhi   *j2   = new TFitParticlePtEtaPhi("j2", "j2", 0, 0., 0);
+    TFitParticlePtEtaPhi   *hadb = new TFitParticlePtEtaPhi("hadb", "hadb", 0, 0., 0);
+    fitter.addMeasParticle(lep);
+    fitter.addMeasParticle(nu);
+    fitter.setParamUnmeas(nu, 1);
+    fitter.addMeasParticle(lepb);
+    fitter.addMeasParticle(j1);
+    fitter.addMeasParticle(j2);
+    fitter.addMeasParticle(hadb);
+    TFitConstraintMGaus *MWlep = new TFitConstraintMGaus("MWlep", "MWlep", 0, 0, TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+    TFitConstraintMGaus *MWhad = new TFitConstraintMGaus("MWhad", "MWhad", 0, 0, TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+    MWlep->addParticles1(lep, nu);
+    MWhad->addParticles1(j1, j2);
+    fitter.addConstraint(MWlep);
+    fitter.addConstraint(MWhad);
+    if ( SameMass ) {
+	TFitConstraintM *MT = new TFitConstraintM("MT", "MT", 0, 0, 0.);
+	MT->addParticles1(lep, nu, lepb);
+	MT->addParticles2(j1, j2, hadb);
+	fitter.addConstraint(MT);
+    } else {
+	TFitConstraintMGaus *MTlep = new TFitConstraintMGaus("MTlep", "MTlep", 0, 0, TToyBenchmark::fgMTop, TToyBenchmark::fgGTop);
+	TFitConstraintMGaus *MThad = new TFitConstraintMGaus("MThad", "MThad", 0, 0, TToyBenchmark::fgMTop, TToyBenchmark::fgGTop);
+	MTlep->addParticles1(lep, nu, lepb);
+	MThad->addParticles1(j1, j2, hadb);
+	fitter.addConstraint(MTlep);
+	fitter.addConstraint(MThad);
+    }
+    SetFitter(fitter);
+    part.push_back(lep); part.push_back(nu); part.push_back(lepb);
+    part.push_back(j1);  part.push_back(j2); part.push_back(hadb);
+}
+
+static void BuildTtbarSame(TKinFitter &fitter, vector<TAbsFitParticle*> &part) {
+    BuildTtbar(fitter, part, kTRUE);
+}
+
+static void BuildTtbarFixed(TKinFitter &fitter, vector<TAbsFitParticle*> &part) {
+    BuildTtbar(fitter, part, kFALSE);
+}
+
+static void GenTtbar(TRandom3 &rnd, vector<TLorentzVector> &p) {
+    p.resize(6);
+    GenTopDecay(rnd, TToyBenchmark::fgMMu, 0., p[0], p[1], p[2]);
+    GenTopDecay(rnd, 0., 0., p[3], p[4], p[5]);
+}
+
+//____________________________________________________________________
+
+static vector<Topology_t> GetTopologies() {
+    //
+    // List of all fit topologies
+    //
+    vector<Topology_t> topos;
+    Topology_t t;
+    t.fObjects = { kLepton, kNeutrino, kJet };
+    t.fName = "sgtop_gaus"; t.fBuild = BuildSgTopGaus; t.fGen = GenSgTop;
+    topos.push_back(t);
+    t.fName = "sgtop_bw";   t.fBuild = BuildSgTopBW;   t.fGen = GenSgTop;
+    topos.push_back(t);
+    t.fObjects = { kJet, kJet };
+    t.fName = "sgtop_whad"; t.fBuild = BuildWhad;      t.fGen = GenWhad;
+    topos.push_back(t);
+    t.fObjects = { kLepton, kNeutrino, kJet, kJet, kJet, kJet };
+    t.fName = "ttbar_same"; t.fBuild = BuildTtbarSame; t.fGen = GenTtbar;
+    topos.push_back(t);
+    t.fName = "ttbar_fixed"; t.fBuild = BuildTtbarFixed; t.fGen = GenTtbar;
+    topos.push_back(t);
+    return topos;
+}
+
+//____________________________________________________________________
+
+static const char* GetParName(EObject obj, Int_t i) {
+    //
+    // Name of the i-th fit parameter
+    //
+    static const char* names[2][3] = {
+	{ "pt", "eta", "phi" }, { "pt", "theta", "phi" } };
+    return names[obj == kNeutrino ? 1 : 0][i];
+}
+
+//____________________________________________________________________
+
+static void RunToys(const Topology_t &topo, Int_t ITopo, Long64_t NEvents,
+		    UInt_t Seed, Int_t IWorker, Int_t NWorkers,
+		    vector<Double_t> &acc) {
+    //
+    // Fit all toy events of the given worker (every NWorkers-th
+    // event) and accumulate the results. Only the fit itself is
+    // timed
+    //
+    TKinFitter fitter;
+    vector<TAbsFitParticle*> part;
+    topo.fBuild(fitter, part);
+    Int_t npart = part.size();
+    acc.assign(kNAcc + 9*npart, 0.);
+
+    TRandom3 rnd;
+    vector<TLorentzVector> truth, meas(npart);
+    vector<TMatrixD> cov(npart, TMatrixD(3, 3));
+    TStopwatch watch;
+    watch.Reset();
+    for ( Long64_t i = IWorker; i < NEvents; i += NWorkers ) {
+	// Own seed for every event, independent of the no. of workers
+	UInt_t seed = Seed*2654435761u + ITopo*1000003u + (UInt_t)i;
+	rnd.SetSeed(seed == 0 ? 1 : seed);
+	topo.fGen(rnd, truth);
+	for ( Int_t j = 0; j < npart; j++ ) {
+	    Smear(rnd, topo.fObjects[j], truth[j], meas[j], cov[j]);
+	    fitter.setParticle(j, &meas[j], &cov[j]);
+	}
+	watch.Start(kFALSE);
+	fitter.fit();
+	watch.Stop();
+	acc[kNFits]++;
+	acc[kNIter] += fitter.getNbIter();
+	if ( fitter.getStatus() != 0 ) continue;
+	acc[kNConv]++;
+	acc[kSumProb] += TMath::Prob(fitter.getS(), fitter.getNDF());
+
+	// Pulls w.r.t. the true parameters
+	for ( Int_t j = 0; j < npart; j++ ) {
+	    TMatrixD *partrue = part[j]->transform(truth[j]);
+	    const TMatrixD *parfit = part[j]->getParCurr();
+	    const TMatrixD *covfit = part[j]->getCovMatrixFit();
+	    for ( Int_t k = 0; k < 3; k++ ) {
+		Double_t diff = (*parfit)(k, 0) - (*partrue)(k, 0);
+		if ( k == 2 ) diff = TVector2::Phi_mpi_pi(diff);
+		Double_t pull = diff/TMath::Sqrt((*covfit)(k, k));
+		if ( TMath::IsNaN(pull) || !TMath::Finite(pull) ) continue;
+		Double_t *a = &acc[kNAcc + 9*j + 3*k];
+		a[0]++; a[1] += pull; a[2] += pull*pull;
+	    }
+	    delete partrue;
+	}
+    }
+    acc[kRealTime] = acc[kRealTimeMax] = watch.RealTime();
+    acc[kCpuTime] = watch.CpuTime();
+}
+
+//____________________________________________________________________
+
+static void RunWorker(const vector<Topology_t> &topos, Long64_t NEvents,
+		      UInt_t Seed, Int_t IWorker, Int_t NWorkers,
+		      vector< vector<Double_t> > &acc) {
+    //
+    // Run all topologies for the given worker
+    //
+    acc.resize(topos.size());
+    for ( size_t t = 0; t < topos.size(); t++ )
+	RunToys(topos[t], t, NEvents, Seed, IWorker, NWorkers, acc[t]);
+}
+
+//____________________________________________________________________
+
+static Bool_t RunParallel(const vector<Topology_t> &topos, Long64_t NEvents,
+			  UInt_t Seed, Int_t NWorkers,
+			  vector< vector<Double_t> > &acc) {
+    //
+    // Distribute the toy events to NWorkers forked worker processes
+    // and combine their results. The results are sent back through
+    // pipes as plain arrays of doubles
+    //
+    if ( NWorkers <= 1 ) {
+	RunWorker(topos, NEvents, Seed, 0, 1, acc);
+	return kTRUE;
+    }
+    cout.flush();
+    cerr.flush();
+    vector<pid_t> pids(NWorkers, -1);
+    vector<int> fds(NWorkers, -1);
+    for ( Int_t w = 0; w < NWorkers; w++ ) {
+	int fd[2];
+	if ( pipe(fd) != 0 ) {
+	    ::Error("RunParallel", "Could not create pipe for worker %d", w);
+	    break;
+	}
+	pid_t pid = fork();
+	if ( pid < 0 ) {
+	    ::Error("RunParallel", "Could not fork worker process %d", w);
+	    close(fd[0]); close(fd[1]);
+	    break;
+	}
+	if ( pid == 0 ) {
+	    // Worker
+	    close(fd[0]);
+	    vector< vector<Double_t> > res;
+	    RunWorker(topos, NEvents, Seed, w, NWorkers, res);
+	    vector<Double_t> buf;
+	    for ( auto &r : res ) buf.insert(buf.end(), r.begin(), r.end());
+	    const char *p = (const char*)buf.data();
+	    size_t left = buf.size()*sizeof(Double_t);
+	    while ( left > 0 ) {
+		ssize_t n = write(fd[1], p, left);
+		if ( n <= 0 ) _exit(1);
+		p += n; left -= n;
+	    }
+	    close(fd[1]);
+	    _exit(0);
+	}
+	close(fd[1]);
+	pids[w] = pid;
+	fds[w] = fd[0];
+    }
+
+    // Collect the results
+    Bool_t ok = kTRUE;
+    acc.clear();
+    for ( Int_t w = 0; w < NWorkers; w++ ) {
+	if ( pids[w] < 0 ) { ok = kFALSE; continue; }
+	vector<Double_t> buf;
+	Double_t val[512];
+	ssize_t n, rest = 0;
+	char *p = (char*)val;
+	while ( (n = read(fds[w], p + rest, sizeof(val) - rest)) > 0 ) {
+	    rest += n;
+	    size_t nval = rest/sizeof(Double_t);
+	    buf.insert(buf.end(), val, val + nval);
+	    rest -= nval*sizeof(Double_t);
+	    memmove(p, p + nval*sizeof(Double_t), rest);
+	}
+	close(fds[w]);
+	int status = 0;
+	if ( waitpid(pids[w], &status, 0) < 0 || !WIFEXITED(status)
+	     || WEXITSTATUS(status) != 0 ) {
+	    ::Error("RunParallel", "Worker process %d failed", w);
+	    ok = kFALSE;
+	    continue;
+	}
+
+	// Unpack and add up (max. for the real time of the slowest worker)
+	size_t pos = 0;
+	if ( acc.empty() ) acc.resize(topos.size());
+	for ( size_t t = 0; t < topos.size(); t++ ) {
+	    size_t len = kNAcc + 9*topos[t].fObjects.size();
+	    if ( pos + len > buf.size() ) {
+		::Error("RunParallel", "Incomplete results from worker %d", w);
+		ok = kFALSE;
+		break;
+	    }
+	    if ( acc[t].empty() ) acc[t].assign(len, 0.);
+	    for ( size_t k = 0; k < len; k++ ) {
+		if ( k == kRealTimeMax ) {
+		    acc[t][k] = TMath::Max(acc[t][k], buf[pos+k]);
+		} else {
+		    acc[t][k] += buf[pos+k];
+		}
+	    }
+	    pos += len;
+	}
+    }
+    return ok;
+}
+
+//____________________________________________________________________
+
+static void Summarize(const vector<Topology_t> &topos,
+		      const vector< vector<Double_t> > &acc,
+		      TToyBenchmark &Results) {
+    //
+    // Convert the accumulated results and print them
+    //
+    cout << endl
+	 << "  Topology       fits/s/core  fits/s(all)   <niter>   f(conv)  <P(chi2)>" << endl
+	 << "  ----------------------------------------------------------------------" << endl;
+    for ( size_t t = 0; t < topos.size(); t++ ) {
+	const vector<Double_t> &a = acc[t];
+	string name = topos[t].fName;
+	Double_t nconv = TMath::Max(a[kNConv], 1.);
+	Double_t rate  = ( a[kRealTime] > 0. )    ? a[kNFits]/a[kRealTime] : 0.;
+	Double_t prate = ( a[kRealTimeMax] > 0. ) ? a[kNFits]/a[kRealTimeMax] : 0.;
+	Results.AddResult((name + "_fit").c_str(), rate, "fits/s",
+			  a[kRealTime], a[kCpuTime]);
+	Results.AddResult((name + "_fit_all_cores").c_str(), prate, "fits/s",
+			  a[kRealTimeMax]);
+	Results.AddResult((name + "_iterations").c_str(), a[kNIter]/a[kNFits], "iterations");
+	Results.AddResult((name + "_converged").c_str(), a[kNConv]/a[kNFits], "fraction");
+	Results.AddResult((name + "_chi2prob").c_str(), a[kSumProb]/nconv, "mean");
+	cout << "  " << setw(12) << left << name << right
+	     << setw(13) << setprecision(5) << rate
+	     << setw(13) << setprecision(5) << prate
+	     << setw(10) << setprecision(4) << a[kNIter]/a[kNFits]
+	     << setw(10) << setprecision(4) << a[kNConv]/a[kNFits]
+	     << setw(11) << setprecision(4) << a[kSumProb]/nconv << endl;
+    }
+
+    cout << endl
+	 << "  Pulls (fitted - true)/error          mean     width" << endl
+	 << "  ---------------------------------------------------" << endl;
+    for ( size_t t = 0; t < topos.size(); t++ ) {
+	TKinFitter fitter;
+	vector<TAbsFitParticle*> part;
+	topos[t].fBuild(fitter, part);
+	for ( size_t j = 0; j < part.size(); j++ ) {
+	    for ( Int_t k = 0; k < 3; k++ ) {
+		const Double_t *a = &acc[t][kNAcc + 9*j + 3*k];
+		if ( a[0] < 2. ) continue;
+		Double_t mean  = a[1]/a[0];
+		Double_t width = TMath::Sqrt(TMath::Max(a[2]/a[0] - mean*mean, 0.));
+		string name = Form("%s_pull_%s_%s", topos[t].fName, part[j]->GetName(),
+				   GetParName(topos[t].fObjects[j], k));
+		Results.AddResult((name + "_mean").c_str(), mean, "mean");
+		Results.AddResult((name + "_width").c_str(), width, "width");
+		cout << "  " << setw(32) << left << name.substr(0, 32) << right
+		     << setw(9) << setprecision(3) << mean
+		     << setw(10) << setprecision(3) << width << endl;
+	    }
+	}
+    }
+}
+
+//____________________________________________________________________
+
+int main(int argc, char **argv) {
+    //
+    // Main program
+    //
+    Long64_t nevents = 20000;
+    Int_t nworkers = 1;
+    UInt_t seed = 4711;
+    TString results = "kinfitter-toys.json";
+    TString reference;
+    Double_t tolerance = 0.1, precision = 1.e-6;
+    int c;
+    while ( (c = getopt(argc, argv, "n:p:s:o:r:x:e:")) != -1 ) {
+	switch ( c ) {
+	case 'n': nevents = strtoll(optarg, 0, 10); break;
+	case 'p': nworkers = atoi(optarg); break;
+	case 's': seed = strtoul(optarg, 0, 10); break;
+	case 'o': results = optarg; break;
+	case 'r': reference = optarg; break;
+	case 'x': tolerance = atof(optarg); break;
+	case 'e': precision = atof(optarg); break;
+	default:
+	    cerr << "Usage: " << argv[0]
+		 << " [-n <events>] [-p <workers>] [-s <seed>] [-o <results file>]"
+		 << " [-r <reference file>] [-x <tolerance>] [-e <precision>]" << endl;
+	    return 2;
+	}
+    }
+    if ( nworkers == 0 ) {
+	SysInfo_t info;
+	gSystem->GetSysInfo(&info);
+	nworkers = TMath::Max(info.fCpus, 1);
+    }
+    if ( nevents <= 0 || nworkers < 0 ) {
+	cerr << argv[0] << ": invalid configuration" << endl;
+	return 2;
+    }
+    gROOT->SetBatch(kTRUE);
+
+    vector<Topology_t> topos = GetTopologies();
+    vector< vector<Double_t> > acc;
+    cout << endl << "  Fitting " << nevents << " toy events per topology with "
+	 << nworkers << " worker(s)" << endl;
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    if ( !RunParallel(topos, nevents, seed, nworkers, acc) ) return 1;
+    watch.Stop();
+
+    TToyBenchmark res("kinfitter-toys");
+    Summarize(topos, acc, res);
+    cout << endl << "  Total wall time " << setprecision(4) << watch.RealTime()
+	 << " s" << endl;
+
+    TString config = Form("\"events\": %lld, \"workers\": %d, \"seed\": %u",
+			  nevents, nworkers, seed);
+    if ( !res.WriteResults(results.Data(), config.Data()) ) return 1;
+    cout << "  Results written to " << results << endl;
+    if ( !reference.IsNull()
+	 && res.CompareResults(reference.Data(), tolerance, precision) > 0 ) {
+	return 1;
+    }
+    return 0;
+}
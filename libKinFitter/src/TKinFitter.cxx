@@ -57,7 +57,8 @@ TKinFitter::TKinFitter():
   _yaVFit(1, 1),
   _constraints(0),
   _particles(0),
-  _paramMeasured(0)
+  _paramMeasured(0),
+  _isOwner(false)
 {
 
   reset();
@@ -97,7 +98,8 @@ TKinFitter::TKinFitter(const TString &name, const TString &title):
   _yaVFit(1, 1),
   _constraints(0),
   _particles(0),
-  _paramMeasured(0)
+  _paramMeasured(0),
+  _isOwner(false)
 {
 
   reset();
@@ -142,6 +144,7 @@ void TKinFitter::reset() {
   _lambdaVFit.ResizeTo(1, 1);
   _yaVFit.ResizeTo(1, 1);
 
+  deleteTopology();
   _constraints.clear();
   _particles.clear();
   _paramMeasured.clear();
@@ -161,6 +164,49 @@ void TKinFitter::resetStatus() {
 
 }
 
+void TKinFitter::resetFit() {
+  // reset status and fit results but keep the fit topology
+  // (particles, constraints, measured/unmeasured parameters)
+  // and the fit settings. Use together with setParticle() to
+  // re-use one fitter for many combinations of the same topology
+
+  resetStatus();
+  resetParams();
+  _matrix_inv_failed = false;
+
+}
+
+void TKinFitter::setParticle( Int_t index, const TLorentzVector* pini, const TMatrixD* theCovMatrix ) {
+  // Re-target the particle with the given index to a new initial
+  // 4-vector and covariance matrix. The particle object and all
+  // constraints referring to it are kept
+
+  if ( index < 0 || index >= (Int_t) _particles.size() ) {
+    cout << "TKinFitter::setParticle - Particle index " << index << " out of range." << endl;
+    return;
+  }
+  TAbsFitParticle* particle = _particles[index];
+  particle->setIni4Vec( pini );
+  particle->setCovMatrix( theCovMatrix );
+  particle->reset();
+
+}
+
+void TKinFitter::deleteTopology() {
+  // delete all particles and constraints if the fitter owns them
+
+  if ( !_isOwner ) return;
+  for (UInt_t iC = 0; iC < _constraints.size(); iC++) {
+    delete _constraints[iC];
+  }
+  for (UInt_t iP = 0; iP < _particles.size(); iP++) {
+    delete _particles[iP];
+  }
+  _constraints.clear();
+  _particles.clear();
+
+}
+
 void TKinFitter::resetParams() {
   // reset all particles and contraints to their 
   // initial parameter values
@@ -179,6 +225,8 @@ void TKinFitter::resetParams() {
 
 TKinFitter::~TKinFitter() {
 
+  deleteTopology();
+
 }
 
 void TKinFitter::countMeasParams() {
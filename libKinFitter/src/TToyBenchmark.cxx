@@ -0,0 +1,273 @@
+//____________________________________________________________________
+//
+// Toy generation and result bookkeeping of the benchmarks
+//
+// Common part of the kinematic-fit and event-loop benchmarks
+// (kinfitter-toys, aplusplus-benchmark and the macro
+// benchmark_topologies.C):
+//
+//   - masses and widths used for the toy events,
+//   - generation of toy decays (GenParent(), Decay()) and smearing
+//     of the measured particles in the parametrisations used by the
+//     A++ finders (Smear(), SmearNu()),
+//   - the list of results, written as JSON file with one result per
+//     line (WriteResults()) and compared with the results file of a
+//     previous release (CompareResults()).
+//
+// All random numbers are taken from the given generator in a fixed
+// order, so the toy events depend on its seed only.
+//
+// Usage:
+// ======
+// TToyBenchmark bench("kinfitter-toys");
+// TLorentzVector top = TToyBenchmark::GenParent(rnd, TToyBenchmark::fgMTop, 50.);
+// ...
+// bench.AddResult("sgtop_gaus_fit", nfits/time, "fits/s");
+// bench.WriteResults("kinfitter-toys.json", "\"events\": 20000");
+// if ( bench.CompareResults("reference.json", 0.1, 1.e-6) > 0 ) ...
+//
+#ifndef TToyBenchmark_h
+#include "KinFitter/TToyBenchmark.h"
+#endif
+#include <TDatime.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TMatrixD.h>
+#include <TROOT.h>
+#include <TRandom3.h>
+#include <TSystem.h>
+#include <TVector2.h>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(TToyBenchmark);
+#endif
+
+const Double_t TToyBenchmark::fgMW   = 80.385;
+const Double_t TToyBenchmark::fgGW   = 2.085;
+const Double_t TToyBenchmark::fgMTop = 172.5;
+const Double_t TToyBenchmark::fgGTop = 1.33;
+const Double_t TToyBenchmark::fgMB   = 4.8;
+const Double_t TToyBenchmark::fgMMu  = 0.1057;
+
+//____________________________________________________________________
+
+TToyBenchmark::TToyBenchmark(const char* Name, Bool_t Verbose) :
+    TNamed(Name, "Benchmark results") {
+    //
+    // Default constructor. The name is written as name of the
+    // benchmark into the results file. In verbose mode every result
+    // is printed when added
+    //
+    fVerbose = Verbose;
+}
+
+//____________________________________________________________________
+
+TToyBenchmark::~TToyBenchmark() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void TToyBenchmark::AddResult(const char* Name, Double_t Value,
+			      const char* Unit, Double_t RealTime,
+			      Double_t CpuTime) {
+    //
+    // Store result
+    //
+    fResNames.push_back(Name);
+    fResValues.push_back(Value);
+    fResUnits.push_back(Unit);
+    fResRealTimes.push_back(RealTime);
+    fResCpuTimes.push_back(CpuTime);
+    if ( fVerbose ) {
+	cout << "  " << setw(36) << left << Name << right
+	     << setw(14) << setprecision(6) << Value << " " << Unit << endl;
+    }
+}
+
+//____________________________________________________________________
+
+Bool_t TToyBenchmark::IsThroughput(const char* Unit) {
+    //
+    // Results given per second are throughputs (higher is better)
+    //
+    return TString(Unit).EndsWith("/s");
+}
+
+//____________________________________________________________________
+
+Bool_t TToyBenchmark::WriteResults(const char* FileName,
+				   const char* Config) const {
+    //
+    // Write results as JSON file with one result per line. Config
+    // is written as is into the "config" object
+    //
+    ofstream out(FileName);
+    if ( !out ) {
+	Error("WriteResults", "Cannot open results file %s", FileName);
+	return kFALSE;
+    }
+    TDatime now;
+    out << "{" << endl
+	<< "  \"benchmark\": \"" << GetName() << "\"," << endl
+	<< "  \"date\": \"" << now.AsSQLString() << "\"," << endl
+	<< "  \"host\": \"" << gSystem->HostName() << "\"," << endl
+	<< "  \"root\": \"" << gROOT->GetVersion() << "\"," << endl
+	<< "  \"config\": {" << Config << "}," << endl
+	<< "  \"results\": [" << endl;
+    for ( Int_t i = 0; i < GetNResults(); i++ ) {
+	out << "    {\"name\": \"" << fResNames[i] << "\", \"value\": "
+	    << setprecision(12) << fResValues[i] << ", \"unit\": \""
+	    << fResUnits[i] << "\", \"real_s\": " << fResRealTimes[i]
+	    << ", \"cpu_s\": " << fResCpuTimes[i] << "}"
+	    << ( i+1 < GetNResults() ? "," : "" ) << endl;
+    }
+    out << "  ]" << endl << "}" << endl;
+    return kTRUE;
+}
+
+//____________________________________________________________________
+
+Int_t TToyBenchmark::CompareResults(const char* RefFile, Double_t Tolerance,
+				    Double_t Precision) const {
+    //
+    // Compare with the results file of a previous run (same
+    // configuration). Throughputs may not drop by more than
+    // Tolerance. All other results must agree within Precision; they
+    // are not compared for Precision < 0 (eg. if they depend on the
+    // machine). Returns the number of failed comparisons
+    //
+    ifstream in(RefFile);
+    if ( !in ) {
+	Error("CompareResults", "Cannot open reference file %s", RefFile);
+	return 1;
+    }
+    map<string, Double_t> ref;
+    string line;
+    while ( getline(in, line) ) {
+	size_t n = line.find("\"name\": \"");
+	size_t v = line.find("\"value\": ");
+	if ( n == string::npos || v == string::npos ) continue;
+	n += 9;
+	ref[line.substr(n, line.find('"', n) - n)] = atof(line.c_str() + v + 9);
+    }
+
+    Int_t nfail = 0;
+    cout << endl << "  Comparison with " << RefFile << ":" << endl;
+    for ( Int_t i = 0; i < GetNResults(); i++ ) {
+	Bool_t speed = IsThroughput(fResUnits[i].Data());
+	if ( !speed && Precision < 0. ) continue;
+	map<string, Double_t>::const_iterator it = ref.find(fResNames[i].Data());
+	if ( it == ref.end() ) {
+	    cout << "  " << setw(44) << left << fResNames[i] << right
+		 << "  not in reference" << endl;
+	    continue;
+	}
+	Bool_t fail = kFALSE;
+	if ( speed ) {
+	    fail = ( it->second > 0. && fResValues[i] < (1. - Tolerance)*it->second );
+	} else {
+	    fail = ( TMath::Abs(fResValues[i] - it->second)
+		     > Precision*(TMath::Abs(it->second) + 1.) );
+	}
+	if ( !fail && !speed ) continue;
+	if ( fail ) nfail++;
+	cout << "  " << setw(44) << left << fResNames[i] << right
+	     << setw(14) << setprecision(8) << fResValues[i]
+	     << setw(14) << setprecision(8) << it->second;
+	if ( speed && it->second > 0. )
+	    cout << setw(8) << setprecision(3) << fResValues[i]/it->second;
+	cout << ( fail ? ( speed ? "  REGRESSION" : "  DIFFERS" ) : "" ) << endl;
+    }
+    if ( nfail == 0 ) cout << "  All results compatible." << endl;
+    return nfail;
+}
+
+//____________________________________________________________________
+
+void TToyBenchmark::Decay(TRandom3 &rnd, const TLorentzVector &parent,
+			  Double_t m1, Double_t m2,
+			  TLorentzVector &d1, TLorentzVector &d2) {
+    //
+    // Isotropic two-body decay
+    //
+    Double_t M = parent.M();
+    Double_t p = TMath::Sqrt(TMath::Max((M*M - (m1+m2)*(m1+m2))*(M*M - (m1-m2)*(m1-m2)), 0.))/(2.*M);
+    Double_t theta = TMath::ACos(rnd.Uniform(-1., 1.));
+    Double_t phi   = rnd.Uniform(-TMath::Pi(), TMath::Pi());
+    TVector3 v;
+    v.SetMagThetaPhi(p, theta, phi);
+    d1.SetVectM(v, m1);
+    d2.SetVectM(-v, m2);
+    d1.Boost(parent.BoostVector());
+    d2.Boost(parent.BoostVector());
+}
+
+//____________________________________________________________________
+
+TLorentzVector TToyBenchmark::GenParent(TRandom3 &rnd, Double_t M,
+					Double_t PtMean) {
+    //
+    // Parent particle with exponential pt spectrum, flat in eta
+    // (|eta| < 2.5) and phi
+    //
+    Double_t pt  = rnd.Exp(PtMean) + 1.;
+    Double_t eta = rnd.Uniform(-2.5, 2.5);
+    Double_t phi = rnd.Uniform(-TMath::Pi(), TMath::Pi());
+    TLorentzVector p;
+    p.SetPtEtaPhiM(pt, eta, phi, M);
+    return p;
+}
+
+//____________________________________________________________________
+
+void TToyBenchmark::Smear(TRandom3 &rnd, TLorentzVector &p, Double_t M,
+			  Double_t RelPt, Double_t SigEta, Double_t SigPhi,
+			  TMatrixD &cov) {
+    //
+    // Smear particle in (pt, eta, phi) and set the corresponding
+    // diagonal covariance matrix (parametrisation of
+    // TFitParticlePtEtaPhi)
+    //
+    Double_t pt  = TMath::Max(p.Pt()*(1. + rnd.Gaus(0., RelPt)), 0.1);
+    Double_t eta = p.Eta() + rnd.Gaus(0., SigEta);
+    Double_t phi = TVector2::Phi_mpi_pi(p.Phi() + rnd.Gaus(0., SigPhi));
+    p.SetPtEtaPhiM(pt, eta, phi, M);
+    cov.ResizeTo(3, 3);
+    cov.Zero();
+    cov(0, 0) = TMath::Power(RelPt*pt, 2);
+    cov(1, 1) = SigEta*SigEta;
+    cov(2, 2) = SigPhi*SigPhi;
+}
+
+//____________________________________________________________________
+
+void TToyBenchmark::SmearNu(TRandom3 &rnd, TLorentzVector &p, Double_t RelPt,
+			    Double_t SigPhi, TMatrixD &cov) {
+    //
+    // Neutrino as seen by the finders: only the transverse momentum
+    // is measured (parametrisation of TFitParticlePtThetaPhi, theta
+    // unmeasured)
+    //
+    Double_t pt  = TMath::Max(p.Pt()*(1. + rnd.Gaus(0., RelPt)), 1.);
+    Double_t phi = TVector2::Phi_mpi_pi(p.Phi() + rnd.Gaus(0., SigPhi));
+    TVector3 v;
+    v.SetPtThetaPhi(pt, TMath::PiOver2(), phi);
+    p.SetVectM(v, 0.);
+    cov.ResizeTo(3, 3);
+    cov.Zero();
+    cov(0, 0) = TMath::Power(RelPt*pt, 2);
+    cov(1, 1) = 1.;
+    cov(2, 2) = SigPhi*SigPhi;
+}
@@ -0,0 +1,659 @@
+//____________________________________________________________________
+//
+// Benchmark of the A++ event loop
+//
+// A SgTop-D3PD (v31) like MC input file is synthesised with the
+// given lepton and jet multiplicities, MC truth records, trigger
+// bits and the bookkeeping needed by AtlEvtReaderD3PDSgTopR2. It is
+// processed by the t-channel analysis chain
+// (AtlEvtReaderD3PDSgTopR2, AtlObjectsDefinitionToolR2,
+// AtlObjectsToolD3PDSgTop, AtlObjRecoScaleFactorTool, AtlCutFlowTool
+// and AtlSgTop_tChannelAnalysis) with event profiling switched on.
+// In addition, micro-benchmarks are run for TKinFitter::fit(),
+// AtlEvent::GetJets() and AtlHistogramTool::Fill(), and the task
+// tree of an AtlTopLevelAnalysis with many samples is built in
+// dry-run mode.
+//
+// The results are written to a JSON file, one result per line. All
+// results given per second are throughputs (higher is better). If the
+// results file of a previous release is given as reference, these
+// throughputs are compared to it and the program fails if one of
+// them dropped by more than the given tolerance.
+//
+// Usage:
+// ======
+// aplusplus-benchmark [-n <events>] [-l <leptons>] [-j <jets>] [-t]
+//                     [-m <iterations>] [-s <seed>] [-w <work dir>]
+//                     [-o <results file>] [-r <reference file>]
+//                     [-x <tolerance>] [-a <samples>] [-k]
+//
+//   -n  No. of synthesised events (default = 20000)
+//   -l  No. of leptons per event (default = 1)
+//   -j  No. of jets per event (default = 4)
+//   -t  Process the MC truth tree (see AtlSelector::fDoTruthTree)
+//   -m  No. of iterations of the micro-benchmarks (default = 200000)
+//   -s  Random seed (default = 4711)
+//   -w  Directory for the input and output files (default = $TMPDIR)
+//   -o  Results file (default = aplusplus-benchmark.json)
+//   -r  Results file of a previous release to compare with
+//   -x  Max. allowed relative drop of a throughput (default = 0.1)
+//   -a  No. of samples of the task-tree benchmark (default = 500)
+//   -k  Keep the synthesised input and the analysis output
+//
+#include <AtlCutFlowTool.h>
+#include <AtlEvent.h>
+#include <AtlEventProfiler.h>
+#include <AtlEvtReaderD3PDSgTopR2.h>
+#include <AtlHistogramTool.h>
+#include <AtlObjRecoScaleFactorTool.h>
+#include <AtlObjectsDefinitionToolR2.h>
+#include <AtlObjectsToolD3PDSgTop.h>
+#include <AtlSample.h>
+#include <AtlSgTop_tChannelAnalysis.h>
+#include <AtlTopLevelAnalysis.h>
+#include <TChain.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TFitConstraintMGaus.h>
+#include <TFitParticlePtEtaPhi.h>
+#include <TFitParticlePtThetaPhi.h>
+#include <TH1D.h>
+#include <TKinFitter.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TMatrixD.h>
+#include <TROOT.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include <TToyBenchmark.h>
+#include <TTree.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+//____________________________________________________________________
+
+static void WriteInput(const char* FileName, Long64_t NEvents,
+		       Int_t NLeptons, Int_t NJets, UInt_t Seed) {
+    //
+    // Synthesise a SgTop-D3PD v31 like MC input file (energies in
+    // MeV) with NLeptons leptons (electrons or muons) and NJets jets
+    // per event. The leading jet is always a b-jet, the sub-leading
+    // one in half of the events.
+    //
+    // The preselection flags of all data-taking periods are set
+    // alike, as the v31 reader merges them anyway.
+    //
+    TRandom3 rnd(Seed);
+    TFile *f = new TFile(FileName, "recreate");
+
+    // Event tree
+    TTree *t = new TTree("nominal", "tree");
+    const char* fnames[] = {
+	"weight_mc", "weight_pileup", "weight_jvt", "weight_forwardjvt",
+	"weight_globalLeptonTriggerSF", "weight_leptonSF",
+	"weight_bTagSF_DL1r_Continuous", "mu", "Vtxz", "met_met", "met_phi",
+	"met_px", "met_py", "met_sumet" };
+    const char* inames[] = {
+	"ejets_2015", "ejets_2016", "ejets_2017", "ejets_2018",
+	"mujets_2015", "mujets_2016", "mujets_2017", "mujets_2018" };
+    const char* trignames[] = {
+	"HLT_e26_lhtight_nod0_ivarloose", "HLT_e60_lhmedium_nod0",
+	"HLT_e140_lhloose_nod0", "HLT_mu26_ivarmedium", "HLT_mu50" };
+    const Double_t trigthr[] = { 27.e3, 61.e3, 141.e3, 27.e3, 51.e3 };
+    const char* vfnames[] = {
+	"el_pt", "el_eta", "el_phi", "el_e", "el_charge", "el_true_pt",
+	"el_true_eta", "mu_pt", "mu_eta", "mu_phi", "mu_e", "mu_charge",
+	"mu_true_pt", "mu_true_eta", "jet_pt", "jet_eta", "jet_phi", "jet_e",
+	"jet_m" };
+    const char* vinames[] = {
+	"el_true_type", "el_true_origin", "el_true_pdg", "mu_true_type",
+	"mu_true_origin", "mu_true_pdg", "jet_tagWeightBin_DL1r_Continuous",
+	"jet_truthflav" };
+    const char* vcnames[] = { "el_isTight", "el_tight", "mu_isTight", "mu_tight" };
+    map<string, Float_t> F;
+    map<string, Int_t> I;
+    map<string, Char_t> C;
+    map<string, vector<float> > VF;
+    map<string, vector<int> > VI;
+    map<string, vector<char> > VC;
+    ULong64_t eventNumber = 0;
+    UInt_t runNumber = 0, mcChannelNumber = 410658, lbn = 0, npVtx = 0;
+    t->Branch("eventNumber", &eventNumber, "eventNumber/l");
+    t->Branch("runNumber", &runNumber, "runNumber/i");
+    t->Branch("mcChannelNumber", &mcChannelNumber, "mcChannelNumber/i");
+    t->Branch("lbn", &lbn, "lbn/i");
+    t->Branch("npVtx", &npVtx, "npVtx/i");
+    for ( auto n : fnames )    t->Branch(n, &F[n], Form("%s/F", n));
+    for ( auto n : inames )    t->Branch(n, &I[n], Form("%s/I", n));
+    for ( auto n : trignames ) t->Branch(n, &C[n], Form("%s/B", n));
+    for ( auto n : vfnames )   t->Branch(n, &VF[n]);
+    for ( auto n : vinames )   t->Branch(n, &VI[n]);
+    for ( auto n : vcnames )   t->Branch(n, &VC[n]);
+
+    // MC truth tree
+    TTree *tt = new TTree("truth", "tree");
+    const char* ttnames[] = {
+	"MC_b_from_t_pt", "MC_b_from_t_eta", "MC_b_from_t_phi", "MC_b_from_t_m",
+	"MC_b_from_tbar_pt", "MC_b_from_tbar_eta", "MC_b_from_tbar_phi",
+	"MC_b_from_tbar_m" };
+    map<string, Float_t> TT;
+    tt->Branch("eventNumber", &eventNumber, "eventNumber/l");
+    tt->Branch("runNumber", &runNumber, "runNumber/i");
+    for ( auto n : ttnames ) tt->Branch(n, &TT[n], Form("%s/F", n));
+
+    // Run numbers of mc16a/d/e
+    const UInt_t runs[3] = { 284500, 300000, 310000 };
+    Double_t sumw = 0., sumwpu = 0.;
+    for ( Long64_t i = 0; i < NEvents; i++ ) {
+	for ( auto &v : VF ) v.second.clear();
+	for ( auto &v : VI ) v.second.clear();
+	for ( auto &v : VC ) v.second.clear();
+
+	// Header and weights
+	eventNumber = i+1;
+	runNumber = runs[rnd.Integer(3)];
+	lbn = rnd.Integer(1000) + 1;
+	F["mu"] = TMath::Max(rnd.Gaus(35., 10.), 1.);
+	npVtx = (UInt_t)(0.6*F["mu"]) + 1;
+	F["Vtxz"] = rnd.Gaus(0., 40.);
+	F["weight_mc"] = ( rnd.Rndm() < 0.1 ? -1. : 1. )*rnd.Gaus(1., 0.05);
+	F["weight_pileup"] = rnd.Gaus(1., 0.1);
+	F["weight_jvt"] = rnd.Gaus(1., 0.02);
+	F["weight_forwardjvt"] = rnd.Gaus(1., 0.02);
+	F["weight_globalLeptonTriggerSF"] = rnd.Gaus(1., 0.02);
+	F["weight_leptonSF"] = rnd.Gaus(1., 0.03);
+	F["weight_bTagSF_DL1r_Continuous"] = rnd.Gaus(1., 0.05);
+	sumw += F["weight_mc"];
+	sumwpu += F["weight_mc"]*F["weight_pileup"];
+
+	// Leptons
+	Double_t sumet = 0.;
+	Bool_t hasel = kFALSE, hasmu = kFALSE;
+	for ( auto n : trignames ) C[n] = 0;
+	for ( Int_t j = 0; j < NLeptons; j++ ) {
+	    Bool_t isel = ( rnd.Rndm() < 0.5 );
+	    const char* pre = isel ? "el_" : "mu_";
+	    Double_t pt  = 25.e3 + rnd.Exp(30.e3);
+	    Double_t eta = rnd.Uniform(-2.47, 2.47);
+	    Double_t q   = ( rnd.Rndm() < 0.5 ) ? -1. : 1.;
+	    Char_t tight = ( rnd.Rndm() < 0.9 );
+	    VF[Form("%spt", pre)].push_back(pt);
+	    VF[Form("%seta", pre)].push_back(eta);
+	    VF[Form("%sphi", pre)].push_back(rnd.Uniform(-TMath::Pi(), TMath::Pi()));
+	    VF[Form("%se", pre)].push_back(pt*TMath::CosH(eta));
+	    VF[Form("%scharge", pre)].push_back(q);
+	    VF[Form("%strue_pt", pre)].push_back(pt*rnd.Gaus(1., 0.02));
+	    VF[Form("%strue_eta", pre)].push_back(eta);
+	    VC[Form("%sisTight", pre)].push_back(tight);
+	    VC[Form("%stight", pre)].push_back(tight);
+	    VI[Form("%strue_type", pre)].push_back(isel ? 2 : 6);    // isolated e/mu
+	    VI[Form("%strue_origin", pre)].push_back(10);            // top
+	    VI[Form("%strue_pdg", pre)].push_back((isel ? -11 : -13)*(Int_t)q);
+	    for ( Int_t k = ( isel ? 0 : 3 ); k < ( isel ? 3 : 5 ); k++ )
+		if ( pt > trigthr[k] ) C[trignames[k]] = 1;
+	    hasel |= ( isel && tight );
+	    hasmu |= ( !isel && tight );
+	    sumet += pt;
+	}
+	for ( Int_t k = 0; k < 4; k++ ) {
+	    I[inames[k]]   = hasel;
+	    I[inames[k+4]] = hasmu;
+	}
+
+	// Jets
+	vector<Double_t> jetpt(NJets);
+	for ( Int_t j = 0; j < NJets; j++ ) jetpt[j] = 25.e3 + rnd.Exp(40.e3);
+	sort(jetpt.rbegin(), jetpt.rend());
+	for ( Int_t j = 0; j < NJets; j++ ) {
+	    Int_t flav = 0;
+	    if ( j == 0 || ( j == 1 && rnd.Rndm() < 0.5 ) ) {
+		flav = 5;
+	    } else if ( rnd.Rndm() < 0.1 ) {
+		flav = 4;
+	    }
+	    Int_t bin = 1;
+	    if ( flav == 5 ) {
+		if ( rnd.Rndm() < 0.85 ) bin = 2 + rnd.Integer(4);
+	    } else if ( flav == 4 ) {
+		if ( rnd.Rndm() < 0.3 ) bin = 2 + rnd.Integer(2);
+	    } else if ( rnd.Rndm() < 0.05 ) {
+		bin = 2;
+	    }
+	    Double_t eta = ( flav == 5 ) ? rnd.Uniform(-2.5, 2.5) : rnd.Uniform(-4.4, 4.4);
+	    Double_t m = 5.e3 + rnd.Exp(5.e3);
+	    Double_t p = jetpt[j]*TMath::CosH(eta);
+	    VF["jet_pt"].push_back(jetpt[j]);
+	    VF["jet_eta"].push_back(eta);
+	    VF["jet_phi"].push_back(rnd.Uniform(-TMath::Pi(), TMath::Pi()));
+	    VF["jet_e"].push_back(TMath::Sqrt(p*p + m*m));
+	    VF["jet_m"].push_back(m);
+	    VI["jet_tagWeightBin_DL1r_Continuous"].push_back(bin);
+	    VI["jet_truthflav"].push_back(flav);
+	    sumet += jetpt[j];
+	}
+
+	// Missing Et
+	Double_t met = rnd.Exp(40.e3);
+	Double_t metphi = rnd.Uniform(-TMath::Pi(), TMath::Pi());
+	F["met_met"] = met;
+	F["met_phi"] = metphi;
+	F["met_px"] = met*TMath::Cos(metphi);
+	F["met_py"] = met*TMath::Sin(metphi);
+	F["met_sumet"] = sumet + met;
+	t->Fill();
+
+	// MC truth: b-quarks from the decays of a top-quark pair
+	for ( Int_t k = 0; k < 2; k++ ) {
+	    TLorentzVector top, W, b;
+	    top.SetPtEtaPhiM(rnd.Exp(60.), rnd.Uniform(-2.5, 2.5),
+			     rnd.Uniform(-TMath::Pi(), TMath::Pi()), TToyBenchmark::fgMTop);
+	    TToyBenchmark::Decay(rnd, top, TToyBenchmark::fgMW, TToyBenchmark::fgMB, W, b);
+	    const char* q = ( k == 0 ) ? "t" : "tbar";
+	    TT[Form("MC_b_from_%s_pt", q)]  = b.Pt()*1.e3;
+	    TT[Form("MC_b_from_%s_eta", q)] = b.Eta();
+	    TT[Form("MC_b_from_%s_phi", q)] = b.Phi();
+	    TT[Form("MC_b_from_%s_m", q)]   = b.M()*1.e3;
+	}
+	tt->Fill();
+    }
+
+    // Bookkeeping (xAOD::CutBookkeeper and cut-flow histograms of the
+    // preselections)
+    TTree *sw = new TTree("sumWeights", "sumWeights");
+    Int_t dsid = mcChannelNumber;
+    Float_t totalEventsWeighted = sumw;
+    ULong64_t totalEvents = NEvents;
+    sw->Branch("dsid", &dsid, "dsid/I");
+    sw->Branch("totalEventsWeighted", &totalEventsWeighted, "totalEventsWeighted/F");
+    sw->Branch("totalEvents", &totalEvents, "totalEvents/l");
+    sw->Fill();
+    const char* presel[2] = { "ejets", "mujets" };
+    const char* cutflows[3] = { "cutflow", "cutflow_mc", "cutflow_mc_pu_zvtx" };
+    const Double_t initial[3] = { (Double_t)NEvents, totalEventsWeighted, sumwpu };
+    for ( Int_t i = 0; i < 2; i++ ) {
+	f->mkdir(presel[i])->cd();
+	for ( Int_t j = 0; j < 3; j++ ) {
+	    TH1D *h = new TH1D(cutflows[j], cutflows[j], 2, 0., 2.);
+	    h->GetXaxis()->SetBinLabel(1, "INITIAL");
+	    h->GetXaxis()->SetBinLabel(2, "GRL");
+	    h->SetBinContent(1, initial[j]);
+	}
+	f->cd();
+    }
+    f->Write();
+    f->Close();
+    delete f;
+}
+
+//____________________________________________________________________
+
+static void RunEventLoop(const char* InputFile, const char* OutputFile,
+			 Bool_t DoTruth, TToyBenchmark &Results) {
+    //
+    // Process the input file with the t-channel analysis chain
+    //
+    AtlSgTop_tChannelAnalysis *sel = new AtlSgTop_tChannelAnalysis(OutputFile);
+    sel->SetEvtReader(new AtlEvtReaderD3PDSgTopR2(sel, AtlEvtReaderD3PDSgTopR2::kMC,
+						  "v31", "nominal", ""));
+    sel->fDoTruthTree = DoTruth;
+    sel->SetEventProfiling(0);
+
+    AtlObjectsDefinitionToolR2 *tool_def =
+	new AtlObjectsDefinitionToolR2("ObjectsR2", "Run-2 object definition");
+    tool_def->fElectronPt_min = 25.;
+    tool_def->fMuonPt_min = 25.;
+    tool_def->fJetPt_min = 25.;
+    tool_def->fJetEta_max = 4.5;
+    tool_def->fJetsAuthor = AtlJet::kDL1r;
+    tool_def->fBtagger = AtlBTag::kDL1r_85;
+    tool_def->fBtaggingWorkingPoint = 0.5;
+    tool_def->fBtaggingNominalEfficiency = 85;
+    sel->AddTool(tool_def);
+
+    AtlObjectsToolD3PDSgTop *tool_obj =
+	new AtlObjectsToolD3PDSgTop("D3PDObjects", "Analysis objects");
+    tool_obj->fLepChannel = AtlSelector::kLepton;
+    tool_obj->fJetMults = AtlSelector::kAllJets;
+    tool_obj->fAddToCutFlow = kTRUE;
+    tool_obj->fElectronPt_min = 25.;
+    tool_obj->fMuonPt_min = 25.;
+    tool_obj->fLeptonN_min = 1;
+    tool_obj->fLeptonN_max = 999;
+    tool_obj->fJetPt_min = 25.;
+    tool_obj->fJetEta_max = 4.5;
+    tool_obj->fJetsAuthor = AtlJet::kDL1r;
+    tool_obj->fBTagger = AtlBTag::kDL1r_85;
+    tool_obj->fBTagWeight_min = 0.5;
+    sel->AddTool(tool_obj);
+
+    AtlObjRecoScaleFactorTool *tool_sf =
+	new AtlObjRecoScaleFactorTool("SFTool", "SF tool");
+    tool_sf->fOperationMode = AtlObjRecoScaleFactorTool::kAllSF;
+    tool_sf->fBTagWP = AtlObjRecoScaleFactorTool::kDL1r_85;
+    sel->AddTool(tool_sf);
+
+    AtlCutFlowTool *tool_cf = new AtlCutFlowTool("CFTool", "Cutflow Tool");
+    tool_cf->fNBins = 20;
+    sel->AddTool(tool_cf);
+
+    TChain *ch = new TChain("nominal");
+    ch->Add(InputFile);
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    ch->Process((TSelector*)sel);
+    watch.Stop();
+
+    // Total throughput (incl. booking and writing of the output) and
+    // throughput of the event loop itself with its stage breakdown
+    Int_t nevt = sel->GetProcessedEvents();
+    AtlEventProfiler *prof = sel->GetEventProfiler();
+    Results.AddResult("eventloop_total", nevt/watch.RealTime(), "events/s",
+	      watch.RealTime(), watch.CpuTime());
+    Results.AddResult("eventloop", nevt/prof->GetSumTime(), "events/s",
+	      prof->GetSumTime());
+    for ( Int_t i = 0; i < AtlEventProfiler::kNStages; i++ ) {
+	Results.AddResult(Form("eventloop_stage_%s", AtlEventProfiler::GetStageName(i)),
+		  1.e6*prof->GetSumTime(i)/nevt, "us/event", prof->GetSumTime(i));
+    }
+}
+
+//____________________________________________________________________
+
+static void RunKinFitter(Int_t NFits, UInt_t Seed, TToyBenchmark &Results) {
+    //
+    // Micro-benchmark of TKinFitter::fit() for the leptonic top
+    // decay as fitted by AtlSgTop_tChannelFinder (lepton, neutrino
+    // with unmeasured theta and b-jet with Gaussian W and top mass
+    // constraints, topology re-used for all fits)
+    //
+    TRandom3 rnd(Seed);
+    vector<TLorentzVector> p(3*NFits);
+    vector<TMatrixD> cov(3*NFits, TMatrixD(3, 3));
+    for ( Int_t i = 0; i < NFits; i++ ) {
+	TLorentzVector W;
+	TLorentzVector top = TToyBenchmark::GenParent(rnd, TToyBenchmark::fgMTop, 50.);
+	TToyBenchmark::Decay(rnd, top, TToyBenchmark::fgMW, TToyBenchmark::fgMB,
+			     W, p[3*i+2]);
+	TToyBenchmark::Decay(rnd, W, TToyBenchmark::fgMMu, 0., p[3*i], p[3*i+1]);
+	TToyBenchmark::Smear(rnd, p[3*i], TToyBenchmark::fgMMu, 0.02, 1.e-3, 1.e-3,
+			     cov[3*i]);
+	TToyBenchmark::SmearNu(rnd, p[3*i+1], 0.2, 0.1, cov[3*i+1]);
+	TToyBenchmark::Smear(rnd, p[3*i+2], TToyBenchmark::fgMB, 0.1, 0.05, 0.05,
+			     cov[3*i+2]);
+    }
+
+    TKinFitter fitter;
+    TFitParticlePtEtaPhi   *lep  = new TFitParticlePtEtaPhi("lep", "lep", 0, 0., 0);
+    TFitParticlePtThetaPhi *nu   = new TFitParticlePtThetaPhi("nu", "nu", 0, 0., 0);
+    TFitParticlePtEtaPhi   *bjet = new TFitParticlePtEtaPhi("bjet", "bjet", 0, 0., 0);
+    TFitConstraintMGaus *MW = new TFitConstraintMGaus("MW", "MW", 0, 0,
+						      TToyBenchmark::fgMW, TToyBenchmark::fgGW);
+    TFitConstraintMGaus *MT = new TFitConstraintMGaus("MT", "MT", 0, 0,
+						      TToyBenchmark::fgMTop, TToyBenchmark::fgGTop);
+    MW->addParticles1(lep, nu);
+    MT->addParticles1(lep, nu, bjet);
+    fitter.setOwner();
+    fitter.addMeasParticle(lep);
+    fitter.addMeasParticle(nu);
+    fitter.setParamUnmeas(nu, 1);
+    fitter.addMeasParticle(bjet);
+    fitter.addConstraint(MW);
+    fitter.addConstraint(MT);
+    fitter.setMaxNbIter(100);
+    fitter.setMaxDeltaS(5.e-5);
+    fitter.setMaxF(1.e-4);
+    fitter.setVerbosity(0);
+
+    Long64_t niter = 0;
+    Int_t nconv = 0;
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    for ( Int_t i = 0; i < NFits; i++ ) {
+	for ( Int_t j = 0; j < 3; j++ )
+	    fitter.setParticle(j, &p[3*i+j], &cov[3*i+j]);
+	fitter.fit();
+	niter += fitter.getNbIter();
+	if ( fitter.getStatus() == 0 ) nconv++;
+    }
+    watch.Stop();
+    Results.AddResult("kinfitter_fit", NFits/watch.RealTime(), "fits/s",
+	      watch.RealTime(), watch.CpuTime());
+    Results.AddResult("kinfitter_fit_iterations", (Double_t)niter/NFits, "iterations");
+    Results.AddResult("kinfitter_fit_converged", (Double_t)nconv/NFits, "fraction");
+}
+
+//____________________________________________________________________
+
+static void RunGetJets(Int_t NCalls, Int_t NJets, UInt_t Seed,
+		       TToyBenchmark &Results) {
+    //
+    // Micro-benchmark of AtlEvent::GetJets() for the plain jet
+    // container and for the selected and sorted jet list
+    //
+    TRandom3 rnd(Seed);
+    AtlEvent *evt = new AtlEvent;
+    for ( Int_t i = 0; i < TMath::Max(NJets, 1); i++ ) {
+	TLorentzVector p;
+	p.SetPtEtaPhiM(25. + rnd.Exp(40.), rnd.Uniform(-4.4, 4.4),
+		       rnd.Uniform(-TMath::Pi(), TMath::Pi()), 10.);
+	evt->AddJet(AtlJet::kDL1r, p.E(), p.Px(), p.Py(), p.Pz(),
+		    AtlJet::kIsGood, TLorentzVector(NAN, NAN, NAN, NAN),
+		    TLorentzVector(NAN, NAN, NAN, NAN), NAN, NAN, NAN);
+    }
+
+    // The no. of returned jets is reported, so the calls cannot be
+    // optimised away
+    TStopwatch watch;
+    Long64_t n = 0;
+    watch.Start(kTRUE);
+    for ( Int_t i = 0; i < NCalls; i++ )
+	n += evt->GetJets(AtlJet::kDL1r)->GetEntriesFast();
+    watch.Stop();
+    Results.AddResult("atlevent_getjets_njets", (Double_t)n/NCalls, "jets");
+    Results.AddResult("atlevent_getjets", NCalls/watch.RealTime(), "calls/s",
+	      watch.RealTime(), watch.CpuTime());
+
+    n = 0;
+    watch.Start(kTRUE);
+    for ( Int_t i = 0; i < NCalls; i++ ) {
+	TList *jets = evt->GetJets(AtlJet::kDL1r, 25., 10e10, -2.5, 2.5);
+	n += jets->GetEntries();
+	delete jets;
+    }
+    watch.Stop();
+    Results.AddResult("atlevent_getjets_selected_njets", (Double_t)n/NCalls, "jets");
+    Results.AddResult("atlevent_getjets_selected", NCalls/watch.RealTime(), "calls/s",
+	      watch.RealTime(), watch.CpuTime());
+    delete evt;
+}
+
+//____________________________________________________________________
+
+class AtlBenchmarkSelector : public AtlSelector {
+    //
+    // Minimal selector providing the output file for the histogram
+    // tool benchmark
+    //
+  public:
+    AtlBenchmarkSelector(const char* OutputFile) : AtlSelector(OutputFile) {
+	fOutputFile = new TFile(OutputFile, "recreate");
+    }
+    virtual void SetBranchStatus() {;}
+    virtual void BookHistograms() {;}
+    virtual void FillHistograms() {;}
+};
+
+//____________________________________________________________________
+
+static void RunHistogramFill(Int_t NFills, const char* OutputFile, UInt_t Seed,
+			     TToyBenchmark &Results) {
+    //
+    // Micro-benchmark of AtlHistogramTool::Fill() with a typical
+    // number of booked histograms in subfolders
+    //
+    const Int_t nhists = 500;
+    AtlBenchmarkSelector *sel = new AtlBenchmarkSelector(OutputFile);
+    AtlHistogramTool *htool = new AtlHistogramTool("Benchmark", "Benchmark histograms");
+    sel->AddTool(htool);
+    vector<TString> names1d, names2d;
+    for ( Int_t i = 0; i < nhists; i++ ) {
+	names1d.push_back(Form("folder%d/sub%d/h_var%d", i%5, i%10, i));
+	htool->Add(names1d.back().Data(), "1d", 40, 0., 200., "x", "Events");
+	if ( i % 10 == 0 ) {
+	    names2d.push_back(Form("folder%d/sub%d/h2_var%d", i%5, i%10, i));
+	    htool->Add(names2d.back().Data(), "2d", 40, 0., 200., 40, 0., 200.,
+		       "x", "y", "Events");
+	}
+    }
+
+    TRandom3 rnd(Seed);
+    vector<Double_t> x(1000);
+    for ( auto &v : x ) v = rnd.Exp(50.);
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    for ( Int_t i = 0; i < NFills; i++ )
+	htool->Fill(names1d[i % nhists].Data(), x[i % 1000], 1.);
+    watch.Stop();
+    Results.AddResult("histogramtool_fill", NFills/watch.RealTime(), "fills/s",
+	      watch.RealTime(), watch.CpuTime());
+
+    watch.Start(kTRUE);
+    for ( Int_t i = 0; i < NFills; i++ )
+	htool->Fill(names2d[i % names2d.size()].Data(), x[i % 1000],
+		    x[(i+1) % 1000], 1.);
+    watch.Stop();
+    Results.AddResult("histogramtool_fill2d", NFills/watch.RealTime(), "fills/s",
+	      watch.RealTime(), watch.CpuTime());
+    delete sel;
+}
+
+//____________________________________________________________________
+
+static void RunBuildTree(Int_t NSamples, const char* WorkDir,
+			 TToyBenchmark &Results) {
+    //
+    // Benchmark of AtlTopLevelAnalysis::BuildTree() in dry-run mode
+    // for NSamples samples of all types, two jet bins and the
+    // default systematics. The analysis tasks are counted only, but
+    // their output paths are built and their job status is checked
+    // as usual (none of the jobs exists)
+    //
+    AtlTopLevelAnalysis *ana = new AtlTopLevelAnalysis("Benchmark", "Benchmark");
+    ana->SetCampaign(15);
+    ana->SetUseHforSamples(kFALSE);
+    ana->SetSgTopVersion("v31");
+    ana->SetHistDir(Form("%s/hists", WorkDir));
+    ana->SetJobHomeDir(Form("%s/jobs", WorkDir));
+    ana->SetTempDir(Form("%s/tmp", WorkDir));
+    ana->SetBuildMergingTree(kFALSE);
+    ana->SetBuildPlottingTree(kFALSE);
+    ana->SetDryRun(kTRUE);
+    ana->AddJetMultiplicity(AtlSelector::kTwoJet);
+    ana->AddJetMultiplicity(AtlSelector::kThreeJet);
+    ana->AddSystematicGroup(AtlTopLevelAnalysis::kSystGrpAllDefault);
+    for ( Int_t i = 0; i < NSamples; i++ ) {
+	ana->AddSample(Form("sample%d", i), Form("Sample %d", i), "kRed",
+		       (AtlSample::EType)(i % AtlSample::kUndefined), 1.);
+    }
+
+    // Suppress the per-folder messages of the tree building
+    Int_t level = gErrorIgnoreLevel;
+    gErrorIgnoreLevel = kWarning;
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    ana->BuildTree(kFALSE);
+    watch.Stop();
+    gErrorIgnoreLevel = level;
+    Int_t ntasks = ana->GetNDryRunTasks();
+    Results.AddResult("toplevel_buildtree_tasks", ntasks, "tasks");
+    Results.AddResult("toplevel_buildtree", ntasks/watch.RealTime(), "tasks/s",
+	      watch.RealTime(), watch.CpuTime());
+    delete ana;
+}
+
+//____________________________________________________________________
+
+int main(int argc, char **argv) {
+    //
+    // Main program
+    //
+    Long64_t nevents = 20000;
+    Int_t nleptons = 1, njets = 4, niter = 200000, nsamples = 500;
+    UInt_t seed = 4711;
+    Bool_t dotruth = kFALSE, keep = kFALSE;
+    TString workdir = gSystem->TempDirectory();
+    TString results = "aplusplus-benchmark.json";
+    TString reference;
+    Double_t tolerance = 0.1;
+    int c;
+    while ( (c = getopt(argc, argv, "n:l:j:tm:s:w:o:r:x:a:k")) != -1 ) {
+	switch ( c ) {
+	case 'n': nevents = strtoll(optarg, 0, 10); break;
+	case 'l': nleptons = atoi(optarg); break;
+	case 'j': njets = atoi(optarg); break;
+	case 't': dotruth = kTRUE; break;
+	case 'm': niter = atoi(optarg); break;
+	case 's': seed = strtoul(optarg, 0, 10); break;
+	case 'w': workdir = optarg; break;
+	case 'o': results = optarg; break;
+	case 'r': reference = optarg; break;
+	case 'x': tolerance = atof(optarg); break;
+	case 'a': nsamples = atoi(optarg); break;
+	case 'k': keep = kTRUE; break;
+	default:
+	    cerr << "Usage: " << argv[0]
+		 << " [-n <events>] [-l <leptons>] [-j <jets>] [-t] [-m <iterations>]"
+		 << " [-s <seed>] [-w <work dir>] [-o <results file>]"
+		 << " [-r <reference file>] [-x <tolerance>] [-a <samples>] [-k]" << endl;
+	    return 2;
+	}
+    }
+    if ( nevents <= 0 || nleptons < 1 || njets < 0 || niter <= 0 || nsamples <= 0 ) {
+	cerr << argv[0] << ": invalid configuration" << endl;
+	return 2;
+    }
+    gROOT->SetBatch(kTRUE);
+
+    TString tag = Form("%s/aplusplus-benchmark-%d", workdir.Data(), gSystem->GetPid());
+    TString input = tag + "_input.root";
+    TString output = tag + "_output.root";
+    TString hists = tag + "_hists.root";
+    TToyBenchmark res("aplusplus-benchmark", kTRUE);
+
+    TStopwatch watch;
+    watch.Start(kTRUE);
+    WriteInput(input.Data(), nevents, nleptons, njets, seed);
+    watch.Stop();
+    cout << endl;
+    res.AddResult("synthesis", nevents/watch.RealTime(), "events/s",
+	      watch.RealTime(), watch.CpuTime());
+    RunEventLoop(input.Data(), output.Data(), dotruth, res);
+    RunKinFitter(niter/10, seed, res);
+    RunGetJets(niter, njets, seed, res);
+    RunHistogramFill(niter, hists.Data(), seed, res);
+    RunBuildTree(nsamples, tag.Data(), res);
+
+    TString config = Form("\"events\": %lld, \"leptons\": %d, \"jets\": %d, \"truth\": %s, "
+			  "\"iterations\": %d, \"samples\": %d, \"seed\": %u", nevents, nleptons,
+			  njets, dotruth ? "true" : "false", niter, nsamples, seed);
+    if ( !res.WriteResults(results.Data(), config.Data()) ) return 1;
+    cout << endl << "  Results written to " << results << endl;
+    if ( !keep ) {
+	gSystem->Unlink(input.Data());
+	gSystem->Unlink(output.Data());
+	gSystem->Unlink(hists.Data());
+    }
+    if ( !reference.IsNull() && res.CompareResults(reference.Data(), tolerance) > 0 ) {
+	return 1;
+    }
+    return 0;
+}
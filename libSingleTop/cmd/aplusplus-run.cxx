@@ -0,0 +1,128 @@
+//____________________________________________________________________
+//
+// Compiled driver for A++ analysis batch jobs
+//
+// Runs the job given by a job description written by
+// AtlAppAnalysisTask::CreateJobDescription() without interpreting
+// analysis_run.C. All selectors, event readers and analysis tools of
+// libAtlasAnalysis, libAtlasFinders and libSingleTop with the common
+// constructor signatures are registered here (see AtlJobRegistry).
+// Other classes are still created via the interpreter, which is
+// reported at the start of the job. New classes have to be added to
+// RegisterSingleTop() below or to AtlJobRegistry::RegisterAtlasAnalysis().
+// The driver is installed by build.sh into $LIBSINGLETOP/bin/$ARCH_TYPE.
+//
+// Usage:
+// ======
+// aplusplus-run analysis_run.job
+//
+#include <AtlJobRegistry.h>
+#include <AtlConvFinder.h>
+#include <AtlD0Finder.h>
+#include <AtlDstarFinder.h>
+#include <AtlEvtReaderMemR2.h>
+#include <AtlEvtReaderMemR2JetLepton.h>
+#include <AtlK0StarFinder.h>
+#include <AtlK0sFinder.h>
+#include <AtlKaonHistos.h>
+#include <AtlLambdaFinder.h>
+#include <AtlMemNtupleProduction.h>
+#include <AtlPdfReweightingTool.h>
+#include <AtlPhiFinder.h>
+#include <AtlSgTopEntryListWriter.h>
+#include <AtlSgTopFCNC_tZ_CtrlSM.h>
+#include <AtlSgTopFCNC_tZ_CtrlTtbar.h>
+#include <AtlSgTopFCNC_tZ_CtrlWZ3L.h>
+#include <AtlSgTopFCNC_tZ_CtrlZjets2L.h>
+#include <AtlSgTopFCNC_tZ_CtrlZjets3L.h>
+#include <AtlSgTopFCNC_tZ_Ctrlttbar2L.h>
+#include <AtlSgTopFCNC_tZ_Multi.h>
+#include <AtlSgTopFCNC_tZ_Signal.h>
+#include <AtlSgTopValidation.h>
+#include <AtlSgTop_WtChannelFinder.h>
+#include <AtlSgTop_combinationAnalysis.h>
+#include <AtlSgTop_combinationMemDiscR2.h>
+#include <AtlSgTop_sChannelAnalysis.h>
+#include <AtlSgTop_sChannelBDT.h>
+#include <AtlSgTop_sChannelMemDisc.h>
+#include <AtlSgTop_sChannelMemDiscR2.h>
+#include <AtlSgTop_tChannelAnalysis.h>
+#include <AtlSgTop_tChannelFinder.h>
+#include <AtlSgTop_tChannelMemDiscr.h>
+#include <AtlTopPairFinder.h>
+#include <AtlWjetsScaleFactorTool.h>
+#include <AtlWtChallenge.h>
+#include <AtlZ0Finder.h>
+#include <AtlZllAnalysisDemo.h>
+#include <Atl_WtChannelAnalysis.h>
+#include <Atl_tChannelAnalysis.h>
+#include <TROOT.h>
+#include <iostream>
+
+typedef AtlJobRegistry R;
+
+//____________________________________________________________________
+
+static void RegisterSingleTop() {
+    //
+    // Register the selectors, readers and tools of libAtlasFinders
+    // and libSingleTop
+    //
+    R::RegisterSelector("AtlMemNtupleProduction",        R::NewSelector<AtlMemNtupleProduction>);
+    R::RegisterSelector("AtlSgTopEntryListWriter",       R::NewSelector<AtlSgTopEntryListWriter>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_CtrlSM",        R::NewSelector<AtlSgTopFCNC_tZ_CtrlSM>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_CtrlTtbar",     R::NewSelector<AtlSgTopFCNC_tZ_CtrlTtbar>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_CtrlWZ3L",      R::NewSelector<AtlSgTopFCNC_tZ_CtrlWZ3L>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_CtrlZjets2L",   R::NewSelector<AtlSgTopFCNC_tZ_CtrlZjets2L>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_CtrlZjets3L",   R::NewSelector<AtlSgTopFCNC_tZ_CtrlZjets3L>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_Ctrlttbar2L",   R::NewSelector<AtlSgTopFCNC_tZ_Ctrlttbar2L>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_Multi",         R::NewSelector<AtlSgTopFCNC_tZ_Multi>);
+    R::RegisterSelector("AtlSgTopFCNC_tZ_Signal",        R::NewSelector<AtlSgTopFCNC_tZ_Signal>);
+    R::RegisterSelector("AtlSgTopValidation",            R::NewSelector<AtlSgTopValidation>);
+    R::RegisterSelector("AtlSgTop_combinationAnalysis",  R::NewSelector<AtlSgTop_combinationAnalysis>);
+    R::RegisterSelector("AtlSgTop_combinationMemDiscR2", R::NewSelector<AtlSgTop_combinationMemDiscR2>);
+    R::RegisterSelector("AtlSgTop_sChannelAnalysis",     R::NewSelector<AtlSgTop_sChannelAnalysis>);
+    R::RegisterSelector("AtlSgTop_sChannelBDT",          R::NewSelector<AtlSgTop_sChannelBDT>);
+    R::RegisterSelector("AtlSgTop_sChannelMemDisc",      R::NewSelector<AtlSgTop_sChannelMemDisc>);
+    R::RegisterSelector("AtlSgTop_sChannelMemDiscR2",    R::NewSelector<AtlSgTop_sChannelMemDiscR2>);
+    R::RegisterSelector("AtlSgTop_tChannelAnalysis",     R::NewSelector<AtlSgTop_tChannelAnalysis>);
+    R::RegisterSelector("AtlSgTop_tChannelMemDiscr",     R::NewSelector<AtlSgTop_tChannelMemDiscr>);
+    R::RegisterSelector("AtlWtChallenge",                R::NewSelector<AtlWtChallenge>);
+    R::RegisterSelector("AtlZllAnalysisDemo",            R::NewSelector<AtlZllAnalysisDemo>);
+    R::RegisterSelector("Atl_WtChannelAnalysis",         R::NewSelector<Atl_WtChannelAnalysis>);
+    R::RegisterSelector("Atl_tChannelAnalysis",          R::NewSelector<Atl_tChannelAnalysis>);
+
+    R::RegisterReader("AtlEvtReaderMemR2",          R::NewD3PDReader<AtlEvtReaderMemR2>);
+    R::RegisterReader("AtlEvtReaderMemR2JetLepton", R::NewD3PDReader<AtlEvtReaderMemR2JetLepton>);
+
+    R::RegisterTool("AtlConvFinder",            R::NewTool<AtlConvFinder>);
+    R::RegisterTool("AtlD0Finder",              R::NewTool<AtlD0Finder>);
+    R::RegisterTool("AtlDstarFinder",           R::NewTool<AtlDstarFinder>);
+    R::RegisterTool("AtlK0StarFinder",          R::NewTool<AtlK0StarFinder>);
+    R::RegisterTool("AtlK0sFinder",             R::NewTool<AtlK0sFinder>);
+    R::RegisterTool("AtlKaonHistos",            R::NewTool<AtlKaonHistos>);
+    R::RegisterTool("AtlLambdaFinder",          R::NewTool<AtlLambdaFinder>);
+    R::RegisterTool("AtlPdfReweightingTool",    R::NewTool<AtlPdfReweightingTool>);
+    R::RegisterTool("AtlPhiFinder",             R::NewTool<AtlPhiFinder>);
+    R::RegisterTool("AtlSgTop_WtChannelFinder", R::NewTool<AtlSgTop_WtChannelFinder>);
+    R::RegisterTool("AtlSgTop_tChannelFinder",  R::NewTool<AtlSgTop_tChannelFinder>);
+    R::RegisterTool("AtlTopPairFinder",         R::NewTool<AtlTopPairFinder>);
+    R::RegisterTool("AtlWjetsScaleFactorTool",  R::NewTool<AtlWjetsScaleFactorTool>);
+    R::RegisterTool("AtlZ0Finder",              R::NewTool<AtlZ0Finder>);
+}
+
+//____________________________________________________________________
+
+int main(int argc, char **argv) {
+    //
+    // Main program
+    //
+    if ( argc != 2 ) {
+	std::cerr << "Usage: " << argv[0] << " <job description>" << std::endl;
+	return 2;
+    }
+    gROOT->SetBatch(kTRUE);
+    R::RegisterAtlasAnalysis();
+    RegisterSingleTop();
+    return R::RunJob(argv[1]);
+}
@@ -0,0 +1,69 @@
+#ifndef SINGLETOP_AtlMemLlhCache
+#define SINGLETOP_AtlMemLlhCache
+#ifndef ROOT_TNamed
+#include <TNamed.h>
+#endif
+#include <vector>
+
+class TFile;
+class TCollection;
+
+class AtlMemLlhCache : public TNamed {
+
+  public:
+    enum ELlh {
+	kSChannel2j = 0,
+	kSChannel3j,
+	kTChannel4FS,
+	kTtbarSL,
+	kTtbarDL,
+	kWjj,
+	kWcj,
+	kWbb,
+	kNLlh
+    };
+    enum ELepton {
+	kEPlus = 0,
+	kEMinus,
+	kMuPlus,
+	kMuMinus
+    };
+
+  private:
+    TString fSystematic;              // Systematic variation the likelihoods belong to
+    std::vector<UInt_t>    fRunNr;    // Run number of each event
+    std::vector<ULong64_t> fEventNr;  // Event number of each event
+    std::vector<Char_t>    fLepton;   // Lepton flavour and charge of each event (see ELepton)
+    std::vector<Double_t>  fWeight;   // Event weight (tag weight) of each event
+    std::vector<Double_t>  fLlh;      // Raw per-process likelihoods, kNLlh per event
+    std::vector<Int_t>     fIndex;    //! Entries sorted by (run, event)
+    Bool_t                 fIsSorted; //! fIndex up-to-date ?
+
+  public:
+    AtlMemLlhCache(const char* Systematic = "nominal");
+    virtual ~AtlMemLlhCache();
+    void Add(UInt_t RunNr, ULong64_t EventNr, Bool_t IsElectron,
+	     Float_t Charge, Double_t Weight, const Double_t *Llh);
+    Int_t Find(UInt_t RunNr, ULong64_t EventNr);
+    virtual Long64_t Merge(TCollection *list);
+    virtual void Clear(Option_t *option = "");
+    virtual void Print(Option_t *option = "") const;
+    static AtlMemLlhCache* Read(TFile *f, const char* Systematic = "nominal");
+    static TString GetKeyName(const char* Systematic);
+
+    inline Int_t GetN() const { return fWeight.size(); }
+    inline const char* GetSystematic() const { return fSystematic.Data(); }
+    inline UInt_t GetRunNr(Int_t i) const { return fRunNr[i]; }
+    inline ULong64_t GetEventNr(Int_t i) const { return fEventNr[i]; }
+    inline Double_t GetWeight(Int_t i) const { return fWeight[i]; }
+    inline Bool_t IsElectron(Int_t i) const
+	    { return fLepton[i] == kEPlus || fLepton[i] == kEMinus; }
+    inline Float_t GetCharge(Int_t i) const
+	    { return ( fLepton[i] == kEPlus || fLepton[i] == kMuPlus ) ? 1. : -1.; }
+    inline const Double_t* GetLlh(Int_t i) const { return fLlh.data() + i*kNLlh; }
+    inline Double_t GetLlh(Int_t i, ELlh process) const { return fLlh[i*kNLlh + process]; }
+
+    ClassDef(AtlMemLlhCache,1) // Per-event cache of raw MEM likelihoods
+};
+#endif
+
@@ -45,6 +45,13 @@ class AtlPdfReweightingTool : public AtlAnalysisTool {
     virtual void   FillHistograms() {;}
     virtual void   Terminate();
     void AddObservable(const char* HistName);
+    inline const std::vector<double>& GetPdfWeights() const {
+	//
+	// Weights of all members of all pdf sets for the current event
+	// (see PdfReweightingTool::GetPdfWeights())
+	//
+	return fPdfReweightingTool->GetPdfWeights();
+    }
 
   private:
     void FirstEvent();
@@ -72,6 +72,8 @@ class AtlSgTop_sChannelAnalysis : public AtlSelector {
     Bool_t  fApplyTtbar4JetVeto;   // Apply ttbar 4 jet veto?
     ELepChannel fLeptonFlavour;    // Select mu or el channel at event cut level
     Bool_t  fEvtWriterCloneOnly;   // Parameter to give to EvtWriter
+    Bool_t  fEvtWriterFastSkim;    // Read the input branches not used by the analysis for accepted events only (see AtlEvtWriterD3PDSgTop::SetFastSkim())
+    Int_t   fEvtWriterCompression; // Compression settings of the output tree (100*algorithm+level, -1 = default)
     Bool_t fQCDVeto;               // Apply QCD veto?
  
     Float_t fHt_min;               // Minimum Ht (GeV)
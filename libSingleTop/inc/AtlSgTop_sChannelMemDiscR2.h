@@ -14,6 +14,7 @@
 #include "AtlEvtReaderD3PDBase.h"  // for AtlEvtReaderD3PDBase
 class AtlCutFlowTool;
 class AtlHistogramTool;
+class AtlMemLlhCache;
 class AtlObjRecoScaleFactorTool;
 class AtlObjectsToolD3PDSgTop;
 class AtlPdfReweightingTool;
@@ -73,6 +74,7 @@ class AtlSgTop_sChannelMemDiscR2 : public AtlSelector {
     Bool_t  fEvtWriterReduceOutput;// Parameter to give to EvtWriter
     Bool_t  fEvtWriterCloneOnly;   // Parameter to give to EvtWriter
     Bool_t  fProcessNegativeLlh;   // Fill event in histogram even if >=1 llh is negative
+    Bool_t  fWriteLlhCache;        // Write the raw likelihoods of all selected events to the output file (see ProcessLlhCache())
 
   private:
 
@@ -98,6 +100,8 @@ class AtlSgTop_sChannelMemDiscR2 : public AtlSelector {
     AtlHistogramTool          *fHistsLlhMu;
     AtlHistogramTool          *fHistsLlhE;
 
+    AtlMemLlhCache *fLlhCache;  // Cache of raw likelihoods (if fWriteLlhCache)
+
     // 
     // MEM likelihood ratio
     // 
@@ -271,10 +275,18 @@ class AtlSgTop_sChannelMemDiscR2 : public AtlSelector {
     virtual void   SetCutDefaults();
     virtual void   Print(Option_t *option) const;
     virtual void   Terminate();
+    Bool_t ProcessLlhCache(const char* CacheFile,
+                           const char* Systematic = "nominal");
 
   protected:
     void BookHistogramsMemLogLikelihood(AtlHistogramTool *htool, const char *subdir="");
-    void FillHistogramsMemLogLikelihood(AtlHistogramTool *htool, Double_t W, const char *subdir="");
+    void BookHistogramsMemDisc();
+    Bool_t FillHistogramsMemDisc(Bool_t IsElectron, Float_t Charge,
+                                 const Double_t *Llh, Double_t W,
+                                 Int_t NNegativeLlh);
+    void FillHistogramsMemLogLikelihood(AtlHistogramTool *htool, const Double_t *Llh,
+                                        Double_t W, const char *subdir="");
+    void SetAprioriProbabilities();
     void InitEvent();
 
     AtlEvtReaderD3PDBase* GetEvtReader() { return dynamic_cast<AtlEvtReaderD3PDBase*>(fEvtReader); }
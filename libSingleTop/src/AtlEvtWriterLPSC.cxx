@@ -112,16 +112,7 @@ TTree* AtlEvtWriterLPSC::CreateTree(const char* name,
     //
     // Create output tree
     //
-    InputTree->SetBranchStatus("*", kTRUE);
-
-    fTree = InputTree->CloneTree(0);
-    if ( fTree == 0 ) {
-	// TTree::CloneTree() cannot cope with empty trees. Bypass by
-	// using TTree::CopyTree()
-    	fTree = InputTree->CopyTree("","");
-    }
-    fTree->SetNameTitle(name, title);
-    return fTree;
+    return AtlEvtWriterD3PDSgTop::CreateTree(name, title, InputTree);
 }
 
 //____________________________________________________________________
@@ -135,6 +126,9 @@ void AtlEvtWriterLPSC::Terminate() {
     // lumi of 1 pb^-1 (default xsec unit in A++).
     //
 
+    // Fast skim summary
+    AtlEvtWriterD3PDSgTop::Terminate();
+
     // only do if there is an output tree
     if ( nullptr == fTree )
         return;
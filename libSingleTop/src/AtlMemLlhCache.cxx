@@ -0,0 +1,207 @@
+//____________________________________________________________________
+//
+// Per-event cache of the raw MEM likelihoods
+//
+// Compact in-memory store of the per-process likelihoods read from
+// the MemTk ntuples, together with run and event number, lepton
+// flavour and charge and the event weight of all events passing the
+// selection of the MEM discriminant selectors
+// (AtlSgTop_sChannelMemDiscR2, AtlSgTop_combinationMemDiscR2).
+//
+// One cache is written per systematic variation into the output file
+// of the selector (key "MemLlhCache_<systematic>", see GetKeyName()).
+// The selectors can read it back via ProcessLlhCache() to recompute
+// the discriminant and refill the discriminant histograms after a
+// change of the a-priori probabilities or the binning without running
+// the full event loop over the MemTk ntuples again.
+//
+// Entries are looked up by (run, event) with Find(). The sorted index
+// needed for this is built on first use and is not streamed.
+//
+// Caches of the same systematic in several output files (eg. of the
+// subjobs of a grid or batch job) are concatenated by Merge(), which
+// is called by hadd and TFileMerger.
+//
+#ifndef SINGLETOP_AtlMemLlhCache
+#include <AtlMemLlhCache.h>
+#endif
+#include <TCollection.h>
+#include <TFile.h>
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+#ifndef __CINT__
+ClassImp(AtlMemLlhCache);
+#endif
+
+//____________________________________________________________________
+
+AtlMemLlhCache::AtlMemLlhCache(const char* Systematic) :
+    TNamed(GetKeyName(Systematic).Data(), "MEM likelihood cache") {
+    //
+    // Default constructor
+    //
+    fSystematic = Systematic;
+    fIsSorted = kFALSE;
+}
+
+//____________________________________________________________________
+
+AtlMemLlhCache::~AtlMemLlhCache() {
+    //
+    // Default destructor
+    //
+}
+
+//____________________________________________________________________
+
+void AtlMemLlhCache::Add(UInt_t RunNr, ULong64_t EventNr, Bool_t IsElectron,
+			 Float_t Charge, Double_t Weight, const Double_t *Llh) {
+    //
+    // Add event. The array Llh must contain kNLlh likelihoods in the
+    // order given by ELlh
+    //
+    Char_t lepton = IsElectron
+	? ( Charge > 0. ? kEPlus  : kEMinus )
+	: ( Charge > 0. ? kMuPlus : kMuMinus );
+    fRunNr.push_back(RunNr);
+    fEventNr.push_back(EventNr);
+    fLepton.push_back(lepton);
+    fWeight.push_back(Weight);
+    fLlh.insert(fLlh.end(), Llh, Llh + kNLlh);
+    fIsSorted = kFALSE;
+}
+
+//____________________________________________________________________
+
+Int_t AtlMemLlhCache::Find(UInt_t RunNr, ULong64_t EventNr) {
+    //
+    // Return the entry of the given event (-1 if not found)
+    //
+    if ( !fIsSorted ) {
+	fIndex.resize(GetN());
+	for ( Int_t i = 0; i < GetN(); i++ ) fIndex[i] = i;
+	std::sort(fIndex.begin(), fIndex.end(),
+		  [this](Int_t a, Int_t b) {
+		      return ( fRunNr[a] != fRunNr[b] ) ? fRunNr[a] < fRunNr[b]
+			  : fEventNr[a] < fEventNr[b];
+		  });
+	fIsSorted = kTRUE;
+    }
+    auto it = std::lower_bound(fIndex.begin(), fIndex.end(), 0,
+			       [this, RunNr, EventNr](Int_t a, Int_t) {
+				   return ( fRunNr[a] != RunNr ) ? fRunNr[a] < RunNr
+				       : fEventNr[a] < EventNr;
+			       });
+    if ( it == fIndex.end()
+	 || fRunNr[*it] != RunNr || fEventNr[*it] != EventNr ) return -1;
+    return *it;
+}
+
+//____________________________________________________________________
+
+Long64_t AtlMemLlhCache::Merge(TCollection *list) {
+    //
+    // Append the events of all caches in the given list (called by
+    // hadd and TFileMerger). All caches must belong to the same
+    // systematic. Returns the no. of events after merging or -1 in
+    // case of an error
+    //
+    if ( list == 0 ) return GetN();
+    TIter next(list);
+    TObject *obj = 0;
+    while ( (obj = next()) ) {
+	AtlMemLlhCache *cache = dynamic_cast<AtlMemLlhCache*>(obj);
+	if ( cache == 0 ) {
+	    Error("Merge", "Cannot merge object %s of class %s.",
+		  obj->GetName(), obj->ClassName());
+	    return -1;
+	}
+	if ( cache == this ) continue;
+	if ( cache->fSystematic != fSystematic ) {
+	    Error("Merge", "Cannot merge cache of systematic \"%s\" into cache of systematic \"%s\".",
+		  cache->GetSystematic(), GetSystematic());
+	    return -1;
+	}
+	fRunNr.insert(fRunNr.end(), cache->fRunNr.begin(), cache->fRunNr.end());
+	fEventNr.insert(fEventNr.end(), cache->fEventNr.begin(), cache->fEventNr.end());
+	fLepton.insert(fLepton.end(), cache->fLepton.begin(), cache->fLepton.end());
+	fWeight.insert(fWeight.end(), cache->fWeight.begin(), cache->fWeight.end());
+	fLlh.insert(fLlh.end(), cache->fLlh.begin(), cache->fLlh.end());
+    }
+    fIsSorted = kFALSE;
+    return GetN();
+}
+
+//____________________________________________________________________
+
+void AtlMemLlhCache::Clear(Option_t */*option*/) {
+    //
+    // Remove all events
+    //
+    fRunNr.clear();
+    fEventNr.clear();
+    fLepton.clear();
+    fWeight.clear();
+    fLlh.clear();
+    fIndex.clear();
+    fIsSorted = kFALSE;
+}
+
+//____________________________________________________________________
+
+void AtlMemLlhCache::Print(Option_t */*option*/) const {
+    //
+    // Print cache summary
+    //
+    Double_t sumw = 0.;
+    for ( Int_t i = 0; i < GetN(); i++ ) sumw += fWeight[i];
+    cout << endl
+	 << "MEM likelihood cache \"" << GetName() << "\"" << endl
+	 << "  Systematic      = " << fSystematic.Data() << endl
+	 << "  No. of events   = " << GetN() << endl
+	 << "  Sum of weights  = " << sumw << endl
+	 << "  Memory (approx) = "
+	 << GetN()*(sizeof(UInt_t) + sizeof(ULong64_t) + sizeof(Char_t)
+		    + (kNLlh+1)*sizeof(Double_t))/1024. << " kB" << endl
+	 << endl;
+}
+
+//____________________________________________________________________
+
+AtlMemLlhCache* AtlMemLlhCache::Read(TFile *f, const char* Systematic) {
+    //
+    // Read the cache of the given systematic from file.
+    // Returns 0 if no such cache exists
+    //
+    if ( f == 0 || f->IsZombie() ) {
+	::Error("AtlMemLlhCache::Read", "Invalid input file.");
+	return 0;
+    }
+    TObject *obj = f->Get(GetKeyName(Systematic).Data());
+    if ( obj == 0 ) {
+	::Warning("AtlMemLlhCache::Read",
+		  "No MEM likelihood cache for systematic \"%s\" found in file %s.",
+		  Systematic, f->GetName());
+	return 0;
+    }
+    AtlMemLlhCache *cache = dynamic_cast<AtlMemLlhCache*>(obj);
+    if ( cache == 0 ) {
+	::Error("AtlMemLlhCache::Read",
+		"Object %s in file %s is of class %s, not AtlMemLlhCache.",
+		obj->GetName(), f->GetName(), obj->ClassName());
+	delete obj;
+    }
+    return cache;
+}
+
+//____________________________________________________________________
+
+TString AtlMemLlhCache::GetKeyName(const char* Systematic) {
+    //
+    // Name of the cache object for the given systematic
+    //
+    return TString::Format("MemLlhCache_%s", Systematic);
+}
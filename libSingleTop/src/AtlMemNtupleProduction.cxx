@@ -12,6 +12,7 @@
 #include <AtlMemNtupleProduction.h>
 #endif
 #include <AtlEvtWriterMem.h>
+#include <AtlEvtWriterFlat.h>
 #include <TList.h>
 #include <iostream>
 
@@ -91,6 +92,12 @@ void AtlMemNtupleProduction::BookHistograms() {
 	((AtlEvtWriterMem*)fEvtWriter)->SetMuons(fMuons);
 	((AtlEvtWriterMem*)fEvtWriter)->SetJets(fJets, fBJets);
 	((AtlEvtWriterMem*)fEvtWriter)->SetBTagger(fObjTool->GetBTagger());
+    } else if ( fOutputMode == kFlatNtuple ) {
+	Warning(__FUNCTION__, "Writing flat ntuples. These cannot be read by AtlEvtReaderMemR2, AtlBDTAnalysisTask and the ntuple plots of the MEM/BDT chain.");
+	((AtlEvtWriterFlat*)fEvtWriter)->SetElectrons(fElectrons);
+	((AtlEvtWriterFlat*)fEvtWriter)->SetMuons(fMuons);
+	((AtlEvtWriterFlat*)fEvtWriter)->SetJets(fJets, fBJets);
+	((AtlEvtWriterFlat*)fEvtWriter)->SetBTagger(fObjTool->GetBTagger());
     }
 }
 
@@ -15,6 +15,12 @@
 // counting use a single-bin histogram. AddObservable() can be called
 // anytime before the event loop, for instance in BookHistograms().
 //
+// The weights of all members of all pdf sets are computed in one
+// call per event and are available afterwards via GetPdfWeights(),
+// eg. for treating the pdf systematic as weight variations in a
+// single pass. Member evaluations are memoised by (id, x, Q) inside
+// PdfSet.
+//
 
 //  
 // Author: Oliver Maria Kind <mailto: kind@mail.desy.de>
@@ -186,20 +192,20 @@ void AtlPdfReweightingTool::FillObservables() {
     TDirectory *savdir = gDirectory;
     gROOT->cd();
     
-    // Loop over all observables
+    // Loop over all observables. The internal histograms are stored
+    // in the same order as the original ones (one per 1-dim.
+    // observable, one per y-bin of a 2-dim. observable)
     TH1F *h_tmp = 0;
     TH1F *h_orig = 0;
     TIter next_orig(fListObsHistsOrig);
+    TIter next_tmp(fListObsHistsTmp);
     while ( (h_orig = (TH1F*)next_orig()) ) {
-	TString hname(h_orig->GetName());
-	hname.Append("_apptmp");
-	    
 	// Check each bin for differences against reference (original histogram)
 	// Differences mean that a bin in the original histogram was filled
 	switch ( h_orig->GetDimension() ) {
 	    case 1:
 		// 1-dim.  case
-		h_tmp = (TH1F*)fListObsHistsTmp->FindObject(hname.Data());
+		h_tmp = (TH1F*)next_tmp();
 		for ( Int_t i = 0; i <= h_orig->GetNbinsX()+1; i++ ) {
 		    if ( h_tmp->GetBinContent(i) != h_orig->GetBinContent(i) ) {
 			h_tmp->SetBinContent(i, h_orig->GetBinContent(i));
@@ -213,8 +219,7 @@ void AtlPdfReweightingTool::FillObservables() {
 	    case 2:
 		// 2-dim. case
 		for ( Int_t j = 0; j <= ((TH2F*)h_orig)->GetNbinsY()+1; j++ ) {
-		    h_tmp = (TH1F*)fListObsHistsTmp
-			   ->FindObject(Form("%s_ybin%-d", hname.Data(), j));
+		    h_tmp = (TH1F*)next_tmp();
 		    for ( Int_t i = 0; i <= h_orig->GetNbinsX()+1; i++ ) {
 			if ( h_tmp->GetBinContent(i) != h_orig->GetBinContent(i, j) ) {
 			    h_tmp->SetBinContent(i, h_orig->GetBinContent(i, j));
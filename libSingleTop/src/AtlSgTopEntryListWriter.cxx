@@ -65,6 +65,10 @@ void AtlSgTopEntryListWriter::SetCutDefaults() {
     // Selection cut defaults
     //
 //    fWriteEntryList = kTRUE;
+
+    // Store the selected events also as compact event index which
+    // allows subsequent jobs to read only the selected baskets
+    fWriteEventIndex = kTRUE;
     
     fTriggerChoice = "EF_e20_medium";
 
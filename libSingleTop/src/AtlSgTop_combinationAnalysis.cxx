@@ -216,8 +216,8 @@ void AtlSgTop_combinationAnalysis::BookHistogramsPreSel(AtlHistogramTool *htool)
     //
 
     // No. of events
-    htool->Add("PreSel/h_presel_nevt", "No. of Pre-Selected Events", 1, 0, 1,
-	       "Number of Entries", "PreSel");
+    htool->Define("PreSel/h_presel_nevt", "No. of Pre-Selected Events", 1, 0, 1,
+		  "Number of Entries", "PreSel");
 }
 
 //____________________________________________________________________
@@ -228,117 +228,117 @@ void AtlSgTop_combinationAnalysis::BookHistogramsSel(AtlHistogramTool *htool){
     //
 
     // No. of events
-    htool->Add("Sel/h_sel_nevt", "No. of Selected Events", 1, 0, 1,
-	       "Selection", "Number of Entries");
+    htool->Define("Sel/h_sel_nevt", "No. of Selected Events", 1, 0, 1,
+		  "Selection", "Number of Entries");
 
     //htool->Add("Sel/h_sel_njets", "No. of jets", 1, -0.5, 4.5,
     //	       "No. of Jets", "Number of Entries");
 
-    htool->Add("Sel/h_sel_Ht", "Ht", 40, 0., 400.,
-               "H_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_Ht", "Ht", 40, 0., 400.,
+		  "H_{T} [GeV]", "Number of Entries");
 
     // MET
-    htool->Add("Sel/h_sel_met", "Missing E_T", 40, 0., 200.,
-	       "E_{T, miss} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_met", "Missing E_T", 40, 0., 200.,
+		  "E_{T, miss} [GeV]", "Number of Entries");
 
     // Mt_W
-    htool->Add("Sel/h_sel_MtW", "Transverse W-Boson mass", 42, 0., 210.,
-	       "M_{T, W} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_MtW", "Transverse W-Boson mass", 42, 0., 210.,
+		  "M_{T, W} [GeV]", "Number of Entries");
 
     // 1st jet
-    htool->Add("Sel/h_sel_LeadingJet_pt", "Leading Jet p_{T}", 60, 0., 300.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_even", "Leading Jet p_{T}, even events",
-	       60, 0., 300., "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_odd", "Leading Jet p_{T}, odd events",
-	       60, 0., 300., "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt", "Leading Jet p_{T}", 60, 0., 300.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_even", "Leading Jet p_{T}, even events",
+		  60, 0., 300., "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_odd", "Leading Jet p_{T}, odd events",
+		  60, 0., 300., "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // 2nd jet
-    htool->Add("Sel/h_sel_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 60, 0., 300.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 60, 0., 300.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // Special histograms for ttbar ctrl region
     // Bjets
-    htool->Add("Sel/h_sel_LeadingBJet_pt", "Leading B-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingBJet_eta", "Leading B-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingBJet_phi", "Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_pt", "2nd Leading B-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_eta", "2nd Leading B-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_phi", "2nd Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingBJet_pt", "Leading B-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingBJet_eta", "Leading B-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingBJet_phi", "Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_pt", "2nd Leading B-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_eta", "2nd Leading B-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_phi", "2nd Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
     // Ljets
-    htool->Add("Sel/h_sel_LeadingLJet_pt", "Leading L-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingLJet_eta", "Leading L-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingLJet_phi", "Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_pt", "2nd Leading L-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_eta", "2nd Leading L-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_phi", "2nd Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_pt", "Leading L-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_eta", "Leading L-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_phi", "Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_pt", "2nd Leading L-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_eta", "2nd Leading L-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_phi", "2nd Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // Lepton
-    htool->Add("Sel/h_sel_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
-	       "Lepton p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_eta", "Lepton #eta", 20., -4., 4.,
-	       "Lepton #eta", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "Lepton #phi", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge", "Lepton Charge", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge_even", "Lepton Charge, even events", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge_odd", "Lepton Charge, odd events", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
+		  "Lepton p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_eta", "Lepton #eta", 20., -4., 4.,
+		  "Lepton #eta", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "Lepton #phi", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge", "Lepton Charge", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge_even", "Lepton Charge, even events", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge_odd", "Lepton Charge, odd events", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
 
     // Leading jet pt for 5 eta bins
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta1", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta2", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta3", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta4", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta5", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta1", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta2", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta3", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta4", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta5", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
 
     // Delta R
-    htool->Add("Sel/h_sel_DeltaR_Lepton_LeadingJet", "#DeltaR(lep, leading jet)", 36., 0.4, 4.,
-	       "#DeltaR(lepton, leading jet)", "Number of Entries");
-    htool->Add("Sel/h_sel_DeltaR_Lepton_2ndLeadingJet","#DeltaR(lep, 2nd leading jet)",36., 0.4, 4.,
-	       "#DeltaR(lepton, 2nd leading jet)", "Number of Entries");
-    htool->Add("Sel/h_sel_DeltaR_LeadingJet_2ndLeadingJet", "#DeltaR(leading jet, 2nd leading jet)",
-	       36., 0.4, 4., "#DeltaR(leading jet, 2nd leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_Lepton_LeadingJet", "#DeltaR(lep, leading jet)", 36., 0.4, 4.,
+		  "#DeltaR(lepton, leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_Lepton_2ndLeadingJet","#DeltaR(lep, 2nd leading jet)",36., 0.4, 4.,
+		  "#DeltaR(lepton, 2nd leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_LeadingJet_2ndLeadingJet", "#DeltaR(leading jet, 2nd leading jet)",
+		  36., 0.4, 4., "#DeltaR(leading jet, 2nd leading jet)", "Number of Entries");
 
     //Inv. mass
-    htool->Add("Sel/h_sel_InvM_Lepton_LeadingJet", "Inv. mass (lepton, leading jet)", 50., 0., 400.,
-	       "Inv. mass (lepton, j_{1}) [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_InvM_LeadingJet_2ndLeadingJet", "Inv. mass (leading jet, 2nd leading jet)",
-	       50., 0., 400., "Inv. mass (j_{1}, j_{2}) [GeV]", "Number of Enrties");
+    htool->Define("Sel/h_sel_InvM_Lepton_LeadingJet", "Inv. mass (lepton, leading jet)", 50., 0., 400.,
+		  "Inv. mass (lepton, j_{1}) [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_InvM_LeadingJet_2ndLeadingJet", "Inv. mass (leading jet, 2nd leading jet)",
+		  50., 0., 400., "Inv. mass (j_{1}, j_{2}) [GeV]", "Number of Enrties");
 
     // Pt_lepton * Et_miss
-    htool->Add("Sel/h_sel_ScalarProd_Lepton_Etmiss","P_{Lepton} * E_{T, miss} [GeV^{2}]", 120., -5000., 10000.,
-	      "#vec{p}_{lepton}#vec{E}_{T, miss}", "Number of Entries");
+    htool->Define("Sel/h_sel_ScalarProd_Lepton_Etmiss","P_{Lepton} * E_{T, miss} [GeV^{2}]", 120., -5000., 10000.,
+		 "#vec{p}_{lepton}#vec{E}_{T, miss}", "Number of Entries");
 
     // QCD Veto
-    htool->Add("Sel/h_sel_QCDVeto", "QCD Veto", 20., -TMath::Pi(), TMath::Pi(), 20., 0., 100., "#Delta#phi(j_{1},l)", "Lepton p_{T} (GeV)", "Events");
+    htool->Define("Sel/h_sel_QCDVeto", "QCD Veto", 20., -TMath::Pi(), TMath::Pi(), 20., 0., 100., "#Delta#phi(j_{1},l)", "Lepton p_{T} (GeV)", "Events");
 }
 
 //____________________________________________________________________
@@ -9,9 +9,12 @@
 // 
 #include <AtlSgTop_combinationMemDiscR2.h>
 #include <AtlEvtWriterMemR2.h>          // for AtlEvtWriterMemR2
+#include <AtlEvtReaderD3PDSgTopR2.h>    // for AtlEvtReaderD3PDSgTopR2
+#include <AtlMemLlhCache.h>             // for AtlMemLlhCache
 #include <AtlQCDMMTool.h>               // for AtlQCDMMTool
 #include <TCollection.h>                // for TIter
 #include <TDirectory.h>                 // for TDirectory, gDirectory
+#include <TFile.h>                      // for TFile
 #include <TH1.h>                        // for TH1F
 #include <TH2.h>                        // for TH2F
 #include <TList.h>                      // for TList
@@ -132,6 +135,7 @@ AtlSgTop_combinationMemDiscR2::AtlSgTop_combinationMemDiscR2(const char* OutputF
     fHistsLlh    = nullptr;
     fHistsLlhMu  = nullptr;
     fHistsLlhE   = nullptr;
+    fLlhCache    = nullptr;
 
     SetCutDefaults();
 	
@@ -145,6 +149,8 @@ AtlSgTop_combinationMemDiscR2::~AtlSgTop_combinationMemDiscR2() {
     //
     if ( nullptr != fEvtWriter )
         delete fEvtWriter;
+    if ( nullptr != fLlhCache )
+        delete fLlhCache;
 }
 
 //____________________________________________________________________
@@ -216,6 +222,7 @@ void AtlSgTop_combinationMemDiscR2::SetCutDefaults() {
     fEvtWriterCloneOnly = kFALSE;
     fEvtWriterReduceOutput = kFALSE;
     fProcessNegativeLlh = kFALSE;
+    fWriteLlhCache = kFALSE;
     fOnlyOdd = kFALSE;
 }
 
@@ -278,8 +285,25 @@ void AtlSgTop_combinationMemDiscR2::BookHistograms() {
 	Info(__FUNCTION__, "QCD Tool not found");
     }
 
-    // a-priori probabilities
+    // Cache of the raw likelihoods for ProcessLlhCache()
+    if ( fWriteLlhCache ) {
+        AtlEvtReaderD3PDSgTopR2 *reader =
+            dynamic_cast<AtlEvtReaderD3PDSgTopR2*>(fEvtReader);
+        fLlhCache = new AtlMemLlhCache(( reader != nullptr )
+                                       ? reader->GetSystematicName() : "nominal");
+    }
+
+    SetAprioriProbabilities();
+    BookHistogramsMemDisc();
+}
 
+//____________________________________________________________________
+
+void AtlSgTop_combinationMemDiscR2::SetAprioriProbabilities() {
+    //
+    // Set the a-priori probabilities of all processes entering the
+    // MEM discriminant
+    //
     if ( fApplyDileptonVeto ) {
         // with AtlasUtils/calculate_alphas.py; input v07_MEM
         // Double_t ttbar_muPlus = 0.17989;
@@ -516,7 +540,14 @@ std::cout<<sChannel2jVS3jFrac<<std::endl;
 	fP_ttbarDL_eMinus  = (1.0 - ttbarSL_vs_ttbarDL_frac_el) * 0.15903;
 	fP_ttbarDL_muMinus = (1.0 - ttbarSL_vs_ttbarDL_frac_mu) * 0.18973;
     }
+}
 
+//____________________________________________________________________
+
+void AtlSgTop_combinationMemDiscR2::BookHistogramsMemDisc() {
+    //
+    // Book MEM discriminant and likelihood histograms
+    //
     // Discriminant Plots
     // fHistsDisc = new AtlHistogramTool("MemDisc", "MEM discriminant histograms");
     // AddTool(fHistsDisc);
@@ -787,6 +818,7 @@ void AtlSgTop_combinationMemDiscR2::BookHistogramsMemLogLikelihood(AtlHistogramT
 //____________________________________________________________________
 
 void AtlSgTop_combinationMemDiscR2::FillHistogramsMemLogLikelihood(AtlHistogramTool *htool,
+                                                                const Double_t *Llh,
                                                                 Double_t W,
                                                                 const char *subdir) {
     //
@@ -799,15 +831,14 @@ void AtlSgTop_combinationMemDiscR2::FillHistogramsMemLogLikelihood(AtlHistogramT
         subdirectory.Append("/") ;
     }
 
-    // get likelihoods from reader
-    Double_t llh_sChannel2j  = GetEvtReader()->GetLLh_sChannel2j();
-    Double_t llh_sChannel3j  = GetEvtReader()->GetLLh_sChannel3j();
-    Double_t llh_tChannel4FS = GetEvtReader()->GetLLh_tChannel4FS();
-    Double_t llh_ttbarSL     = GetEvtReader()->GetLLh_ttbarSL();
-    Double_t llh_ttbarDL     = GetEvtReader()->GetLLh_ttbarDL();
-    Double_t llh_Wjj         = GetEvtReader()->GetLLh_Wjj();
-    Double_t llh_Wcj         = GetEvtReader()->GetLLh_Wcj();
-    Double_t llh_Wbb         = GetEvtReader()->GetLLh_Wbb();
+    Double_t llh_sChannel2j  = Llh[AtlMemLlhCache::kSChannel2j];
+    Double_t llh_sChannel3j  = Llh[AtlMemLlhCache::kSChannel3j];
+    Double_t llh_tChannel4FS = Llh[AtlMemLlhCache::kTChannel4FS];
+    Double_t llh_ttbarSL     = Llh[AtlMemLlhCache::kTtbarSL];
+    Double_t llh_ttbarDL     = Llh[AtlMemLlhCache::kTtbarDL];
+    Double_t llh_Wjj         = Llh[AtlMemLlhCache::kWjj];
+    Double_t llh_Wcj         = Llh[AtlMemLlhCache::kWcj];
+    Double_t llh_Wbb         = Llh[AtlMemLlhCache::kWbb];
 
     // fill histograms
     htool->Fill(Form("%slogllh_sChannel2j", subdirectory.Data()),
@@ -996,23 +1027,57 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     // This method will be called only for events surviving the
     // ProcessCut() routine
     //
+    Double_t llh[AtlMemLlhCache::kNLlh];
+    llh[AtlMemLlhCache::kSChannel2j]  = GetEvtReader()->GetLLh_sChannel2j();
+    llh[AtlMemLlhCache::kSChannel3j]  = GetEvtReader()->GetLLh_sChannel3j();
+    llh[AtlMemLlhCache::kTChannel4FS] = GetEvtReader()->GetLLh_tChannel4FS();
+    llh[AtlMemLlhCache::kTtbarSL]     = GetEvtReader()->GetLLh_ttbarSL();
+    llh[AtlMemLlhCache::kTtbarDL]     = GetEvtReader()->GetLLh_ttbarDL();
+    llh[AtlMemLlhCache::kWjj]         = GetEvtReader()->GetLLh_Wjj();
+    llh[AtlMemLlhCache::kWcj]         = GetEvtReader()->GetLLh_Wcj();
+    llh[AtlMemLlhCache::kWbb]         = GetEvtReader()->GetLLh_Wbb();
+
+    Bool_t  lepIsElectron = fLepton->IsElectron();
+    Float_t lepCharge     = fLepton->Charge();
+
+    // Keep the raw likelihoods for a later re-evaluation
+    if ( fLlhCache != nullptr ) {
+        fLlhCache->Add(fEvent->RunNr(), fEvent->EventNr(), lepIsElectron,
+                       lepCharge, GetTagEvtWeight(), llh);
+    }
 
-    // S.K.: change this to use histogram tools
+    // Kinematic control plots (not available from the likelihood cache)
+    if ( FillHistogramsMemDisc(lepIsElectron, lepCharge, llh, GetTagEvtWeight(),
+                               fNNegativeLlh) ) {
+        FillCtrlPlots();
+    }
+}
 
-    HepParticle *lepton        = fLepton;
+//____________________________________________________________________
 
-    Float_t      lepCharge     = lepton->Charge();
-    Bool_t       lepIsElectron = lepton->IsElectron();
-    Bool_t       lepIsMuon     = lepton->IsMuon();
+Bool_t AtlSgTop_combinationMemDiscR2::FillHistogramsMemDisc(Bool_t IsElectron, Float_t Charge,
+                                                            const Double_t *Llh, Double_t W,
+                                                            Int_t NNegativeLlh) {
+    //
+    // Compute the MEM discriminant from the given per-process
+    // likelihoods (see AtlMemLlhCache::ELlh) and fill the
+    // discriminant and log-likelihood histograms with weight W.
+    // Returns kFALSE if the discriminant is invalid for this event.
+    //
+    // Used by FillHistograms() during the event loop and by
+    // ProcessLlhCache() when running from a likelihood cache
+    //
+
+    // S.K.: change this to use histogram tools
 
-    Double_t llh_sChannel2j  = GetEvtReader()->GetLLh_sChannel2j();
-    Double_t llh_sChannel3j  = GetEvtReader()->GetLLh_sChannel3j();
-    Double_t llh_tChannel4FS = GetEvtReader()->GetLLh_tChannel4FS();
-    Double_t llh_ttbarSL     = GetEvtReader()->GetLLh_ttbarSL();
-    Double_t llh_ttbarDL     = GetEvtReader()->GetLLh_ttbarDL();
-    Double_t llh_Wjj         = GetEvtReader()->GetLLh_Wjj();
-    Double_t llh_Wcj         = GetEvtReader()->GetLLh_Wcj();
-    Double_t llh_Wbb         = GetEvtReader()->GetLLh_Wbb();
+    Double_t llh_sChannel2j  = Llh[AtlMemLlhCache::kSChannel2j];
+    Double_t llh_sChannel3j  = Llh[AtlMemLlhCache::kSChannel3j];
+    Double_t llh_tChannel4FS = Llh[AtlMemLlhCache::kTChannel4FS];
+    Double_t llh_ttbarSL     = Llh[AtlMemLlhCache::kTtbarSL];
+    Double_t llh_ttbarDL     = Llh[AtlMemLlhCache::kTtbarDL];
+    Double_t llh_Wjj         = Llh[AtlMemLlhCache::kWjj];
+    Double_t llh_Wcj         = Llh[AtlMemLlhCache::kWcj];
+    Double_t llh_Wbb         = Llh[AtlMemLlhCache::kWbb];
 
     Double_t p_sChannel2j  = 0.0;
     Double_t p_sChannel3j  = 0.0;
@@ -1033,8 +1098,8 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     p_ttbarSL     = fP_ttbarSL_ePlus;
     p_ttbarDL     = fP_ttbarDL_ePlus;
 
-    if ( lepIsElectron ) {
-	if ( lepCharge > 0.0 ) {
+    if ( IsElectron ) {
+	if ( Charge > 0.0 ) {
 	    // e+
 	    p_sChannel2j  = fP_sChannel2j_ePlus;
 	    p_sChannel3j  = fP_sChannel3j_ePlus;
@@ -1056,8 +1121,8 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
 	    p_ttbarDL     = fP_ttbarDL_eMinus;
 	}
     }
-    else if ( lepIsMuon ) {
-	if ( lepCharge > 0.0 ) {
+    else {
+	if ( Charge > 0.0 ) {
 	    // mu+
 	    p_sChannel2j  = fP_sChannel2j_muPlus;
 	    p_sChannel3j  = fP_sChannel3j_muPlus;
@@ -1083,7 +1148,7 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     // S.K.: check if any llh fails, (llh < 0)
     //   set prob. to 0 (to compute some discr. in ttbar regions), give warning
     // the check is performed in ProcessCut()
-    if ( fNNegativeLlh > 0 ) {
+    if ( NNegativeLlh > 0 ) {
         if ( llh_sChannel2j < 0 ) { p_sChannel2j = 0; }
         if ( llh_sChannel3j < 0 ) { p_sChannel3j = 0; }
         if ( llh_tChannel4FS < 0 ) { p_tChannel4FS = 0; }
@@ -1092,7 +1157,7 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
         if ( llh_Wcj < 0 ) { p_Wcj = 0; }
         if ( llh_ttbarSL < 0 ) { p_ttbarSL = 0; }
         if ( llh_ttbarDL < 0 ) { p_ttbarDL = 0; }
-        Warning(__FUNCTION__, "There were %d negative likelihood(s) in the event, still using event!", fNNegativeLlh);
+        Warning(__FUNCTION__, "There were %d negative likelihood(s) in the event, still using event!", NNegativeLlh);
     }
 
     // sum over a priori prob times likelihood
@@ -1109,18 +1174,18 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     if ( sig + bkg == 0. ) {
         Warning(__FUNCTION__, "sig+bkg=%g, skip filling event in histograms",
                 sig+bkg);
-        return;
+        return kFALSE;
     }
-    fCutFlowTool->Fill("sig+bkg", GetTagEvtWeight());
+    if ( fCutFlowTool != nullptr ) fCutFlowTool->Fill("sig+bkg", W);
 
     // s-channel ratio = prob = MEM discriminant
     Double_t sChannelRatio = sig / (sig + bkg);
     if ( !  (sChannelRatio >= 0. && sChannelRatio <= 1.) ) {
         Error(__FUNCTION__, "sChannelRatio invalid: sig=%g, bkg=%g, sChannelRatio=%g",
               sig, bkg, sChannelRatio);
-        return;
+        return kFALSE;
     }
-    fCutFlowTool->Fill("sch_ratio", GetTagEvtWeight());
+    if ( fCutFlowTool != nullptr ) fCutFlowTool->Fill("sch_ratio", W);
 
     Double_t wjetsRatio            = wjetsSum / (sig + bkg);
     Double_t wjetsRatio_reBinned   = TMath::Power(wjetsRatio, 2.0/3.0); // Rebinning by simple mapping
@@ -1129,9 +1194,9 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     if ( ! (wjetsRatio >= 0. && wjetsRatio <= 1.) ) {
         Error(__FUNCTION__, "wjetsRatio invalid: wjetsSum=%g, sig+bkg=%g, wjetsRatio=%g",
               wjetsSum, sig+bkg, wjetsRatio);
-        return;
+        return kFALSE;
     }
-    fCutFlowTool->Fill("wjets_ratio", GetTagEvtWeight());
+    if ( fCutFlowTool != nullptr ) fCutFlowTool->Fill("wjets_ratio", W);
 
     Double_t ttbarRatio          = ttbarSum / (sig + bkg);
     Double_t ttbarRatio_reBinned = TMath::Power(ttbarRatio, 2.0/3.0); // Rebinning by simple mapping
@@ -1139,9 +1204,9 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     if ( ! (ttbarRatio >= 0. && ttbarRatio <= 1.) ) {
         Error(__FUNCTION__, "ttbarRatio invalid: ttbarSum=%g, sig+bkg=%g, ttbarRatio=%g",
               ttbarSum, sig+bkg, ttbarRatio);
-        return;
+        return kFALSE;
     }
-    fCutFlowTool->Fill("ttbar_ratio", GetTagEvtWeight());
+    if ( fCutFlowTool != nullptr ) fCutFlowTool->Fill("ttbar_ratio", W);
 
     // find which bin the s-channel prob. fits into (number)
     Int_t bin_sChannelRatio = 1 + TMath::BinarySearch(fgNBins_sChannelRatio,
@@ -1160,53 +1225,55 @@ void AtlSgTop_combinationMemDiscR2::FillHistograms() {
     // Double_t sChannelRatio_bin1Spread = TMath::Power(sChannelRatio, 0.25); // S.K.??
 
     // fill histograms
-    if(GetTagEvtWeight() < 0 ) std::cout<<"HALLO "<<sChannelRatio<<"  "<<GetTagEvtWeight()<<std::endl;
-    fHist_llh_sChannel_ratio_raw->Fill(sChannelRatio, GetTagEvtWeight());
-    fHist_llh_sChannel_ratio->Fill(sChannelRatio_reBinned, GetTagEvtWeight());
-    if ( lepton->Charge() > 0 )
-	fHist_llh_sChannel_ratio_lplus->Fill(sChannelRatio_reBinned, GetTagEvtWeight());
+    if(W < 0 ) std::cout<<"HALLO "<<sChannelRatio<<"  "<<W<<std::endl;
+    fHist_llh_sChannel_ratio_raw->Fill(sChannelRatio, W);
+    fHist_llh_sChannel_ratio->Fill(sChannelRatio_reBinned, W);
+    if ( Charge > 0 )
+	fHist_llh_sChannel_ratio_lplus->Fill(sChannelRatio_reBinned, W);
     else
-	fHist_llh_sChannel_ratio_lminus->Fill(sChannelRatio_reBinned, GetTagEvtWeight());
-    fHist_llh_ttbar_ratio_raw->Fill(ttbarRatio, GetTagEvtWeight());
-    fHist_llh_ttbar_ratio->Fill(ttbarRatio_reBinned, GetTagEvtWeight());
-    fHist_llh_wjets_ratio_raw->Fill(wjetsRatio, GetTagEvtWeight());
-    fHist_llh_wjets_ratio->Fill(wjetsRatio_reBinned, GetTagEvtWeight());
+	fHist_llh_sChannel_ratio_lminus->Fill(sChannelRatio_reBinned, W);
+    fHist_llh_ttbar_ratio_raw->Fill(ttbarRatio, W);
+    fHist_llh_ttbar_ratio->Fill(ttbarRatio_reBinned, W);
+    fHist_llh_wjets_ratio_raw->Fill(wjetsRatio, W);
+    fHist_llh_wjets_ratio->Fill(wjetsRatio_reBinned, W);
 
     // 2D Histograms:
-    fHist_2D_sChannel_vs_Wjets->Fill(sChannelRatio, wjetsRatio, GetTagEvtWeight());
-    fHist_2D_sChannel_vs_ttbar->Fill(sChannelRatio, ttbarRatio, GetTagEvtWeight());
+    fHist_2D_sChannel_vs_Wjets->Fill(sChannelRatio, wjetsRatio, W);
+    fHist_2D_sChannel_vs_ttbar->Fill(sChannelRatio, ttbarRatio, W);
     // Double_t SumLLH = sig+bkg;
-    // fHist_2D_sChannel_vs_SumLLH->Fill(sChannelRatio, TMath::Log10(SumLLH), GetTagEvtWeight());
+    // fHist_2D_sChannel_vs_SumLLH->Fill(sChannelRatio, TMath::Log10(SumLLH), W);
 
     // Add discriminant(s) to output tree
     AtlEvtWriterMemR2 *evt_writer = dynamic_cast<AtlEvtWriterMemR2*>(fEvtWriter);
-    evt_writer->SetMemDisc_sChannelRatio(sChannelRatio);
-    evt_writer->SetMemDisc_wjetsRatio(wjetsRatio);
-    evt_writer->SetMemDisc_ttbarRatio(ttbarRatio);
+    if ( evt_writer != nullptr ) {
+        evt_writer->SetMemDisc_sChannelRatio(sChannelRatio);
+        evt_writer->SetMemDisc_wjetsRatio(wjetsRatio);
+        evt_writer->SetMemDisc_ttbarRatio(ttbarRatio);
+    }
 
     // fill histogram tool histograms
-    if ( lepIsElectron ) {
-        FillHistogramsMemLogLikelihood(fHistsLlhE, GetTagEvtWeight());
-        /*if ( lepCharge > 0. ) {
-            FillHistogramsMemLogLikelihood(fHistsLlhE, GetTagEvtWeight(), "PositiveCharge");
+    if ( IsElectron ) {
+        FillHistogramsMemLogLikelihood(fHistsLlhE, Llh, W);
+        /*if ( Charge > 0. ) {
+            FillHistogramsMemLogLikelihood(fHistsLlhE, Llh, W, "PositiveCharge");
         } else {
-            FillHistogramsMemLogLikelihood(fHistsLlhE, GetTagEvtWeight(), "NegativeCharge");
+            FillHistogramsMemLogLikelihood(fHistsLlhE, Llh, W, "NegativeCharge");
         }*/
     } else {
-        FillHistogramsMemLogLikelihood(fHistsLlhMu, GetTagEvtWeight());
-        /*if ( lepCharge > 0. ) {
-            FillHistogramsMemLogLikelihood(fHistsLlhMu, GetTagEvtWeight(), "PositiveCharge");
+        FillHistogramsMemLogLikelihood(fHistsLlhMu, Llh, W);
+        /*if ( Charge > 0. ) {
+            FillHistogramsMemLogLikelihood(fHistsLlhMu, Llh, W, "PositiveCharge");
         } else {
-            FillHistogramsMemLogLikelihood(fHistsLlhMu, GetTagEvtWeight(), "NegativeCharge");
+            FillHistogramsMemLogLikelihood(fHistsLlhMu, Llh, W, "NegativeCharge");
         }*/
     }        
-    FillHistogramsMemLogLikelihood(fHistsLlh, GetTagEvtWeight());
-    /*if ( lepCharge > 0. ) {
-        FillHistogramsMemLogLikelihood(fHistsLlh, GetTagEvtWeight(), "PositiveCharge");
+    FillHistogramsMemLogLikelihood(fHistsLlh, Llh, W);
+    /*if ( Charge > 0. ) {
+        FillHistogramsMemLogLikelihood(fHistsLlh, Llh, W, "PositiveCharge");
     } else {
-        FillHistogramsMemLogLikelihood(fHistsLlh, GetTagEvtWeight(), "NegativeCharge");
+        FillHistogramsMemLogLikelihood(fHistsLlh, Llh, W, "NegativeCharge");
     }*/
-    FillCtrlPlots();
+    return kTRUE;
 }
 
 //____________________________________________________________________
@@ -1251,6 +1318,7 @@ void AtlSgTop_combinationMemDiscR2::Print(Option_t */*option*/) const {
              << "  fVetoBTagWeight_min  = " << fVetoBTagWeight_min << endl;
     }
     cout << "  fProcessNegativeLlh  = " << (fProcessNegativeLlh ? "true" : "false") << endl
+         << "  fWriteLlhCache       = " << (fWriteLlhCache ? "true" : "false") << endl
          << endl
 	 << "================================================================" << endl
 	 << endl;
@@ -1262,6 +1330,84 @@ void AtlSgTop_combinationMemDiscR2::Terminate() {
     //
     // Terminate routine called at the end of event loop
     //    
+
+    // Store likelihood cache
+    if ( fLlhCache != nullptr ) {
+        fOutputFile->cd();
+        fLlhCache->Write();
+        Info(__FUNCTION__, "Wrote MEM likelihood cache \"%s\" with %d events.",
+             fLlhCache->GetName(), fLlhCache->GetN());
+    }
 	
     AtlSelector::Terminate();
 }
+
+//____________________________________________________________________
+
+Bool_t AtlSgTop_combinationMemDiscR2::ProcessLlhCache(const char* CacheFile,
+                                                      const char* Systematic) {
+    //
+    // Fast path for re-evaluating the MEM discriminant.
+    //
+    // Reads the likelihood cache of the given systematic from
+    // CacheFile (output file of a previous job with fWriteLlhCache
+    // set), recomputes the discriminant with the current a-priori
+    // probabilities and binning and fills the discriminant and
+    // log-likelihood histograms into the output file given in the
+    // constructor. The event loop, the event selection and all other
+    // tools are skipped; the selection is the one applied when the
+    // cache was written.
+    // The kinematic control plots (BuildCtrlPlots()) need the full
+    // event and stay empty.
+    //
+    // Call this method instead of processing the input chain, at most
+    // once per selector object.
+    //
+    TFile *f = TFile::Open(CacheFile);
+    if ( f == 0 || f->IsZombie() ) {
+        Error(__FUNCTION__, "Cannot open likelihood cache file \"%s\".",
+              CacheFile);
+        delete f;
+        return kFALSE;
+    }
+    AtlMemLlhCache *cache = AtlMemLlhCache::Read(f, Systematic);
+    if ( cache == 0 ) {
+        Error(__FUNCTION__, "No likelihood cache for systematic \"%s\" in \"%s\".",
+              Systematic, CacheFile);
+        delete f;
+        return kFALSE;
+    }
+    Info(__FUNCTION__, "Processing %d events from likelihood cache \"%s\".",
+         cache->GetN(), cache->GetName());
+
+    // Book histograms
+    fOutputFile = new TFile(fOutputFilename->Data(), "recreate");
+    SetAprioriProbabilities();
+    BookHistogramsMemDisc();
+
+    // Fill histograms
+    Int_t n_filled = 0;
+    for ( Int_t i = 0; i < cache->GetN(); i++ ) {
+        if ( fOnlyOdd && (cache->GetEventNr(i) % 2 == 0) ) continue;
+        const Double_t *llh = cache->GetLlh(i);
+        Int_t n_negative = 0;
+        for ( Int_t j = 0; j < AtlMemLlhCache::kNLlh; j++ ) {
+            if ( llh[j] < 0 ) n_negative++;
+        }
+        if ( n_negative > 0 && !fProcessNegativeLlh ) continue;
+        if ( FillHistogramsMemDisc(cache->IsElectron(i), cache->GetCharge(i),
+                                   llh, cache->GetWeight(i), n_negative) )
+            n_filled++;
+    }
+    delete cache;
+    delete f;
+
+    // Write output file
+    Info(__FUNCTION__, "Filled %d events. Write output file \"%s\".",
+         n_filled, fOutputFilename->Data());
+    fOutputFile->Write();
+    fOutputFile->Close();
+    delete fOutputFile;
+    fOutputFile = nullptr;
+    return kTRUE;
+}
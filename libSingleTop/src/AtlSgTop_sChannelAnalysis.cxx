@@ -73,6 +73,8 @@ void AtlSgTop_sChannelAnalysis::Begin(TTree *tree) {
     // Create event writer
     fEvtWriter = new AtlEvtWriterLPSC;
     dynamic_cast<AtlEvtWriterD3PDSgTop*>(fEvtWriter)->SetCloneOnly(fEvtWriterCloneOnly);
+    dynamic_cast<AtlEvtWriterD3PDSgTop*>(fEvtWriter)->SetFastSkim(fEvtWriterFastSkim);
+    fEvtWriter->SetCompressionSettings(fEvtWriterCompression);
 
     AtlSelector::Begin(tree);
 }
@@ -133,6 +135,8 @@ void AtlSgTop_sChannelAnalysis::SetCutDefaults() {
     fQCDVeto = kFALSE;
 
     fEvtWriterCloneOnly = kFALSE;
+    fEvtWriterFastSkim = kFALSE;
+    fEvtWriterCompression = -1;
     
     fMCTruthStudy = kFALSE;
 }
@@ -237,30 +241,30 @@ void AtlSgTop_sChannelAnalysis::BookHistogramsPretag(AtlHistogramTool *htool) {
     //
     // Book pretag histograms
     //    
-    htool->Add("h_pretag_Ht", "H_T", 40, 0., 400.,
-               "H_{T} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_MET", "Missing E_T", 40, 0., 200.,
-	       "E_{T, miss} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_MtW", "Transverse W-Boson mass", 42, 0., 210.,
-	       "M_{T, W} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_LeadingJet_pt", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("h_pretag_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("h_pretag_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("h_pretag_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("h_pretag_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
-	       "Lepton p_{T} [GeV]", "Number of Entries");
-    htool->Add("h_pretag_Lepton_eta", "Lepton #eta", 20., -4., 4.,
-	       "Lepton #eta", "Number of Entries");
-    htool->Add("h_pretag_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "Lepton #phi", "Number of Entries");
+    htool->Define("h_pretag_Ht", "H_T", 40, 0., 400.,
+		  "H_{T} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_MET", "Missing E_T", 40, 0., 200.,
+		  "E_{T, miss} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_MtW", "Transverse W-Boson mass", 42, 0., 210.,
+		  "M_{T, W} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_LeadingJet_pt", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("h_pretag_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("h_pretag_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("h_pretag_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("h_pretag_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
+		  "Lepton p_{T} [GeV]", "Number of Entries");
+    htool->Define("h_pretag_Lepton_eta", "Lepton #eta", 20., -4., 4.,
+		  "Lepton #eta", "Number of Entries");
+    htool->Define("h_pretag_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "Lepton #phi", "Number of Entries");
 }
 
 //____________________________________________________________________
@@ -271,8 +275,8 @@ void AtlSgTop_sChannelAnalysis::BookHistogramsPreSel(AtlHistogramTool *htool) {
     //
 
     // No. of events
-    htool->Add("PreSel/h_presel_nevt", "No. of Pre-Selected Events", 1, 0, 1,
-	       "Number of Entries", "PreSel");
+    htool->Define("PreSel/h_presel_nevt", "No. of Pre-Selected Events", 1, 0, 1,
+		  "Number of Entries", "PreSel");
 }    
 
 //____________________________________________________________________
@@ -283,114 +287,114 @@ void AtlSgTop_sChannelAnalysis::BookHistogramsSel(AtlHistogramTool *htool){
     //
 
     // No. of events
-    htool->Add("Sel/h_sel_nevt", "No. of Selected Events", 1, 0, 1,
-	       "Selection", "Number of Entries");
+    htool->Define("Sel/h_sel_nevt", "No. of Selected Events", 1, 0, 1,
+		  "Selection", "Number of Entries");
 
-    htool->Add("Sel/h_sel_Ht", "Ht", 40, 0., 400.,
-               "H_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_Ht", "Ht", 40, 0., 400.,
+		  "H_{T} [GeV]", "Number of Entries");
 
     // MET
-    htool->Add("Sel/h_sel_met", "Missing E_T", 40, 0., 200.,
-	       "E_{T, miss} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_met", "Missing E_T", 40, 0., 200.,
+		  "E_{T, miss} [GeV]", "Number of Entries");
 
     // Mt_W
-    htool->Add("Sel/h_sel_MtW", "Transverse W-Boson mass", 42, 0., 210.,
-	       "M_{T, W} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_MtW", "Transverse W-Boson mass", 42, 0., 210.,
+		  "M_{T, W} [GeV]", "Number of Entries");
 
     // 1st jet
-    htool->Add("Sel/h_sel_LeadingJet_pt", "Leading Jet p_{T}", 60, 0., 300.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_even", "Leading Jet p_{T}, even events",
-	       60, 0., 300., "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_odd", "Leading Jet p_{T}, odd events",
-	       60, 0., 300., "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt", "Leading Jet p_{T}", 60, 0., 300.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_even", "Leading Jet p_{T}, even events",
+		  60, 0., 300., "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_odd", "Leading Jet p_{T}, odd events",
+		  60, 0., 300., "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_eta", "Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_phi", "Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // 2nd jet
-    htool->Add("Sel/h_sel_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 60, 0., 300.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_pt", "2nd Leading Jet p_{T}", 60, 0., 300.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_eta", "2nd Leading Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingJet_phi", "2nd Leading Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // Special histograms for ttbar ctrl region
     // Bjets
-    htool->Add("Sel/h_sel_LeadingBJet_pt", "Leading B-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingBJet_eta", "Leading B-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingBJet_phi", "Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_pt", "2nd Leading B-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_eta", "2nd Leading B-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingBJet_phi", "2nd Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");    
+    htool->Define("Sel/h_sel_LeadingBJet_pt", "Leading B-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingBJet_eta", "Leading B-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingBJet_phi", "Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_pt", "2nd Leading B-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_eta", "2nd Leading B-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingBJet_phi", "2nd Leading B-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");    
     // Ljets
-    htool->Add("Sel/h_sel_LeadingLJet_pt", "Leading L-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingLJet_eta", "Leading L-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingLJet_phi", "Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_pt", "2nd Leading L-Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_eta", "2nd Leading L-Jet #eta", 25, -5., 5.,
-	       "#eta", "Number of Entries");
-    htool->Add("Sel/h_sel_2ndLeadingLJet_phi", "2nd Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_pt", "Leading L-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_eta", "Leading L-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingLJet_phi", "Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_pt", "2nd Leading L-Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_eta", "2nd Leading L-Jet #eta", 25, -5., 5.,
+		  "#eta", "Number of Entries");
+    htool->Define("Sel/h_sel_2ndLeadingLJet_phi", "2nd Leading L-Jet #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "#phi", "Number of Entries");
 
     // Lepton
-    htool->Add("Sel/h_sel_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
-	       "Lepton p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_eta", "Lepton #eta", 20., -4., 4.,
-	       "Lepton #eta", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
-	       "Lepton #phi", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge", "Lepton Charge", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge_even", "Lepton Charge, even events", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
-    htool->Add("Sel/h_sel_Lepton_charge_odd", "Lepton Charge, odd events", 2, -1.0001, 1.0001,
-	       "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_pt", "Lepton p_{T}", 30., 0., 150.,
+		  "Lepton p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_eta", "Lepton #eta", 20., -4., 4.,
+		  "Lepton #eta", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_phi", "Lepton #phi", 20, -TMath::Pi(), TMath::Pi(),
+		  "Lepton #phi", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge", "Lepton Charge", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge_even", "Lepton Charge, even events", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
+    htool->Define("Sel/h_sel_Lepton_charge_odd", "Lepton Charge, odd events", 2, -1.0001, 1.0001,
+		  "Lepton Charge", "Number of Entries");
     
     // Leading jet pt for 5 eta bins
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta1", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta2", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta3", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");  
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta4", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");    
-    htool->Add("Sel/h_sel_LeadingJet_pt_eta5", "Leading Jet p_{T}", 44, 0., 220.,
-	       "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta1", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta2", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta3", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");  
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta4", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");    
+    htool->Define("Sel/h_sel_LeadingJet_pt_eta5", "Leading Jet p_{T}", 44, 0., 220.,
+		  "p_{T} [GeV]", "Number of Entries");
 
     // Delta R
-    htool->Add("Sel/h_sel_DeltaR_Lepton_LeadingJet", "#DeltaR(lep, leading jet)", 36., 0.4, 4.,
-	       "#DeltaR(lepton, leading jet)", "Number of Entries");
-    htool->Add("Sel/h_sel_DeltaR_Lepton_2ndLeadingJet","#DeltaR(lep, 2nd leading jet)",36., 0.4, 4.,
-	       "#DeltaR(lepton, 2nd leading jet)", "Number of Entries");
-    htool->Add("Sel/h_sel_DeltaR_LeadingJet_2ndLeadingJet", "#DeltaR(leading jet, 2nd leading jet)",
-	       36., 0.4, 4., "#DeltaR(leading jet, 2nd leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_Lepton_LeadingJet", "#DeltaR(lep, leading jet)", 36., 0.4, 4.,
+		  "#DeltaR(lepton, leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_Lepton_2ndLeadingJet","#DeltaR(lep, 2nd leading jet)",36., 0.4, 4.,
+		  "#DeltaR(lepton, 2nd leading jet)", "Number of Entries");
+    htool->Define("Sel/h_sel_DeltaR_LeadingJet_2ndLeadingJet", "#DeltaR(leading jet, 2nd leading jet)",
+		  36., 0.4, 4., "#DeltaR(leading jet, 2nd leading jet)", "Number of Entries");
 
     //Inv. mass
-    htool->Add("Sel/h_sel_InvM_Lepton_LeadingJet", "Inv. mass (lepton, leading jet)", 50., 0., 400.,
-	       "Inv. mass (lepton, j_{1}) [GeV]", "Number of Entries");
-    htool->Add("Sel/h_sel_InvM_LeadingJet_2ndLeadingJet", "Inv. mass (leading jet, 2nd leading jet)",
-	       50., 0., 400., "Inv. mass (j_{1}, j_{2}) [GeV]", "Number of Enrties");
+    htool->Define("Sel/h_sel_InvM_Lepton_LeadingJet", "Inv. mass (lepton, leading jet)", 50., 0., 400.,
+		  "Inv. mass (lepton, j_{1}) [GeV]", "Number of Entries");
+    htool->Define("Sel/h_sel_InvM_LeadingJet_2ndLeadingJet", "Inv. mass (leading jet, 2nd leading jet)",
+		  50., 0., 400., "Inv. mass (j_{1}, j_{2}) [GeV]", "Number of Enrties");
 
     // Pt_lepton * Et_miss
-    htool->Add("Sel/h_sel_ScalarProd_Lepton_Etmiss","P_{Lepton} * E_{T, miss} [GeV^{2}]", 120., -5000., 10000.,
-	      "#vec{p}_{lepton}#vec{E}_{T, miss}", "Number of Entries");
+    htool->Define("Sel/h_sel_ScalarProd_Lepton_Etmiss","P_{Lepton} * E_{T, miss} [GeV^{2}]", 120., -5000., 10000.,
+		 "#vec{p}_{lepton}#vec{E}_{T, miss}", "Number of Entries");
 
     // QCD Veto
-    htool->Add("Sel/h_sel_QCDVeto", "QCD Veto", 20., -TMath::Pi(), TMath::Pi(), 20., 0., 100., "#Delta#phi(j_{1},l)", "Lepton p_{T} (GeV)", "Events");
+    htool->Define("Sel/h_sel_QCDVeto", "QCD Veto", 20., -TMath::Pi(), TMath::Pi(), 20., 0., 100., "#Delta#phi(j_{1},l)", "Lepton p_{T} (GeV)", "Events");
 }
 
 //____________________________________________________________________
@@ -1234,88 +1238,88 @@ void AtlSgTop_sChannelAnalysis::BookHistogramsBDT(AtlHistogramTool *htool) {
     //
 
     // Number of loose leptons
-    htool->Add("h_bdt_number_looseleptons", "number of loose leptons", 5, -0.5001, 4.5001,
-               "n(loose leptons)", "Number of Entries");
+    htool->Define("h_bdt_number_looseleptons", "number of loose leptons", 5, -0.5001, 4.5001,
+		  "n(loose leptons)", "Number of Entries");
 
     // Number of loose jets
-    htool->Add("h_bdt_number_loosejets", "number of loose jets", 5, -0.5001, 4.5001,
-               "n(loose jets)", "Number of Entries");
+    htool->Define("h_bdt_number_loosejets", "number of loose jets", 5, -0.5001, 4.5001,
+		  "n(loose jets)", "Number of Entries");
 
     // MET
-    htool->Add("h_bdt_MET", "MET (BDT)", 40, 0., 200.,
-               "MET [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MET", "MET (BDT)", 40, 0., 200.,
+		  "MET [GeV]", "Number of Entries");
     // MtW
-    htool->Add("h_bdt_MtW", "MtW (BDT)", 60, 0., 300.,
-               "M_{t}(W) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MtW", "MtW (BDT)", 60, 0., 300.,
+		  "M_{t}(W) [GeV]", "Number of Entries");
     // Lepton Pt
-    htool->Add("h_bdt_lep_pt", "Lepton Pt", 40, 0., 200.,
-               "P_{t}^{lep} [GeV]", "Number of Entries");
+    htool->Define("h_bdt_lep_pt", "Lepton Pt", 40, 0., 200.,
+		  "P_{t}^{lep} [GeV]", "Number of Entries");
     // Lepton Charge
-    htool->Add("h_bdt_lep_charge", "Lepton charge", 2, -1.0001, 1.0001,
-               "q{lep}", "Number of Entries");    
+    htool->Define("h_bdt_lep_charge", "Lepton charge", 2, -1.0001, 1.0001,
+		  "q{lep}", "Number of Entries");    
     // Sum Et = lepton Pt + MET
-    htool->Add("h_bdt_sumEt_lep_met", "Sum Et, lepton Pt + MET", 60, 0., 300.,
-               "#sum E_{t}(lepton, MET) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_sumEt_lep_met", "Sum Et, lepton Pt + MET", 60, 0., 300.,
+		  "#sum E_{t}(lepton, MET) [GeV]", "Number of Entries");
     // Sum Et = lepton Pt + MET + b-jets
-    htool->Add("h_bdt_sumEt_lep_met_bjet", "Sum Et, lepton Pt + MET + BJets", 140, 100., 700.,
-               "#sum E_{t}(lepton, MET, b-jets) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_sumEt_lep_met_bjet", "Sum Et, lepton Pt + MET + BJets", 140, 100., 700.,
+		  "#sum E_{t}(lepton, MET, b-jets) [GeV]", "Number of Entries");
     // Sum Pt
-    htool->Add("h_bdt_sumPt", "Sum Pt, lepton + MET + b-jets", 30, 0., 150.,
-               "#sum P_{t}(lepton, MET, b-jets) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_sumPt", "Sum Pt, lepton + MET + b-jets", 30, 0., 150.,
+		  "#sum P_{t}(lepton, MET, b-jets) [GeV]", "Number of Entries");
     // Delta Phi, top2 - leading b-jet
-    htool->Add("h_bdt_DeltaPhi_TopBJet2_BJet1", "DeltaPhi", 25., 0., 4.,
-               "#Delta#phi(top, leading b-jet) (rad)", "Number of Entries");
+    htool->Define("h_bdt_DeltaPhi_TopBJet2_BJet1", "DeltaPhi", 25., 0., 4.,
+		  "#Delta#phi(top, leading b-jet) (rad)", "Number of Entries");
     // Delta Phi, top1 - sub-leading b-jet
-    htool->Add("h_bdt_DeltaPhi_TopBJet1_BJet2", "DeltaPhi", 25, 0., 4.,
-               "#Delta#phi(top, sub-leading b-jet) (rad)", "Number of Entries");
+    htool->Define("h_bdt_DeltaPhi_TopBJet1_BJet2", "DeltaPhi", 25, 0., 4.,
+		  "#Delta#phi(top, sub-leading b-jet) (rad)", "Number of Entries");
     // Delta eta, lepton - leading b-jet
-    htool->Add("h_bdt_DeltaEta_Lep_BJet1", "Delta Eta", 32, 0., 4.,
-               "#Delta#eta(lepton, leading b-jet", "Number of Entries");
+    htool->Define("h_bdt_DeltaEta_Lep_BJet1", "Delta Eta", 32, 0., 4.,
+		  "#Delta#eta(lepton, leading b-jet", "Number of Entries");
     // Delta eta, lepton - sub-leading b-jet
-    htool->Add("h_bdt_DeltaEta_Lep_BJet2", "Delta Eta", 32, 0., 4.,
-               "#Delta#eta(lepton, sub-leading b-jet", "Number of Entries");
+    htool->Define("h_bdt_DeltaEta_Lep_BJet2", "Delta Eta", 32, 0., 4.,
+		  "#Delta#eta(lepton, sub-leading b-jet", "Number of Entries");
     // Delta eta, top2 - leading b-jet
-    htool->Add("h_bdt_DeltaEta_TopBJet2_BJet1", "Delta Eta", 40, 0., 5.,
-               "#Delta#eta(top, leading b-jet", "Number of Entries");
+    htool->Define("h_bdt_DeltaEta_TopBJet2_BJet1", "Delta Eta", 40, 0., 5.,
+		  "#Delta#eta(top, leading b-jet", "Number of Entries");
     // Delta phi, leading b-jet, sub-leading b-jet
-    htool->Add("h_bdt_DeltaPhi_BJet1_BJet2", "Delta Phi", 20, 0., 4.,
-               "#Delta#phi(leading b-jet, sub-leading b-jet) (rad)", "Number of Entries");
+    htool->Define("h_bdt_DeltaPhi_BJet1_BJet2", "Delta Phi", 20, 0., 4.,
+		  "#Delta#phi(leading b-jet, sub-leading b-jet) (rad)", "Number of Entries");
     // Delta phi, lepton - MET
-    htool->Add("h_bdt_DeltaPhi_Lep_MET", "Delta Phi", 20, 0., 4.,
-               "#Delta#phi(lepton, MET) (rad)", "Number of Entries");
+    htool->Define("h_bdt_DeltaPhi_Lep_MET", "Delta Phi", 20, 0., 4.,
+		  "#Delta#phi(lepton, MET) (rad)", "Number of Entries");
     // Cos, LepW - Wtop
-    htool->Add("h_bdt_Cos_LepW_WTopBJet1", "Cos", 20, -1., 1.,
-               "cos#theta(lepton_{W-frame}, W_{top-frame})", "Number of Entries");
+    htool->Define("h_bdt_Cos_LepW_WTopBJet1", "Cos", 20, -1., 1.,
+		  "cos#theta(lepton_{W-frame}, W_{top-frame})", "Number of Entries");
     // Cos, LepTop1 - Top1CMS
-    htool->Add("h_bdt_Cos_LepTopBJet1_TopBJet1CMS", "Cos", 20, -1., 1.,
-               "cos#theta(lepton_{top1-frame}, top1_{cms})", "Number of Entries");
+    htool->Define("h_bdt_Cos_LepTopBJet1_TopBJet1CMS", "Cos", 20, -1., 1.,
+		  "cos#theta(lepton_{top1-frame}, top1_{cms})", "Number of Entries");
     // Cos, LepTop2 - Top2CMS
-    htool->Add("h_bdt_Cos_LepTopBJet2_TopBJet2CMS", "Cos", 20, -1., 1.,
-               "cos#theta(lepton_{top2-frame}, top2_{cms})", "Number of Entries");
+    htool->Define("h_bdt_Cos_LepTopBJet2_TopBJet2CMS", "Cos", 20, -1., 1.,
+		  "cos#theta(lepton_{top2-frame}, top2_{cms})", "Number of Entries");
     // Pt, b-jet from top candidate
-    htool->Add("h_bdt_PtBJet_Top", "PtBJet_Top", 50, 0., 250.,
-               "P_{t}(b-jet from best top) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_PtBJet_Top", "PtBJet_Top", 50, 0., 250.,
+		  "P_{t}(b-jet from best top) [GeV]", "Number of Entries");
     // Delta eta, neutrino - b-jet from non-to candidate
-    htool->Add("h_bdt_DeltaEtaNu_BJetNonTop", "DeltaEtaNu_BJetNonTop", 32, 0., 4.,
-               "#Delta#eta(#nu, b-jet_{non-top})", "Number of Entries");
+    htool->Define("h_bdt_DeltaEtaNu_BJetNonTop", "DeltaEtaNu_BJetNonTop", 32, 0., 4.,
+		  "#Delta#eta(#nu, b-jet_{non-top})", "Number of Entries");
     // Sum Pt, b-jet1 + b-jet2
-    htool->Add("h_bdt_SumPtBJet1_BJet2", "SumPtBJet1_BJet2", 25, 0., 250.,
-               "#sum P_{t} (leading b-jet, sub-leading b-jet) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_SumPtBJet1_BJet2", "SumPtBJet1_BJet2", 25, 0., 250.,
+		  "#sum P_{t} (leading b-jet, sub-leading b-jet) [GeV]", "Number of Entries");
     // Cos, MET - sub-leading b-jet
-    htool->Add("h_bdt_CosMET_BJet2", "CosMET_BJet2", 20, -1., 1.,
-               "cos#theta(MT, sub-leading b-jet)", "Number of Entries");
+    htool->Define("h_bdt_CosMET_BJet2", "CosMET_BJet2", 20, -1., 1.,
+		  "cos#theta(MT, sub-leading b-jet)", "Number of Entries");
     // Inv. mass, lepton + sub-leading b-jet
-    htool->Add("h_bdt_MLep_BJet2", "MLep_BJet2", 60, 0., 300.,
-               "M(lepton, sub-leading b-jet) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MLep_BJet2", "MLep_BJet2", 60, 0., 300.,
+		  "M(lepton, sub-leading b-jet) [GeV]", "Number of Entries");
     // Top Mass
-    htool->Add("h_bdt_MTop", "M_top", 100, 0., 500.,
-               "M(top) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MTop", "M_top", 100, 0., 500.,
+		  "M(top) [GeV]", "Number of Entries");
     // invariant mass of lepton and b-jet from top
-    htool->Add("h_bdt_MLep_BJetTop", "MLep_BJetTop", 60, 0., 300.,
-               "M(lepton, b-jet from top) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MLep_BJetTop", "MLep_BJetTop", 60, 0., 300.,
+		  "M(lepton, b-jet from top) [GeV]", "Number of Entries");
     // invariant mass of top and other b-jet
-    htool->Add("h_bdt_MTop_NonTopBJet", "MTop_NonTopBJet", 200, 0., 1000.,
-               "M(top, b-jet not from top) [GeV]", "Number of Entries");
+    htool->Define("h_bdt_MTop_NonTopBJet", "MTop_NonTopBJet", 200, 0., 1000.,
+		  "M(top, b-jet not from top) [GeV]", "Number of Entries");
 
 }
 
@@ -31,7 +31,7 @@ setupAPlusPlus() {
 
    # declare local variables
    local EnvVarName Options Root Source x y
-   local -a LibPaths IncludePaths RootLibs
+   local -a BinPaths LibPaths IncludePaths RootLibs
 
    if [[ -n ${BASH_VERSION:-} ]] ; then
       Source=${BASH_SOURCE[0]}
@@ -101,6 +101,7 @@ setupAPlusPlus() {
             export "${EnvVarName}"="${y}"
             IncludePaths+=( "${y}/inc" )
             LibPaths+=( "${y}/lib/${ARCH_TYPE}" )
+            BinPaths+=( "${y}/bin/${ARCH_TYPE}" )
             RootLibs+=( "${x}" )
          fi
       done
@@ -108,6 +109,9 @@ setupAPlusPlus() {
    fi
 
    # set PATH-like variables
+   for y in "${BinPaths[@]}" ; do
+      export PATH="${y}${PATH:+:${PATH}}"
+   done
    for y in "${LibPaths[@]}" ; do
       export LD_LIBRARY_PATH="${y}${LD_LIBRARY_PATH:+:${LD_LIBRARY_PATH}}"
    done